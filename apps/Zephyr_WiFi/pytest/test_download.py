@@ -0,0 +1,128 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''Resumable download against a stand-in server that misbehaves: drops
+connections, ignores ranges, sends chunked bodies, changes the asset under
+the device, or goes away until the device is restarted. Each scenario of
+sample.yaml runs one of these tests.
+
+Run through twister on native_sim, e.g.
+
+  west twister -p native_sim -T apps/Zephyr_WiFi
+'''
+
+import re
+
+from twister_harness import DeviceAdapter
+
+SIZE = 1024 * 1024
+DROP_AFTER = 100000
+
+
+def resumable_get(dut):
+    '''The outcome of the device's download, as printed by http_get.c.'''
+    lines = dut.readlines_until(regex=r'Resumable GET .*', timeout=120)
+    result = lines[-1]
+
+    m = re.search(r'Resumable GET (\S+): (-?\d+), (\d+) bytes in (\d+) ranges, '
+                  r'(\d+) requests, (\d+) ms, (\d+) pattern mismatches',
+                  result)
+    assert m, result
+
+    ret, total, ranges, requests, mismatches = (int(m.group(i))
+                                                for i in (2, 3, 4, 5, 7))
+    return {'ret': ret, 'total': total, 'ranges': ranges,
+            'requests': requests, 'mismatches': mismatches,
+            'output': '\n'.join(lines)}
+
+
+def test_resumable_download(standin, dut: DeviceAdapter):
+    standin('http_standin.py', 'CONFIG_APP_HTTP_PORT',
+            '--drop-after', str(DROP_AFTER))
+    got = resumable_get(dut)
+
+    assert got['ret'] == 0
+    assert got['total'] == SIZE
+    assert got['mismatches'] == 0
+    # Every connection is dropped, so completing takes several resumes
+    assert got['requests'] >= SIZE // DROP_AFTER
+    assert got['ranges'] >= 1
+
+
+def test_no_ranges(standin, dut: DeviceAdapter):
+    standin('http_standin.py', 'CONFIG_APP_HTTP_PORT', '--no-ranges')
+    got = resumable_get(dut)
+
+    # The probe of a parallel download gets the whole asset with a 200
+    assert got['ret'] == 0
+    assert got['total'] == SIZE
+    assert got['mismatches'] == 0
+    assert got['ranges'] == 1
+    assert got['requests'] == 1
+
+
+def test_chunked(standin, dut: DeviceAdapter):
+    standin('http_standin.py', 'CONFIG_APP_HTTP_PORT', '--no-ranges',
+            '--chunked')
+    got = resumable_get(dut)
+
+    # No Content-Length: the size is learnt from the end of the message
+    assert got['ret'] == 0
+    assert got['total'] == SIZE
+    assert got['mismatches'] == 0
+    assert got['requests'] == 1
+
+
+def test_etag_change(standin, dut: DeviceAdapter):
+    standin('http_standin.py', 'CONFIG_APP_HTTP_PORT',
+            '--drop-after', str(DROP_AFTER), '--etag-change-after', '1')
+    got = resumable_get(dut)
+
+    # The resume gets a range of another version of the asset (-ESTALE)
+    assert got['ret'] < 0
+    assert 'asset changed, progress discarded' in got['output']
+    assert got['total'] == 0
+    assert got['mismatches'] == 0
+
+
+def test_size_change(standin, dut: DeviceAdapter):
+    standin('http_standin.py', 'CONFIG_APP_HTTP_PORT',
+            '--drop-after', str(DROP_AFTER), '--resize-after', '1')
+    got = resumable_get(dut)
+
+    # Same ETag, but the total of Content-Range no longer matches (-ESTALE)
+    assert got['ret'] < 0
+    assert 'asset changed, progress discarded' in got['output']
+    assert got['total'] == 0
+    assert got['mismatches'] == 0
+
+
+def test_persist(standin, build_config, dut: DeviceAdapter):
+    path = build_config['CONFIG_APP_HTTP_DOWNLOAD_PATH']
+    attempts = int(build_config['CONFIG_APP_HTTP_DOWNLOAD_ATTEMPTS'])
+    done = 4 * DROP_AFTER
+    # A fresh download would need more requests than the device makes
+    assert -(-SIZE // DROP_AFTER) > attempts
+
+    # The server goes away after a few ranges, and the device gives up
+    server = standin('http_standin.py', 'CONFIG_APP_HTTP_PORT',
+                     '--drop-after', str(DROP_AFTER),
+                     '--fail-after', str(done // DROP_AFTER))
+    got = resumable_get(dut)
+    assert got['ret'] < 0
+    server.stop()
+
+    # Restarted, it picks up from the progress kept in flash
+    server = standin('http_standin.py', 'CONFIG_APP_HTTP_PORT',
+                     '--drop-after', str(DROP_AFTER))
+    dut.close()
+    dut.launch()
+    got = resumable_get(dut)
+
+    assert got['ret'] == 0
+    assert got['total'] == SIZE
+    assert got['mismatches'] == 0
+    firsts = [int(m.group(1)) for m in
+              re.finditer(re.escape(path) + r' \[(\d+)-',
+                          '\n'.join(server.stop()))]
+    assert firsts and firsts[0] == done, firsts
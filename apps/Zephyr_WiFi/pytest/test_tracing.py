@@ -0,0 +1,67 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''Stage tracepoints of a resumable download, recorded in CTF on native_sim.
+
+Run through twister on native_sim, e.g.
+
+  west twister -p native_sim -T apps/Zephyr_WiFi \\
+      -s sample.net.wifi.download.tracing
+
+The per-stage breakdown is printed and the timeline written next to the
+trace, as trace.json, to open in ui.perfetto.dev.
+'''
+
+import json
+import sys
+from pathlib import Path
+
+import pytest
+from twister_harness import DeviceAdapter
+
+SCRIPTS = Path(__file__).resolve().parents[3] / 'scripts'
+DROP_AFTER = 100000
+
+sys.path.insert(0, str(SCRIPTS))
+import trace_report  # noqa: E402
+
+
+@pytest.fixture(scope='module')
+def server(standin):
+    return standin('http_standin.py', 'CONFIG_APP_HTTP_PORT',
+                   '--drop-after', str(DROP_AFTER))
+
+
+def find_trace(dut):
+    build_dir = Path(dut.device_config.build_dir)
+    for directory in (build_dir, build_dir / 'zephyr', Path.cwd()):
+        if (directory / 'channel0_0').is_file():
+            return directory / 'channel0_0'
+    pytest.fail(f'no channel0_0 written under {build_dir}')
+
+
+def test_stage_breakdown(server, dut: DeviceAdapter):
+    dut.readlines_until(regex=r'Resumable GET .*', timeout=120)
+    trace = find_trace(dut)
+
+    spans, slices, _ = trace_report.spans_of(trace_report.load(trace))
+    rows = {row['stage']: row for row in trace_report.breakdown(spans)}
+    span_us = max(s.end for s in spans) - spans[0].begin
+    trace_report.print_breakdown(rows.values(), span_us, 0)
+
+    for stage in ('http_connect', 'http_range', 'http_request',
+                  'http_consume'):
+        assert stage in rows, f'no {stage} spans'
+        assert rows[stage]['max_us'] >= rows[stage]['p50_us'] >= 0
+
+    # Every connection is dropped, so each range is a connection of its own
+    assert rows['http_range']['count'] >= 1024 * 1024 // DROP_AFTER
+    assert rows['http_connect']['count'] >= rows['http_range']['count']
+    # Ranges are made of requests, made of consumed fragments
+    assert rows['http_range']['total_us'] >= rows['http_request']['total_us']
+    assert rows['http_consume']['count'] >= rows['http_request']['count']
+    # The drain threads show up on the thread tracks
+    assert slices
+
+    timeline = trace.parent / 'trace.json'
+    timeline.write_text(json.dumps(trace_report.timeline(spans, slices)))
@@ -0,0 +1,577 @@
+/*
+ * Resumable HTTP downloads using Range requests.
+ *
+ * Each byte range of the asset is fetched with "Range: bytes=<next>-<end>"
+ * and validated against the Content-Range, ETag and total size seen on the
+ * first response, so a dropped connection only costs a reconnect. A one-byte
+ * probe tells whether the server honours ranges at all; if it does, the rest
+ * of the asset can be split over several sockets.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/http/client.h>
+#include <zephyr/settings/settings.h>
+
+#include <app/lib/tracepoints.h>
+
+#include "http_download.h"
+#include "http_get.h"
+
+enum download_header {
+	HDR_NONE,
+	HDR_ETAG,
+	HDR_CONTENT_RANGE,
+};
+
+struct range_worker {
+	struct http_download *dl;
+	struct zsock_addrinfo **res;
+	uint8_t idx;
+	int max_attempts;
+	int result;
+
+	/* Per-response state, reset before each request */
+	uint16_t status;
+	uint32_t base;
+	uint32_t persisted;
+	int err;
+	bool complete;
+	enum download_header hdr;
+	/* Header callbacks come in pieces when a header straddles buffers */
+	bool in_value;
+	char field[16];
+	size_t field_len;
+	size_t value_len;
+	char content_range[48];
+	char etag[CONFIG_HTTP_DOWNLOAD_ETAG_LEN];
+
+	char range_hdr[48];
+	char if_range_hdr[CONFIG_HTTP_DOWNLOAD_ETAG_LEN + 16];
+	const char *headers[3];
+	struct http_stream stream;
+};
+
+static struct range_worker workers[CONFIG_HTTP_DOWNLOAD_MAX_RANGES];
+static uint8_t worker_buf[CONFIG_HTTP_DOWNLOAD_MAX_RANGES][2]
+			 [CONFIG_HTTP_STREAM_BUF_SIZE];
+static struct k_thread worker_threads[CONFIG_HTTP_DOWNLOAD_MAX_RANGES];
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks,
+				   CONFIG_HTTP_DOWNLOAD_MAX_RANGES,
+				   CONFIG_HTTP_DOWNLOAD_WORKER_STACK_SIZE);
+static K_MUTEX_DEFINE(state_lock);
+
+/* ------------------------------- Persistence -------------------------------- */
+#if defined(CONFIG_HTTP_DOWNLOAD_PERSIST)
+static void http_download_key(const struct http_download *dl,
+			      char *key, size_t len)
+{
+	snprintk(key, len, "dl/%s", dl->name);
+}
+
+static int http_download_load_cb(const char *key, size_t len,
+				 settings_read_cb read_cb, void *cb_arg,
+				 void *param)
+{
+	struct http_download_state *state = param;
+	int ret;
+
+	if (len != sizeof(*state)) {
+		return -EINVAL;
+	}
+
+	ret = read_cb(cb_arg, state, sizeof(*state));
+
+	return (ret < 0) ? ret : 0;
+}
+
+static void http_download_load(struct http_download *dl)
+{
+	char key[SETTINGS_MAX_NAME_LEN];
+
+	if (dl->name == NULL || settings_subsys_init() != 0) {
+		return;
+	}
+
+	http_download_key(dl, key, sizeof(key));
+	(void)settings_load_subtree_direct(key, http_download_load_cb,
+					   &dl->state);
+}
+
+static void http_download_save(struct http_download *dl)
+{
+	char key[SETTINGS_MAX_NAME_LEN];
+
+	if (dl->name == NULL) {
+		return;
+	}
+
+	http_download_key(dl, key, sizeof(key));
+
+	k_mutex_lock(&state_lock, K_FOREVER);
+	(void)settings_save_one(key, &dl->state, sizeof(dl->state));
+	k_mutex_unlock(&state_lock);
+}
+
+static void http_download_forget(struct http_download *dl)
+{
+	char key[SETTINGS_MAX_NAME_LEN];
+
+	if (dl->name == NULL) {
+		return;
+	}
+
+	http_download_key(dl, key, sizeof(key));
+	(void)settings_delete(key);
+}
+#else
+static inline void http_download_load(struct http_download *dl) {}
+static inline void http_download_save(struct http_download *dl) {}
+static inline void http_download_forget(struct http_download *dl) {}
+#endif /* CONFIG_HTTP_DOWNLOAD_PERSIST */
+
+/* ------------------------------ Header parsing ------------------------------ */
+static struct range_worker *parser_to_worker(struct http_parser *parser)
+{
+	struct http_request *req = CONTAINER_OF(parser, struct http_request,
+						internal.parser);
+	struct http_stream *stream = req->internal.user_data;
+
+	return CONTAINER_OF(stream, struct range_worker, stream);
+}
+
+/* Append a piece of text at @p *len in @p dst, truncating what overflows */
+static void append_piece(char *dst, size_t dst_len, size_t *len,
+			 const char *at, size_t length)
+{
+	length = MIN(length, dst_len - 1 - *len);
+	memcpy(dst + *len, at, length);
+	*len += length;
+	dst[*len] = '\0';
+}
+
+static int on_header_field(struct http_parser *parser, const char *at,
+			   size_t length)
+{
+	struct range_worker *w = parser_to_worker(parser);
+
+	/* A field after a value starts the next header */
+	if (w->in_value) {
+		w->in_value = false;
+		w->field_len = 0;
+	}
+	append_piece(w->field, sizeof(w->field), &w->field_len, at, length);
+
+	w->hdr = HDR_NONE;
+	if (strcasecmp(w->field, "ETag") == 0) {
+		w->hdr = HDR_ETAG;
+	} else if (strcasecmp(w->field, "Content-Range") == 0) {
+		w->hdr = HDR_CONTENT_RANGE;
+	}
+
+	return 0;
+}
+
+static int on_header_value(struct http_parser *parser, const char *at,
+			   size_t length)
+{
+	struct range_worker *w = parser_to_worker(parser);
+
+	/* The first piece of a value replaces the previous header's */
+	if (!w->in_value) {
+		w->in_value = true;
+		w->value_len = 0;
+	}
+
+	switch (w->hdr) {
+	case HDR_ETAG:
+		append_piece(w->etag, sizeof(w->etag), &w->value_len, at,
+			     length);
+		break;
+	case HDR_CONTENT_RANGE:
+		append_piece(w->content_range, sizeof(w->content_range),
+			     &w->value_len, at, length);
+		break;
+	default:
+		break;
+	}
+
+	return 0;
+}
+
+/* Parse "bytes <first>-<last>/<total>" */
+static int parse_content_range(const char *value, uint32_t *first,
+			       uint32_t *total)
+{
+	char *end;
+
+	if (strncmp(value, "bytes ", 6) != 0) {
+		return -EINVAL;
+	}
+
+	*first = strtoul(value + 6, &end, 10);
+	if (*end != '-') {
+		return -EINVAL;
+	}
+
+	end = strchr(end, '/');
+	if (end == NULL || end[1] == '*') {
+		return -EINVAL;
+	}
+
+	*total = strtoul(end + 1, NULL, 10);
+
+	return 0;
+}
+
+static int on_headers_complete(struct http_parser *parser)
+{
+	struct range_worker *w = parser_to_worker(parser);
+	struct http_download_state *state = &w->dl->state;
+	struct http_download_range *r = &state->range[w->idx];
+	uint32_t first, total;
+
+	w->status = parser->status_code;
+
+	switch (parser->status_code) {
+	case 206:
+		if (parse_content_range(w->content_range, &first, &total) < 0 ||
+		    first != r->start + r->done) {
+			w->err = -EPROTO;
+			break;
+		}
+		if (state->etag[0] != '\0' && w->etag[0] != '\0' &&
+		    strcmp(state->etag, w->etag) != 0) {
+			w->err = -ESTALE;
+			break;
+		}
+		if (state->total == HTTP_DOWNLOAD_SIZE_UNKNOWN) {
+			state->total = total;
+		} else if (state->total != total) {
+			w->err = -ESTALE;
+			break;
+		}
+		if (r->end == HTTP_DOWNLOAD_SIZE_UNKNOWN) {
+			r->end = total;
+		}
+		w->base = first;
+		break;
+	case 200:
+		/* Whole asset: no range support, or If-Range did not match */
+		if (state->num_ranges > 1 || r->start != 0) {
+			w->err = -ENOTSUP;
+			break;
+		}
+		r->done = 0;
+		state->total = (parser->content_length != ULLONG_MAX) ?
+			       (uint32_t)parser->content_length :
+			       HTTP_DOWNLOAD_SIZE_UNKNOWN;
+		r->end = state->total;
+		state->etag[0] = '\0';
+		w->base = 0;
+		break;
+	default:
+		w->err = -EIO;
+		break;
+	}
+
+	if (w->err == 0 && state->etag[0] == '\0') {
+		strcpy(state->etag, w->etag);
+	}
+
+	return 0;
+}
+
+static int on_message_complete(struct http_parser *parser)
+{
+	struct range_worker *w = parser_to_worker(parser);
+
+	w->complete = true;
+
+	return 0;
+}
+
+static const struct http_parser_settings download_parser_cb = {
+	.on_header_field = on_header_field,
+	.on_header_value = on_header_value,
+	.on_headers_complete = on_headers_complete,
+	.on_message_complete = on_message_complete,
+};
+
+/* --------------------------------- Transfer --------------------------------- */
+static bool range_complete(const struct http_download_range *r)
+{
+	return r->end != HTTP_DOWNLOAD_SIZE_UNKNOWN &&
+	       r->start + r->done >= r->end;
+}
+
+static int range_consumer(const uint8_t *frag, size_t len, size_t offset,
+			  void *user_data)
+{
+	struct range_worker *w = user_data;
+	struct http_download *dl = w->dl;
+	struct http_download_range *r = &dl->state.range[w->idx];
+	uint32_t pos = w->base + offset;
+	int ret;
+
+	if (w->err < 0) {
+		return w->err;
+	}
+
+	/* Never hand over bytes beyond the range, whatever the server sends */
+	if (r->end != HTTP_DOWNLOAD_SIZE_UNKNOWN) {
+		if (pos >= r->end) {
+			return 0;
+		}
+		len = MIN(len, r->end - pos);
+	}
+
+	ret = dl->consumer(frag, len, pos, dl->user_data);
+	if (ret < 0) {
+		return ret;
+	}
+
+	r->done = pos + len - r->start;
+
+	if (IS_ENABLED(CONFIG_HTTP_DOWNLOAD_PERSIST) &&
+	    r->done - w->persisted >= CONFIG_HTTP_DOWNLOAD_PERSIST_BYTES) {
+		w->persisted = r->done;
+		http_download_save(dl);
+	}
+
+	return 0;
+}
+
+static int range_request(struct range_worker *w)
+{
+	struct http_download *dl = w->dl;
+	struct http_download_state *state = &dl->state;
+	struct http_download_range *r = &state->range[w->idx];
+	int n = 0;
+	int sock;
+	int ret;
+
+	tracepoint_begin("http_connect", TRACEPOINT_ID(w));
+	sock = connect_socket(w->res, dl->port);
+	tracepoint_end("http_connect", TRACEPOINT_ID(w));
+	if (sock < 0) {
+		return -ECONNREFUSED;
+	}
+
+	if (r->end == HTTP_DOWNLOAD_SIZE_UNKNOWN) {
+		snprintk(w->range_hdr, sizeof(w->range_hdr),
+			 "Range: bytes=%u-\r\n", r->start + r->done);
+	} else {
+		snprintk(w->range_hdr, sizeof(w->range_hdr),
+			 "Range: bytes=%u-%u\r\n", r->start + r->done,
+			 r->end - 1);
+	}
+	w->headers[n++] = w->range_hdr;
+
+	if (state->etag[0] != '\0') {
+		snprintk(w->if_range_hdr, sizeof(w->if_range_hdr),
+			 "If-Range: %s\r\n", state->etag);
+		w->headers[n++] = w->if_range_hdr;
+	}
+	w->headers[n] = NULL;
+
+	w->status = 0;
+	w->err = 0;
+	w->complete = false;
+	w->hdr = HDR_NONE;
+	w->in_value = false;
+	w->field_len = 0;
+	w->value_len = 0;
+	w->etag[0] = '\0';
+	w->content_range[0] = '\0';
+	w->persisted = r->done;
+	w->stream.headers = w->headers;
+	w->stream.http_cb = &download_parser_cb;
+
+	ret = http_stream_get(&w->stream, sock, dl->host, dl->url,
+			      CONFIG_HTTP_DOWNLOAD_TIMEOUT_MS);
+	zsock_close(sock);
+
+	/* A whole body of unknown length (chunked) ends with the message;
+	 * its bytes have all been consumed once http_stream_get() returns
+	 */
+	if (ret >= 0 && w->complete && w->err == 0 && w->status == 200 &&
+	    r->end == HTTP_DOWNLOAD_SIZE_UNKNOWN) {
+		r->end = r->start + r->done;
+		state->total = r->end;
+	}
+
+	atomic_inc(&dl->attempts);
+	http_download_save(dl);
+
+	if (w->err < 0) {
+		return w->err;
+	}
+
+	return (ret < 0) ? ret : 0;
+}
+
+static int range_fetch(struct range_worker *w)
+{
+	struct http_download_range *r = &w->dl->state.range[w->idx];
+	int ret = 0;
+
+	for (int attempt = 0; attempt < w->max_attempts; attempt++) {
+		if (range_complete(r)) {
+			return 0;
+		}
+
+		if (attempt > 0) {
+			printk("Range %u: resuming at %u (%d)\n", w->idx,
+			       r->start + r->done, ret);
+			k_msleep(CONFIG_HTTP_DOWNLOAD_RETRY_DELAY_MS);
+		}
+
+		tracepoint_begin("http_range", TRACEPOINT_ID(w));
+		ret = range_request(w);
+		tracepoint_end("http_range", TRACEPOINT_ID(w));
+
+		/* The asset or the server changed under us, start over */
+		if (ret == -ESTALE || ret == -ENOTSUP) {
+			return ret;
+		}
+	}
+
+	return range_complete(r) ? 0 : -ETIMEDOUT;
+}
+
+static void range_worker_entry(void *p1, void *p2, void *p3)
+{
+	struct range_worker *w = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	w->result = range_fetch(w);
+}
+
+static void range_worker_init(struct range_worker *w, struct http_download *dl,
+			      struct zsock_addrinfo **res, uint8_t idx,
+			      int max_attempts)
+{
+	w->dl = dl;
+	w->res = res;
+	w->idx = idx;
+	w->max_attempts = max_attempts;
+	w->result = 0;
+
+	http_stream_init(&w->stream, worker_buf[idx][0], worker_buf[idx][1],
+			 CONFIG_HTTP_STREAM_BUF_SIZE, range_consumer, w);
+}
+
+/* Split everything after the probed first byte into @p parallel ranges */
+static void http_download_split(struct http_download_state *state,
+				int parallel)
+{
+	uint32_t rest = state->total - 1;
+
+	parallel = CLAMP(parallel, 1, CONFIG_HTTP_DOWNLOAD_MAX_RANGES);
+
+	for (int i = 0; i < parallel; i++) {
+		struct http_download_range *r = &state->range[i];
+
+		r->start = (i == 0) ? 0 : 1 + (uint32_t)((uint64_t)rest * i /
+							 parallel);
+		r->end = 1 + (uint32_t)((uint64_t)rest * (i + 1) / parallel);
+		if (i > 0) {
+			r->done = 0;
+		}
+	}
+
+	state->num_ranges = parallel;
+}
+
+void http_download_reset(struct http_download *dl)
+{
+	memset(&dl->state, 0, sizeof(dl->state));
+	atomic_set(&dl->attempts, 0);
+	http_download_forget(dl);
+}
+
+int http_download(struct http_download *dl, int parallel, int max_attempts)
+{
+	struct http_download_state *state = &dl->state;
+	struct zsock_addrinfo *res = NULL;
+	int ret = 0;
+
+	if (state->num_ranges == 0) {
+		http_download_load(dl);
+	}
+
+	nslookup(dl->host, &res);
+	if (res == NULL) {
+		return -EHOSTUNREACH;
+	}
+
+	if (state->num_ranges == 0) {
+		/* Fresh download: one range, size learnt from the response */
+		state->total = HTTP_DOWNLOAD_SIZE_UNKNOWN;
+		state->num_ranges = 1;
+		state->range[0].start = 0;
+		state->range[0].done = 0;
+		state->range[0].end = HTTP_DOWNLOAD_SIZE_UNKNOWN;
+
+		if (parallel > 1) {
+			/* Probe the first byte to learn size and range support */
+			state->range[0].end = 1;
+			range_worker_init(&workers[0], dl, &res, 0, max_attempts);
+			ret = range_fetch(&workers[0]);
+			if (ret < 0) {
+				goto out;
+			}
+
+			if (workers[0].status == 206 && state->total > 1) {
+				http_download_split(state, parallel);
+				http_download_save(dl);
+			}
+		}
+	}
+
+	if (state->num_ranges == 1) {
+		range_worker_init(&workers[0], dl, &res, 0, max_attempts);
+		ret = range_fetch(&workers[0]);
+		goto out;
+	}
+
+	for (uint8_t i = 0; i < state->num_ranges; i++) {
+		range_worker_init(&workers[i], dl, &res, i, max_attempts);
+		k_thread_create(&worker_threads[i], worker_stacks[i],
+				K_THREAD_STACK_SIZEOF(worker_stacks[i]),
+				range_worker_entry, &workers[i], NULL, NULL,
+				CONFIG_HTTP_DOWNLOAD_WORKER_PRIORITY, 0,
+				K_NO_WAIT);
+	}
+
+	for (uint8_t i = 0; i < state->num_ranges; i++) {
+		k_thread_join(&worker_threads[i], K_FOREVER);
+		if (workers[i].result < 0 && ret == 0) {
+			ret = workers[i].result;
+		}
+	}
+
+out:
+	zsock_freeaddrinfo(res);
+
+	if (ret == -ESTALE || ret == -ENOTSUP) {
+		/* Progress no longer matches the asset, next call restarts */
+		printk("Download of %s: %s, progress discarded\n", dl->url,
+		       (ret == -ESTALE) ? "asset changed" : "ranges refused");
+		http_download_reset(dl);
+	} else if (ret == 0) {
+		http_download_forget(dl);
+	}
+
+	return ret;
+}
@@ -0,0 +1,73 @@
+/*
+ * Resumable HTTP downloads using Range requests.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HTTP_DOWNLOAD_H_
+#define HTTP_DOWNLOAD_H_
+
+#include <stdint.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/net/socket.h>
+
+#include "http_stream.h"
+
+#define HTTP_DOWNLOAD_SIZE_UNKNOWN UINT32_MAX
+
+/* Progress of one byte range, [start, end) of the asset */
+struct http_download_range {
+	uint32_t start;
+	uint32_t end;
+	uint32_t done;
+};
+
+/*
+ * Everything needed to resume a download. This is what gets persisted,
+ * so it only holds plain data.
+ */
+struct http_download_state {
+	uint32_t total;
+	uint8_t num_ranges;
+	struct http_download_range range[CONFIG_HTTP_DOWNLOAD_MAX_RANGES];
+	char etag[CONFIG_HTTP_DOWNLOAD_ETAG_LEN];
+};
+
+struct http_download {
+	/* Settings key suffix used to persist progress, NULL to disable */
+	const char *name;
+	const char *host;
+	uint16_t port;
+	const char *url;
+	/*
+	 * Receives the body at absolute offsets within the asset. Ranges
+	 * downloaded in parallel arrive out of order and are consumed
+	 * concurrently, each from its own thread; calls for one range are
+	 * never concurrent.
+	 */
+	http_stream_cb_t consumer;
+	void *user_data;
+
+	struct http_download_state state;
+	/* Number of requests issued so far */
+	atomic_t attempts;
+};
+
+/*
+ * Download @p dl->url, resuming from any persisted progress. Every dropped
+ * connection is retried from the last received byte, up to @p max_attempts
+ * requests per range.
+ *
+ * When @p parallel is greater than one and the server supports ranges, the
+ * remaining bytes are split into that many ranges, each fetched over its own
+ * socket.
+ *
+ * Returns 0 once the whole asset has been handed to the consumer, or a
+ * negative errno. Progress is kept on failure, so calling again resumes.
+ */
+int http_download(struct http_download *dl, int parallel, int max_attempts);
+
+/* Forget any progress of @p dl, both in memory and persisted. */
+void http_download_reset(struct http_download *dl);
+
+#endif /* HTTP_DOWNLOAD_H_ */
@@ -13,6 +13,9 @@
 #include <zephyr/kernel.h>
 #include <zephyr/net/http/client.h>
 
+#include "http_download.h"
+#include "http_stream.h"
+
 void nslookup(const char * hostname, struct zsock_addrinfo **results)
 {
 	int err;
@@ -79,7 +82,7 @@ int connect_socket(struct zsock_addrinfo **results, uint16_t port)
 			zsock_inet_ntop(AF_INET6, &sa6->sin6_addr, ipv6, INET6_ADDRSTRLEN);
 			printk("Connecting to %s:%d ", ipv6, port);
 
-			ret = zsock_connect(sock, (struct sockaddr *) sa6, sizeof(struct sockaddr_in));
+			ret = zsock_connect(sock, (struct sockaddr *) sa6, sizeof(struct sockaddr_in6));
 			if (ret == 0) {
 				printk("Success\r\n");
 				return(sock);
@@ -121,39 +124,106 @@ int connect_socket(struct zsock_addrinfo **results, uint16_t port)
 			}
 		}
 	}
-	
-	return(0);
+
+	// Close IPv4 Socket
+	zsock_close(sock);
+
+	return(-1);
+}
+
+static int http_print_consumer(const uint8_t *frag, size_t len,
+			       size_t offset, void *user_data)
+{
+	printk("%.*s", (int)len, frag);
+	return 0;
+}
+
+void http_get(int sock, char * hostname, char * url)
+{
+	static uint8_t recv_buf[2][CONFIG_HTTP_STREAM_BUF_SIZE];
+	static struct http_stream stream;
+
+	http_stream_init(&stream, recv_buf[0], recv_buf[1], sizeof(recv_buf[0]),
+			 http_print_consumer, NULL);
+
+	(void)http_stream_get(&stream, sock, hostname, url, 5000);
+}
+
+static int http_discard_consumer(const uint8_t *frag, size_t len,
+				 size_t offset, void *user_data)
+{
+	return 0;
 }
 
-static void http_response_cb(struct http_response *rsp,
-			enum http_final_call final_data,
-			void *user_data)
+int http_get_benchmark(int sock, char * hostname, char * url)
 {
-	if (final_data == HTTP_DATA_MORE) {
-		//printk("Partial data received (%zd bytes)\n", rsp->data_len);
-	} else if (final_data == HTTP_DATA_FINAL) {
-		//printk("All the data received (%zd bytes)\n", rsp->data_len);
+	static uint8_t recv_buf[2][CONFIG_HTTP_STREAM_BUF_SIZE];
+	static struct http_stream stream;
+	uint32_t kbps;
+	int ret;
+
+	http_stream_init(&stream, recv_buf[0], recv_buf[1], sizeof(recv_buf[0]),
+			 http_discard_consumer, NULL);
+
+	ret = http_stream_get(&stream, sock, hostname, url, 30000);
+	if (ret < 0) {
+		printk("Streaming GET failed (%d)\n", ret);
+		return ret;
 	}
 
-	//printk("Bytes Recv %zd\n", rsp->data_len);
-	//printk("Response status %s\n", rsp->http_status);
-	//printk("Recv Buffer Length %zd\n", rsp->recv_buf_len);
-	printk("%.*s", rsp->data_len, rsp->recv_buf);
+	kbps = stream.stats.elapsed_ms ?
+	       (uint32_t)((uint64_t)stream.stats.body_bytes * 8U /
+			  stream.stats.elapsed_ms) : 0;
+
+	printk("HTTP %u: %zu bytes in %u ms (%u kbit/s), %u fragments, "
+	       "consumer stall %u ms\n",
+	       stream.http_status_code, stream.stats.body_bytes,
+	       stream.stats.elapsed_ms, kbps, stream.stats.fragments,
+	       stream.stats.stall_ms);
+
+	return ret;
 }
 
-void http_get(int sock, char * hostname, char * url)
+/* Checks the /blob/<size> pattern served by scripts/http_standin.py */
+static int http_verify_consumer(const uint8_t *frag, size_t len,
+				size_t offset, void *user_data)
+{
+	atomic_t *mismatches = user_data;
+
+	/* Called for several ranges at once when downloading in parallel */
+	for (size_t i = 0; i < len; i++) {
+		if (frag[i] != (uint8_t)((offset + i) * 31U + 7U)) {
+			atomic_inc(mismatches);
+		}
+	}
+
+	return 0;
+}
+
+int http_get_resumable(char * hostname, uint16_t port, char * url,
+		       int parallel, int max_attempts)
 {
-	struct http_request req = { 0 };
-	static uint8_t recv_buf[512];
+	static struct http_download dl;
+	static atomic_t mismatches;
+	int64_t start;
 	int ret;
 
-	req.method = HTTP_GET;
-	req.url = url;
-	req.host = hostname;
-	req.protocol = "HTTP/1.1";
-	req.response = (void *)http_response_cb;
-	req.recv_buf = recv_buf;
-	req.recv_buf_len = sizeof(recv_buf);
+	dl.name = "app";
+	dl.host = hostname;
+	dl.port = port;
+	dl.url = url;
+	dl.consumer = http_verify_consumer;
+	dl.user_data = &mismatches;
+
+	atomic_set(&mismatches, 0);
+	start = k_uptime_get();
+	ret = http_download(&dl, parallel, max_attempts);
+
+	printk("Resumable GET %s: %d, %u bytes in %u ranges, %ld requests, "
+	       "%u ms, %ld pattern mismatches\n",
+	       url, ret, dl.state.total, dl.state.num_ranges,
+	       atomic_get(&dl.attempts), (uint32_t)(k_uptime_get() - start),
+	       atomic_get(&mismatches));
 
-	ret = http_client_req(sock, &req, 5000, NULL);
+	return ret;
 }
@@ -6,4 +6,7 @@
 void nslookup(const char * hostname, struct zsock_addrinfo **results);
 void print_addrinfo_results(struct zsock_addrinfo **results);
 void http_get(int sock, char * hostname, char * url);
+int http_get_benchmark(int sock, char * hostname, char * url);
+int http_get_resumable(char * hostname, uint16_t port, char * url,
+		       int parallel, int max_attempts);
 int connect_socket(struct zsock_addrinfo **results, uint16_t port);
\ No newline at end of file
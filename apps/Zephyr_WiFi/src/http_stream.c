@@ -0,0 +1,226 @@
+/*
+ * Streaming HTTP GET with double-buffered, zero-copy fragment handoff.
+ *
+ * The HTTP client fills rsp->recv_buf and calls the response callback each
+ * time that buffer is full. Instead of copying the data out, the callback
+ * queues the filled buffer to a drain thread and points rsp->recv_buf at the
+ * second buffer, so the network thread keeps receiving while the consumer
+ * works on the previous fragment in place. Every stream being downloaded
+ * has a queue and a drain thread of its own, so parallel downloads are
+ * consumed in parallel too.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/http/client.h>
+
+#include <app/lib/tracepoints.h>
+
+#include "http_stream.h"
+
+/* Drain threads, one per stream being downloaded */
+static struct k_thread drain_threads[CONFIG_HTTP_STREAM_MAX_ACTIVE];
+static K_THREAD_STACK_ARRAY_DEFINE(drain_stacks, CONFIG_HTTP_STREAM_MAX_ACTIVE,
+				   CONFIG_HTTP_STREAM_DRAIN_STACK_SIZE);
+static ATOMIC_DEFINE(drain_used, CONFIG_HTTP_STREAM_MAX_ACTIVE);
+static K_SEM_DEFINE(drain_free, CONFIG_HTTP_STREAM_MAX_ACTIVE,
+		    CONFIG_HTTP_STREAM_MAX_ACTIVE);
+
+static void http_stream_drain(void *p1, void *p2, void *p3)
+{
+	struct http_stream *stream = p1;
+	struct http_stream_frag *frag;
+	int err;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (1) {
+		frag = k_fifo_get(&stream->fifo, K_FOREVER);
+
+		if (frag->len > 0 && stream->consumer_err == 0) {
+			tracepoint_begin("http_consume", TRACEPOINT_ID(stream));
+			err = stream->consumer(frag->data, frag->len,
+					       frag->offset, stream->user_data);
+			tracepoint_end("http_consume", TRACEPOINT_ID(stream));
+			if (err < 0) {
+				stream->consumer_err = err;
+			}
+		}
+
+		if (frag->final) {
+			k_sem_give(&stream->done);
+			return;
+		}
+
+		k_sem_give(&stream->buf_free[frag->buf_idx]);
+	}
+}
+
+/* Start a drain thread for @p stream, waiting for one to be free */
+static int http_stream_drain_start(struct http_stream *stream)
+{
+	int slot;
+
+	k_sem_take(&drain_free, K_FOREVER);
+
+	for (slot = 0; slot < CONFIG_HTTP_STREAM_MAX_ACTIVE; slot++) {
+		if (!atomic_test_and_set_bit(drain_used, slot)) {
+			break;
+		}
+	}
+
+	k_thread_create(&drain_threads[slot], drain_stacks[slot],
+			K_THREAD_STACK_SIZEOF(drain_stacks[slot]),
+			http_stream_drain, stream, NULL, NULL,
+			CONFIG_HTTP_STREAM_DRAIN_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&drain_threads[slot], "http_drain");
+
+	return slot;
+}
+
+static void http_stream_drain_stop(int slot)
+{
+	k_thread_join(&drain_threads[slot], K_FOREVER);
+	atomic_clear_bit(drain_used, slot);
+	k_sem_give(&drain_free);
+}
+
+static void http_stream_post(struct http_stream *stream, const uint8_t *data,
+			     size_t len, bool final)
+{
+	struct http_stream_frag *frag = &stream->frag[stream->fill_idx];
+
+	frag->data = data;
+	frag->len = len;
+	frag->offset = stream->offset;
+	frag->final = final;
+
+	stream->offset += len;
+	if (len > 0) {
+		stream->stats.fragments++;
+	}
+	if (final) {
+		stream->final_posted = true;
+	}
+
+	k_fifo_put(&stream->fifo, frag);
+}
+
+static void http_stream_response_cb(struct http_response *rsp,
+				    enum http_final_call final_data,
+				    void *user_data)
+{
+	struct http_stream *stream = user_data;
+	size_t len = rsp->body_frag_start ? rsp->body_frag_len : 0;
+	uint8_t next;
+	int64_t wait_start;
+
+	stream->http_status_code = rsp->http_status_code;
+	stream->content_length = rsp->content_length;
+
+	if (final_data == HTTP_DATA_FINAL) {
+		http_stream_post(stream, rsp->body_frag_start, len, true);
+		return;
+	}
+
+	/* Buffer held nothing but headers, let the client reuse it */
+	if (len == 0) {
+		return;
+	}
+
+	http_stream_post(stream, rsp->body_frag_start, len, false);
+
+	/* Swap to the other buffer once the consumer has released it */
+	next = stream->fill_idx ^ 1;
+	wait_start = k_uptime_get();
+	tracepoint_begin("http_stall", TRACEPOINT_ID(stream));
+	k_sem_take(&stream->buf_free[next], K_FOREVER);
+	tracepoint_end("http_stall", TRACEPOINT_ID(stream));
+	stream->stats.stall_ms += (uint32_t)(k_uptime_get() - wait_start);
+
+	stream->fill_idx = next;
+	rsp->recv_buf = stream->buf[next];
+}
+
+void http_stream_init(struct http_stream *stream,
+		      uint8_t *buf0, uint8_t *buf1, size_t buf_len,
+		      http_stream_cb_t consumer, void *user_data)
+{
+	memset(stream, 0, sizeof(*stream));
+
+	stream->consumer = consumer;
+	stream->user_data = user_data;
+	stream->buf[0] = buf0;
+	stream->buf[1] = buf1;
+	stream->buf_len = buf_len;
+
+	for (int i = 0; i < 2; i++) {
+		stream->frag[i].stream = stream;
+		stream->frag[i].buf_idx = i;
+	}
+}
+
+int http_stream_get(struct http_stream *stream, int sock,
+		    const char *hostname, const char *url,
+		    int32_t timeout_ms)
+{
+	struct http_request req = { 0 };
+	int64_t start;
+	int slot;
+	int ret;
+
+	/* Buffer 0 is being filled, buffer 1 is free for the swap */
+	k_sem_init(&stream->buf_free[0], 0, 1);
+	k_sem_init(&stream->buf_free[1], 1, 1);
+	k_sem_init(&stream->done, 0, 1);
+	k_fifo_init(&stream->fifo);
+	stream->fill_idx = 0;
+	stream->offset = 0;
+	stream->final_posted = false;
+	stream->consumer_err = 0;
+	stream->http_status_code = 0;
+	stream->content_length = 0;
+	memset(&stream->stats, 0, sizeof(stream->stats));
+
+	req.method = HTTP_GET;
+	req.url = url;
+	req.host = hostname;
+	req.protocol = "HTTP/1.1";
+	req.header_fields = stream->headers;
+	req.http_cb = stream->http_cb;
+	req.response = (void *)http_stream_response_cb;
+	req.recv_buf = stream->buf[0];
+	req.recv_buf_len = stream->buf_len;
+
+	slot = http_stream_drain_start(stream);
+
+	start = k_uptime_get();
+	tracepoint_begin("http_request", TRACEPOINT_ID(stream));
+	ret = http_client_req(sock, &req, timeout_ms, stream);
+	tracepoint_end("http_request", TRACEPOINT_ID(stream));
+
+	/* Request ended without a final callback (timeout, reset, ...) */
+	if (!stream->final_posted) {
+		http_stream_post(stream, NULL, 0, true);
+	}
+
+	k_sem_take(&stream->done, K_FOREVER);
+	http_stream_drain_stop(slot);
+
+	stream->stats.body_bytes = stream->offset;
+	stream->stats.elapsed_ms = (uint32_t)(k_uptime_get() - start);
+
+	if (stream->consumer_err < 0) {
+		return stream->consumer_err;
+	}
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	return (int)stream->offset;
+}
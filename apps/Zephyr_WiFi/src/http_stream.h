@@ -0,0 +1,97 @@
+/*
+ * Streaming HTTP GET with double-buffered, zero-copy fragment handoff.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef HTTP_STREAM_H_
+#define HTTP_STREAM_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/http/client.h>
+
+/*
+ * Consumer callback, invoked from the drain thread of the stream for every
+ * body fragment. Streams downloading at the same time call their consumers
+ * concurrently. @p frag points straight into the receive buffer the network
+ * thread filled; it is only valid until the callback returns. @p offset is
+ * the position of the fragment within the response body.
+ *
+ * Return 0 to continue, or a negative errno to stop consuming (the rest of
+ * the response is still drained from the socket, but not handed over).
+ */
+typedef int (*http_stream_cb_t)(const uint8_t *frag, size_t len,
+				size_t offset, void *user_data);
+
+struct http_stream;
+
+/* One in-flight fragment descriptor; there is one per receive buffer. */
+struct http_stream_frag {
+	void *fifo_reserved;
+	struct http_stream *stream;
+	const uint8_t *data;
+	size_t len;
+	size_t offset;
+	uint8_t buf_idx;
+	bool final;
+};
+
+struct http_stream_stats {
+	size_t body_bytes;
+	uint32_t fragments;
+	uint32_t elapsed_ms;
+	/* Time the network thread spent waiting for the consumer */
+	uint32_t stall_ms;
+};
+
+struct http_stream {
+	/* Set through http_stream_init() */
+	http_stream_cb_t consumer;
+	void *user_data;
+	uint8_t *buf[2];
+	size_t buf_len;
+
+	/* Optional, set by the caller before http_stream_get() */
+	const char **headers;
+	const struct http_parser_settings *http_cb;
+
+	/* Response information, valid once http_stream_get() returns */
+	uint16_t http_status_code;
+	size_t content_length;
+	struct http_stream_stats stats;
+
+	/* Internal state */
+	struct k_fifo fifo;
+	struct k_sem buf_free[2];
+	struct k_sem done;
+	struct http_stream_frag frag[2];
+	uint8_t fill_idx;
+	size_t offset;
+	bool final_posted;
+	int consumer_err;
+};
+
+/*
+ * Prepare @p stream to download into the two caller-provided buffers of
+ * @p buf_len bytes each. While the network thread fills one buffer, the
+ * drain thread of the stream hands the other one to @p consumer.
+ */
+void http_stream_init(struct http_stream *stream,
+		      uint8_t *buf0, uint8_t *buf1, size_t buf_len,
+		      http_stream_cb_t consumer, void *user_data);
+
+/*
+ * Issue a GET for @p url on the connected socket @p sock and stream the body
+ * to the consumer. Returns once every fragment has been consumed. Up to
+ * CONFIG_HTTP_STREAM_MAX_ACTIVE streams download at once, more wait.
+ *
+ * Returns the number of body bytes received, or a negative errno.
+ */
+int http_stream_get(struct http_stream *stream, int sock,
+		    const char *hostname, const char *url,
+		    int32_t timeout_ms);
+
+#endif /* HTTP_STREAM_H_ */
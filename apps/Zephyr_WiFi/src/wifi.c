@@ -14,10 +14,13 @@
 #include <errno.h>
 #include <string.h>
 
+#if defined(CONFIG_WIFI)
 #include "ei_config.h"   /* defines WIFI_SSID, WIFI_PASS */
+#endif
 #include "http_get.h"
 #include "ping.h"
 
+#if defined(CONFIG_WIFI)
 /* Only need this for Wi-Fi association */
 static K_SEM_DEFINE(wifi_connected, 0, 1);
 
@@ -198,18 +201,21 @@ void wifi_disconnect(void)
         printk("WiFi Disconnection Request Failed\n");
     }
 }
+#endif /* CONFIG_WIFI */
 
 /* ---------------------------------- main() ---------------------------------- */
 int main(void)
 {
     int sock;
-    struct net_if *iface = net_if_get_default();
-    const char *host = "iot.beyondlogic.org";
-    const char *path = "/LoremIpsum.txt";
+    const char *host = CONFIG_APP_HTTP_HOST;
+    const char *path = CONFIG_APP_HTTP_PATH;
     struct zsock_addrinfo *res = NULL;
 
     printk("WiFi Example\nBoard: %s\n", CONFIG_BOARD);
 
+#if defined(CONFIG_WIFI)
+    struct net_if *iface = net_if_get_default();
+
     net_mgmt_init_event_callback(
         &wifi_cb,
         wifi_mgmt_event_handler,
@@ -233,18 +239,35 @@ int main(void)
 
     /* Connectivity checks */
     ping("8.8.8.8", 4);
+#else
+    /* native_sim: sockets are offloaded to the host; QEMU: Ethernet, up
+     * with its static address before main()
+     */
+    printk("Ready...\n\n");
+#endif /* CONFIG_WIFI */
 
     printk("\nLooking up IP addresses:\n");
     nslookup(host, &res);
     print_addrinfo_results(&res);
 
     printk("\nConnecting to HTTP Server:\n");
-    sock = connect_socket(&res, 80);
+    sock = connect_socket(&res, CONFIG_APP_HTTP_PORT);
     if (sock >= 0) {
         http_get(sock, (char *)host, (char *)path);
         zsock_close(sock);
     } else {
-        printk("Failed to connect to %s:80\n", host);
+        printk("Failed to connect to %s:%d\n", host, CONFIG_APP_HTTP_PORT);
+    }
+
+    /* Streaming throughput measurement, see scripts/http_standin.py */
+    if (strlen(CONFIG_APP_HTTP_BENCH_PATH) > 0) {
+        printk("\nStreaming %s:\n", CONFIG_APP_HTTP_BENCH_PATH);
+        sock = connect_socket(&res, CONFIG_APP_HTTP_PORT);
+        if (sock >= 0) {
+            http_get_benchmark(sock, (char *)host,
+                               (char *)CONFIG_APP_HTTP_BENCH_PATH);
+            zsock_close(sock);
+        }
     }
 
     /* Free addrinfo results if allocated */
@@ -253,5 +276,14 @@ int main(void)
         res = NULL;
     }
 
+    /* Resumable download, see scripts/http_standin.py --drop-after */
+    if (strlen(CONFIG_APP_HTTP_DOWNLOAD_PATH) > 0) {
+        printk("\nResumable download of %s:\n", CONFIG_APP_HTTP_DOWNLOAD_PATH);
+        http_get_resumable((char *)host, CONFIG_APP_HTTP_PORT,
+                           (char *)CONFIG_APP_HTTP_DOWNLOAD_PATH,
+                           CONFIG_APP_HTTP_DOWNLOAD_PARALLEL,
+                           CONFIG_APP_HTTP_DOWNLOAD_ATTEMPTS);
+    }
+
     return 0;
 }
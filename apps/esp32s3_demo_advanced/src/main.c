@@ -3,10 +3,13 @@
 #include <zephyr/drivers/sensor.h>
 #include <zephyr/sys/printk.h>
 
+#include <app/drivers/sensor/sht4x_group.h>
+#include <app/lib/pipeline.h>
+
 /* Devicetree aliases from overlay */
 #define LED0_NODE DT_ALIAS(led0)
 #define SW0_NODE  DT_ALIAS(sw0)
-#define THS0_NODE DT_ALIAS(ths0)
+#define THS_GROUP_NODE DT_ALIAS(ths_group)
 
 #if !DT_NODE_HAS_STATUS(LED0_NODE, okay)
 #error "No alias 'led0' in devicetree; check overlay."
@@ -16,20 +19,87 @@
 #error "No alias 'sw0' in devicetree; check overlay."
 #endif
 
-#if !DT_NODE_HAS_STATUS(THS0_NODE, okay)
-#error "No alias 'ths0' in devicetree; check overlay."
+#if !DT_NODE_HAS_STATUS(THS_GROUP_NODE, okay)
+#error "No alias 'ths-group' in devicetree; check overlay."
 #endif
 
+/* Temperature and humidity of every SHT40 of the group, in one sample */
+#define SHT40_COUNT SHT4X_GROUP_DT_NUM_SENSORS(THS_GROUP_NODE)
+
+BUILD_ASSERT(2 * SHT40_COUNT <= CONFIG_PIPELINE_MAX_VALUES,
+             "CONFIG_PIPELINE_MAX_VALUES too small for the SHT40 group");
+
+#define SHT40_PERIOD_MS 1000
+
 static const struct gpio_dt_spec led =
     GPIO_DT_SPEC_GET(LED0_NODE, gpios);
 
 static const struct gpio_dt_spec button =
     GPIO_DT_SPEC_GET(SW0_NODE, gpios);
 
-static const struct device *const ths_dev =
-    DEVICE_DT_GET(THS0_NODE);
+static struct gpio_callback button_cb;
+
+/* --------------------------------------------------------------------------
+ * SHT40 pipeline: read temperature and humidity every second, print them.
+ * All sensors of the group convert at once, so a fetch takes one conversion
+ * time however many there are.
+ * -------------------------------------------------------------------------- */
+
+#define SHT40_CHANNELS(i, _) \
+    SENSOR_CHAN_SHT4X_GROUP_TEMP(i), SENSOR_CHAN_SHT4X_GROUP_HUM(i)
+
+static const enum sensor_channel sht40_channels[] = {
+    LISTIFY(SHT40_COUNT, SHT40_CHANNELS, (,))
+};
+
+static struct pipeline_acquire sht40 = {
+    .sensor = DEVICE_DT_GET(THS_GROUP_NODE),
+    .channels = sht40_channels,
+    .num_channels = ARRAY_SIZE(sht40_channels),
+    .period_ms = SHT40_PERIOD_MS,
+};
 
+static int print_sample(struct net_buf *samples, void *user_data)
+{
+    const struct pipeline_sample *sample = pipeline_sample(samples);
+
+    ARG_UNUSED(user_data);
+
+    for (int i = 0; i + 1 < sample->count; i += 2) {
+        const struct sensor_value *temp = &sample->values[i];
+        const struct sensor_value *hum = &sample->values[i + 1];
+
+        /* val2 is in micro-units (1e-6); two decimals: micro / 10^4 */
+        printk("SHT40 #%d: T = %d.%02d C, RH = %d.%02d %%\n", i / 2,
+            temp->val1, temp->val2 / 10000, hum->val1, hum->val2 / 10000);
+    }
+
+    return 0;
+}
 
+static struct pipeline_sink console =
+    PIPELINE_SINK_INITIALIZER(print_sample, NULL);
+
+PIPELINE_DEFINE(sht40_pipeline, 2, &sht40, &console.stage);
+
+/* --------------------------------------------------------------------------
+ * Button: LED follows the button
+ * -------------------------------------------------------------------------- */
+
+static void button_changed(const struct device *port, struct gpio_callback *cb,
+                           gpio_port_pins_t pins)
+{
+    int pressed = gpio_pin_get_dt(&button);
+
+    ARG_UNUSED(port);
+    ARG_UNUSED(cb);
+    ARG_UNUSED(pins);
+
+    if (pressed >= 0) {
+        printk("Button is %s\n", pressed ? "PRESSED" : "released");
+        gpio_pin_set_dt(&led, pressed);
+    }
+}
 
 int main(void)
 {
@@ -47,11 +117,6 @@ int main(void)
         return 0;
     }
 
-    if (!device_is_ready(ths_dev)) {
-        printk("SHT40 device not ready\n");
-        return 0;
-    }
-
     /* LED output, initially off */
     ret = gpio_pin_configure_dt(&led, GPIO_OUTPUT_INACTIVE);
     if (ret != 0) {
@@ -59,57 +124,24 @@ int main(void)
         return 0;
     }
 
-    /* Button input, pulls from devicetree */
+    /* Button input, pulls from devicetree, interrupt on both edges */
     ret = gpio_pin_configure_dt(&button, GPIO_INPUT);
+    if (ret == 0) {
+        gpio_init_callback(&button_cb, button_changed, BIT(button.pin));
+        ret = gpio_add_callback_dt(&button, &button_cb);
+    }
+    if (ret == 0) {
+        ret = gpio_pin_interrupt_configure_dt(&button, GPIO_INT_EDGE_BOTH);
+    }
     if (ret != 0) {
         printk("Failed to configure button: %d\n", ret);
         return 0;
     }
 
-    bool last_pressed = false;
-    int counter = 0;
-
-    while (1) {
-        /* Button handling */
-        int val = gpio_pin_get_dt(&button);
-        if (val >= 0) {
-            bool pressed = (val == 0); /* because active low */
-            if (pressed != last_pressed) {
-                last_pressed = pressed;
-                printk("Button is %s\n", pressed ? "PRESSED" : "released");
-                gpio_pin_set_dt(&led, pressed ? 1 : 0);
-            }
-        }
-
-        /* Every 1 second, read SHT40 */
-        if ((counter % 10) == 0) {
-            struct sensor_value temp, hum;
-
-            ret = sensor_sample_fetch(ths_dev);
-            if (ret == 0) {
-                ret = sensor_channel_get(ths_dev, SENSOR_CHAN_AMBIENT_TEMP, &temp);
-            }
-            if (ret == 0) {
-                ret = sensor_channel_get(ths_dev, SENSOR_CHAN_HUMIDITY, &hum);
-            }
-
-            if (ret == 0) {
-                /* temp.val2 and hum.val2 are in micro-units (1e-6) */
-                int t_int = temp.val1;
-                int t_dec = temp.val2 / 10000;   /* two decimals: micro / 10^4 */
-
-                int h_int = hum.val1;
-                int h_dec = hum.val2 / 10000;
-
-                printk("SHT40: T = %d.%02d C, RH = %d.%02d %%\n",
-                    t_int, t_dec, h_int, h_dec);
-            } else {
-                printk("SHT40 read error: %d\n", ret);
-            }
-        }
-
-        counter++;
-        k_msleep(100); /* 100 ms loop => ~1 s per SHT40 read */
+    ret = pipeline_start(&sht40_pipeline);
+    if (ret != 0) {
+        printk("Failed to start SHT40 pipeline: %d\n", ret);
+        return 0;
     }
 
     return 0;
@@ -0,0 +1,70 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''A week of sampling and uploads, simulated on native_sim against the
+ingestion mock, checked end to end; with CONFIG_APP_INFERENCE, the results
+of classified windows too.
+
+Run through twister on native_sim, e.g.
+
+  west twister -p native_sim -T apps/esp32s3_demo_edgeimpulse -s app.sim
+'''
+
+import json
+import re
+import urllib.request
+
+import pytest
+from twister_harness import DeviceAdapter
+
+
+@pytest.fixture(scope='module')
+def mock(standin, build_config):
+    return standin('ei_ingestion_mock.py', 'CONFIG_UPLINK_PORT',
+                   '--api-key', build_config['CONFIG_APP_EI_API_KEY'],
+                   '--quiet')
+
+
+def run_week(mock, dut):
+    '''The device's report and what the mock received, checking that every
+    upload the device saw confirmed arrived, whole and only once.'''
+    lines = dut.readlines_until(regex=r'SIM DONE: .*', timeout=600)
+    for line in lines:
+        if line.startswith('SIM '):
+            print(line)
+
+    m = re.search(r'SIM DONE: uploads=(\d+) samples=(\d+) failed=(\d+) '
+                  r'lost=(\d+)', lines[-1])
+    assert m, lines[-1]
+    uploads, samples, failed, lost = (int(g) for g in m.groups())
+
+    with urllib.request.urlopen(f'http://127.0.0.1:{mock.port}/stats') \
+            as reply:
+        received = json.load(reply)
+    print(f'mock: {received}')
+
+    assert failed == 0
+    assert lost == 0
+    assert received['rejected'] == 0
+    assert received['duplicates'] == 0
+    assert received['uploads'] == uploads
+    return samples, received
+
+
+def test_week(mock, dut: DeviceAdapter):
+    samples, received = run_week(mock, dut)
+
+    assert received['values'] == samples
+    assert received['results'] == 0
+    # An hourly heartbeat at least, and the trace's events as windows
+    assert received['heartbeats'] >= 7 * 24 // 2
+    assert received['windows'] > 0
+
+
+def test_week_inference(mock, dut: DeviceAdapter):
+    _, received = run_week(mock, dut)
+
+    # Windows go up as results, with the API key, to the results path
+    assert received['results'] > 0
+    assert received['windows'] == 0
+    assert received['heartbeats'] >= 7 * 24 // 2
@@ -0,0 +1,66 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+# The simulation of src/sim.c, for CONFIG_APP_SIM, and the trace it replays
+# as sim_trace.h. CONFIG_APP_SIM_TRACE is a CSV file of "time_s,temp_c,
+# hum_pct" rows, relative to the application directory unless absolute:
+# seconds from the start of the trace, in order, and levels with up to
+# three decimals. Comment lines starting with # and the header are skipped.
+
+set(SIM_TRACE ${CONFIG_APP_SIM_TRACE})
+if(NOT IS_ABSOLUTE ${SIM_TRACE})
+    set(SIM_TRACE ${APPLICATION_SOURCE_DIR}/${SIM_TRACE})
+endif()
+set(SIM_GENERATED ${CMAKE_CURRENT_BINARY_DIR}/sim)
+
+# "21.5" to 21500, "-0.25" to -250
+function(sim_milli value out)
+    if(NOT value MATCHES "^(-?)([0-9]+)(\\.([0-9]*))?$")
+        message(FATAL_ERROR "${SIM_TRACE}: '${value}' is not a level")
+    endif()
+    set(sign ${CMAKE_MATCH_1})
+    set(units ${CMAKE_MATCH_2})
+    string(SUBSTRING "${CMAKE_MATCH_4}000" 0 3 milli)
+    math(EXPR milli "${sign}(${units} * 1000 + ${milli})")
+    set(${out} ${milli} PARENT_SCOPE)
+endfunction()
+
+set(SIM_POINTS "")
+set(sim_count 0)
+set(sim_last -1)
+file(STRINGS ${SIM_TRACE} sim_lines)
+foreach(line IN LISTS sim_lines)
+    if(line MATCHES "^#" OR line MATCHES "^time_s," OR line STREQUAL "")
+        continue()
+    endif()
+    if(NOT line MATCHES "^([0-9]+),([^,]+),([^,]+)$")
+        message(FATAL_ERROR "${SIM_TRACE}: bad row '${line}'")
+    endif()
+    set(time_s ${CMAKE_MATCH_1})
+    sim_milli(${CMAKE_MATCH_2} temp)
+    sim_milli(${CMAKE_MATCH_3} hum)
+    if(NOT time_s GREATER sim_last)
+        message(FATAL_ERROR "${SIM_TRACE}: time ${time_s} out of order")
+    endif()
+    set(sim_last ${time_s})
+    math(EXPR sim_count "${sim_count} + 1")
+    string(APPEND SIM_POINTS "    { ${time_s}, ${temp}, ${hum} },\n")
+endforeach()
+if(sim_count LESS 2)
+    message(FATAL_ERROR "${SIM_TRACE}: a trace takes at least two rows")
+endif()
+
+file(CONFIGURE OUTPUT ${SIM_GENERATED}/sim_trace.h @ONLY CONTENT
+"/* Generated from @SIM_TRACE@, do not edit */
+
+static const struct sim_point sim_trace[] = {
+@SIM_POINTS@};
+")
+set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${SIM_TRACE})
+
+target_include_directories(app PRIVATE ${SIM_GENERATED})
+target_sources(app PRIVATE ${APPLICATION_SOURCE_DIR}/src/sim.c)
+
+# The host clock, read from the native simulator runner
+target_sources(native_simulator INTERFACE
+    ${APPLICATION_SOURCE_DIR}/src/sim_clock_bottom.c)
@@ -6,18 +6,25 @@
 #include <string.h>
 #include <errno.h>
 
-#include <zephyr/net/socket.h>
+#include <app/drivers/blink.h>
+#include <app/lib/appconfig.h>
+#include <app/lib/inference.h>
+#include <app/lib/pipeline.h>
+#include <app/lib/timesync.h>
+#include <app/lib/tracepoints.h>
+#include <app/lib/uplink.h>
 
 #include "wifi.h"
-#include "ei_config.h"
+#include "model.h"
+#include "sim.h"
 
 /* Devicetree aliases from overlay */
-#define LED0_NODE DT_ALIAS(led0)
+#define BLINK0_NODE DT_ALIAS(blink0)
 #define SW0_NODE  DT_ALIAS(sw0)
 #define THS0_NODE DT_ALIAS(ths0)
 
-#if !DT_NODE_HAS_STATUS(LED0_NODE, okay)
-#error "No alias 'led0' in devicetree; check overlay."
+#if !DT_NODE_HAS_STATUS(BLINK0_NODE, okay)
+#error "No alias 'blink0' in devicetree; check overlay."
 #endif
 
 #if !DT_NODE_HAS_STATUS(SW0_NODE, okay)
@@ -28,65 +35,106 @@
 #error "No alias 'ths0' in devicetree; check overlay."
 #endif
 
-static const struct gpio_dt_spec led =
-    GPIO_DT_SPEC_GET(LED0_NODE, gpios);
+static const struct device *const status_led =
+    DEVICE_DT_GET(BLINK0_NODE);
 
 static const struct gpio_dt_spec button =
     GPIO_DT_SPEC_GET(SW0_NODE, gpios);
 
-static const struct device *const ths_dev =
-    DEVICE_DT_GET(THS0_NODE);
+static struct gpio_callback button_cb;
 
 /* --------------------------------------------------------------------------
  * Sampling / upload configuration
  * -------------------------------------------------------------------------- */
 
-/* Sampling settings.
- * One sample per upload; sampling interval defines samples/hour.
- * With the current interval this yields ~10 uploads per hour.
+/* Flat samples per doubling of the sampling period */
+#define SAMPLE_HOLD               4
+
+/* Held by change detection: samples from before a change, the window
+ * after it and a summary, plus the sample being acquired.
  */
-#define SAMPLES_PER_HOUR          1
-#define SAMPLE_INTERVAL_MS        (360U * 1000U)    /* 6 minutes */
-
-/* Edge Impulse ingestion endpoint (HTTP) */
-#define EI_INGEST_HOST            "ingestion.edgeimpulse.com"
-#define EI_INGEST_PORT            "80"
-#define EI_INGEST_PATH            "/api/training/data"
-#define EI_DEVICE_NAME            "esp32s3-zephyr"
-#define EI_DEVICE_TYPE            "ESP32S3"
+#define SAMPLE_BUFS               (CONFIG_PIPELINE_CHANGEDET_MAX_PRE + 1 + \
+                                   CONFIG_PIPELINE_CHANGEDET_POST + 2)
 
-struct sample_entry {
-    uint32_t t_ms;
-    double   temp_c;
-    double   hum_pct;
+#define EI_DEVICE_TYPE            "ESP32S3"
+#define EI_DEVICE_NAME_SIZE       32
+#define EI_API_KEY_SIZE           80
+
+/* Runtime configuration, saved to flash and editable from the shell:
+ *   appconfig show ei
+ *   appconfig set ei sample_max_ms 600000
+ *
+ * Sampling starts at sample_ms. The period then follows the signal: down
+ * to sample_min_ms while temperature or humidity move by more than the
+ * thresholds below, doubling up to sample_max_ms while they are flat.
+ * Only windows of "window" samples after changes are uploaded at full
+ * resolution; quiet stretches go up as one averaged sample every
+ * "heartbeat" samples. Uploads go to host:port/path as device_name, and
+ * with CONFIG_APP_INFERENCE the results of classified windows to
+ * result_path on the same host, with the same API key.
+ * Every change applies at once, WiFi credentials by reconnecting.
+ */
+static struct appconfig_entry ei_entries[] = {
+    APPCONFIG_UINT("sample_ms", 60U * 1000U, 1000U, 3600U * 1000U),
+    APPCONFIG_UINT("sample_min_ms", 10U * 1000U, 1000U, 3600U * 1000U),
+    APPCONFIG_UINT("sample_max_ms", 180U * 1000U, 1000U, 3600U * 1000U),
+    APPCONFIG_UINT("window", CONFIG_PIPELINE_CHANGEDET_POST, 1,
+                   CONFIG_PIPELINE_CHANGEDET_POST),
+    APPCONFIG_UINT("heartbeat", CONFIG_PIPELINE_CHANGEDET_HEARTBEAT, 1,
+                   UINT16_MAX),
+    APPCONFIG_STRING("host", UPLINK_HOST_MAX_LEN + 1, CONFIG_UPLINK_HOST, 0),
+    APPCONFIG_UINT("port", CONFIG_UPLINK_PORT, 1, UINT16_MAX),
+    APPCONFIG_STRING("path", UPLINK_PATH_MAX_LEN + 1, UPLINK_PATH_DEFAULT,
+                     0),
+#ifdef CONFIG_APP_INFERENCE
+    APPCONFIG_STRING("result_path", UPLINK_PATH_MAX_LEN + 1,
+                     CONFIG_APP_RESULT_PATH, 0),
+#endif
+    APPCONFIG_STRING("device_name", EI_DEVICE_NAME_SIZE, "esp32s3-zephyr",
+                     0),
+    APPCONFIG_STRING("api_key", EI_API_KEY_SIZE, CONFIG_APP_EI_API_KEY,
+                     APPCONFIG_SECRET),
+    APPCONFIG_STRING("wifi_ssid", 33, CONFIG_APP_WIFI_SSID, 0),
+    APPCONFIG_STRING("wifi_psk", 65, CONFIG_APP_WIFI_PSK, APPCONFIG_SECRET),
 };
 
-static struct sample_entry samples[SAMPLES_PER_HOUR];
-static int sample_count = 0;
+static void config_changed(struct appconfig *cfg,
+                           const struct appconfig_entry *entry,
+                           void *user_data);
+
+static struct appconfig ei_config =
+    APPCONFIG_INITIALIZER("ei", ei_entries, config_changed, NULL);
 
-/* HTTP buffers kept static to avoid large stack frames */
-static char ei_body[2048];
-static char ei_req[4096];
+static uint32_t config_uint(const char *name)
+{
+    uint32_t value = 0;
+
+    (void)appconfig_get_uint(&ei_config, name, &value);
+    return value;
+}
+
+/* Room for the HTTP headers at the end of an upload payload */
+#define EI_HEADERS_SIZE           256
 
 /* --------------------------------------------------------------------------
  * Label + JSON builder
  * -------------------------------------------------------------------------- */
 
-static void make_label(char *buf, size_t len)
+static void make_label(char *buf, size_t len, int64_t epoch_ms)
 {
-    time_t now = time(NULL);
+    time_t now = (time_t)(epoch_ms / 1000);
     struct tm tm_buf;
     struct tm *tm = NULL;
 
-    if (now != (time_t)-1) {
+    if (epoch_ms > 0) {
         tm = gmtime_r(&now, &tm_buf);
     }
 
-    /* If RTC time is not set (e.g. still 1970),
-     * fall back to an uptime-based session label.
+    /* If the clock was never synchronized, fall back to an uptime-based
+     * session label.
      */
-    if (!tm || (tm->tm_year + 1900) < 2020) {
-        uint32_t up_s = k_uptime_get_32() / 1000U;
+    if (!tm) {
+        uint32_t up_s = (uint32_t)(k_uptime_get() / 1000);
         snprintk(buf, len, "esp32s3_session_%u", up_s);
         return;
     }
@@ -109,26 +157,59 @@ static void make_label(char *buf, size_t len)
              tm->tm_sec);
 }
 
+/* --------------------------------------------------------------------------
+ * Status LED patterns, played by the blink driver without blocking
+ * -------------------------------------------------------------------------- */
+
+/* Startup: two 1 s flashes */
+static const struct blink_step startup_steps[] = {
+    { .on_ms = 1000, .off_ms = 1000, .count = 2 },
+};
+
+/* Idle: LED steadily on while *not* sampling */
+static const struct blink_step idle_steps[] = {
+    { .on_ms = 1000, .off_ms = 0, .count = 1 },
+};
+
+/* Upload done: one quick flash, then back to off (sampling) */
+static const struct blink_step uploaded_steps[] = {
+    { .on_ms = 200, .off_ms = 0, .count = 1 },
+};
+
+static void show_status(const struct blink_step *steps, uint8_t num_steps,
+                        uint8_t repeat)
+{
+    const struct blink_pattern pattern = {
+        .steps = steps,
+        .num_steps = num_steps,
+        .repeat = repeat,
+    };
+
+    (void)blink_set_pattern(status_led, &pattern);
+}
+
 static void flash_led_quick(void)
 {
-    gpio_pin_set_dt(&led, 1);
-    k_sleep(K_MSEC(200));
-    gpio_pin_set_dt(&led, 0);
+    show_status(uploaded_steps, ARRAY_SIZE(uploaded_steps), 1);
 }
 
 static int build_ei_json(char *out, size_t out_size,
-                         const struct sample_entry *buf,
-                         int count)
+                         struct net_buf *samples, uint32_t interval_ms)
 {
+    char device_name[EI_DEVICE_NAME_SIZE];
     int len = 0;
     int rem = (int)out_size;
 
+    (void)appconfig_get_string(&ei_config, "device_name", device_name,
+                               sizeof(device_name));
+
+    /* Issued at the first sample, 0 if the clock is not synchronized */
     len = snprintk(out, rem,
                    "{"
                    "\"protected\":{"
                      "\"ver\":\"v1\","
                      "\"alg\":\"none\","
-                     "\"iat\":0"
+                     "\"iat\":%lld"
                    "},"
                    "\"signature\":\"0\","
                    "\"payload\":{"
@@ -140,20 +221,22 @@ static int build_ei_json(char *out, size_t out_size,
                        "{\"name\":\"hum\",\"units\":\"%%\"}"
                      "],"
                      "\"values\":[",
-                   EI_DEVICE_NAME,
+                   (long long)(pipeline_sample(samples)->epoch_ms / 1000),
+                   device_name,
                    EI_DEVICE_TYPE,
-                   SAMPLE_INTERVAL_MS);
+                   interval_ms);
     if (len < 0 || len >= rem) {
         return -1;
     }
     rem -= len;
 
-    for (int i = 0; i < count; i++) {
+    for (struct net_buf *frag = samples; frag != NULL; frag = frag->frags) {
+        const struct pipeline_sample *sample = pipeline_sample(frag);
         int n = snprintk(out + len, rem,
                          "[%.5f,%.5f]%s",
-                         buf[i].temp_c,
-                         buf[i].hum_pct,
-                         (i == count - 1) ? "" : ",");
+                         sensor_value_to_double(&sample->values[0]),
+                         sensor_value_to_double(&sample->values[1]),
+                         (frag->frags == NULL) ? "" : ",");
         if (n < 0 || n >= rem) {
             return -1;
         }
@@ -169,239 +252,515 @@ static int build_ei_json(char *out, size_t out_size,
     return len;
 }
 
-static int upload_to_edge_impulse(const struct sample_entry *buf,
-                                  int count,
-                                  const char *label)
+static int upload_to_edge_impulse(struct net_buf *samples,
+                                  const char *label, uint32_t interval_ms)
 {
-    printk("Uploading %d samples to Edge Impulse with label '%s'\n",
-           count, label);
+    char api_key[EI_API_KEY_SIZE];
+    int count = 0;
+
+    for (struct net_buf *frag = samples; frag != NULL; frag = frag->frags) {
+        count++;
+    }
+
+    printk("Uploading %d samples to Edge Impulse with label '%s' (%s)\n",
+           count, label, uplink_backend_name());
+
+    /* Body and headers are encoded once, into a buffer from the slab */
+    struct pipeline_payload *payload = pipeline_payload_alloc(K_SECONDS(1));
+    if (payload == NULL) {
+        printk("No upload buffer available\n");
+        return -ENOMEM;
+    }
 
-    int body_len = build_ei_json(ei_body, sizeof(ei_body), buf, count);
+    char *body = (char *)payload->data;
+    tracepoint_begin("ei_encode", TRACEPOINT_ID(samples));
+    int body_len = build_ei_json(body, payload->size - EI_HEADERS_SIZE,
+                                 samples, interval_ms);
+    tracepoint_end("ei_encode", TRACEPOINT_ID(samples));
     if (body_len < 0) {
         printk("Failed to build JSON body\n");
+        pipeline_payload_unref(payload);
+        return -1;
+    }
+    payload->len = body_len;
+
+    /* Ingestion API metadata, only carried by the HTTP backend */
+    (void)appconfig_get_string(&ei_config, "api_key", api_key,
+                               sizeof(api_key));
+    char *headers = body + body_len + 1;
+    int hdr_len = snprintk(headers, payload->size - body_len - 1,
+                           "x-api-key: %s\r\n"
+                           "x-label: %s\r\n"
+                           "x-file-name: %s.json\r\n",
+                           api_key, label, label);
+    if (hdr_len < 0 || hdr_len >= (int)(payload->size - body_len - 1)) {
+        printk("Failed to build HTTP headers\n");
+        pipeline_payload_unref(payload);
         return -1;
     }
 
-    struct zsock_addrinfo hints;
-    struct zsock_addrinfo *res = NULL;
-    memset(&hints, 0, sizeof(hints));
+    struct uplink_msg msg = {
+        .label = label,
+        .payload = payload->data,
+        .len = payload->len,
+        .content_type = "application/json",
+        .headers = headers,
+    };
 
-    hints.ai_family   = AF_INET;
-    hints.ai_socktype = SOCK_STREAM;
+    int ret = uplink_send(&msg);
+    pipeline_payload_unref(payload);
+    if (ret < 0) {
+        printk("uplink_send() failed: %d\n", ret);
+        return ret;
+    }
 
-    int err = zsock_getaddrinfo(EI_INGEST_HOST, EI_INGEST_PORT,
-                                &hints, &res);
-    if (err != 0 || res == NULL) {
-        printk("zsock_getaddrinfo failed: %d\n", err);
-        if (res) {
-            zsock_freeaddrinfo(res);
-        }
-        return -1;
+    struct uplink_stats st;
+    uplink_stats_get(&st);
+    printk("Uplink: %u sent, %u acked, %u failed, wire tx %llu rx %llu, "
+           "last latency %u ms\n",
+           st.sent, st.acked, st.failed, st.wire_tx_bytes, st.wire_rx_bytes,
+           st.last_latency_ms);
+
+    struct pipeline_payload_stats ps;
+    pipeline_payload_stats_get(&ps);
+    printk("Payloads: %u of %u in use, high-water %u, %u allocation "
+           "failures\n", ps.used, ps.count, ps.max_used, ps.failures);
+
+    return 0;
+}
+
+#ifdef CONFIG_APP_INFERENCE
+/* A few hundred bytes in place of the window's samples */
+static int upload_result(struct net_buf *samples, const char *label)
+{
+    char device_name[EI_DEVICE_NAME_SIZE];
+    char api_key[EI_API_KEY_SIZE];
+    char path[UPLINK_PATH_MAX_LEN + 1];
+    struct inference_result result;
+    int ret;
+
+    ret = inference_classify(samples, &result);
+    if (ret < 0) {
+        printk("Classification failed: %d\n", ret);
+        return ret;
     }
 
-    int sock = zsock_socket(res->ai_family, res->ai_socktype, res->ai_protocol);
-    if (sock < 0) {
-        printk("zsock_socket() failed: %d\n", errno);
-        zsock_freeaddrinfo(res);
-        return -1;
+    printk("Window '%s': %s (%u/1000) over %u samples in %u us\n",
+           label, result.label, result.score, result.samples,
+           result.latency_us);
+
+    struct pipeline_payload *payload = pipeline_payload_alloc(K_SECONDS(1));
+    if (payload == NULL) {
+        printk("No upload buffer available\n");
+        return -ENOMEM;
     }
 
-    if (zsock_connect(sock, res->ai_addr, res->ai_addrlen) < 0) {
-        printk("zsock_connect() failed: %d\n", errno);
-        zsock_close(sock);
-        zsock_freeaddrinfo(res);
+    (void)appconfig_get_string(&ei_config, "device_name", device_name,
+                               sizeof(device_name));
+    char *body = (char *)payload->data;
+    int len = snprintk(body, payload->size - EI_HEADERS_SIZE,
+                       "{"
+                       "\"device_name\":\"%s\","
+                       "\"iat\":%lld,"
+                       "\"window\":\"%s\","
+                       "\"class\":\"%s\","
+                       "\"score\":%u,"
+                       "\"samples\":%u,"
+                       "\"latency_us\":%u"
+                       "}",
+                       device_name,
+                       (long long)(pipeline_sample(samples)->epoch_ms / 1000),
+                       label, result.label, result.score, result.samples,
+                       result.latency_us);
+    if (len < 0 || len >= (int)(payload->size - EI_HEADERS_SIZE)) {
+        printk("Failed to build result\n");
+        pipeline_payload_unref(payload);
         return -1;
     }
-
-    zsock_freeaddrinfo(res);
-
-    int req_len = snprintk(ei_req, sizeof(ei_req),
-                           "POST " EI_INGEST_PATH " HTTP/1.1\r\n"
-                           "Host: " EI_INGEST_HOST "\r\n"
-                           "Connection: close\r\n"
-                           "x-api-key: " EI_API_KEY "\r\n"
-                           "x-label: %s\r\n"
-                           "x-file-name: %s.json\r\n"
-                           "Content-Type: application/json\r\n"
-                           "Content-Length: %d\r\n"
-                           "\r\n",
-                           label, label, body_len);
-    if (req_len < 0 || req_len >= (int)sizeof(ei_req)) {
+    payload->len = len;
+
+    /* Results have an endpoint of their own, behind the same API key */
+    (void)appconfig_get_string(&ei_config, "api_key", api_key,
+                               sizeof(api_key));
+    (void)appconfig_get_string(&ei_config, "result_path", path,
+                               sizeof(path));
+    char *headers = body + len + 1;
+    int hdr_len = snprintk(headers, payload->size - len - 1,
+                           "x-api-key: %s\r\n"
+                           "x-label: %s\r\n",
+                           api_key, label);
+    if (hdr_len < 0 || hdr_len >= (int)(payload->size - len - 1)) {
         printk("Failed to build HTTP headers\n");
-        zsock_close(sock);
+        pipeline_payload_unref(payload);
         return -1;
     }
 
-    int sent = zsock_send(sock, ei_req, req_len, 0);
-    if (sent != req_len) {
-        printk("Failed to send HTTP headers (sent=%d, expected=%d)\n",
-               sent, req_len);
-        zsock_close(sock);
-        return -1;
-    }
+    struct uplink_msg msg = {
+        .label = label,
+        .payload = payload->data,
+        .len = payload->len,
+        .content_type = "application/json",
+        .headers = headers,
+        .path = path,
+    };
 
-    sent = zsock_send(sock, ei_body, body_len, 0);
-    if (sent != body_len) {
-        printk("Failed to send HTTP body (sent=%d, expected=%d)\n",
-               sent, body_len);
-        zsock_close(sock);
-        return -1;
+    ret = uplink_send(&msg);
+    pipeline_payload_unref(payload);
+    if (ret < 0) {
+        printk("uplink_send() failed: %d\n", ret);
     }
 
-    char resp[256];
-    int r;
+    return ret;
+}
+#endif /* CONFIG_APP_INFERENCE */
+
+/* --------------------------------------------------------------------------
+ * Sampling pipeline: SHT40 every interval, changes and heartbeats uploaded
+ * -------------------------------------------------------------------------- */
+
+static const enum sensor_channel ths_channels[] = {
+    SENSOR_CHAN_AMBIENT_TEMP,
+    SENSOR_CHAN_HUMIDITY,
+};
+
+/* Changes worth sampling faster for: 0.2 C and 1 %RH, in milli-units */
+static const int32_t ths_thresholds[] = { 200, 1000 };
 
-    while ((r = zsock_recv(sock, resp, sizeof(resp) - 1, 0)) > 0) {
-        resp[r] = '\0';
-        printk("EI chunk: %s\n", resp);
+/* Periods set from the configuration before the pipeline starts */
+static struct pipeline_adaptive ths_rate = PIPELINE_ADAPTIVE_INITIALIZER(
+    1000U, 3600U * 1000U, ths_thresholds, SAMPLE_HOLD);
+
+static struct pipeline_acquire ths = {
+    .sensor = DEVICE_DT_GET(THS0_NODE),
+    .channels = ths_channels,
+    .num_channels = ARRAY_SIZE(ths_channels),
+    .period_ms = 60U * 1000U,
+    .adaptive = &ths_rate,
+};
+
+/* Mean spacing of the samples of a window, which the period may vary over */
+static uint32_t window_interval_ms(struct net_buf *samples)
+{
+    const struct pipeline_sample *first = pipeline_sample(samples);
+    const struct pipeline_sample *last = first;
+    uint32_t count = 1;
+
+    for (struct net_buf *frag = samples->frags; frag; frag = frag->frags) {
+        last = pipeline_sample(frag);
+        count++;
     }
 
-    if (r <= 0) {
-        printk("EI recv completed with r=%d\n", r);
+    if (count < 2) {
+        return config_uint("sample_ms");
     }
 
-    zsock_close(sock);
+    return (uint32_t)((last->timestamp_ms - first->timestamp_ms) /
+                      (count - 1));
+}
+
+static int print_sample(struct net_buf *samples, void *user_data)
+{
+    const struct pipeline_sample *sample = pipeline_sample(samples);
+
+    ARG_UNUSED(user_data);
+
+    printk("Sample: T=%.2f C, RH=%.2f %%\n",
+           sensor_value_to_double(&sample->values[0]),
+           sensor_value_to_double(&sample->values[1]));
+
     return 0;
 }
 
+static struct pipeline_changedet changes = PIPELINE_CHANGEDET_INITIALIZER();
+
+static int upload_batch(struct net_buf *samples, void *user_data)
+{
+    const struct pipeline_sample *first = pipeline_sample(samples);
+    uint32_t interval_ms = window_interval_ms(samples);
+    char label[64];
+    int ret;
+
+    ARG_UNUSED(user_data);
+
+    /* Labelled with the time of the first sample of the window */
+    make_label(label, sizeof(label), first->epoch_ms);
+
+    /* A heartbeat is one sample averaged over the quiet stretch, taken
+     * at the slowest period once the signal has settled
+     */
+    if (first->flags & PIPELINE_SAMPLE_SUMMARY) {
+        struct pipeline_changedet_params params;
+        struct pipeline_adaptive_stats rate;
+
+        pipeline_changedet_params_get(&changes, &params);
+        pipeline_adaptive_stats_get(&ths_rate, &rate);
+        interval_ms = rate.period_ms * params.heartbeat;
+        strncat(label, "_heartbeat", sizeof(label) - strlen(label) - 1);
+    }
+
+#ifdef CONFIG_APP_INFERENCE
+    /* Windows are classified here, only the result goes up */
+    if (!(first->flags & PIPELINE_SAMPLE_SUMMARY)) {
+        tracepoint_begin("ei_result", TRACEPOINT_ID(samples));
+        sim_upload_begin();
+        ret = upload_result(samples, label);
+        sim_upload_end(samples, ret);
+        tracepoint_end("ei_result", TRACEPOINT_ID(samples));
+        printk("Result upload done (ret=%d), label='%s'\n", ret, label);
+        flash_led_quick();
+        return ret;
+    }
+#endif
+
+    /* Encoding and sending, the tail of the path traced from acquire */
+    tracepoint_begin("ei_upload", TRACEPOINT_ID(samples));
+    sim_upload_begin();
+    ret = upload_to_edge_impulse(samples, label, interval_ms);
+    sim_upload_end(samples, ret);
+    tracepoint_end("ei_upload", TRACEPOINT_ID(samples));
+
+    printk("Upload done (ret=%d), label='%s'\n", ret, label);
+
+    flash_led_quick();
+
+    return ret;
+}
+
+static struct pipeline_sink console =
+    PIPELINE_SINK_INITIALIZER(print_sample, NULL);
+static struct pipeline_sink uploader =
+    PIPELINE_SINK_INITIALIZER(upload_batch, NULL);
+
+PIPELINE_DEFINE(ei_pipeline, SAMPLE_BUFS, &ths,
+                &console.stage, &changes.stage, &uploader.stage);
+
 /* --------------------------------------------------------------------------
- * Main
+ * Runtime configuration: applied at boot, then on every change
  * -------------------------------------------------------------------------- */
 
-int main(void)
+/* Given when the WiFi credentials change; main() reconnects */
+static K_SEM_DEFINE(wifi_changed, 0, 1);
+
+/* A new sample_ms restarts from it; new bounds only clamp the period */
+static void apply_rate(bool restart)
 {
-    int ret;
+    struct pipeline_adaptive_stats rate;
+    uint32_t period_ms = config_uint("sample_ms");
 
-    printk("Edge Impulse ESP32S3 temp/humidity logger starting\n");
+    if (pipeline_adaptive_bounds_set(&ths_rate, config_uint("sample_min_ms"),
+                                     config_uint("sample_max_ms")) < 0) {
+        printk("sample_min_ms is above sample_max_ms, periods unchanged\n");
+        return;
+    }
 
-    if (!device_is_ready(led.port) ||
-        !device_is_ready(button.port) ||
-        !device_is_ready(ths_dev)) {
-        printk("Devices not ready\n");
-        return 0;
+    pipeline_adaptive_stats_get(&ths_rate, &rate);
+    if (!restart && rate.period_ms > 0) {
+        period_ms = rate.period_ms;
     }
 
-    ret = gpio_pin_configure_dt(&led, GPIO_OUTPUT_INACTIVE);
-    if (ret != 0) {
-        printk("Failed to configure LED: %d\n", ret);
-        return 0;
+    (void)pipeline_period_set(&ei_pipeline, period_ms);
+}
+
+static void apply_changedet(void)
+{
+    struct pipeline_changedet_params params;
+
+    pipeline_changedet_params_get(&changes, &params);
+    params.post = config_uint("window");
+    params.heartbeat = config_uint("heartbeat");
+    (void)pipeline_changedet_params_set(&changes, &params);
+}
+
+static void apply_peer(void)
+{
+    struct uplink_peer peer = { .port = config_uint("port") };
+
+    (void)appconfig_get_string(&ei_config, "host", peer.host,
+                               sizeof(peer.host));
+    (void)appconfig_get_string(&ei_config, "path", peer.path,
+                               sizeof(peer.path));
+
+    if (uplink_peer_set(&peer) < 0) {
+        printk("Invalid uplink peer '%s:%u', keeping the previous one\n",
+               peer.host, peer.port);
     }
+}
 
-    ret = gpio_pin_configure_dt(&button, GPIO_INPUT);
-    if (ret != 0) {
-        printk("Failed to configure button: %d\n", ret);
-        return 0;
+static void config_changed(struct appconfig *cfg,
+                           const struct appconfig_entry *entry,
+                           void *user_data)
+{
+    const char *name = entry->name;
+
+    ARG_UNUSED(cfg);
+    ARG_UNUSED(user_data);
+
+    printk("Configuration: %s changed\n", name);
+
+    /* device_name and api_key are read at every upload */
+    if (strcmp(name, "sample_ms") == 0) {
+        apply_rate(true);
+    } else if (strncmp(name, "sample_", 7) == 0) {
+        apply_rate(false);
+    } else if (strcmp(name, "window") == 0 ||
+               strcmp(name, "heartbeat") == 0) {
+        apply_changedet();
+    } else if (strcmp(name, "host") == 0 || strcmp(name, "port") == 0 ||
+               strcmp(name, "path") == 0) {
+        apply_peer();
+    } else if (strncmp(name, "wifi_", 5) == 0) {
+        k_sem_give(&wifi_changed);
     }
+}
+
+/* --------------------------------------------------------------------------
+ * Button: toggles sampling, debounced off the interrupt
+ * -------------------------------------------------------------------------- */
 
-    /* Startup indication: flash LED twice */
-    gpio_pin_set_dt(&led, 1);
-    k_sleep(K_SECONDS(1));
-    gpio_pin_set_dt(&led, 0);
-    k_sleep(K_SECONDS(1));
-    gpio_pin_set_dt(&led, 1);
-    k_sleep(K_SECONDS(1));
-    gpio_pin_set_dt(&led, 0);
+#define BUTTON_DEBOUNCE_MS 50
 
-    /* Idle state: LED ON when *not* sampling */
-    gpio_pin_set_dt(&led, 1);
+static void button_work_handler(struct k_work *work)
+{
+    ARG_UNUSED(work);
 
-    /* Bring up Wi-Fi using your known-good helpers, but don’t block the app forever */
-    wifi_init();
-    printk("Connecting to WiFi SSID='%s'...\n", WIFI_SSID);
-    ret = wifi_connect(WIFI_SSID, WIFI_PASS);
+    if (gpio_pin_get_dt(&button) != 1) {
+        return;
+    }
+
+    if (pipeline_start(&ei_pipeline) == 0) {
+        blink_off(status_led);  /* LED off while sampling */
+        printk("Sampling started (button)\n");
+    } else {
+        /* Uploads whatever was sampled so far */
+        (void)pipeline_stop(&ei_pipeline);
+        /* LED on when stopped */
+        show_status(idle_steps, ARRAY_SIZE(idle_steps),
+                    BLINK_PATTERN_FOREVER);
+        printk("Sampling stopped (button)\n");
+    }
+}
+
+static K_WORK_DELAYABLE_DEFINE(button_work, button_work_handler);
+
+static void button_pressed(const struct device *port, struct gpio_callback *cb,
+                           gpio_port_pins_t pins)
+{
+    ARG_UNUSED(port);
+    ARG_UNUSED(cb);
+    ARG_UNUSED(pins);
+
+    k_work_reschedule(&button_work, K_MSEC(BUTTON_DEBOUNCE_MS));
+}
+
+/* --------------------------------------------------------------------------
+ * Main
+ * -------------------------------------------------------------------------- */
+
+/* Join the configured network, then sync the clock and open the uplink */
+static void connect_network(void)
+{
+    char ssid[33];
+    char psk[65];
+    int ret;
+
+    (void)appconfig_get_string(&ei_config, "wifi_ssid", ssid, sizeof(ssid));
+    (void)appconfig_get_string(&ei_config, "wifi_psk", psk, sizeof(psk));
+
+    if (ssid[0] == '\0') {
+        printk("No WiFi network set, use \"appconfig set ei wifi_ssid\"\n");
+        return;
+    }
+
+    printk("Connecting to WiFi SSID='%s'...\n", ssid);
+    ret = wifi_connect(ssid, psk);
     if (ret < 0) {
         printk("WiFi connection failed (%d), uploads will fail but sampling will still run\n", ret);
-    } else {
-        printk("WiFi connect() returned %d, waiting for IP...\n", ret);
-        wifi_wait_for_ip_addr();
-        printk("WiFi ready, continuing.\n");
-        printk("Sampling will auto-start; button toggles on/off.\n");
-    }
-
-    bool last_pressed = false;
-    bool sampling_enabled = true;   /* auto-start sampling for bring-up */
-    uint32_t last_sample_ms = 0;
-
-    while (1) {
-        int val = gpio_pin_get_dt(&button);
-        if (val >= 0) {
-            bool pressed = (val == 0); /* active low */
-
-            if (pressed && !last_pressed) {
-                printk("Button press edge detected (sampling=%d)\n",
-                       sampling_enabled ? 1 : 0);
-
-                if (!sampling_enabled) {
-                    sampling_enabled = true;
-                    sample_count = 0;
-                    last_sample_ms = k_uptime_get_32();
-                    gpio_pin_set_dt(&led, 0);  /* LED off while sampling */
-                    printk("Sampling started (button)\n");
-                } else {
-                    sampling_enabled = false;
-                    gpio_pin_set_dt(&led, 1);  /* LED on when stopped */
-                    printk("Sampling stopped (button)\n");
-                }
-            }
-
-            last_pressed = pressed;
-        }
+        return;
+    }
 
-        if (sampling_enabled) {
-            uint32_t now_ms = k_uptime_get_32();
+    printk("WiFi connect() returned %d, waiting for IP...\n", ret);
+    wifi_wait_for_ip_addr();
+    printk("WiFi ready, continuing.\n");
 
-            /* Take a sample only once per interval */
-            if ((now_ms - last_sample_ms) >= SAMPLE_INTERVAL_MS) {
+    /* Keeps syncing in the background if the first query fails */
+    ret = timesync_start(K_SECONDS(5));
+    if (ret < 0) {
+        printk("Time sync failed (%d), labels fall back to uptime\n",
+               ret);
+    }
 
-                struct sensor_value temp, hum;
+    ret = uplink_connect();
+    if (ret < 0) {
+        printk("Uplink connect failed (%d), will retry on upload\n", ret);
+    }
+}
 
-                ret = sensor_sample_fetch(ths_dev);
-                if (ret == 0) {
-                    ret = sensor_channel_get(ths_dev,
-                                             SENSOR_CHAN_AMBIENT_TEMP,
-                                             &temp);
-                }
-                if (ret == 0) {
-                    ret = sensor_channel_get(ths_dev,
-                                             SENSOR_CHAN_HUMIDITY,
-                                             &hum);
-                }
+int main(void)
+{
+    int ret;
 
-                if (ret == 0 && sample_count < SAMPLES_PER_HOUR) {
-                    double temp_c = sensor_value_to_double(&temp);
-                    double hum_pct = sensor_value_to_double(&hum);
+    printk("Edge Impulse ESP32S3 temp/humidity logger starting\n");
 
-                    samples[sample_count].t_ms    = now_ms;
-                    samples[sample_count].temp_c  = temp_c;
-                    samples[sample_count].hum_pct = hum_pct;
-                    sample_count++;
+    if (!device_is_ready(status_led) ||
+        !device_is_ready(button.port)) {
+        printk("Devices not ready\n");
+        return 0;
+    }
 
-                    last_sample_ms = now_ms;
+    ret = gpio_pin_configure_dt(&button, GPIO_INPUT);
+    if (ret == 0) {
+        gpio_init_callback(&button_cb, button_pressed, BIT(button.pin));
+        ret = gpio_add_callback_dt(&button, &button_cb);
+    }
+    if (ret == 0) {
+        ret = gpio_pin_interrupt_configure_dt(&button, GPIO_INT_EDGE_TO_ACTIVE);
+    }
+    if (ret != 0) {
+        printk("Failed to configure button: %d\n", ret);
+        return 0;
+    }
 
-                    printk("Sample %d: T=%.2f C, RH=%.2f %%\n",
-                           sample_count, temp_c, hum_pct);
-                }
+    /* Startup indication: flash LED twice while WiFi comes up */
+    show_status(startup_steps, ARRAY_SIZE(startup_steps), 1);
 
-                if (sample_count >= SAMPLES_PER_HOUR) {
-                    char label[64];
-                    make_label(label, sizeof(label));
+    /* Saved configuration, or the defaults on first boot */
+    ret = appconfig_register(&ei_config);
+    if (ret < 0) {
+        printk("Configuration not loaded (%d), using defaults\n", ret);
+    }
+    apply_rate(true);
+    apply_changedet();
+    apply_peer();
 
-                    int up_ret = upload_to_edge_impulse(samples,
-                                                        sample_count,
-                                                        label);
+    /* Bring up Wi-Fi using your known-good helpers, but don’t block the app forever */
+    wifi_init();
+    connect_network();
+    printk("Sampling will auto-start; button toggles on/off.\n");
 
-                    printk("Upload done (ret=%d), label='%s'\n",
-                           up_ret, label);
+#ifdef CONFIG_INFERENCE
+    ret = inference_model_set(&room_model);
+    if (ret < 0) {
+        printk("Invalid model: %d\n", ret);
+        return 0;
+    }
+#endif
 
-                    flash_led_quick();
+    /* auto-start sampling for bring-up */
+    ret = pipeline_start(&ei_pipeline);
+    if (ret != 0) {
+        printk("Failed to start sampling: %d\n", ret);
+        return 0;
+    }
 
-                    sample_count = 0;
-                    last_sample_ms = k_uptime_get_32();
-                }
-            }
-        }
+    blink_off(status_led);  /* LED off while sampling */
 
-        k_msleep(100);
+    /* Sampling and uploads carry on in the pipeline; new WiFi
+     * credentials take a reconnection, done here
+     */
+    while (true) {
+        k_sem_take(&wifi_changed, K_FOREVER);
+        (void)wifi_disconnect();
+        connect_network();
     }
 
     return 0;
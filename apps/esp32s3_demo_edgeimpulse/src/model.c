@@ -0,0 +1,51 @@
+#include <app/lib/inference.h>
+
+#include "model.h"
+
+#ifdef CONFIG_INFERENCE_BACKEND_CENTROID
+
+/* Features of a change window (4 samples before the change, 8 after, one a
+ * minute), in thousandths: temperature change and range, then humidity
+ * change and range. Hand-set to the typical shape of each event: 81% of
+ * the windows of tests/lib/inference right, against 96% for the trained
+ * model of the TFLite Micro backend run with numpy.
+ */
+static const struct inference_class room_classes[] = {
+    { "steady",  {     0,   100,      0,   300 } },
+    { "heating", {  2200,  2200,  -2000,  2000 } },
+    { "cooling", { -2200,  2200,   2000,  2000 } },
+    { "airing",  {  -500,  1800,   1000,  5500 } },
+    { "shower",  {   600,   600,  20000, 20000 } },
+};
+
+static const int32_t room_scale[] = { 700, 700, 2500, 2500 };
+
+const struct inference_model room_model = {
+    .num_values = 2,
+    .scale = room_scale,
+    .classes = room_classes,
+    .num_classes = ARRAY_SIZE(room_classes),
+};
+
+#elif defined(CONFIG_INFERENCE_BACKEND_TFLM)
+
+/* In the order of the model outputs, as in scripts/room_model.py */
+static const char *const room_labels[] = {
+    "steady", "heating", "cooling", "airing", "shower",
+};
+
+/* 13 samples of temperature and humidity, 16 ReLU units, softmax: written
+ * by scripts/room_model.py from synthetic windows of each event
+ */
+static const uint8_t room_tflite[] __aligned(16) = {
+#include "room.tflite.inc"
+};
+
+const struct inference_model room_model = {
+    .tflite = room_tflite,
+    .num_values = 2,
+    .labels = room_labels,
+    .num_labels = ARRAY_SIZE(room_labels),
+};
+
+#endif
@@ -0,0 +1,11 @@
+#ifndef MODEL_H_
+#define MODEL_H_
+
+#include <app/lib/inference.h>
+
+#ifdef CONFIG_INFERENCE
+/* Events seen around a change in a room, for the backend compiled in */
+extern const struct inference_model room_model;
+#endif
+
+#endif // MODEL_H_
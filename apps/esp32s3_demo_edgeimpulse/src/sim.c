@@ -0,0 +1,318 @@
+/*
+ * Simulation of the logger on native_sim, for CONFIG_APP_SIM.
+ *
+ * The SHT40 is an SHT4x on the I2C emulator, measuring the levels of a
+ * trace (sim/sim.cmake) interpolated every CONFIG_APP_SIM_STEP_S. Sockets
+ * are offloaded to the host, where scripts/ei_ingestion_mock.py stands in
+ * for the ingestion API. Simulated time runs CONFIG_APP_SIM_SPEEDUP times
+ * faster than the host's, except during uploads: those take host time, and
+ * network timeouts would expire before any answer could arrive. After
+ * CONFIG_APP_SIM_DAYS the pipeline is stopped, what it held is uploaded,
+ * and a report of throughput, latency and loss ends the run.
+ *
+ * Settings are erased at boot, and the emulator's noise is seeded, so
+ * every run samples the same values and takes the same decisions; only
+ * the times of uploads vary with the host.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/init.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/printk.h>
+
+#include <app/drivers/sensor/sht4x_group.h>
+#include <app/lib/pipeline.h>
+#include <app/lib/uplink.h>
+
+/* native_sim: posix_exit() and the speed of simulated time */
+#include "posix_board_if.h"
+#include "timer_model.h"
+
+#include "sim.h"
+
+struct sim_point {
+    uint32_t time_s;
+    int32_t temp_milli;
+    int32_t hum_milli;
+};
+
+#include "sim_trace.h"
+
+#define SIM_DAY_S                 (24U * 3600U)
+#define SIM_TRACE_LEN             ARRAY_SIZE(sim_trace)
+#define SIM_TRACE_SPAN_S          (sim_trace[SIM_TRACE_LEN - 1].time_s - \
+                                   sim_trace[0].time_s)
+
+/* Room for the samples held at the end to be uploaded */
+#define SIM_DRAIN_POLL_MS         100
+#define SIM_DRAIN_POLLS           600
+
+/* sim_clock_bottom.c */
+uint64_t sim_host_clock_us_bottom(void);
+
+static const struct emul *const ths_emul = EMUL_DT_GET(DT_ALIAS(ths0));
+
+/* --------------------------------------------------------------------------
+ * Trace replay
+ * -------------------------------------------------------------------------- */
+
+/* Point the interpolation starts from, the trace being replayed in order */
+static size_t trace_pos;
+
+static int32_t interpolate(int32_t from, int32_t to, uint32_t num,
+                           uint32_t den)
+{
+    return from + (int32_t)(((int64_t)to - from) * num / den);
+}
+
+/* Levels at @p time_s from boot, the trace repeating if shorter */
+static void replay(uint32_t time_s)
+{
+    uint32_t t = sim_trace[0].time_s + time_s % SIM_TRACE_SPAN_S;
+
+    if (sim_trace[trace_pos].time_s > t) {
+        trace_pos = 0;
+    }
+    while (sim_trace[trace_pos + 1].time_s <= t) {
+        trace_pos++;
+    }
+
+    const struct sim_point *a = &sim_trace[trace_pos];
+    const struct sim_point *b = &sim_trace[trace_pos + 1];
+    uint32_t num = t - a->time_s;
+    uint32_t den = b->time_s - a->time_s;
+
+    sht4x_emul_set(ths_emul,
+                   interpolate(a->temp_milli, b->temp_milli, num, den),
+                   interpolate(a->hum_milli, b->hum_milli, num, den));
+}
+
+static void replay_step(struct k_timer *timer)
+{
+    ARG_UNUSED(timer);
+
+    replay((uint32_t)(k_uptime_get() / MSEC_PER_SEC));
+}
+
+static K_TIMER_DEFINE(replay_timer, replay_step, NULL);
+
+/* --------------------------------------------------------------------------
+ * Speed of simulated time
+ * -------------------------------------------------------------------------- */
+
+static struct k_spinlock speed_lock;
+static unsigned int network_users;
+
+/* Host time while any upload is on the network, accelerated otherwise */
+static void network_enter(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&speed_lock);
+
+    if (network_users++ == 0) {
+        hwtimer_set_rt_ratio(1.0);
+    }
+
+    k_spin_unlock(&speed_lock, key);
+}
+
+static void network_exit(void)
+{
+    k_spinlock_key_t key = k_spin_lock(&speed_lock);
+
+    if (--network_users == 0) {
+        hwtimer_set_rt_ratio(CONFIG_APP_SIM_SPEEDUP);
+    }
+
+    k_spin_unlock(&speed_lock, key);
+}
+
+/* --------------------------------------------------------------------------
+ * Uploads, as the sink sees them
+ * -------------------------------------------------------------------------- */
+
+static struct {
+    uint32_t uploads;
+    uint32_t failed;
+    uint32_t samples;
+    uint32_t samples_failed;
+    /* Sink to confirmation, in host time */
+    uint64_t total_upload_ms;
+    uint32_t max_upload_ms;
+    /* First sample of an upload to its confirmation, in simulated time */
+    uint64_t total_age_ms;
+    uint32_t max_age_ms;
+} counts;
+
+static int64_t upload_start_ms;
+
+void sim_upload_begin(void)
+{
+    network_enter();
+    upload_start_ms = k_uptime_get();
+}
+
+void sim_upload_end(struct net_buf *samples, int ret)
+{
+    uint32_t num = 0;
+
+    /* Confirmations of asynchronous backends are part of the upload */
+    if (ret == 0) {
+        ret = uplink_flush(K_MSEC(CONFIG_UPLINK_TIMEOUT_MS));
+    }
+
+    int64_t now = k_uptime_get();
+    uint32_t upload_ms = (uint32_t)(now - upload_start_ms);
+    uint32_t age_ms = (uint32_t)(now - pipeline_sample(samples)->timestamp_ms);
+
+    network_exit();
+
+    for (struct net_buf *frag = samples; frag != NULL; frag = frag->frags) {
+        num++;
+    }
+
+    if (ret < 0) {
+        counts.failed++;
+        counts.samples_failed += num;
+        return;
+    }
+
+    counts.uploads++;
+    counts.samples += num;
+    counts.total_upload_ms += upload_ms;
+    counts.max_upload_ms = MAX(counts.max_upload_ms, upload_ms);
+    counts.total_age_ms += age_ms;
+    counts.max_age_ms = MAX(counts.max_age_ms, age_ms);
+}
+
+/* --------------------------------------------------------------------------
+ * End of the run
+ * -------------------------------------------------------------------------- */
+
+static uint64_t host_start_us;
+
+static void stop_pipeline(struct pipeline *pipeline, void *user_data)
+{
+    ARG_UNUSED(user_data);
+
+    (void)pipeline_stop(pipeline);
+}
+
+static void add_stats(struct pipeline *pipeline, void *user_data)
+{
+    struct pipeline_stats *total = user_data;
+    struct pipeline_stats stats;
+
+    pipeline_stats_get(pipeline, &stats);
+    total->acquired += stats.acquired;
+    total->no_buf += stats.no_buf;
+    total->acquire_errors += stats.acquire_errors;
+    total->dropped += stats.dropped;
+    total->delivered += stats.delivered;
+    total->sink_errors += stats.sink_errors;
+    total->bufs_used += stats.bufs_used;
+}
+
+static void report(void)
+{
+    struct pipeline_stats ps = { 0 };
+    struct sht4x_emul_stats es;
+    struct uplink_stats us;
+    uint32_t days = CONFIG_APP_SIM_DAYS;
+    uint64_t host_ms = (sim_host_clock_us_bottom() - host_start_us) / 1000U;
+    uint32_t lost;
+
+    pipeline_foreach(add_stats, &ps);
+    sht4x_emul_stats_get(ths_emul, &es);
+    uplink_stats_get(&us);
+
+    /* Samples that never reached the ingestion API, whatever the cause */
+    lost = ps.no_buf + ps.acquire_errors + counts.samples_failed;
+
+    printk("SIM %u days in %llu.%03llu s of host time, %llux\n", days,
+           host_ms / 1000U, host_ms % 1000U,
+           (uint64_t)days * SIM_DAY_S * 1000U / MAX(host_ms, 1U));
+    printk("SIM sensor: %u conversions, %u bus bytes\n", es.measurements,
+           es.bus_bytes);
+    printk("SIM samples: %u acquired, %u summarized, %u uploaded, %u lost "
+           "(%u no buffer, %u read errors, %u in failed uploads)\n",
+           ps.acquired, ps.dropped, counts.samples, lost, ps.no_buf,
+           ps.acquire_errors, counts.samples_failed);
+    printk("SIM uploads: %u ok, %u failed; uplink %u sent, %u acked, "
+           "%u connects\n", counts.uploads, counts.failed, us.sent, us.acked,
+           us.connects);
+    printk("SIM throughput: %u uploads, %u samples, %llu payload bytes, "
+           "%llu wire bytes per day\n", counts.uploads / days,
+           counts.samples / days, us.payload_bytes / days,
+           (us.wire_tx_bytes + us.wire_rx_bytes) / days);
+    printk("SIM latency: upload mean %llu ms, max %u ms; "
+           "data age mean %llu s, max %u s\n",
+           counts.total_upload_ms / MAX(counts.uploads, 1U),
+           counts.max_upload_ms,
+           counts.total_age_ms / MAX(counts.uploads, 1U) / MSEC_PER_SEC,
+           counts.max_age_ms / MSEC_PER_SEC);
+    printk("SIM DONE: uploads=%u samples=%u failed=%u lost=%u\n",
+           counts.uploads, counts.samples, counts.failed, lost);
+}
+
+static void sim_thread(void *p1, void *p2, void *p3)
+{
+    struct pipeline_stats ps;
+
+    ARG_UNUSED(p1);
+    ARG_UNUSED(p2);
+    ARG_UNUSED(p3);
+
+    k_sleep(K_SECONDS((int64_t)CONFIG_APP_SIM_DAYS * SIM_DAY_S));
+    k_timer_stop(&replay_timer);
+
+    /* Held samples go up as the pipeline stops, as with the button */
+    pipeline_foreach(stop_pipeline, NULL);
+    for (int i = 0; i < SIM_DRAIN_POLLS; i++) {
+        ps = (struct pipeline_stats){ 0 };
+        pipeline_foreach(add_stats, &ps);
+        if (ps.bufs_used == 0) {
+            break;
+        }
+        k_msleep(SIM_DRAIN_POLL_MS);
+    }
+
+    report();
+    posix_exit(0);
+}
+
+K_THREAD_DEFINE(sim_tid, 2048, sim_thread, NULL, NULL, NULL,
+                K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+
+/* Before main(): defaults, the first levels, and full speed */
+static int sim_init(void)
+{
+    const struct flash_area *fa;
+    int ret;
+
+    ret = flash_area_open(FIXED_PARTITION_ID(storage_partition), &fa);
+    if (ret == 0) {
+        ret = flash_area_erase(fa, 0, fa->fa_size);
+        flash_area_close(fa);
+    }
+    if (ret < 0) {
+        printk("SIM: settings not erased (%d)\n", ret);
+    }
+
+    sht4x_emul_set_noise(ths_emul, CONFIG_APP_SIM_SEED);
+    replay(0);
+    k_timer_start(&replay_timer, K_SECONDS(CONFIG_APP_SIM_STEP_S),
+                  K_SECONDS(CONFIG_APP_SIM_STEP_S));
+
+    printk("SIM %u days of %s, %u points over %u s, at %ux\n",
+           CONFIG_APP_SIM_DAYS, CONFIG_APP_SIM_TRACE, (uint32_t)SIM_TRACE_LEN,
+           SIM_TRACE_SPAN_S, CONFIG_APP_SIM_SPEEDUP);
+
+    host_start_us = sim_host_clock_us_bottom();
+    hwtimer_set_rt_ratio(CONFIG_APP_SIM_SPEEDUP);
+
+    return 0;
+}
+
+SYS_INIT(sim_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
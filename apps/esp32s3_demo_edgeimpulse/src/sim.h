@@ -0,0 +1,25 @@
+#ifndef SIM_H_
+#define SIM_H_
+
+#include <zephyr/net/buf.h>
+
+#ifdef CONFIG_APP_SIM
+/* Around every upload of the sink, on native_sim: the network runs on host
+ * time, so simulated time slows down to it until the upload is done, which
+ * is then counted for the report.
+ */
+void sim_upload_begin(void);
+void sim_upload_end(struct net_buf *samples, int ret);
+#else
+static inline void sim_upload_begin(void)
+{
+}
+
+static inline void sim_upload_end(struct net_buf *samples, int ret)
+{
+    ARG_UNUSED(samples);
+    ARG_UNUSED(ret);
+}
+#endif
+
+#endif // SIM_H_
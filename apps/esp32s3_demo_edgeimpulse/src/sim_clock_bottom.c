@@ -0,0 +1,16 @@
+/*
+ * Host side of the simulation's wall clock, built into the native simulator
+ * runner with the host C library.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+uint64_t sim_host_clock_us_bottom(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
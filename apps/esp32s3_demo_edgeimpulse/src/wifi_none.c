@@ -0,0 +1,30 @@
+/*
+ * WiFi helpers for boards without WiFi: native_sim, where sockets go out
+ * through the host, and QEMU, whose Ethernet is up before main(). There is
+ * no network to join.
+ */
+
+#include <zephyr/kernel.h>
+
+#include "wifi.h"
+
+void wifi_init(void)
+{
+}
+
+int wifi_connect(char *ssid, char *psk)
+{
+    ARG_UNUSED(ssid);
+    ARG_UNUSED(psk);
+
+    return 0;
+}
+
+void wifi_wait_for_ip_addr(void)
+{
+}
+
+int wifi_disconnect(void)
+{
+    return 0;
+}
@@ -0,0 +1,95 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''Fixtures shared by the pytest harness scenarios of twister.
+
+The stand-in peers of scripts/ are started on the port the scenario's build
+points the device at, read from its .config: scenarios that can run side by
+side are given ports of their own with extra_configs. A stand-in is ready
+once it prints its "<name> listening on <bind>:<port>" line; one that exits
+before, e.g. because the port is taken, fails the test with its output.
+'''
+
+import re
+import subprocess
+import sys
+import threading
+from pathlib import Path
+
+import pytest
+
+SCRIPTS = Path(__file__).resolve().parent / 'scripts'
+LISTEN_TIMEOUT_S = 10
+
+
+class Standin:
+    '''A stand-in running in the background, everything it prints kept.'''
+
+    def __init__(self, script, port, args):
+        self.name = Path(script).stem
+        self.port = port
+        self.lines = []
+        self.ready = threading.Event()
+        self.proc = subprocess.Popen(
+            [sys.executable, '-u', str(SCRIPTS / script),
+             '--bind', '127.0.0.1', '--port', str(port), *args],
+            stdout=subprocess.PIPE, stderr=subprocess.STDOUT, text=True)
+        self.reader = threading.Thread(target=self.read, daemon=True)
+        self.reader.start()
+
+    def read(self):
+        for line in self.proc.stdout:
+            line = line.rstrip('\n')
+            print(f'[{self.name}] {line}')
+            self.lines.append(line)
+            if ' listening on ' in line:
+                self.ready.set()
+        # Exited: nothing more to wait for
+        self.ready.set()
+
+    def wait_listening(self):
+        self.ready.wait(LISTEN_TIMEOUT_S)
+        if self.proc.poll() is not None or \
+                not any(' listening on ' in line for line in self.lines):
+            output = '\n'.join(self.stop())
+            pytest.fail(f'{self.name} not listening on port {self.port}:\n'
+                        f'{output}')
+
+    def stop(self):
+        '''Stop the stand-in and return the lines it printed.'''
+        if self.proc.poll() is None:
+            self.proc.terminate()
+            self.proc.wait()
+        self.reader.join()
+        return self.lines
+
+
+@pytest.fixture(scope='module')
+def build_config(request):
+    '''Kconfig symbols of the build under test, strings unquoted.'''
+    path = Path(request.config.getoption('--build-dir')) / 'zephyr' / \
+        '.config'
+    return {m.group(1): m.group(2).strip('"')
+            for m in re.finditer(r'^(CONFIG_\w+)=(.*)$', path.read_text(),
+                                 re.M)}
+
+
+@pytest.fixture(scope='module')
+def standin(build_config):
+    '''Start stand-ins from scripts/, stopped with the module:
+
+      standin('http_standin.py', 'CONFIG_APP_HTTP_PORT', '--no-ranges')
+
+    listens on the port of the Kconfig symbol, and returns a Standin once
+    it does.'''
+    started = []
+
+    def start(script, port_symbol, *args):
+        proc = Standin(script, int(build_config[port_symbol]), args)
+        started.append(proc)
+        proc.wait_listening()
+        return proc
+
+    yield start
+    for proc in started:
+        proc.stop()
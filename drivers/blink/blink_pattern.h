@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_DRIVERS_BLINK_PATTERN_H_
+#define APP_DRIVERS_BLINK_PATTERN_H_
+
+/*
+ * Step sequencer shared by the blink drivers. It only decides which level the
+ * LED takes next and for how long; driving the LED and arming the timer are
+ * left to the driver.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include <app/drivers/blink.h>
+
+struct blink_pattern_state {
+	struct blink_step steps[CONFIG_BLINK_PATTERN_MAX_STEPS];
+	uint8_t num_steps;
+	uint8_t repeat;
+	/* Position: step index, repetitions of that step done, phase */
+	uint8_t step;
+	uint8_t iter;
+	bool off_phase;
+	/* Full passes played */
+	uint8_t played;
+	/* Absolute end of the current phase, in ticks */
+	int64_t deadline;
+};
+
+/* Copy and validate @p pattern, rewinding to its first step */
+static inline int blink_pattern_load(struct blink_pattern_state *st,
+				     const struct blink_pattern *pattern)
+{
+	uint32_t total = 0;
+
+	if (pattern == NULL || pattern->steps == NULL ||
+	    pattern->num_steps == 0 ||
+	    pattern->num_steps > CONFIG_BLINK_PATTERN_MAX_STEPS) {
+		return -EINVAL;
+	}
+
+	for (uint8_t i = 0; i < pattern->num_steps; i++) {
+		total += pattern->steps[i].on_ms + pattern->steps[i].off_ms;
+	}
+	if (total == 0) {
+		return -EINVAL;
+	}
+
+	memcpy(st->steps, pattern->steps,
+	       pattern->num_steps * sizeof(pattern->steps[0]));
+	st->num_steps = pattern->num_steps;
+	st->repeat = pattern->repeat;
+	st->step = 0;
+	st->iter = 0;
+	st->off_phase = false;
+	st->played = 0;
+
+	return 0;
+}
+
+/*
+ * A looping pattern that never switches the LED needs no timer. Returns true
+ * for such patterns, with the level in @p on.
+ */
+static inline bool blink_pattern_is_steady(const struct blink_pattern_state *st,
+					   bool *on)
+{
+	bool any_on = false;
+	bool any_off = false;
+
+	if (st->repeat != BLINK_PATTERN_FOREVER) {
+		return false;
+	}
+
+	for (uint8_t i = 0; i < st->num_steps; i++) {
+		any_on |= st->steps[i].on_ms > 0;
+		any_off |= st->steps[i].off_ms > 0;
+	}
+
+	*on = any_on;
+
+	return any_on != any_off;
+}
+
+/*
+ * Move to the next phase with a non-zero duration. Returns its duration in
+ * milliseconds with the LED level in @p on, or 0 once the pattern has ended.
+ */
+static inline uint32_t blink_pattern_next(struct blink_pattern_state *st,
+					  bool *on)
+{
+	while (st->step < st->num_steps) {
+		const struct blink_step *s = &st->steps[st->step];
+		bool phase_on = !st->off_phase;
+		uint32_t ms = phase_on ? s->on_ms : s->off_ms;
+
+		if (phase_on) {
+			st->off_phase = true;
+		} else {
+			st->off_phase = false;
+			if (++st->iter >= MAX(s->count, 1)) {
+				st->iter = 0;
+				st->step++;
+				if (st->step == st->num_steps &&
+				    (st->repeat == BLINK_PATTERN_FOREVER ||
+				     ++st->played < st->repeat)) {
+					st->step = 0;
+				}
+			}
+		}
+
+		if (ms > 0) {
+			*on = phase_on;
+			return ms;
+		}
+	}
+
+	return 0;
+}
+
+/*
+ * Timeout for a phase of @p ms starting where the previous one ended, so
+ * timer latency does not accumulate over a long pattern. Pass @p restart to
+ * start counting from now.
+ */
+static inline k_timeout_t blink_pattern_timeout(struct blink_pattern_state *st,
+						uint32_t ms, bool restart)
+{
+#if defined(CONFIG_TIMEOUT_64BIT)
+	if (restart) {
+		st->deadline = k_uptime_ticks();
+	}
+	st->deadline += k_ms_to_ticks_ceil64(ms);
+
+	return K_TIMEOUT_ABS_TICKS(st->deadline);
+#else
+	ARG_UNUSED(st);
+	ARG_UNUSED(restart);
+
+	return K_MSEC(ms);
+#endif
+}
+
+#endif /* APP_DRIVERS_BLINK_PATTERN_H_ */
@@ -14,10 +14,16 @@
 
 #include <app/drivers/blink.h>
 
+#include "blink_pattern.h"
+
 LOG_MODULE_REGISTER(blink_gpio_led, CONFIG_BLINK_LOG_LEVEL);
 
 struct blink_gpio_led_data {
 	struct k_timer timer;
+	/* Guards the pattern against the timer handler */
+	struct k_spinlock lock;
+	bool pattern_active;
+	struct blink_pattern_state pattern;
 };
 
 struct blink_gpio_led_config {
@@ -25,23 +31,90 @@ struct blink_gpio_led_config {
 	unsigned int period_ms;
 };
 
+/* Apply the next pattern phase and arm the one-shot timer for its end */
+static void blink_gpio_led_pattern_step(const struct device *dev, bool restart)
+{
+	const struct blink_gpio_led_config *config = dev->config;
+	struct blink_gpio_led_data *data = dev->data;
+	bool on = false;
+	uint32_t ms;
+
+	ms = blink_pattern_next(&data->pattern, &on);
+	if (ms == 0) {
+		data->pattern_active = false;
+	} else {
+		k_timer_start(&data->timer,
+			      blink_pattern_timeout(&data->pattern, ms, restart),
+			      K_NO_WAIT);
+	}
+
+	(void)gpio_pin_set_dt(&config->led, on);
+}
+
 static void blink_gpio_led_on_timer_expire(struct k_timer *timer)
 {
 	const struct device *dev = k_timer_user_data_get(timer);
 	const struct blink_gpio_led_config *config = dev->config;
+	struct blink_gpio_led_data *data = dev->data;
+	k_spinlock_key_t key;
 	int ret;
 
+	key = k_spin_lock(&data->lock);
+	if (data->pattern_active) {
+		blink_gpio_led_pattern_step(dev, false);
+		k_spin_unlock(&data->lock, key);
+		return;
+	}
+	k_spin_unlock(&data->lock, key);
+
 	ret = gpio_pin_toggle_dt(&config->led);
 	if (ret < 0) {
 		LOG_ERR("Could not toggle LED GPIO (%d)", ret);
 	}
 }
 
+static int blink_gpio_led_set_pattern(const struct device *dev,
+				      const struct blink_pattern *pattern)
+{
+	const struct blink_gpio_led_config *config = dev->config;
+	struct blink_gpio_led_data *data = dev->data;
+	k_spinlock_key_t key;
+	bool on;
+	int ret;
+
+	key = k_spin_lock(&data->lock);
+
+	ret = blink_pattern_load(&data->pattern, pattern);
+	if (ret < 0) {
+		k_spin_unlock(&data->lock, key);
+		return ret;
+	}
+
+	k_timer_stop(&data->timer);
+
+	if (blink_pattern_is_steady(&data->pattern, &on)) {
+		data->pattern_active = false;
+		ret = gpio_pin_set_dt(&config->led, on);
+	} else {
+		data->pattern_active = true;
+		blink_gpio_led_pattern_step(dev, true);
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
+}
+
 static int blink_gpio_led_set_period_ms(const struct device *dev,
 					unsigned int period_ms)
 {
 	const struct blink_gpio_led_config *config = dev->config;
 	struct blink_gpio_led_data *data = dev->data;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&data->lock);
+	data->pattern_active = false;
+	k_spin_unlock(&data->lock, key);
 
 	if (period_ms == 0) {
 		k_timer_stop(&data->timer);
@@ -55,6 +128,7 @@ static int blink_gpio_led_set_period_ms(const struct device *dev,
 
 static DEVICE_API(blink, blink_gpio_led_api) = {
 	.set_period_ms = &blink_gpio_led_set_period_ms,
+	.set_pattern = &blink_gpio_led_set_pattern,
 };
 
 static int blink_gpio_led_init(const struct device *dev)
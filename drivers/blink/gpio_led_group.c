@@ -0,0 +1,344 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT blink_gpio_led_group
+
+#include <zephyr/device.h>
+
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+#include <app/drivers/blink.h>
+
+#include "blink_pattern.h"
+
+LOG_MODULE_REGISTER(blink_gpio_led_group, CONFIG_BLINK_LOG_LEVEL);
+
+/*
+ * Every LED of a group is a blink device, but only the group owns a timer.
+ * Each tick the group walks its LEDs, collects the pins that change into one
+ * mask and writes them with a single gpio_port_set_masked() call. The timer
+ * only runs while at least one LED is blinking.
+ */
+
+enum blink_group_mode {
+	BLINK_GROUP_IDLE,
+	BLINK_GROUP_PERIOD,
+	/* Pattern loaded, its first phase starts on the next tick */
+	BLINK_GROUP_PATTERN_START,
+	BLINK_GROUP_PATTERN,
+};
+
+struct blink_gpio_led_group_data {
+	struct k_timer timer;
+	/* Guards the timer and the state of every LED in the group */
+	struct k_spinlock lock;
+	bool running;
+	/* Controller shared by all LEDs of the group */
+	const struct device *port;
+};
+
+struct blink_gpio_led_group_config {
+	uint32_t tick_ms;
+	const struct device *const *leds;
+	size_t num_leds;
+};
+
+struct blink_gpio_led_group_led_data {
+	enum blink_group_mode mode;
+	bool on;
+	/* Ticks per toggle in period mode */
+	uint32_t reload;
+	/* Ticks left in the current period or pattern phase */
+	uint32_t remaining;
+	struct blink_pattern_state pattern;
+};
+
+struct blink_gpio_led_group_led_config {
+	const struct device *group;
+	struct gpio_dt_spec led;
+	unsigned int period_ms;
+};
+
+static uint32_t blink_group_ms_to_ticks(const struct device *group,
+					uint32_t ms)
+{
+	const struct blink_gpio_led_group_config *config = group->config;
+
+	return MAX(DIV_ROUND_CLOSEST(ms, config->tick_ms), 1U);
+}
+
+/* Start the pattern phase that follows; returns false once it has ended */
+static bool blink_group_pattern_next(const struct device *group,
+				     struct blink_gpio_led_group_led_data *led)
+{
+	uint32_t ms;
+
+	ms = blink_pattern_next(&led->pattern, &led->on);
+	if (ms == 0) {
+		led->mode = BLINK_GROUP_IDLE;
+		led->on = false;
+		return false;
+	}
+
+	led->remaining = blink_group_ms_to_ticks(group, ms);
+
+	return true;
+}
+
+/* Advance one LED by a tick; returns true if its level must be written */
+static bool blink_group_led_tick(const struct device *group,
+				 struct blink_gpio_led_group_led_data *led)
+{
+	bool was_on = led->on;
+
+	switch (led->mode) {
+	case BLINK_GROUP_PERIOD:
+		if (--led->remaining > 0) {
+			return false;
+		}
+		led->remaining = led->reload;
+		led->on = !led->on;
+		return true;
+	case BLINK_GROUP_PATTERN_START:
+		led->mode = BLINK_GROUP_PATTERN;
+		(void)blink_group_pattern_next(group, led);
+		/* Written even if unchanged, the LED may be in any state */
+		return true;
+	case BLINK_GROUP_PATTERN:
+		if (--led->remaining > 0) {
+			return false;
+		}
+		(void)blink_group_pattern_next(group, led);
+		return led->on != was_on;
+	default:
+		return false;
+	}
+}
+
+static void blink_gpio_led_group_on_timer_expire(struct k_timer *timer)
+{
+	const struct device *group = k_timer_user_data_get(timer);
+	const struct blink_gpio_led_group_config *config = group->config;
+	struct blink_gpio_led_group_data *data = group->data;
+	gpio_port_pins_t mask = 0;
+	gpio_port_value_t value = 0;
+	bool active = false;
+	k_spinlock_key_t key;
+	int ret;
+
+	key = k_spin_lock(&data->lock);
+
+	for (size_t i = 0; i < config->num_leds; i++) {
+		const struct device *dev = config->leds[i];
+		const struct blink_gpio_led_group_led_config *led_config =
+			dev->config;
+		struct blink_gpio_led_group_led_data *led = dev->data;
+
+		if (blink_group_led_tick(group, led)) {
+			mask |= BIT(led_config->led.pin);
+			if (led->on) {
+				value |= BIT(led_config->led.pin);
+			}
+		}
+		active |= led->mode != BLINK_GROUP_IDLE;
+	}
+
+	if (!active) {
+		k_timer_stop(&data->timer);
+		data->running = false;
+	}
+
+	/* Under the lock, so a concurrent set_period_ms() write wins */
+	if (mask != 0) {
+		ret = gpio_port_set_masked(data->port, mask, value);
+		if (ret < 0) {
+			LOG_ERR("Could not update LED GPIOs (%d)", ret);
+		}
+	}
+
+	k_spin_unlock(&data->lock, key);
+}
+
+/* Called with the group lock held, once an LED has started blinking */
+static void blink_group_ensure_running(const struct device *group)
+{
+	const struct blink_gpio_led_group_config *config = group->config;
+	struct blink_gpio_led_group_data *data = group->data;
+
+	if (!data->running) {
+		data->running = true;
+		k_timer_start(&data->timer, K_MSEC(config->tick_ms),
+			      K_MSEC(config->tick_ms));
+	}
+}
+
+static int blink_gpio_led_group_set_pattern(const struct device *dev,
+					    const struct blink_pattern *pattern)
+{
+	const struct blink_gpio_led_group_led_config *config = dev->config;
+	struct blink_gpio_led_group_led_data *led = dev->data;
+	struct blink_gpio_led_group_data *data = config->group->data;
+	k_spinlock_key_t key;
+	bool on;
+	int ret = 0;
+
+	key = k_spin_lock(&data->lock);
+
+	ret = blink_pattern_load(&led->pattern, pattern);
+	if (ret < 0) {
+		k_spin_unlock(&data->lock, key);
+		return ret;
+	}
+
+	if (blink_pattern_is_steady(&led->pattern, &on)) {
+		led->mode = BLINK_GROUP_IDLE;
+		led->on = on;
+		ret = gpio_pin_set_dt(&config->led, on);
+	} else {
+		/* Start on a tick, in phase with the other LEDs */
+		led->mode = BLINK_GROUP_PATTERN_START;
+		blink_group_ensure_running(config->group);
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
+}
+
+static int blink_gpio_led_group_set_period_ms(const struct device *dev,
+					      unsigned int period_ms)
+{
+	const struct blink_gpio_led_group_led_config *config = dev->config;
+	struct blink_gpio_led_group_led_data *led = dev->data;
+	struct blink_gpio_led_group_data *data = config->group->data;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	key = k_spin_lock(&data->lock);
+
+	if (period_ms == 0) {
+		led->mode = BLINK_GROUP_IDLE;
+		led->on = false;
+		ret = gpio_pin_set_dt(&config->led, 0);
+	} else {
+		led->mode = BLINK_GROUP_PERIOD;
+		led->reload = blink_group_ms_to_ticks(config->group, period_ms);
+		led->remaining = led->reload;
+		blink_group_ensure_running(config->group);
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
+}
+
+static DEVICE_API(blink, blink_gpio_led_group_api) = {
+	.set_period_ms = &blink_gpio_led_group_set_period_ms,
+	.set_pattern = &blink_gpio_led_group_set_pattern,
+};
+
+static int blink_gpio_led_group_led_init(const struct device *dev)
+{
+	const struct blink_gpio_led_group_led_config *config = dev->config;
+
+	/* The group, initialized first, has set the LED up */
+	if (!device_is_ready(config->group)) {
+		return -ENODEV;
+	}
+
+	if (config->period_ms > 0) {
+		return blink_gpio_led_group_set_period_ms(dev,
+							  config->period_ms);
+	}
+
+	return 0;
+}
+
+static int blink_gpio_led_group_init(const struct device *group)
+{
+	const struct blink_gpio_led_group_config *config = group->config;
+	struct blink_gpio_led_group_data *data = group->data;
+	int ret;
+
+	data->port = ((const struct blink_gpio_led_group_led_config *)
+			      config->leds[0]->config)->led.port;
+	if (!device_is_ready(data->port)) {
+		LOG_ERR("LED GPIO controller not ready");
+		return -ENODEV;
+	}
+
+	for (size_t i = 0; i < config->num_leds; i++) {
+		const struct blink_gpio_led_group_led_config *led_config =
+			config->leds[i]->config;
+
+		if (led_config->led.port != data->port) {
+			LOG_ERR("All LEDs of a group must share a GPIO controller");
+			return -EINVAL;
+		}
+
+		ret = gpio_pin_configure_dt(&led_config->led,
+					    GPIO_OUTPUT_INACTIVE);
+		if (ret < 0) {
+			LOG_ERR("Could not configure LED GPIO (%d)", ret);
+			return ret;
+		}
+	}
+
+	k_timer_init(&data->timer, blink_gpio_led_group_on_timer_expire, NULL);
+	k_timer_user_data_set(&data->timer, (void *)group);
+
+	return 0;
+}
+
+#define BLINK_GPIO_LED_GROUP_LED_DEFINE(node_id)                               \
+	static struct blink_gpio_led_group_led_data                            \
+		_CONCAT(led_data, DT_DEP_ORD(node_id));                        \
+                                                                               \
+	static const struct blink_gpio_led_group_led_config                    \
+		_CONCAT(led_config, DT_DEP_ORD(node_id)) = {                   \
+	    .group = DEVICE_DT_GET(DT_PARENT(node_id)),                        \
+	    .led = GPIO_DT_SPEC_GET(node_id, led_gpios),                       \
+	    .period_ms = DT_PROP_OR(node_id, blink_period_ms, 0U),             \
+	};                                                                     \
+                                                                               \
+	DEVICE_DT_DEFINE(node_id, blink_gpio_led_group_led_init, NULL,         \
+			 &_CONCAT(led_data, DT_DEP_ORD(node_id)),              \
+			 &_CONCAT(led_config, DT_DEP_ORD(node_id)),            \
+			 POST_KERNEL, CONFIG_BLINK_INIT_PRIORITY,              \
+			 &blink_gpio_led_group_api);
+
+#define BLINK_GPIO_LED_GROUP_LED_GET(node_id) DEVICE_DT_GET(node_id),
+
+#define BLINK_GPIO_LED_GROUP_DEFINE(inst)                                      \
+	BUILD_ASSERT(DT_INST_PROP(inst, tick_ms) > 0,                          \
+		     "tick-ms must be greater than 0");                        \
+	BUILD_ASSERT(DT_INST_CHILD_NUM_STATUS_OKAY(inst) > 0,                  \
+		     "blink-gpio-led-group without LEDs");                     \
+                                                                               \
+	DT_INST_FOREACH_CHILD_STATUS_OKAY(inst,                                \
+					  BLINK_GPIO_LED_GROUP_LED_DEFINE)     \
+                                                                               \
+	static const struct device *const leds##inst[] = {                     \
+	    DT_INST_FOREACH_CHILD_STATUS_OKAY(inst,                            \
+					      BLINK_GPIO_LED_GROUP_LED_GET)    \
+	};                                                                     \
+                                                                               \
+	static struct blink_gpio_led_group_data data##inst;                    \
+                                                                               \
+	static const struct blink_gpio_led_group_config config##inst = {       \
+	    .tick_ms = DT_INST_PROP(inst, tick_ms),                            \
+	    .leds = leds##inst,                                                \
+	    .num_leds = ARRAY_SIZE(leds##inst),                                \
+	};                                                                     \
+                                                                               \
+	DEVICE_DT_INST_DEFINE(inst, blink_gpio_led_group_init, NULL,           \
+			      &data##inst, &config##inst, POST_KERNEL,         \
+			      CONFIG_BLINK_INIT_PRIORITY, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(BLINK_GPIO_LED_GROUP_DEFINE)
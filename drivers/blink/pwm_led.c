@@ -0,0 +1,314 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT blink_pwm_led
+
+#include <zephyr/device.h>
+
+#include <zephyr/devicetree.h>
+#include <zephyr/drivers/pwm.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include <app/drivers/blink.h>
+
+#include "blink_pattern.h"
+
+LOG_MODULE_REGISTER(blink_pwm_led, CONFIG_BLINK_LOG_LEVEL);
+
+/*
+ * Blinking at a fixed period, and patterns made of a single looping step,
+ * are handed to the PWM hardware as one long period with the on time as
+ * pulse, so the CPU is not woken up at all. The timer is only used when the
+ * controller can not produce such a slow period, for multi-step patterns,
+ * and while fading.
+ */
+
+enum blink_pwm_led_mode {
+	/* Constant duty cycle, or blinking in hardware */
+	BLINK_PWM_LED_STEADY,
+	BLINK_PWM_LED_TOGGLE,
+	BLINK_PWM_LED_PATTERN,
+	BLINK_PWM_LED_FADE,
+};
+
+struct blink_pwm_led_data {
+	struct k_timer timer;
+	/* Guards the mode and its state against the timer handler */
+	struct k_spinlock lock;
+	enum blink_pwm_led_mode mode;
+	/* Software toggling state */
+	bool on;
+	/* Pulse width of the current constant level, in nanoseconds */
+	uint32_t pulse;
+	struct blink_pattern_state pattern;
+	/* Fade ramp */
+	uint32_t fade_from;
+	uint32_t fade_to;
+	int64_t fade_start;
+	unsigned int fade_ms;
+};
+
+struct blink_pwm_led_config {
+	struct pwm_dt_spec led;
+	unsigned int period_ms;
+};
+
+static int blink_pwm_led_set_pulse(const struct device *dev, uint32_t pulse)
+{
+	const struct blink_pwm_led_config *config = dev->config;
+	struct blink_pwm_led_data *data = dev->data;
+
+	data->pulse = pulse;
+
+	return pwm_set_pulse_dt(&config->led, pulse);
+}
+
+static int blink_pwm_led_set_level(const struct device *dev, bool on)
+{
+	const struct blink_pwm_led_config *config = dev->config;
+
+	return blink_pwm_led_set_pulse(dev, on ? config->led.period : 0U);
+}
+
+/* Let the controller blink on its own, if it can produce the period */
+static int blink_pwm_led_hw_blink(const struct device *dev, uint32_t on_ms,
+				  uint32_t off_ms)
+{
+	const struct blink_pwm_led_config *config = dev->config;
+	struct blink_pwm_led_data *data = dev->data;
+	uint64_t period = (uint64_t)(on_ms + off_ms) * NSEC_PER_MSEC;
+	int ret;
+
+	if (period > UINT32_MAX) {
+		return -ERANGE;
+	}
+
+	ret = pwm_set_dt(&config->led, (uint32_t)period,
+			 on_ms * NSEC_PER_MSEC);
+	if (ret < 0) {
+		LOG_DBG("%u/%u ms not possible in hardware (%d)", on_ms, off_ms,
+			ret);
+		return ret;
+	}
+
+	data->mode = BLINK_PWM_LED_STEADY;
+	/* Any fade that follows starts from off */
+	data->pulse = 0U;
+
+	return 0;
+}
+
+/* Apply the next pattern phase and arm the one-shot timer for its end */
+static void blink_pwm_led_pattern_step(const struct device *dev, bool restart)
+{
+	struct blink_pwm_led_data *data = dev->data;
+	bool on = false;
+	uint32_t ms;
+
+	ms = blink_pattern_next(&data->pattern, &on);
+	if (ms == 0) {
+		data->mode = BLINK_PWM_LED_STEADY;
+	} else {
+		k_timer_start(&data->timer,
+			      blink_pattern_timeout(&data->pattern, ms, restart),
+			      K_NO_WAIT);
+	}
+
+	(void)blink_pwm_led_set_level(dev, on);
+}
+
+static void blink_pwm_led_fade_step(const struct device *dev)
+{
+	struct blink_pwm_led_data *data = dev->data;
+	int64_t elapsed = k_uptime_get() - data->fade_start;
+	int64_t delta = (int64_t)data->fade_to - data->fade_from;
+
+	if (elapsed >= data->fade_ms) {
+		k_timer_stop(&data->timer);
+		data->mode = BLINK_PWM_LED_STEADY;
+		(void)blink_pwm_led_set_pulse(dev, data->fade_to);
+		return;
+	}
+
+	(void)blink_pwm_led_set_pulse(
+		dev, (uint32_t)(data->fade_from +
+				delta * elapsed / (int64_t)data->fade_ms));
+}
+
+static void blink_pwm_led_on_timer_expire(struct k_timer *timer)
+{
+	const struct device *dev = k_timer_user_data_get(timer);
+	struct blink_pwm_led_data *data = dev->data;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&data->lock);
+
+	switch (data->mode) {
+	case BLINK_PWM_LED_TOGGLE:
+		data->on = !data->on;
+		(void)blink_pwm_led_set_level(dev, data->on);
+		break;
+	case BLINK_PWM_LED_PATTERN:
+		blink_pwm_led_pattern_step(dev, false);
+		break;
+	case BLINK_PWM_LED_FADE:
+		blink_pwm_led_fade_step(dev);
+		break;
+	default:
+		break;
+	}
+
+	k_spin_unlock(&data->lock, key);
+}
+
+static int blink_pwm_led_set_pattern(const struct device *dev,
+				     const struct blink_pattern *pattern)
+{
+	struct blink_pwm_led_data *data = dev->data;
+	const struct blink_step *step;
+	k_spinlock_key_t key;
+	bool on;
+	int ret;
+
+	key = k_spin_lock(&data->lock);
+
+	ret = blink_pattern_load(&data->pattern, pattern);
+	if (ret < 0) {
+		k_spin_unlock(&data->lock, key);
+		return ret;
+	}
+
+	k_timer_stop(&data->timer);
+
+	step = &data->pattern.steps[0];
+	if (blink_pattern_is_steady(&data->pattern, &on)) {
+		data->mode = BLINK_PWM_LED_STEADY;
+		ret = blink_pwm_led_set_level(dev, on);
+	} else if (data->pattern.num_steps == 1 &&
+		   data->pattern.repeat == BLINK_PATTERN_FOREVER &&
+		   blink_pwm_led_hw_blink(dev, step->on_ms, step->off_ms) == 0) {
+		/* Single looping step: one PWM period */
+	} else {
+		data->mode = BLINK_PWM_LED_PATTERN;
+		blink_pwm_led_pattern_step(dev, true);
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
+}
+
+static int blink_pwm_led_set_period_ms(const struct device *dev,
+				       unsigned int period_ms)
+{
+	struct blink_pwm_led_data *data = dev->data;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	key = k_spin_lock(&data->lock);
+
+	k_timer_stop(&data->timer);
+
+	if (period_ms == 0) {
+		data->mode = BLINK_PWM_LED_STEADY;
+		ret = blink_pwm_led_set_level(dev, false);
+	} else if (blink_pwm_led_hw_blink(dev, period_ms, period_ms) < 0) {
+		data->mode = BLINK_PWM_LED_TOGGLE;
+		data->on = false;
+		ret = blink_pwm_led_set_level(dev, false);
+		k_timer_start(&data->timer, K_MSEC(period_ms),
+			      K_MSEC(period_ms));
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
+}
+
+static int blink_pwm_led_set_brightness(const struct device *dev,
+					uint8_t percent, unsigned int fade_ms)
+{
+	const struct blink_pwm_led_config *config = dev->config;
+	struct blink_pwm_led_data *data = dev->data;
+	uint32_t target;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	if (percent > 100U) {
+		return -EINVAL;
+	}
+
+	target = (uint32_t)((uint64_t)config->led.period * percent / 100U);
+
+	key = k_spin_lock(&data->lock);
+
+	k_timer_stop(&data->timer);
+
+	if (fade_ms == 0U || target == data->pulse) {
+		data->mode = BLINK_PWM_LED_STEADY;
+		ret = blink_pwm_led_set_pulse(dev, target);
+	} else {
+		data->mode = BLINK_PWM_LED_FADE;
+		data->fade_from = data->pulse;
+		data->fade_to = target;
+		data->fade_start = k_uptime_get();
+		data->fade_ms = fade_ms;
+		k_timer_start(&data->timer,
+			      K_MSEC(CONFIG_BLINK_PWM_LED_FADE_STEP_MS),
+			      K_MSEC(CONFIG_BLINK_PWM_LED_FADE_STEP_MS));
+	}
+
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
+}
+
+static DEVICE_API(blink, blink_pwm_led_api) = {
+	.set_period_ms = &blink_pwm_led_set_period_ms,
+	.set_pattern = &blink_pwm_led_set_pattern,
+	.set_brightness = &blink_pwm_led_set_brightness,
+};
+
+static int blink_pwm_led_init(const struct device *dev)
+{
+	const struct blink_pwm_led_config *config = dev->config;
+	struct blink_pwm_led_data *data = dev->data;
+	int ret;
+
+	if (!pwm_is_ready_dt(&config->led)) {
+		LOG_ERR("LED PWM not ready");
+		return -ENODEV;
+	}
+
+	ret = blink_pwm_led_set_level(dev, false);
+	if (ret < 0) {
+		LOG_ERR("Could not set LED PWM (%d)", ret);
+		return ret;
+	}
+
+	k_timer_init(&data->timer, blink_pwm_led_on_timer_expire, NULL);
+	k_timer_user_data_set(&data->timer, (void *)dev);
+
+	if (config->period_ms > 0) {
+		return blink_pwm_led_set_period_ms(dev, config->period_ms);
+	}
+
+	return 0;
+}
+
+#define BLINK_PWM_LED_DEFINE(inst)                                             \
+	static struct blink_pwm_led_data data##inst;                           \
+                                                                               \
+	static const struct blink_pwm_led_config config##inst = {              \
+	    .led = PWM_DT_SPEC_INST_GET(inst),                                 \
+	    .period_ms = DT_INST_PROP_OR(inst, blink_period_ms, 0U),           \
+	};                                                                     \
+                                                                               \
+	DEVICE_DT_INST_DEFINE(inst, blink_pwm_led_init, NULL, &data##inst,     \
+			      &config##inst, POST_KERNEL,                      \
+			      CONFIG_BLINK_INIT_PRIORITY, &blink_pwm_led_api);
+
+DT_INST_FOREACH_STATUS_OKAY(BLINK_PWM_LED_DEFINE)
@@ -9,16 +9,12 @@
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/drivers/sensor.h>
 
+#include <app/drivers/sensor/example_sensor.h>
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(example_sensor, CONFIG_SENSOR_LOG_LEVEL);
 
-struct example_sensor_data {
-	int state;
-};
-
-struct example_sensor_config {
-	struct gpio_dt_spec input;
-};
+#include "example_sensor.h"
 
 static int example_sensor_sample_fetch(const struct device *dev,
 				      enum sensor_channel chan)
@@ -27,6 +23,12 @@ static int example_sensor_sample_fetch(const struct device *dev,
 	struct example_sensor_data *data = dev->data;
 
 	data->state = gpio_pin_get_dt(&config->input);
+#ifdef CONFIG_EXAMPLE_SENSOR_TRIGGER
+	data->timestamp = data->stable_ticks;
+#endif
+#ifdef CONFIG_EXAMPLE_SENSOR_STREAM
+	data->fetched_overflows = (uint32_t)atomic_get(&data->overflows_total);
+#endif
 
 	return 0;
 }
@@ -37,6 +39,27 @@ static int example_sensor_channel_get(const struct device *dev,
 {
 	struct example_sensor_data *data = dev->data;
 
+#ifdef CONFIG_EXAMPLE_SENSOR_TRIGGER
+	if ((enum sensor_channel_example_sensor)chan ==
+	    SENSOR_CHAN_EXAMPLE_SENSOR_TIMESTAMP) {
+		int64_t us = k_ticks_to_us_floor64(data->timestamp);
+
+		val->val1 = (int32_t)(us / USEC_PER_SEC);
+		val->val2 = (int32_t)(us % USEC_PER_SEC);
+
+		return 0;
+	}
+#endif
+#ifdef CONFIG_EXAMPLE_SENSOR_STREAM
+	if ((enum sensor_channel_example_sensor)chan ==
+	    SENSOR_CHAN_EXAMPLE_SENSOR_FIFO_OVERFLOWS) {
+		val->val1 = (int32_t)data->fetched_overflows;
+		val->val2 = 0;
+
+		return 0;
+	}
+#endif
+
 	if (chan != SENSOR_CHAN_PROX) {
 		return -ENOTSUP;
 	}
@@ -49,6 +72,13 @@ static int example_sensor_channel_get(const struct device *dev,
 static DEVICE_API(sensor, example_sensor_api) = {
 	.sample_fetch = &example_sensor_sample_fetch,
 	.channel_get = &example_sensor_channel_get,
+#ifdef CONFIG_EXAMPLE_SENSOR_TRIGGER
+	.trigger_set = &example_sensor_trigger_set,
+#endif
+#ifdef CONFIG_SENSOR_ASYNC_API
+	.submit = &example_sensor_submit,
+	.get_decoder = &example_sensor_get_decoder,
+#endif
 };
 
 static int example_sensor_init(const struct device *dev)
@@ -68,14 +98,40 @@ static int example_sensor_init(const struct device *dev)
 		return ret;
 	}
 
+#ifdef CONFIG_EXAMPLE_SENSOR_TRIGGER
+	ret = example_sensor_trigger_init(dev);
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
 	return 0;
 }
 
+#define EXAMPLE_SENSOR_FIFO_DEFINE(i)					       \
+	BUILD_ASSERT(DT_INST_PROP(i, fifo_watermark) > 0 &&		       \
+		     DT_INST_PROP(i, fifo_watermark) <=			       \
+			     CONFIG_EXAMPLE_SENSOR_FIFO_SIZE,		       \
+		     "fifo-watermark must be within the FIFO size");	       \
+	static struct example_sensor_edge				       \
+		example_sensor_fifo_buf_##i[CONFIG_EXAMPLE_SENSOR_FIFO_SIZE];  \
+	static struct spsc_example_sensor_fifo example_sensor_fifo_##i =       \
+		SPSC_INITIALIZER(CONFIG_EXAMPLE_SENSOR_FIFO_SIZE,	       \
+				 example_sensor_fifo_buf_##i);
+
 #define EXAMPLE_SENSOR_INIT(i)						       \
+	IF_ENABLED(CONFIG_EXAMPLE_SENSOR_STREAM,			       \
+		   (EXAMPLE_SENSOR_FIFO_DEFINE(i)))			       \
+									       \
 	static struct example_sensor_data example_sensor_data_##i;	       \
 									       \
 	static const struct example_sensor_config example_sensor_config_##i = {\
 		.input = GPIO_DT_SPEC_INST_GET(i, input_gpios),		       \
+		IF_ENABLED(CONFIG_EXAMPLE_SENSOR_TRIGGER, (		       \
+		.debounce_ms = DT_INST_PROP(i, debounce_interval_ms),))        \
+		IF_ENABLED(CONFIG_EXAMPLE_SENSOR_STREAM, (		       \
+		.fifo = &example_sensor_fifo_##i,			       \
+		.fifo_watermark = DT_INST_PROP(i, fifo_watermark),))	       \
 	};								       \
 									       \
 	DEVICE_DT_INST_DEFINE(i, example_sensor_init, NULL,		       \
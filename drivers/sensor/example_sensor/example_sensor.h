@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_DRIVERS_SENSOR_EXAMPLE_SENSOR_EXAMPLE_SENSOR_H_
+#define APP_DRIVERS_SENSOR_EXAMPLE_SENSOR_EXAMPLE_SENSOR_H_
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#ifdef CONFIG_EXAMPLE_SENSOR_STREAM
+#include <zephyr/sys/spsc_lockfree.h>
+
+/* Edge captured by the ISR */
+struct example_sensor_edge {
+	uint64_t timestamp_ns;
+	uint8_t state;
+};
+
+/* struct spsc_example_sensor_fifo, shared by all instances */
+SPSC_DECLARE(example_sensor_fifo, struct example_sensor_edge);
+#endif
+
+struct example_sensor_data {
+	int state;
+#ifdef CONFIG_EXAMPLE_SENSOR_TRIGGER
+	/* Uptime ticks of the edge behind the fetched state */
+	int64_t timestamp;
+
+	const struct device *dev;
+	struct gpio_callback gpio_cb;
+	struct k_work_delayable debounce_work;
+	/* Set from the first edge until the input has settled */
+	atomic_t pending;
+	/* First edge of the pending burst, captured in the ISR */
+	int64_t edge_ticks;
+	/* Last debounced state and the edge that led to it */
+	int stable;
+	int64_t stable_ticks;
+
+	sensor_trigger_handler_t data_ready_handler;
+	const struct sensor_trigger *data_ready_trigger;
+	sensor_trigger_handler_t near_far_handler;
+	const struct sensor_trigger *near_far_trigger;
+#endif
+#ifdef CONFIG_EXAMPLE_SENSOR_STREAM
+	struct k_work fifo_work;
+	/* Streaming request waiting for the watermark */
+	atomic_ptr_t stream_sqe;
+	/* Set by the first streaming request, enables the FIFO */
+	bool streaming;
+	/* Edges dropped since the last frame, and in total */
+	atomic_t overflows;
+	atomic_t overflows_total;
+	uint32_t fetched_overflows;
+#endif
+};
+
+struct example_sensor_config {
+	struct gpio_dt_spec input;
+#ifdef CONFIG_EXAMPLE_SENSOR_TRIGGER
+	uint32_t debounce_ms;
+#endif
+#ifdef CONFIG_EXAMPLE_SENSOR_STREAM
+	/* Filled by the ISR (producer), drained by fifo_work (consumer) */
+	struct spsc_example_sensor_fifo *fifo;
+	uint16_t fifo_watermark;
+#endif
+};
+
+#ifdef CONFIG_SENSOR_ASYNC_API
+void example_sensor_submit(const struct device *dev,
+			   struct rtio_iodev_sqe *iodev_sqe);
+
+int example_sensor_get_decoder(const struct device *dev,
+			       const struct sensor_decoder_api **decoder);
+#endif
+
+#ifdef CONFIG_EXAMPLE_SENSOR_TRIGGER
+int example_sensor_trigger_set(const struct device *dev,
+			       const struct sensor_trigger *trig,
+			       sensor_trigger_handler_t handler);
+
+int example_sensor_trigger_init(const struct device *dev);
+
+/* Enable the input interrupt if triggers or a stream need it */
+int example_sensor_irq_update(const struct device *dev);
+#endif
+
+#ifdef CONFIG_EXAMPLE_SENSOR_STREAM
+/* Called from the GPIO ISR for every edge */
+void example_sensor_fifo_push(const struct device *dev);
+
+void example_sensor_stream_init(const struct device *dev);
+#endif
+
+#endif /* APP_DRIVERS_SENSOR_EXAMPLE_SENSOR_EXAMPLE_SENSOR_H_ */
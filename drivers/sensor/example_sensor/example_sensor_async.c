@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/drivers/sensor_clock.h>
+#include <zephyr/rtio/rtio.h>
+
+#include <app/drivers/sensor/example_sensor.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(example_sensor, CONFIG_SENSOR_LOG_LEVEL);
+
+#include "example_sensor.h"
+
+#define FRAME_SIZE(n)                                                          \
+	(sizeof(struct example_sensor_frame_header) +                          \
+	 (n) * sizeof(struct example_sensor_frame_event))
+
+#ifdef CONFIG_EXAMPLE_SENSOR_STREAM
+
+BUILD_ASSERT(IS_POWER_OF_TWO(CONFIG_EXAMPLE_SENSOR_FIFO_SIZE),
+	     "CONFIG_EXAMPLE_SENSOR_FIFO_SIZE must be a power of two");
+
+/*
+ * While a FIFO watermark stream is open, the GPIO ISR appends every edge to
+ * a lock-free single-producer single-consumer ring. Once the watermark is
+ * reached, a work item moves all buffered edges into the pending request's
+ * buffer in one frame, so the consumer wakes up once per batch of edges.
+ */
+
+void example_sensor_fifo_push(const struct device *dev)
+{
+	const struct example_sensor_config *config = dev->config;
+	struct example_sensor_data *data = dev->data;
+	struct example_sensor_edge *edge;
+	uint64_t cycles;
+
+	if (!data->streaming) {
+		return;
+	}
+
+	edge = spsc_acquire(config->fifo);
+	if (edge == NULL) {
+		atomic_inc(&data->overflows);
+		atomic_inc(&data->overflows_total);
+		return;
+	}
+
+	(void)sensor_clock_get_cycles(&cycles);
+	edge->timestamp_ns = sensor_clock_cycles_to_ns(cycles);
+	edge->state = (uint8_t)gpio_pin_get_dt(&config->input);
+	spsc_produce(config->fifo);
+
+	if (atomic_ptr_get(&data->stream_sqe) != NULL &&
+	    spsc_consumable(config->fifo) >= config->fifo_watermark) {
+		k_work_submit(&data->fifo_work);
+	}
+}
+
+static void example_sensor_fifo_work(struct k_work *work)
+{
+	struct example_sensor_data *data =
+		CONTAINER_OF(work, struct example_sensor_data, fifo_work);
+	const struct example_sensor_config *config = data->dev->config;
+	struct example_sensor_frame_header *hdr;
+	struct example_sensor_frame_event *events;
+	struct rtio_iodev_sqe *iodev_sqe;
+	struct example_sensor_edge *edge;
+	uint32_t available, fit;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int ret;
+
+	iodev_sqe = atomic_ptr_clear(&data->stream_sqe);
+	if (iodev_sqe == NULL) {
+		return;
+	}
+
+	available = spsc_consumable(config->fifo);
+	if (available == 0) {
+		atomic_ptr_set(&data->stream_sqe, iodev_sqe);
+		return;
+	}
+
+	ret = rtio_sqe_rx_buf(iodev_sqe, FRAME_SIZE(1), FRAME_SIZE(available),
+			      &buf, &buf_len);
+	if (ret < 0) {
+		LOG_ERR("Failed to get a buffer for %u events", available);
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	fit = MIN(available, (buf_len - FRAME_SIZE(0)) /
+				     sizeof(struct example_sensor_frame_event));
+
+	hdr = (struct example_sensor_frame_header *)buf;
+	events = (struct example_sensor_frame_event *)(hdr + 1);
+
+	hdr->timestamp = spsc_peek(config->fifo)->timestamp_ns;
+	hdr->count = (uint16_t)fit;
+	hdr->overflows = (uint16_t)MIN(atomic_clear(&data->overflows),
+				       UINT16_MAX);
+	hdr->fifo_watermark = 1;
+
+	for (uint32_t i = 0; i < fit; i++) {
+		edge = spsc_consume(config->fifo);
+		events[i].delta_us = (uint32_t)((edge->timestamp_ns -
+						 hdr->timestamp) /
+						NSEC_PER_USEC);
+		events[i].state = edge->state;
+		spsc_release(config->fifo);
+	}
+
+	/* A multishot request comes straight back through submit */
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
+
+static void example_sensor_submit_stream(const struct device *dev,
+					 struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *cfg = iodev_sqe->sqe.iodev->data;
+	const struct example_sensor_config *config = dev->config;
+	struct example_sensor_data *data = dev->data;
+	int ret;
+
+	for (size_t i = 0; i < cfg->count; i++) {
+		if (cfg->triggers[i].trigger != SENSOR_TRIG_FIFO_WATERMARK ||
+		    cfg->triggers[i].opt != SENSOR_STREAM_DATA_INCLUDE) {
+			LOG_DBG("Stream trigger %d not supported",
+				cfg->triggers[i].trigger);
+			rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+			return;
+		}
+	}
+
+	if (!atomic_ptr_cas(&data->stream_sqe, NULL, iodev_sqe)) {
+		rtio_iodev_sqe_err(iodev_sqe, -EBUSY);
+		return;
+	}
+
+	if (!data->streaming) {
+		data->streaming = true;
+		ret = example_sensor_irq_update(dev);
+		if (ret < 0) {
+			data->streaming = false;
+			atomic_ptr_clear(&data->stream_sqe);
+			rtio_iodev_sqe_err(iodev_sqe, ret);
+			return;
+		}
+	}
+
+	/* Edges may have piled up while no request was pending */
+	if (spsc_consumable(config->fifo) >= config->fifo_watermark) {
+		k_work_submit(&data->fifo_work);
+	}
+}
+
+void example_sensor_stream_init(const struct device *dev)
+{
+	struct example_sensor_data *data = dev->data;
+
+	k_work_init(&data->fifo_work, example_sensor_fifo_work);
+}
+
+#endif /* CONFIG_EXAMPLE_SENSOR_STREAM */
+
+/*
+ * Reading the input is a single GPIO access, so a one-shot request is
+ * completed right away from the submitting context rather than deferred.
+ */
+void example_sensor_submit(const struct device *dev,
+			   struct rtio_iodev_sqe *iodev_sqe)
+{
+	const struct sensor_read_config *cfg = iodev_sqe->sqe.iodev->data;
+	const struct example_sensor_config *config = dev->config;
+	struct example_sensor_frame_header *hdr;
+	struct example_sensor_frame_event *event;
+	uint32_t min_buf_len = FRAME_SIZE(1);
+	uint64_t cycles;
+	uint8_t *buf;
+	uint32_t buf_len;
+	int ret;
+
+	if (cfg->is_streaming) {
+#ifdef CONFIG_EXAMPLE_SENSOR_STREAM
+		example_sensor_submit_stream(dev, iodev_sqe);
+#else
+		rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+#endif
+		return;
+	}
+
+	for (size_t i = 0; i < cfg->count; i++) {
+		enum sensor_channel chan = cfg->channels[i].chan_type;
+
+		if (chan != SENSOR_CHAN_PROX && chan != SENSOR_CHAN_ALL) {
+			LOG_DBG("Channel %d not supported", chan);
+			rtio_iodev_sqe_err(iodev_sqe, -ENOTSUP);
+			return;
+		}
+	}
+
+	ret = rtio_sqe_rx_buf(iodev_sqe, min_buf_len, min_buf_len, &buf,
+			      &buf_len);
+	if (ret < 0) {
+		LOG_ERR("Failed to get a read buffer of size %u bytes",
+			min_buf_len);
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	ret = sensor_clock_get_cycles(&cycles);
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	ret = gpio_pin_get_dt(&config->input);
+	if (ret < 0) {
+		rtio_iodev_sqe_err(iodev_sqe, ret);
+		return;
+	}
+
+	hdr = (struct example_sensor_frame_header *)buf;
+	hdr->timestamp = sensor_clock_cycles_to_ns(cycles);
+	hdr->count = 1;
+	hdr->overflows = 0;
+	hdr->fifo_watermark = 0;
+
+	event = (struct example_sensor_frame_event *)(hdr + 1);
+	event->delta_us = 0;
+	event->state = (uint8_t)ret;
+
+	rtio_iodev_sqe_ok(iodev_sqe, 0);
+}
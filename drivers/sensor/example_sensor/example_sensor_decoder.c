@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT zephyr_example_sensor
+
+#include <zephyr/drivers/sensor.h>
+
+#include <app/drivers/sensor/example_sensor.h>
+
+#include "example_sensor.h"
+
+/*
+ * Events are decoded as proximity samples: is_near is the input level. A
+ * frame is a header followed by one event for a one-shot read, or by every
+ * buffered edge for a FIFO watermark stream.
+ */
+
+static int example_sensor_decoder_get_frame_count(
+	const uint8_t *buffer, struct sensor_chan_spec chan_spec,
+	uint16_t *frame_count)
+{
+	const struct example_sensor_frame_header *hdr =
+		(const struct example_sensor_frame_header *)buffer;
+
+	if (chan_spec.chan_type != SENSOR_CHAN_PROX ||
+	    chan_spec.chan_idx != 0) {
+		return -ENOTSUP;
+	}
+
+	*frame_count = hdr->count;
+
+	return 0;
+}
+
+static int example_sensor_decoder_decode(const uint8_t *buffer,
+					 struct sensor_chan_spec chan_spec,
+					 uint32_t *fit, uint16_t max_count,
+					 void *data_out)
+{
+	const struct example_sensor_frame_header *hdr =
+		(const struct example_sensor_frame_header *)buffer;
+	const struct example_sensor_frame_event *events =
+		(const struct example_sensor_frame_event *)(hdr + 1);
+	struct sensor_byte_data *out = data_out;
+	uint64_t base;
+	uint16_t n = 0;
+
+	if (chan_spec.chan_type != SENSOR_CHAN_PROX ||
+	    chan_spec.chan_idx != 0) {
+		return -ENOTSUP;
+	}
+
+	if (*fit >= hdr->count || max_count == 0) {
+		return 0;
+	}
+
+	base = (uint64_t)events[*fit].delta_us * NSEC_PER_USEC;
+	out->header.base_timestamp_ns = hdr->timestamp + base;
+
+	while (*fit < hdr->count && n < max_count) {
+		uint64_t delta = (uint64_t)events[*fit].delta_us * NSEC_PER_USEC -
+				 base;
+
+		/* The rest goes in the next call, relative to a new base */
+		if (delta > UINT32_MAX) {
+			break;
+		}
+
+		out->readings[n].timestamp_delta = (uint32_t)delta;
+		out->readings[n].is_near = events[*fit].state;
+		n++;
+		(*fit)++;
+	}
+
+	out->header.reading_count = n;
+
+	return n;
+}
+
+static bool example_sensor_decoder_has_trigger(const uint8_t *buffer,
+					       enum sensor_trigger_type trigger)
+{
+	const struct example_sensor_frame_header *hdr =
+		(const struct example_sensor_frame_header *)buffer;
+
+	return trigger == SENSOR_TRIG_FIFO_WATERMARK && hdr->fifo_watermark;
+}
+
+SENSOR_DECODER_API_DT_DEFINE() = {
+	.get_frame_count = example_sensor_decoder_get_frame_count,
+	.get_size_info = sensor_natively_supported_channel_size_info,
+	.decode = example_sensor_decoder_decode,
+	.has_trigger = example_sensor_decoder_has_trigger,
+};
+
+int example_sensor_get_decoder(const struct device *dev,
+			       const struct sensor_decoder_api **decoder)
+{
+	ARG_UNUSED(dev);
+
+	*decoder = &SENSOR_DECODER_NAME();
+
+	return 0;
+}
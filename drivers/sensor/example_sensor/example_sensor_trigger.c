@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/kernel.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(example_sensor, CONFIG_SENSOR_LOG_LEVEL);
+
+#include "example_sensor.h"
+
+/*
+ * Every edge (re)starts the debounce timer; the input is only read back once
+ * it has been quiet for debounce-interval-ms. The ISR keeps the time of the
+ * first edge of a burst, which is when the change really happened.
+ */
+
+static void example_sensor_gpio_callback(const struct device *port,
+					 struct gpio_callback *cb,
+					 gpio_port_pins_t pins)
+{
+	struct example_sensor_data *data =
+		CONTAINER_OF(cb, struct example_sensor_data, gpio_cb);
+	const struct example_sensor_config *config = data->dev->config;
+
+	ARG_UNUSED(port);
+	ARG_UNUSED(pins);
+
+#ifdef CONFIG_EXAMPLE_SENSOR_STREAM
+	example_sensor_fifo_push(data->dev);
+#endif
+
+	if (data->data_ready_handler == NULL && data->near_far_handler == NULL) {
+		return;
+	}
+
+	if (atomic_set(&data->pending, 1) == 0) {
+		data->edge_ticks = k_uptime_ticks();
+	}
+
+	k_work_reschedule(&data->debounce_work, K_MSEC(config->debounce_ms));
+}
+
+static void example_sensor_debounce_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct example_sensor_data *data =
+		CONTAINER_OF(dwork, struct example_sensor_data, debounce_work);
+	const struct example_sensor_config *config = data->dev->config;
+	int64_t edge_ticks = data->edge_ticks;
+	int level;
+
+	atomic_clear(&data->pending);
+
+	level = gpio_pin_get_dt(&config->input);
+	if (level < 0) {
+		LOG_ERR("Could not read input GPIO (%d)", level);
+		return;
+	}
+
+	/* A glitch that came back to the previous state */
+	if (level == data->stable) {
+		return;
+	}
+
+	data->stable = level;
+	data->stable_ticks = edge_ticks;
+
+	if (data->data_ready_handler != NULL) {
+		data->data_ready_handler(data->dev, data->data_ready_trigger);
+	}
+	if (level == 1 && data->near_far_handler != NULL) {
+		data->near_far_handler(data->dev, data->near_far_trigger);
+	}
+}
+
+int example_sensor_irq_update(const struct device *dev)
+{
+	const struct example_sensor_config *config = dev->config;
+	struct example_sensor_data *data = dev->data;
+	bool handlers = data->data_ready_handler != NULL ||
+			data->near_far_handler != NULL;
+	bool needed = handlers;
+	int ret;
+
+#ifdef CONFIG_EXAMPLE_SENSOR_STREAM
+	needed |= data->streaming;
+#endif
+
+	if (handlers) {
+		ret = gpio_pin_get_dt(&config->input);
+		if (ret < 0) {
+			return ret;
+		}
+		data->stable = ret;
+	} else {
+		(void)k_work_cancel_delayable(&data->debounce_work);
+		atomic_clear(&data->pending);
+	}
+
+	ret = gpio_pin_interrupt_configure_dt(
+		&config->input, needed ? GPIO_INT_EDGE_BOTH : GPIO_INT_DISABLE);
+	if (ret < 0) {
+		LOG_ERR("Could not configure input interrupt (%d)", ret);
+		return ret;
+	}
+
+	return 0;
+}
+
+int example_sensor_trigger_set(const struct device *dev,
+			       const struct sensor_trigger *trig,
+			       sensor_trigger_handler_t handler)
+{
+	struct example_sensor_data *data = dev->data;
+
+	if (trig->chan != SENSOR_CHAN_PROX && trig->chan != SENSOR_CHAN_ALL) {
+		return -ENOTSUP;
+	}
+
+	switch (trig->type) {
+	case SENSOR_TRIG_DATA_READY:
+		data->data_ready_handler = handler;
+		data->data_ready_trigger = trig;
+		break;
+	case SENSOR_TRIG_NEAR_FAR:
+		data->near_far_handler = handler;
+		data->near_far_trigger = trig;
+		break;
+	default:
+		return -ENOTSUP;
+	}
+
+	/* Only take interrupts while someone is listening */
+	return example_sensor_irq_update(dev);
+}
+
+int example_sensor_trigger_init(const struct device *dev)
+{
+	const struct example_sensor_config *config = dev->config;
+	struct example_sensor_data *data = dev->data;
+	int ret;
+
+	data->dev = dev;
+	k_work_init_delayable(&data->debounce_work,
+			      example_sensor_debounce_work);
+
+	gpio_init_callback(&data->gpio_cb, example_sensor_gpio_callback,
+			   BIT(config->input.pin));
+
+	ret = gpio_add_callback_dt(&config->input, &data->gpio_cb);
+	if (ret < 0) {
+		LOG_ERR("Could not add input GPIO callback (%d)", ret);
+		return ret;
+	}
+
+#ifdef CONFIG_EXAMPLE_SENSOR_STREAM
+	example_sensor_stream_init(dev);
+#endif
+
+	return 0;
+}
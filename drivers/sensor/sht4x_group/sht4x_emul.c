@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sensirion_sht4x
+
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/i2c_emul.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+#include <app/drivers/sensor/sht4x_group.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(sht4x_emul, CONFIG_SENSOR_LOG_LEVEL);
+
+#include "sht4x_group.h"
+
+/*
+ * An SHT4x on the I2C emulator. A measure command starts a conversion that
+ * takes the full conversion time of its repeatability; reads are
+ * NACKed until then, as the sensor does, and return the levels set with
+ * sht4x_emul_set() when the conversion started, plus noise if enabled.
+ */
+
+/* Repeatability of the datasheet as a standard deviation, in milli-units */
+static const uint16_t noise_temp_milli[] = { 100, 70, 40 };
+static const uint16_t noise_hum_milli[] = { 250, 150, 80 };
+
+struct sht4x_emul_data {
+	struct k_spinlock lock;
+	int32_t temp_milli;
+	int32_t hum_milli;
+	bool fail;
+	/* Noise generator state, 0 for none */
+	uint32_t noise_state;
+	/* Conversion in progress or done, when it is done and its result */
+	bool measuring;
+	int64_t ready_ticks;
+	int32_t result_temp_milli;
+	int32_t result_hum_milli;
+	struct sht4x_emul_stats stats;
+};
+
+void sht4x_emul_set(const struct emul *target, int32_t temp_milli,
+		    int32_t hum_milli)
+{
+	struct sht4x_emul_data *data = target->data;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	data->temp_milli = temp_milli;
+	data->hum_milli = hum_milli;
+
+	k_spin_unlock(&data->lock, key);
+}
+
+void sht4x_emul_set_fail(const struct emul *target, bool fail)
+{
+	struct sht4x_emul_data *data = target->data;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	data->fail = fail;
+
+	k_spin_unlock(&data->lock, key);
+}
+
+void sht4x_emul_set_noise(const struct emul *target, uint32_t seed)
+{
+	struct sht4x_emul_data *data = target->data;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	data->noise_state = seed;
+
+	k_spin_unlock(&data->lock, key);
+}
+
+void sht4x_emul_stats_get(const struct emul *target,
+			  struct sht4x_emul_stats *stats)
+{
+	struct sht4x_emul_data *data = target->data;
+	k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+	*stats = data->stats;
+
+	k_spin_unlock(&data->lock, key);
+}
+
+/*
+ * Normal noise of standard deviation @p sigma: a sum of twelve uniform
+ * 16-bit numbers has a standard deviation of 65536.
+ */
+static int32_t sht4x_emul_noise(struct sht4x_emul_data *data, int32_t sigma)
+{
+	int64_t sum = 0;
+
+	if (data->noise_state == 0) {
+		return 0;
+	}
+
+	for (int i = 0; i < 12; i++) {
+		data->noise_state = data->noise_state * 1664525U + 1013904223U;
+		sum += (int32_t)(data->noise_state >> 16) - 32768;
+	}
+
+	return (int32_t)(sum * sigma / 65536);
+}
+
+/* Encode a level as the sensor sends it: two bytes and their CRC */
+static void sht4x_emul_word(uint8_t *word, int64_t raw)
+{
+	sys_put_be16((uint16_t)CLAMP(raw, 0, UINT16_MAX), word);
+	word[2] = crc8(word, 2, SHT4X_CRC_POLY, SHT4X_CRC_INIT, false);
+}
+
+static int sht4x_emul_command(struct sht4x_emul_data *data, uint8_t cmd)
+{
+	if (cmd == SHT4X_CMD_RESET) {
+		data->measuring = false;
+		return 0;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(sht4x_measure_cmd); i++) {
+		if (cmd == sht4x_measure_cmd[i]) {
+			data->measuring = true;
+			data->ready_ticks =
+				k_uptime_ticks() +
+				k_us_to_ticks_ceil64(sht4x_measure_wait_us[i]);
+			data->result_temp_milli =
+				data->temp_milli +
+				sht4x_emul_noise(data, noise_temp_milli[i]);
+			data->result_hum_milli =
+				data->hum_milli +
+				sht4x_emul_noise(data, noise_hum_milli[i]);
+			data->stats.measurements++;
+			data->stats.conversion_us += sht4x_measure_wait_us[i];
+			return 0;
+		}
+	}
+
+	LOG_WRN("Unsupported command 0x%02x", cmd);
+
+	return -EIO;
+}
+
+static int sht4x_emul_result(struct sht4x_emul_data *data, uint8_t *buf,
+			     uint32_t len)
+{
+	uint8_t result[SHT4X_RESULT_SIZE];
+
+	/* Not measuring, or not done: NACK */
+	if (!data->measuring || k_uptime_ticks() < data->ready_ticks) {
+		return -EIO;
+	}
+
+	/* The inverse of the datasheet conversions */
+	sht4x_emul_word(&result[0],
+			((int64_t)data->result_temp_milli + 45000) * 65535 /
+				175000);
+	sht4x_emul_word(&result[3],
+			((int64_t)data->result_hum_milli + 6000) * 65535 /
+				125000);
+	data->measuring = false;
+
+	memcpy(buf, result, MIN(len, sizeof(result)));
+
+	return 0;
+}
+
+static int sht4x_emul_transfer(const struct emul *target,
+			       struct i2c_msg *msgs, int num_msgs, int addr)
+{
+	struct sht4x_emul_data *data = target->data;
+	k_spinlock_key_t key;
+	int ret = 0;
+
+	ARG_UNUSED(addr);
+
+	key = k_spin_lock(&data->lock);
+
+	if (data->fail) {
+		ret = -EIO;
+		goto out;
+	}
+
+	/* The sensor takes single-byte commands, then plain reads */
+	for (int i = 0; i < num_msgs && ret == 0; i++) {
+		data->stats.bus_bytes += 1 + msgs[i].len;
+
+		if (msgs[i].flags & I2C_MSG_READ) {
+			ret = sht4x_emul_result(data, msgs[i].buf,
+						msgs[i].len);
+		} else if (msgs[i].len == 1) {
+			ret = sht4x_emul_command(data, msgs[i].buf[0]);
+		} else {
+			ret = -EIO;
+		}
+	}
+
+out:
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
+}
+
+static const struct i2c_emul_api sht4x_emul_api = {
+	.transfer = sht4x_emul_transfer,
+};
+
+static int sht4x_emul_init(const struct emul *target,
+			   const struct device *parent)
+{
+	ARG_UNUSED(parent);
+
+	sht4x_emul_set(target, 25000, 50000);
+
+	return 0;
+}
+
+#define SHT4X_EMUL_DEFINE(inst)                                                \
+	static struct sht4x_emul_data sht4x_emul_data_##inst;                  \
+	EMUL_DT_INST_DEFINE(inst, sht4x_emul_init, &sht4x_emul_data_##inst,    \
+			    NULL, &sht4x_emul_api, NULL);
+
+DT_INST_FOREACH_STATUS_OKAY(SHT4X_EMUL_DEFINE)
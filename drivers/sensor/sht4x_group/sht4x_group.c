@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#define DT_DRV_COMPAT sht4x_group
+
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/i2c.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/crc.h>
+
+#include <app/drivers/sensor/sht4x_group.h>
+#include <app/lib/filters.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(sht4x_group, CONFIG_SENSOR_LOG_LEVEL);
+
+#include "sht4x_group.h"
+
+/*
+ * The SHT4x converts on its own once it has a measure command, and NACKs
+ * reads until it is done. The group writes the command of every sensor,
+ * sleeps once for the longest conversion of them, and reads them all, so
+ * the bus and the caller wait one conversion time whatever the size of the
+ * group. The sensors are addressed directly: the "sensirion,sht4x" driver
+ * of each node sleeps through its own conversion on every fetch.
+ *
+ * With oversampling, a fetch repeats that round and combines the readings
+ * of every sensor with a filter of lib/filters, on the raw counts, which
+ * are proportional to the levels.
+ */
+
+#define MAX_READINGS CONFIG_SHT4X_GROUP_MAX_OVERSAMPLING
+
+struct sht4x_group_data {
+	/* Readings of the fetch in progress, MAX_READINGS per sensor */
+	int32_t *t_readings;
+	int32_t *rh_readings;
+	uint8_t *num_readings;
+	/* Sensors converting in the current round */
+	atomic_t *converting;
+	/* Filtered raw results of the last fetch, per sensor */
+	uint16_t *t_raw;
+	uint16_t *rh_raw;
+	/* Sensors whose last fetch succeeded */
+	atomic_t *valid;
+	/* Readings per fetch and how they are combined */
+	uint8_t oversampling;
+	enum filter_type filter;
+};
+
+struct sht4x_group_sensor {
+	struct i2c_dt_spec bus;
+	uint8_t repeatability;
+};
+
+struct sht4x_group_config {
+	const struct sht4x_group_sensor *sensors;
+	size_t num_sensors;
+};
+
+/* Check one word of a result: two bytes and their CRC */
+static bool sht4x_group_crc_ok(const uint8_t *word)
+{
+	return crc8(word, 2, SHT4X_CRC_POLY, SHT4X_CRC_INIT, false) ==
+	       word[2];
+}
+
+/* Convert on every sensor at once and add the results to the readings */
+static void sht4x_group_round(const struct device *dev)
+{
+	const struct sht4x_group_config *config = dev->config;
+	struct sht4x_group_data *data = dev->data;
+	uint8_t rx[SHT4X_RESULT_SIZE];
+	uint32_t wait_us = 0;
+	int ret;
+
+	/* Start every conversion back to back */
+	for (size_t i = 0; i < config->num_sensors; i++) {
+		const struct sht4x_group_sensor *sensor = &config->sensors[i];
+		uint8_t cmd = sht4x_measure_cmd[sensor->repeatability];
+
+		ret = i2c_write_dt(&sensor->bus, &cmd, sizeof(cmd));
+		if (ret < 0) {
+			LOG_DBG("Sensor %zu: measure command failed (%d)", i,
+				ret);
+			continue;
+		}
+
+		atomic_set_bit(data->converting, i);
+		wait_us = MAX(wait_us,
+			      sht4x_measure_wait_us[sensor->repeatability]);
+	}
+
+	if (wait_us == 0) {
+		return;
+	}
+
+	/* One wait for the whole group, as long as its slowest conversion */
+	k_usleep(wait_us);
+
+	for (size_t i = 0; i < config->num_sensors; i++) {
+		size_t slot = i * MAX_READINGS + data->num_readings[i];
+
+		if (!atomic_test_and_clear_bit(data->converting, i)) {
+			continue;
+		}
+
+		ret = i2c_read_dt(&config->sensors[i].bus, rx, sizeof(rx));
+		if (ret < 0 || !sht4x_group_crc_ok(&rx[0]) ||
+		    !sht4x_group_crc_ok(&rx[3])) {
+			LOG_DBG("Sensor %zu: no valid result (%d)", i, ret);
+			continue;
+		}
+
+		data->t_readings[slot] = sys_get_be16(&rx[0]);
+		data->rh_readings[slot] = sys_get_be16(&rx[3]);
+		data->num_readings[i]++;
+	}
+}
+
+static int sht4x_group_sample_fetch(const struct device *dev,
+				    enum sensor_channel chan)
+{
+	const struct sht4x_group_config *config = dev->config;
+	struct sht4x_group_data *data = dev->data;
+	int failed = 0;
+
+	if (chan != SENSOR_CHAN_ALL && chan != SENSOR_CHAN_AMBIENT_TEMP &&
+	    chan != SENSOR_CHAN_HUMIDITY) {
+		return -ENOTSUP;
+	}
+
+	memset(data->num_readings, 0, config->num_sensors);
+
+	for (uint8_t round = 0; round < data->oversampling; round++) {
+		sht4x_group_round(dev);
+	}
+
+	for (size_t i = 0; i < config->num_sensors; i++) {
+		int32_t *t = &data->t_readings[i * MAX_READINGS];
+		int32_t *rh = &data->rh_readings[i * MAX_READINGS];
+		uint8_t n = data->num_readings[i];
+		int32_t t_raw, rh_raw;
+
+		/* The sensors that answered keep their results */
+		if (n == 0 || filter_apply(data->filter, t, n, &t_raw) < 0 ||
+		    filter_apply(data->filter, rh, n, &rh_raw) < 0) {
+			LOG_WRN("Sensor %zu: no valid result", i);
+			atomic_clear_bit(data->valid, i);
+			failed++;
+			continue;
+		}
+
+		data->t_raw[i] = (uint16_t)t_raw;
+		data->rh_raw[i] = (uint16_t)rh_raw;
+		atomic_set_bit(data->valid, i);
+	}
+
+	return failed > 0 ? -EIO : 0;
+}
+
+/* From the datasheet: T = -45 + 175 * raw / 65535, in micro-units */
+static void sht4x_group_temp(uint16_t raw, struct sensor_value *val)
+{
+	int64_t micro = (int64_t)raw * 175000000 / 65535 - 45000000;
+
+	(void)sensor_value_from_micro(val, micro);
+}
+
+/* RH = -6 + 125 * raw / 65535, limited to what is physically possible */
+static void sht4x_group_hum(uint16_t raw, struct sensor_value *val)
+{
+	int64_t micro = (int64_t)raw * 125000000 / 65535 - 6000000;
+
+	(void)sensor_value_from_micro(val, CLAMP(micro, 0, 100000000));
+}
+
+static int sht4x_group_value_get(const struct device *dev, size_t i,
+				 bool hum, struct sensor_value *val)
+{
+	struct sht4x_group_data *data = dev->data;
+
+	if (!atomic_test_bit(data->valid, i)) {
+		return -ENODATA;
+	}
+
+	if (hum) {
+		sht4x_group_hum(data->rh_raw[i], val);
+	} else {
+		sht4x_group_temp(data->t_raw[i], val);
+	}
+
+	return 0;
+}
+
+static int sht4x_group_channel_get(const struct device *dev,
+				   enum sensor_channel chan,
+				   struct sensor_value *val)
+{
+	const struct sht4x_group_config *config = dev->config;
+	size_t index;
+
+	/* The first sensor stands for the group on the common channels */
+	if (chan == SENSOR_CHAN_AMBIENT_TEMP) {
+		return sht4x_group_value_get(dev, 0, false, val);
+	} else if (chan == SENSOR_CHAN_HUMIDITY) {
+		return sht4x_group_value_get(dev, 0, true, val);
+	} else if (chan < SENSOR_CHAN_PRIV_START) {
+		return -ENOTSUP;
+	}
+
+	index = (size_t)(chan - SENSOR_CHAN_PRIV_START);
+	if (index / 2 >= config->num_sensors) {
+		return -ENOTSUP;
+	}
+
+	return sht4x_group_value_get(dev, index / 2, index % 2 == 1, val);
+}
+
+static int sht4x_group_attr_set(const struct device *dev,
+				enum sensor_channel chan,
+				enum sensor_attribute attr,
+				const struct sensor_value *val)
+{
+	struct sht4x_group_data *data = dev->data;
+
+	if (chan != SENSOR_CHAN_ALL) {
+		return -ENOTSUP;
+	}
+
+	if (attr == SENSOR_ATTR_OVERSAMPLING) {
+		if (val->val1 < 1 || val->val1 > MAX_READINGS) {
+			return -EINVAL;
+		}
+		data->oversampling = (uint8_t)val->val1;
+
+		return 0;
+	}
+
+	if ((enum sensor_attribute_sht4x_group)attr ==
+	    SENSOR_ATTR_SHT4X_GROUP_FILTER) {
+		if (filter_name((enum filter_type)val->val1) == NULL) {
+			return -EINVAL;
+		}
+		data->filter = (enum filter_type)val->val1;
+
+		return 0;
+	}
+
+	return -ENOTSUP;
+}
+
+static int sht4x_group_attr_get(const struct device *dev,
+				enum sensor_channel chan,
+				enum sensor_attribute attr,
+				struct sensor_value *val)
+{
+	struct sht4x_group_data *data = dev->data;
+
+	if (chan != SENSOR_CHAN_ALL) {
+		return -ENOTSUP;
+	}
+
+	if (attr == SENSOR_ATTR_OVERSAMPLING) {
+		*val = (struct sensor_value){ .val1 = data->oversampling };
+	} else if ((enum sensor_attribute_sht4x_group)attr ==
+		   SENSOR_ATTR_SHT4X_GROUP_FILTER) {
+		*val = (struct sensor_value){ .val1 = data->filter };
+	} else {
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
+static DEVICE_API(sensor, sht4x_group_api) = {
+	.attr_set = &sht4x_group_attr_set,
+	.attr_get = &sht4x_group_attr_get,
+	.sample_fetch = &sht4x_group_sample_fetch,
+	.channel_get = &sht4x_group_channel_get,
+};
+
+static int sht4x_group_init(const struct device *dev)
+{
+	const struct sht4x_group_config *config = dev->config;
+
+	for (size_t i = 0; i < config->num_sensors; i++) {
+		if (!i2c_is_ready_dt(&config->sensors[i].bus)) {
+			LOG_ERR("Sensor %zu: I2C bus not ready", i);
+			return -ENODEV;
+		}
+	}
+
+	return 0;
+}
+
+#define SHT4X_GROUP_SENSOR(node_id, prop, idx)                                 \
+	{                                                                      \
+	    .bus = I2C_DT_SPEC_GET(DT_PHANDLE_BY_IDX(node_id, prop, idx)),     \
+	    .repeatability =                                                   \
+		DT_PROP(DT_PHANDLE_BY_IDX(node_id, prop, idx), repeatability), \
+	},
+
+#define SHT4X_GROUP_DEFINE(inst)                                               \
+	BUILD_ASSERT(DT_INST_PROP(inst, oversampling) >= 1 &&                  \
+		     DT_INST_PROP(inst, oversampling) <= MAX_READINGS,         \
+		     "oversampling out of 1..SHT4X_GROUP_MAX_OVERSAMPLING");   \
+                                                                               \
+	static const struct sht4x_group_sensor sensors##inst[] = {             \
+	    DT_INST_FOREACH_PROP_ELEM(inst, sensors, SHT4X_GROUP_SENSOR)       \
+	};                                                                     \
+                                                                               \
+	static int32_t t_readings##inst[ARRAY_SIZE(sensors##inst) *            \
+					MAX_READINGS];                         \
+	static int32_t rh_readings##inst[ARRAY_SIZE(sensors##inst) *           \
+					 MAX_READINGS];                        \
+	static uint8_t num_readings##inst[ARRAY_SIZE(sensors##inst)];          \
+	static ATOMIC_DEFINE(converting##inst, ARRAY_SIZE(sensors##inst));     \
+	static uint16_t t_raw##inst[ARRAY_SIZE(sensors##inst)];                \
+	static uint16_t rh_raw##inst[ARRAY_SIZE(sensors##inst)];               \
+	static ATOMIC_DEFINE(valid##inst, ARRAY_SIZE(sensors##inst));          \
+                                                                               \
+	/* The binding lists the filters in enum filter_type order */          \
+	static struct sht4x_group_data data##inst = {                          \
+	    .t_readings = t_readings##inst,                                    \
+	    .rh_readings = rh_readings##inst,                                  \
+	    .num_readings = num_readings##inst,                                \
+	    .converting = converting##inst,                                    \
+	    .t_raw = t_raw##inst,                                              \
+	    .rh_raw = rh_raw##inst,                                            \
+	    .valid = valid##inst,                                              \
+	    .oversampling = DT_INST_PROP(inst, oversampling),                  \
+	    .filter = DT_INST_ENUM_IDX(inst, oversampling_filter),             \
+	};                                                                     \
+                                                                               \
+	static const struct sht4x_group_config config##inst = {                \
+	    .sensors = sensors##inst,                                          \
+	    .num_sensors = ARRAY_SIZE(sensors##inst),                          \
+	};                                                                     \
+                                                                               \
+	SENSOR_DEVICE_DT_INST_DEFINE(inst, sht4x_group_init, NULL,             \
+				     &data##inst, &config##inst, POST_KERNEL,  \
+				     CONFIG_SENSOR_INIT_PRIORITY,              \
+				     &sht4x_group_api);
+
+DT_INST_FOREACH_STATUS_OKAY(SHT4X_GROUP_DEFINE)
@@ -0,0 +1,27 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_DRIVERS_SENSOR_SHT4X_GROUP_SHT4X_GROUP_H_
+#define APP_DRIVERS_SENSOR_SHT4X_GROUP_SHT4X_GROUP_H_
+
+#include <stdint.h>
+
+/* SHT4x protocol, shared by the group driver and the emulator */
+
+#define SHT4X_CMD_RESET 0x94
+
+/* A result: temperature, its CRC, humidity, its CRC */
+#define SHT4X_RESULT_SIZE 6
+
+#define SHT4X_CRC_POLY 0x31
+#define SHT4X_CRC_INIT 0xFF
+
+/* Measure commands by repeatability, low to high */
+static const uint8_t sht4x_measure_cmd[] = { 0xE0, 0xF6, 0xFD };
+
+/* Conversion times by repeatability, as the sensirion,sht4x driver waits */
+static const uint16_t sht4x_measure_wait_us[] = { 1700, 4500, 8200 };
+
+#endif /* APP_DRIVERS_SENSOR_SHT4X_GROUP_SHT4X_GROUP_H_ */
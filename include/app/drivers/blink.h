@@ -6,6 +6,9 @@
 #ifndef APP_DRIVERS_BLINK_H_
 #define APP_DRIVERS_BLINK_H_
 
+#include <errno.h>
+#include <stdint.h>
+
 #include <zephyr/device.h>
 #include <zephyr/toolchain.h>
 
@@ -17,11 +20,37 @@
  * @brief A custom driver class to blink LEDs
  *
  * This driver class is provided as an example of how to create custom driver
- * classes. It provides an interface to blink an LED at a configurable rate.
- * Implementations could include simple GPIO-controlled LEDs, addressable LEDs,
- * etc.
+ * classes. It provides an interface to blink an LED at a configurable rate,
+ * or to play a sequence of on/off steps. Implementations could include simple
+ * GPIO-controlled LEDs, addressable LEDs, etc.
  */
 
+/** @brief One step of a blink pattern. */
+struct blink_step {
+	/** Time the LED stays on, in milliseconds. May be 0. */
+	uint16_t on_ms;
+	/** Time the LED stays off afterwards, in milliseconds. May be 0. */
+	uint16_t off_ms;
+	/** Number of times the step is played before the next one, 0 is 1. */
+	uint8_t count;
+};
+
+/** Play a pattern until another pattern or period is set. */
+#define BLINK_PATTERN_FOREVER 0
+
+/** @brief Sequence of blink steps. */
+struct blink_pattern {
+	/** Steps, played in order. */
+	const struct blink_step *steps;
+	/** Number of entries in @p steps. */
+	uint8_t num_steps;
+	/**
+	 * Number of times the whole sequence is played, or
+	 * @ref BLINK_PATTERN_FOREVER. The LED is off once it ends.
+	 */
+	uint8_t repeat;
+};
+
 /**
  * @defgroup drivers_blink_ops Blink driver operations
  * @{
@@ -48,6 +77,37 @@ __subsystem struct blink_driver_api {
 	 * @retval -errno Other negative errno code on failure.
 	 */
 	int (*set_period_ms)(const struct device *dev, unsigned int period_ms);
+
+	/**
+	 * @brief Play a blink pattern. Optional.
+	 *
+	 * The steps must be copied, the caller's array may go away as soon as
+	 * this returns.
+	 *
+	 * @param dev Blink device instance.
+	 * @param pattern Pattern to play.
+	 *
+	 * @retval 0 if successful.
+	 * @retval -EINVAL if @p pattern is empty, too long or has no duration.
+	 * @retval -errno Other negative errno code on failure.
+	 */
+	int (*set_pattern)(const struct device *dev,
+			   const struct blink_pattern *pattern);
+
+	/**
+	 * @brief Light the LED steadily at a given brightness. Optional.
+	 *
+	 * @param dev Blink device instance.
+	 * @param percent Brightness, 0 to 100.
+	 * @param fade_ms Time to fade from the current brightness, 0 to
+	 * switch at once.
+	 *
+	 * @retval 0 if successful.
+	 * @retval -EINVAL if @p percent is above 100.
+	 * @retval -errno Other negative errno code on failure.
+	 */
+	int (*set_brightness)(const struct device *dev, uint8_t percent,
+			      unsigned int fade_ms);
 };
 
 /** @} */
@@ -87,6 +147,70 @@ static inline int z_impl_blink_set_period_ms(const struct device *dev,
 	return DEVICE_API_GET(blink, dev)->set_period_ms(dev, period_ms);
 }
 
+/**
+ * @brief Play a blink pattern.
+ *
+ * The pattern runs from the driver's timer, so the caller never blocks. It
+ * replaces any blink period or pattern set before, and is itself replaced by
+ * the next call to blink_set_pattern() or blink_set_period_ms().
+ *
+ * @param dev Blink device instance.
+ * @param pattern Pattern to play. The steps are copied.
+ *
+ * @retval 0 if successful.
+ * @retval -ENOSYS if the driver does not support patterns.
+ * @retval -EINVAL if @p pattern is empty, too long or has no duration.
+ * @retval -errno Other negative errno code on failure.
+ */
+__syscall int blink_set_pattern(const struct device *dev,
+				const struct blink_pattern *pattern);
+
+static inline int z_impl_blink_set_pattern(const struct device *dev,
+					   const struct blink_pattern *pattern)
+{
+	__ASSERT_NO_MSG(DEVICE_API_IS(blink, dev));
+
+	if (DEVICE_API_GET(blink, dev)->set_pattern == NULL) {
+		return -ENOSYS;
+	}
+
+	return DEVICE_API_GET(blink, dev)->set_pattern(dev, pattern);
+}
+
+/**
+ * @brief Light the LED steadily at a given brightness.
+ *
+ * Only drivers that can dim the LED, such as PWM-driven ones, support this.
+ * It replaces any blink period or pattern set before. With a non-zero
+ * @p fade_ms the brightness ramps linearly from its current level, which
+ * takes timer wakeups until the fade ends.
+ *
+ * @param dev Blink device instance.
+ * @param percent Brightness, 0 (off) to 100.
+ * @param fade_ms Duration of the fade in milliseconds, 0 for none.
+ *
+ * @retval 0 if successful.
+ * @retval -ENOSYS if the driver can not dim the LED.
+ * @retval -EINVAL if @p percent is above 100.
+ * @retval -errno Other negative errno code on failure.
+ */
+__syscall int blink_set_brightness(const struct device *dev, uint8_t percent,
+				   unsigned int fade_ms);
+
+static inline int z_impl_blink_set_brightness(const struct device *dev,
+					      uint8_t percent,
+					      unsigned int fade_ms)
+{
+	__ASSERT_NO_MSG(DEVICE_API_IS(blink, dev));
+
+	if (DEVICE_API_GET(blink, dev)->set_brightness == NULL) {
+		return -ENOSYS;
+	}
+
+	return DEVICE_API_GET(blink, dev)->set_brightness(dev, percent,
+							  fade_ms);
+}
+
 /**
  * @brief Turn LED blinking off.
  *
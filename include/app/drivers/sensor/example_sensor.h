@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_DRIVERS_SENSOR_EXAMPLE_SENSOR_H_
+#define APP_DRIVERS_SENSOR_EXAMPLE_SENSOR_H_
+
+#include <zephyr/drivers/sensor.h>
+
+/**
+ * @brief Example sensor custom channels.
+ */
+enum sensor_channel_example_sensor {
+	/**
+	 * Uptime of the first input edge behind the last debounced state
+	 * change, captured in the interrupt handler. val1 holds seconds and
+	 * val2 microseconds. Needs CONFIG_EXAMPLE_SENSOR_TRIGGER.
+	 */
+	SENSOR_CHAN_EXAMPLE_SENSOR_TIMESTAMP = SENSOR_CHAN_PRIV_START,
+	/**
+	 * Edge events dropped so far because the FIFO was full, in val1.
+	 * Needs CONFIG_EXAMPLE_SENSOR_STREAM.
+	 */
+	SENSOR_CHAN_EXAMPLE_SENSOR_FIFO_OVERFLOWS,
+};
+
+/**
+ * @brief Header of the frames read from the example sensor through RTIO.
+ *
+ * A one-shot read holds a single event with the current input level. A
+ * FIFO watermark stream frame holds every input edge buffered since the
+ * previous frame. The sensor's decoder turns either into
+ * struct sensor_byte_data on SENSOR_CHAN_PROX.
+ */
+struct example_sensor_frame_header {
+	/** Sensor clock time of the first event, in nanoseconds. */
+	uint64_t timestamp;
+	/** Number of events following the header. */
+	uint16_t count;
+	/** Events lost to a full FIFO since the previous frame. */
+	uint16_t overflows;
+	/** Set in frames produced by a FIFO watermark stream. */
+	uint8_t fifo_watermark;
+} __packed;
+
+/** @brief One event of an example sensor frame. */
+struct example_sensor_frame_event {
+	/** Time since the header timestamp, in microseconds. */
+	uint32_t delta_us;
+	/** Input level after the event. */
+	uint8_t state;
+} __packed;
+
+#endif /* APP_DRIVERS_SENSOR_EXAMPLE_SENSOR_H_ */
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_DRIVERS_SENSOR_SHT4X_GROUP_H_
+#define APP_DRIVERS_SENSOR_SHT4X_GROUP_H_
+
+#include <stdint.h>
+
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/sensor.h>
+
+/**
+ * @brief Temperature of sensor @p n of a group, in degrees Celsius.
+ *
+ * SENSOR_CHAN_AMBIENT_TEMP reads sensor 0.
+ */
+#define SENSOR_CHAN_SHT4X_GROUP_TEMP(n)                                        \
+	((enum sensor_channel)(SENSOR_CHAN_PRIV_START + 2 * (n)))
+
+/**
+ * @brief Relative humidity of sensor @p n of a group, in percent.
+ *
+ * SENSOR_CHAN_HUMIDITY reads sensor 0.
+ */
+#define SENSOR_CHAN_SHT4X_GROUP_HUM(n)                                         \
+	((enum sensor_channel)(SENSOR_CHAN_PRIV_START + 2 * (n) + 1))
+
+/**
+ * @brief SHT4x group custom attributes.
+ *
+ * SENSOR_ATTR_OVERSAMPLING sets the number of readings of every sensor per
+ * fetch, in val1, on SENSOR_CHAN_ALL.
+ */
+enum sensor_attribute_sht4x_group {
+	/**
+	 * How the readings of a sensor are combined, an enum filter_type of
+	 * lib/filters in val1. Set on SENSOR_CHAN_ALL.
+	 */
+	SENSOR_ATTR_SHT4X_GROUP_FILTER = SENSOR_ATTR_PRIV_START,
+};
+
+/** @brief Number of sensors of the sht4x-group node @p node_id. */
+#define SHT4X_GROUP_DT_NUM_SENSORS(node_id) DT_PROP_LEN(node_id, sensors)
+
+/**
+ * @brief Set the levels an emulated SHT4x measures next.
+ *
+ * Needs CONFIG_SHT4X_GROUP_EMUL.
+ *
+ * @param target Emulator of a "sensirion,sht4x" node.
+ * @param temp_milli Temperature in thousandths of a degree Celsius.
+ * @param hum_milli Relative humidity in thousandths of a percent.
+ */
+void sht4x_emul_set(const struct emul *target, int32_t temp_milli,
+		    int32_t hum_milli);
+
+/**
+ * @brief Make an emulated SHT4x stop answering, or answer again.
+ *
+ * Needs CONFIG_SHT4X_GROUP_EMUL.
+ *
+ * @param target Emulator of a "sensirion,sht4x" node.
+ * @param fail Whether every transfer is refused, as by a missing sensor.
+ */
+void sht4x_emul_set_fail(const struct emul *target, bool fail);
+
+/** @brief Activity of an emulated SHT4x, cumulative since boot. */
+struct sht4x_emul_stats {
+	/** Conversions started. */
+	uint32_t measurements;
+	/** Time spent converting, in microseconds. */
+	uint32_t conversion_us;
+	/** Bytes on the bus, addresses included. */
+	uint32_t bus_bytes;
+};
+
+/**
+ * @brief Get the activity of an emulated SHT4x.
+ *
+ * Needs CONFIG_SHT4X_GROUP_EMUL.
+ *
+ * @param target Emulator of a "sensirion,sht4x" node.
+ * @param stats Filled with the activity so far.
+ */
+void sht4x_emul_stats_get(const struct emul *target,
+			  struct sht4x_emul_stats *stats);
+
+/**
+ * @brief Add measurement noise to an emulated SHT4x, or remove it.
+ *
+ * The noise is normally distributed, with the standard deviation the
+ * datasheet gives as repeatability for each measure command: 0.1, 0.07 and
+ * 0.04 C, 0.25, 0.15 and 0.08 %RH from low to high repeatability.
+ *
+ * Needs CONFIG_SHT4X_GROUP_EMUL.
+ *
+ * @param target Emulator of a "sensirion,sht4x" node.
+ * @param seed Seed of the noise, or 0 for noiseless readings.
+ */
+void sht4x_emul_set_noise(const struct emul *target, uint32_t seed);
+
+#endif /* APP_DRIVERS_SENSOR_SHT4X_GROUP_H_ */
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_APPCONFIG_H_
+#define APP_LIB_APPCONFIG_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/slist.h>
+#include <zephyr/sys/util.h>
+
+/**
+ * @defgroup lib_appconfig Runtime configuration library
+ * @ingroup lib
+ * @{
+ *
+ * @brief Application parameters kept by the settings subsystem.
+ *
+ * An application declares its tunable parameters as a group of entries,
+ * each an unsigned integer within a range or a string, with a default.
+ * Registering the group at boot loads the values saved earlier, stored
+ * under "appcfg/<group>/<entry>". Values set afterwards, by the application
+ * or with the "appconfig" shell command, are saved at once and reported to
+ * the callback of the group, so they apply without a restart.
+ */
+
+/** @brief Type of an entry. */
+enum appconfig_type {
+	/** A uint32_t within a range. */
+	APPCONFIG_UINT,
+	/** A NUL-terminated string. */
+	APPCONFIG_STRING,
+};
+
+/** @brief Entry flag: the shell does not show the value, e.g. a password. */
+#define APPCONFIG_SECRET BIT(0)
+
+/** @brief One parameter, see APPCONFIG_UINT() and APPCONFIG_STRING(). */
+struct appconfig_entry {
+	/** Name, unique within the group. */
+	const char *name;
+	/** Type of the value. */
+	enum appconfig_type type;
+	/** APPCONFIG_SECRET or 0. */
+	uint8_t flags;
+	/** Current value: a uint32_t, or a string buffer of @ref size bytes. */
+	void *value;
+	/** Size of @ref value, the terminating NUL of strings included. */
+	size_t size;
+	/** Default of integers. */
+	uint32_t def;
+	/** Default of strings. */
+	const char *def_str;
+	/** Smallest value of integers. */
+	uint32_t min;
+	/** Largest value of integers. */
+	uint32_t max;
+};
+
+/**
+ * @brief Define an integer entry, in an entry array at file scope.
+ *
+ * @param _name Name of the entry.
+ * @param _def Default value.
+ * @param _min Smallest value.
+ * @param _max Largest value.
+ */
+#define APPCONFIG_UINT(_name, _def, _min, _max)                                \
+	{                                                                      \
+		.name = (_name),                                               \
+		.type = APPCONFIG_UINT,                                        \
+		.value = &(uint32_t){ 0 },                                     \
+		.size = sizeof(uint32_t),                                      \
+		.def = (_def),                                                 \
+		.min = (_min),                                                 \
+		.max = (_max),                                                 \
+	}
+
+/**
+ * @brief Define a string entry, in an entry array at file scope.
+ *
+ * @param _name Name of the entry.
+ * @param _size Size of the value, the terminating NUL included.
+ * @param _def Default value.
+ * @param _flags APPCONFIG_SECRET or 0.
+ */
+#define APPCONFIG_STRING(_name, _size, _def, _flags)                           \
+	{                                                                      \
+		.name = (_name),                                               \
+		.type = APPCONFIG_STRING,                                      \
+		.flags = (_flags),                                             \
+		.value = (char[_size]){ 0 },                                   \
+		.size = (_size),                                               \
+		.def_str = (_def),                                             \
+	}
+
+struct appconfig;
+
+/**
+ * @brief Called after an entry changed, on the thread that changed it.
+ *
+ * @param cfg Group of the entry.
+ * @param entry Entry that changed; read its value with appconfig_get_uint()
+ *              or appconfig_get_string().
+ * @param user_data User data of the group.
+ */
+typedef void (*appconfig_changed_t)(struct appconfig *cfg,
+				    const struct appconfig_entry *entry,
+				    void *user_data);
+
+/** @brief A group of entries, defined with APPCONFIG_INITIALIZER(). */
+struct appconfig {
+	/** Name of the group, the second level of the settings keys. */
+	const char *name;
+	/** Entries of the group. */
+	struct appconfig_entry *entries;
+	/** Number of @ref entries. */
+	size_t num_entries;
+	/** Called after an entry changed, or NULL. */
+	appconfig_changed_t changed;
+	/** Passed to @ref changed. */
+	void *user_data;
+
+	/* Set by appconfig_register() */
+	sys_snode_t node;
+};
+
+/**
+ * @brief Initializer for a @ref appconfig.
+ *
+ * @param _name Name of the group.
+ * @param _entries Array of entries.
+ * @param _changed Called after an entry changed, or NULL.
+ * @param _user_data Passed to @p _changed.
+ */
+#define APPCONFIG_INITIALIZER(_name, _entries, _changed, _user_data)           \
+	{                                                                      \
+		.name = (_name),                                               \
+		.entries = (_entries),                                         \
+		.num_entries = ARRAY_SIZE(_entries),                           \
+		.changed = (_changed),                                         \
+		.user_data = (_user_data),                                     \
+	}
+
+/**
+ * @brief Register a group and load its saved values.
+ *
+ * Entries start at their default, then take the values saved earlier.
+ * Saved values out of range are ignored. The callback is not called for
+ * the loaded values: read them once this returns.
+ *
+ * @param cfg Group to register.
+ *
+ * @retval 0 if successful.
+ * @retval -EALREADY if a group of the same name is registered.
+ * @retval -EINVAL if an entry or its default is invalid.
+ * @retval -errno Other negative errno code if the settings failed to load.
+ */
+int appconfig_register(struct appconfig *cfg);
+
+/**
+ * @brief Get the value of an integer entry.
+ *
+ * @param cfg Registered group.
+ * @param name Name of the entry.
+ * @param value Filled with the value.
+ *
+ * @retval 0 if successful.
+ * @retval -ENOENT if there is no such entry.
+ * @retval -EINVAL if the entry is not an integer.
+ */
+int appconfig_get_uint(struct appconfig *cfg, const char *name,
+		       uint32_t *value);
+
+/**
+ * @brief Get the value of a string entry.
+ *
+ * @param cfg Registered group.
+ * @param name Name of the entry.
+ * @param buf Filled with the value, NUL-terminated.
+ * @param len Size of @p buf.
+ *
+ * @retval 0 if successful.
+ * @retval -ENOENT if there is no such entry.
+ * @retval -EINVAL if the entry is not a string.
+ * @retval -ENOSPC if the value does not fit in @p buf.
+ */
+int appconfig_get_string(struct appconfig *cfg, const char *name, char *buf,
+			 size_t len);
+
+/**
+ * @brief Set an entry from its text form, save it and report the change.
+ *
+ * Integers are parsed in decimal, or in hexadecimal with a 0x prefix.
+ * Setting an entry to its current value does nothing.
+ *
+ * @param cfg Registered group.
+ * @param name Name of the entry.
+ * @param value New value.
+ *
+ * @retval 0 if successful.
+ * @retval -ENOENT if there is no such entry.
+ * @retval -EINVAL if @p value is not valid for the entry.
+ * @retval -errno Other negative errno code if it could not be saved; the
+ *         entry keeps its value.
+ */
+int appconfig_set(struct appconfig *cfg, const char *name, const char *value);
+
+/**
+ * @brief Set an entry back to its default and forget the saved value.
+ *
+ * @param cfg Registered group.
+ * @param name Name of the entry.
+ *
+ * @retval 0 if successful.
+ * @retval -ENOENT if there is no such entry.
+ * @retval -errno Other negative errno code if the saved value could not be
+ *         deleted.
+ */
+int appconfig_reset(struct appconfig *cfg, const char *name);
+
+/**
+ * @brief Find a registered group.
+ *
+ * @param name Name of the group.
+ *
+ * @return The group, or NULL if none is registered under @p name.
+ */
+struct appconfig *appconfig_find(const char *name);
+
+/** @brief Callback of appconfig_foreach(). */
+typedef void (*appconfig_cb_t)(struct appconfig *cfg, void *user_data);
+
+/**
+ * @brief Call @p fn for every registered group.
+ *
+ * @param fn Callback.
+ * @param user_data Passed to @p fn.
+ */
+void appconfig_foreach(appconfig_cb_t fn, void *user_data);
+
+/** @} */
+
+#endif /* APP_LIB_APPCONFIG_H_ */
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_FILTERS_H_
+#define APP_LIB_FILTERS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @defgroup lib_filters Filter library
+ * @ingroup lib
+ * @{
+ *
+ * @brief Combine repeated readings of one quantity into a single value.
+ *
+ * The filters work on integers, such as milli-units or raw sensor counts,
+ * and round their results to the nearest integer. The ones based on order
+ * sort the readings in place: they are meant for the few readings of one
+ * oversampled measurement, not for long series.
+ */
+
+/** @brief Ways of combining readings. */
+enum filter_type {
+	/** Arithmetic mean: lowest noise for well-behaved readings. */
+	FILTER_MEAN,
+	/** Median: ignores up to half of the readings being outliers. */
+	FILTER_MEDIAN,
+	/**
+	 * Mean of the middle half, the lowest and highest quarter of the
+	 * readings being dropped: close to the mean on well-behaved
+	 * readings, and robust to a few outliers.
+	 */
+	FILTER_TRIMMED_MEAN,
+};
+
+/**
+ * @brief Mean of @p n readings, rounded to the nearest integer.
+ *
+ * @param values Readings.
+ * @param n Number of readings, at least 1.
+ */
+int32_t filter_mean(const int32_t *values, size_t n);
+
+/**
+ * @brief Median of @p n readings.
+ *
+ * For an even number of readings, the mean of the two middle ones.
+ *
+ * @param values Readings, sorted on return.
+ * @param n Number of readings, at least 1.
+ */
+int32_t filter_median(int32_t *values, size_t n);
+
+/**
+ * @brief Mean of @p n readings without the @p trim lowest and highest ones.
+ *
+ * @param values Readings, sorted on return.
+ * @param n Number of readings, at least 1.
+ * @param trim Readings dropped at each end. Trimming all of them or all but
+ *             one gives the median.
+ */
+int32_t filter_trimmed_mean(int32_t *values, size_t n, size_t trim);
+
+/**
+ * @brief Combine @p n readings with the filter @p type.
+ *
+ * @param type Filter to apply.
+ * @param values Readings, possibly reordered on return.
+ * @param n Number of readings.
+ * @param out Combined value.
+ *
+ * @retval 0 if successful.
+ * @retval -EINVAL if there are no readings or @p type is unknown.
+ */
+int filter_apply(enum filter_type type, int32_t *values, size_t n,
+		 int32_t *out);
+
+/**
+ * @brief Name of the filter @p type, or NULL if unknown.
+ */
+const char *filter_name(enum filter_type type);
+
+/** @} */
+
+#endif /* APP_LIB_FILTERS_H_ */
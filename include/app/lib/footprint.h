@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_FOOTPRINT_H_
+#define APP_LIB_FOOTPRINT_H_
+
+/**
+ * @defgroup lib_footprint Stack footprint report
+ * @ingroup lib
+ * @{
+ *
+ * @brief Thread stack high-water marks, printed for tooling to collect.
+ *
+ * Every thread's stack is filled with a known pattern when it is created;
+ * the report measures how much of it has been overwritten since. The lines
+ * are meant for `west footprint`, which builds and runs the apps through a
+ * scenario and combines them with the RAM and ROM usage of the image:
+ *
+ * @code{.unparsed}
+ * footprint: begin
+ * footprint: stack <size> <used> <thread name>
+ * footprint: end
+ * @endcode
+ *
+ * Stacks only give meaningful numbers on boards that run threads on their
+ * Zephyr stacks, i.e. not on native_sim, where threads run on host stacks.
+ */
+
+/**
+ * @brief Print the stack usage of every thread.
+ *
+ * Called automatically CONFIG_FOOTPRINT_REPORT_DELAY_MS after boot when
+ * that is non-zero. Call it at the end of a scenario otherwise.
+ */
+void footprint_report(void);
+
+/** @} */
+
+#endif /* APP_LIB_FOOTPRINT_H_ */
@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_INFERENCE_H_
+#define APP_LIB_INFERENCE_H_
+
+#include <stdint.h>
+
+#include <zephyr/net_buf.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup lib_inference Inference library
+ * @ingroup lib
+ * @{
+ *
+ * @brief Classification of sample windows on the device.
+ *
+ * Windows are chains of pipeline samples (see @ref lib_pipeline), such as
+ * those passed on around a change by a change detection stage. Each one is
+ * classified by the backend compiled in:
+ *
+ * - CONFIG_INFERENCE_BACKEND_CENTROID, a nearest centroid classifier over
+ *   the change and the range of each value in the window, with the model
+ *   given by the application. It needs no library and runs anywhere.
+ * - CONFIG_INFERENCE_BACKEND_TFLM, a float32 TensorFlow Lite model given
+ *   by the application and run by the tflite-micro module. It is fed the
+ *   samples of the window as offsets from its first sample, in the units
+ *   of each value.
+ *
+ * Classification runs in the caller's thread, typically a pipeline sink.
+ */
+
+/** @brief Outcome of one classification. */
+struct inference_result {
+	/** Most likely class. Points into the model, never NULL on success. */
+	const char *label;
+	/** Confidence in @ref label, in thousandths. */
+	uint16_t score;
+	/** Samples classified. */
+	uint16_t samples;
+	/** Time spent classifying, feature extraction included. */
+	uint32_t latency_us;
+};
+
+/** @brief Inference statistics, cumulative since boot. */
+struct inference_stats {
+	/** Windows classified. */
+	uint32_t runs;
+	/** Windows that could not be classified. */
+	uint32_t failures;
+	/** Latency of the last classification. */
+	uint32_t last_latency_us;
+	/** Largest latency seen. */
+	uint32_t max_latency_us;
+	/** Sum of all latencies, for the average. */
+	uint64_t total_latency_us;
+	/** Static RAM held by the backend: model input, arena and tables. */
+	uint32_t ram_bytes;
+};
+
+#ifdef CONFIG_INFERENCE_BACKEND_CENTROID
+
+/** @brief Features per value: change over the window, then its range. */
+#define INFERENCE_FEATURES_PER_VALUE 2
+
+/** @brief One class of a centroid model. */
+struct inference_class {
+	/** Class name, reported as the result label. */
+	const char *label;
+	/**
+	 * Typical features of the class, in thousandths of the value unit:
+	 * change and range of the first value, then of the second, etc.
+	 */
+	int32_t centroid[CONFIG_PIPELINE_MAX_VALUES *
+			 INFERENCE_FEATURES_PER_VALUE];
+};
+
+/** @brief Centroid model. */
+struct inference_model {
+	/** Values per sample the model expects. */
+	uint8_t num_values;
+	/**
+	 * Spread of each feature, in the units of the centroids. Distances
+	 * are measured in spreads, so that every feature weighs the same.
+	 */
+	const int32_t *scale;
+	/** Classes, at least one. */
+	const struct inference_class *classes;
+	/** Number of @ref classes. */
+	uint8_t num_classes;
+};
+
+#elif defined(CONFIG_INFERENCE_BACKEND_TFLM)
+
+/**
+ * @brief TensorFlow Lite Micro model.
+ *
+ * The model has one float32 input of a whole number of samples, each its
+ * values in order, and one float32 output of a score per label. Windows
+ * of more samples than the input holds are cut to their first ones, and
+ * shorter windows padded with their last sample.
+ */
+struct inference_model {
+	/** TFLite flatbuffer, aligned to 16 bytes. */
+	const uint8_t *tflite;
+	/** Values per sample the model expects. */
+	uint8_t num_values;
+	/** Label of each model output, in order. */
+	const char *const *labels;
+	/** Number of @ref labels, the size of the model output. */
+	uint8_t num_labels;
+};
+
+#endif /* CONFIG_INFERENCE_BACKEND_TFLM */
+
+/**
+ * @brief Set the model to classify with.
+ *
+ * @param model Model, which must stay valid while in use.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p model is malformed.
+ * @retval -ENOMEM if the model does not fit the tensor arena
+ *         (CONFIG_INFERENCE_TFLM_ARENA_SIZE).
+ */
+int inference_model_set(const struct inference_model *model);
+
+/**
+ * @brief Classify a window.
+ *
+ * @param samples Chain of samples, oldest first. Not consumed.
+ * @param result Filled with the most likely class.
+ *
+ * @retval 0 on success.
+ * @retval -ENODEV if there is no model to classify with.
+ * @retval -EINVAL if the samples do not fit the model.
+ * @retval -EIO if the backend failed.
+ */
+int inference_classify(struct net_buf *samples,
+		       struct inference_result *result);
+
+/**
+ * @brief Get a snapshot of the inference statistics.
+ *
+ * @param stats Filled with the current statistics.
+ */
+void inference_stats_get(struct inference_stats *stats);
+
+/** @brief Name of the backend compiled in. */
+const char *inference_backend_name(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_LIB_INFERENCE_H_ */
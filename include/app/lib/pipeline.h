@@ -0,0 +1,743 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_PIPELINE_H_
+#define APP_LIB_PIPELINE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/drivers/gpio.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net_buf.h>
+
+/**
+ * @defgroup lib_pipeline Sensor pipeline library
+ * @ingroup lib
+ * @{
+ *
+ * @brief Sensor-to-uplink data pipelines.
+ *
+ * A pipeline is an acquisition source followed by a list of stages. The
+ * source reads sensor channels and GPIO inputs into one sample per buffer,
+ * periodically or on demand. Stages transform samples in place, gather them
+ * into batches and hand the batches to sinks. Samples travel in buffers of
+ * a pool owned by the pipeline; batches are chains of those buffers, so no
+ * sample is copied between acquisition and the sink.
+ *
+ * Every stage runs on one of CONFIG_PIPELINE_THREADS shared work queues.
+ * A stage never runs concurrently with itself, and processes its buffers in
+ * order, but different stages of a pipeline run in parallel, so a slow sink
+ * does not hold back acquisition.
+ */
+
+/** @brief One sample, the content of a pipeline buffer. */
+struct pipeline_sample {
+	/** Uptime at which the sample was acquired, in milliseconds. */
+	int64_t timestamp_ms;
+	/**
+	 * Unix time at which the sample was acquired, in milliseconds, or 0
+	 * without CONFIG_PIPELINE_TIMESYNC or before the clock was first
+	 * synchronized.
+	 */
+	int64_t epoch_ms;
+	/** PIPELINE_SAMPLE_* flags. */
+	uint8_t flags;
+	/** Number of valid entries in @ref values. */
+	uint8_t count;
+	/** Sensor channels in acquisition order, then GPIO levels. */
+	struct sensor_value values[CONFIG_PIPELINE_MAX_VALUES];
+};
+
+/**
+ * @brief The sample is a summary: its values are averages over the samples
+ * since the previous summary, and its timestamps the ones of the first of
+ * them. See @ref pipeline_changedet.
+ */
+#define PIPELINE_SAMPLE_SUMMARY BIT(0)
+
+/**
+ * @brief Get the sample held by a buffer.
+ *
+ * @param buf One buffer of a pipeline, or one fragment of a batch.
+ */
+static inline struct pipeline_sample *pipeline_sample(struct net_buf *buf)
+{
+	return (struct pipeline_sample *)buf->data;
+}
+
+struct pipeline;
+struct pipeline_stage;
+
+/** @brief Operations of a stage. */
+struct pipeline_stage_api {
+	/** Optional: name of its tracepoints, "stage" if NULL. */
+	const char *name;
+	/** Optional: prepare the stage, called once by pipeline_start(). */
+	int (*init)(struct pipeline_stage *stage);
+	/**
+	 * Process one buffer, which may be a batch. Return the buffer to
+	 * pass on to the next stage, or NULL if the stage kept or released
+	 * it.
+	 */
+	struct net_buf *(*process)(struct pipeline_stage *stage,
+				   struct net_buf *buf);
+	/**
+	 * Optional: pass on whatever the stage holds, or NULL. Called on a
+	 * flush, once every buffer that reached the stage before it has been
+	 * processed.
+	 */
+	struct net_buf *(*flush)(struct pipeline_stage *stage);
+};
+
+/**
+ * @brief A stage, embedded as the first member of every stage type.
+ *
+ * Custom stages provide their own @ref pipeline_stage_api.
+ */
+struct pipeline_stage {
+	/** Stage operations. */
+	const struct pipeline_stage_api *api;
+
+	/* Set by pipeline_start() */
+	struct pipeline *pipeline;
+	struct pipeline_stage *next;
+	struct k_work_q *queue;
+	struct k_work work;
+	struct k_fifo fifo;
+	atomic_t flags;
+};
+
+/** @brief Acquisition source, the head of every pipeline. */
+struct pipeline_acquire {
+	/** Sensor to fetch a sample from, or NULL for GPIO inputs only. */
+	const struct device *sensor;
+	/** Channels of @ref sensor to read, in order. */
+	const enum sensor_channel *channels;
+	/** Number of entries in @ref channels. */
+	size_t num_channels;
+	/**
+	 * GPIO inputs read after the channels, as logical levels in val1.
+	 * The application configures them as inputs.
+	 */
+	const struct gpio_dt_spec *gpios;
+	/** Number of entries in @ref gpios. */
+	size_t num_gpios;
+	/** Acquisition period, or 0 to only acquire on pipeline_trigger(). */
+	uint32_t period_ms;
+	/**
+	 * Adapts @ref period_ms to the samples, or NULL for a fixed period.
+	 * Needs CONFIG_PIPELINE_ADAPTIVE.
+	 */
+	struct pipeline_adaptive *adaptive;
+
+	/* Set by pipeline_start() */
+	struct pipeline *pipeline;
+	struct k_work_q *queue;
+	struct k_work_delayable work;
+	int64_t deadline_ms;
+};
+
+/** @brief Stage applying a function to every sample. */
+struct pipeline_transform {
+	struct pipeline_stage stage;
+	/**
+	 * Modify @p sample in place. Return 0 to pass the sample on, or
+	 * non-zero to drop it.
+	 */
+	int (*fn)(struct pipeline_sample *sample, void *user_data);
+	/** Passed to @ref fn. */
+	void *user_data;
+};
+
+/** @brief Stage gathering samples into batches. */
+struct pipeline_batch {
+	struct pipeline_stage stage;
+	/** Number of samples per batch. */
+	uint16_t size;
+	/**
+	 * Pass on an incomplete batch once its first sample is this old, or
+	 * 0 to wait for @ref size samples or a flush.
+	 */
+	uint32_t max_age_ms;
+
+	/* Batch being gathered */
+	struct net_buf *head;
+	struct net_buf *tail;
+	uint16_t count;
+	struct k_timer timer;
+};
+
+/**
+ * @brief Stage consuming every buffer that reaches it.
+ *
+ * The buffer is passed on unchanged, so several sinks can follow each other
+ * and get the same samples. It is released after the last stage.
+ */
+struct pipeline_sink {
+	struct pipeline_stage stage;
+	/**
+	 * Consume a batch, or a single sample without a batch stage. Return
+	 * a negative errno code to count a failure.
+	 */
+	int (*fn)(struct net_buf *samples, void *user_data);
+	/** Passed to @ref fn. */
+	void *user_data;
+};
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct pipeline_stage_api pipeline_transform_api;
+extern const struct pipeline_stage_api pipeline_batch_api;
+extern const struct pipeline_stage_api pipeline_sink_api;
+void pipeline_buf_destroy(struct net_buf *buf);
+/** @endcond */
+
+/**
+ * @brief Initializer for a @ref pipeline_transform.
+ *
+ * @param _fn Function applied to every sample.
+ * @param _user_data Passed to @p _fn.
+ */
+#define PIPELINE_TRANSFORM_INITIALIZER(_fn, _user_data)                        \
+	{                                                                      \
+		.stage = { .api = &pipeline_transform_api },                   \
+		.fn = (_fn),                                                   \
+		.user_data = (_user_data),                                     \
+	}
+
+/**
+ * @brief Initializer for a @ref pipeline_batch.
+ *
+ * @param _size Number of samples per batch.
+ * @param _max_age_ms Age of the first sample at which an incomplete batch is
+ *                    passed on, or 0.
+ */
+#define PIPELINE_BATCH_INITIALIZER(_size, _max_age_ms)                         \
+	{                                                                      \
+		.stage = { .api = &pipeline_batch_api },                       \
+		.size = (_size),                                               \
+		.max_age_ms = (_max_age_ms),                                   \
+	}
+
+/**
+ * @brief Initializer for a @ref pipeline_sink.
+ *
+ * @param _fn Function consuming every batch.
+ * @param _user_data Passed to @p _fn.
+ */
+#define PIPELINE_SINK_INITIALIZER(_fn, _user_data)                             \
+	{                                                                      \
+		.stage = { .api = &pipeline_sink_api },                        \
+		.fn = (_fn),                                                   \
+		.user_data = (_user_data),                                     \
+	}
+
+/**
+ * @brief Pipeline statistics.
+ *
+ * Counters are cumulative since boot.
+ */
+struct pipeline_stats {
+	/** Samples acquired. */
+	uint32_t acquired;
+	/**
+	 * Acquisitions skipped because every buffer was in use. The first
+	 * of a shortage flushes the pipeline, so that stages holding
+	 * samples pass them on and release their buffers.
+	 */
+	uint32_t no_buf;
+	/** Acquisitions that failed to read a channel or input. */
+	uint32_t acquire_errors;
+	/** Samples dropped by transform and change detection stages. */
+	uint32_t dropped;
+	/** Samples handed to sinks. */
+	uint32_t delivered;
+	/** Sink calls that returned an error. */
+	uint32_t sink_errors;
+	/** Sample buffers in use, acquired and not yet released. */
+	uint32_t bufs_used;
+	/** Most sample buffers in use at once, the pool high-water mark. */
+	uint32_t bufs_max_used;
+};
+
+/** @brief A pipeline, defined with @ref PIPELINE_DEFINE. */
+struct pipeline {
+	const char *name;
+	struct net_buf_pool *pool;
+	struct pipeline_acquire *source;
+	struct pipeline_stage *const *stages;
+	size_t num_stages;
+
+	atomic_t state;
+	struct pipeline_stats stats;
+	struct k_spinlock lock;
+	sys_snode_t node;
+};
+
+/**
+ * @brief Define a pipeline.
+ *
+ * @param _name Name of the pipeline variable.
+ * @param _num_bufs Number of samples that can be in flight, including those
+ *                  held by batch stages.
+ * @param _source Pointer to the @ref pipeline_acquire source.
+ * @param ... Pointers to the @ref pipeline_stage of every stage, in order.
+ */
+#define PIPELINE_DEFINE(_name, _num_bufs, _source, ...)                        \
+	NET_BUF_POOL_FIXED_DEFINE(_name##_pool, _num_bufs,                     \
+				  sizeof(struct pipeline_sample),              \
+				  sizeof(struct pipeline *),                   \
+				  pipeline_buf_destroy);                       \
+	static struct pipeline_stage *const _name##_stages[] = {               \
+		__VA_ARGS__                                                    \
+	};                                                                     \
+	static struct pipeline _name = {                                       \
+		.name = #_name,                                                \
+		.pool = &_name##_pool,                                         \
+		.source = (_source),                                           \
+		.stages = _name##_stages,                                      \
+		.num_stages = ARRAY_SIZE(_name##_stages),                      \
+	}
+
+/**
+ * @brief Start a pipeline.
+ *
+ * Periodic acquisition starts right away.
+ *
+ * @param pipeline Pipeline to start.
+ *
+ * @retval 0 if successful.
+ * @retval -EALREADY if the pipeline is running.
+ * @retval -ENODEV if a sensor or GPIO controller is not ready.
+ * @retval -EINVAL if a sample does not fit CONFIG_PIPELINE_MAX_VALUES.
+ * @retval -errno Other negative errno code if a stage failed to initialize.
+ */
+int pipeline_start(struct pipeline *pipeline);
+
+/**
+ * @brief Stop a pipeline.
+ *
+ * Acquisition stops, then the samples in flight are flushed through to the
+ * sinks, including incomplete batches.
+ *
+ * @param pipeline Pipeline to stop.
+ *
+ * @retval 0 if successful.
+ * @retval -EALREADY if the pipeline is not running.
+ */
+int pipeline_stop(struct pipeline *pipeline);
+
+/**
+ * @brief Acquire one sample now.
+ *
+ * @param pipeline Pipeline with on-demand acquisition.
+ *
+ * @retval 0 if an acquisition was queued.
+ * @retval -EAGAIN if the pipeline is not running.
+ * @retval -ENOTSUP if the pipeline acquires periodically.
+ */
+int pipeline_trigger(struct pipeline *pipeline);
+
+/**
+ * @brief Change the acquisition period of a running or stopped pipeline.
+ *
+ * The next sample is acquired @p period_ms after the previous one, or right
+ * away if that is already past. With an adaptive period, @p period_ms is
+ * clamped to its bounds and adapted from there.
+ *
+ * @param pipeline Pipeline with periodic acquisition.
+ * @param period_ms New period.
+ *
+ * @retval 0 if successful.
+ * @retval -EINVAL if @p period_ms is 0.
+ * @retval -ENOTSUP if the pipeline acquires on demand.
+ */
+int pipeline_period_set(struct pipeline *pipeline, uint32_t period_ms);
+
+/**
+ * @brief Pass on incomplete batches.
+ *
+ * Samples acquired before the call reach the sinks without waiting for
+ * their batch to fill up. Returns without waiting for them to get there.
+ *
+ * @param pipeline Pipeline to flush.
+ */
+void pipeline_flush(struct pipeline *pipeline);
+
+/**
+ * @brief Get a snapshot of the pipeline statistics.
+ *
+ * @param pipeline Pipeline to query.
+ * @param stats Filled with the current statistics.
+ */
+void pipeline_stats_get(struct pipeline *pipeline,
+			struct pipeline_stats *stats);
+
+/** @brief Callback of pipeline_foreach(). */
+typedef void (*pipeline_cb_t)(struct pipeline *pipeline, void *user_data);
+
+/**
+ * @brief Iterate over the pipelines started at least once.
+ *
+ * @param fn Called for every pipeline, in the order they were first started.
+ * @param user_data Passed to @p fn.
+ */
+void pipeline_foreach(pipeline_cb_t fn, void *user_data);
+
+#ifdef CONFIG_PIPELINE_CHANGEDET
+
+/**
+ * @brief Change detection parameters.
+ *
+ * Levels are in thousandths of the unit of the values, e.g. milli-degrees.
+ */
+struct pipeline_changedet_params {
+	/** Weight of a new sample in the running mean, 1 / 2^alpha_shift. */
+	uint8_t alpha_shift;
+	/** Deviation from the mean tolerated as noise, the CUSUM drift. */
+	int32_t drift;
+	/** Accumulated deviation at which a change is detected. */
+	int32_t threshold;
+	/** Samples from before a change passed on with it. */
+	uint16_t pre;
+	/** Samples passed on after the last change. */
+	uint16_t post;
+	/** Samples after which a summary is passed on, or 0 for none. */
+	uint16_t heartbeat;
+};
+
+/** @brief Change detection statistics, cumulative since boot. */
+struct pipeline_changedet_stats {
+	/** Samples processed. */
+	uint32_t samples;
+	/** Changes detected. */
+	uint32_t changes;
+	/** Windows passed on. */
+	uint32_t windows;
+	/** Samples passed on in windows. */
+	uint32_t window_samples;
+	/** Summaries passed on. */
+	uint32_t heartbeats;
+};
+
+/**
+ * @brief Stage passing on samples around changes only.
+ *
+ * Every value is tracked by an exponentially weighted running mean, and a
+ * two-sided CUSUM of its deviations from that mean. When either sum of any
+ * value crosses the threshold, the samples from @ref
+ * pipeline_changedet_params.pre before the change up to @ref
+ * pipeline_changedet_params.post after the last change are passed on as
+ * one chain, a window. A window is also passed on once it holds pre + 1 +
+ * post samples, and the next one continues from there.
+ *
+ * The other samples are released, and replaced by one summary every
+ * @ref pipeline_changedet_params.heartbeat samples, flagged with
+ * @ref PIPELINE_SAMPLE_SUMMARY. A quiet sample is summarized once it is no
+ * longer one of the last pre, so it is never both in a window and in a
+ * summary, and summaries lag the samples by pre. The summary takes one more
+ * buffer of the pipeline: size the pool for pre + post + 2 samples on top
+ * of the ones in flight elsewhere. Parameters for which pre + 1 + post + 2
+ * exceeds the pool are refused. Should the pool run out anyway, e.g. while
+ * a sink holds on to an earlier window, the pipeline is flushed and the
+ * window passed on as it is.
+ *
+ * Place it before any batch stage: it expects single samples.
+ */
+struct pipeline_changedet {
+	struct pipeline_stage stage;
+	/** Parameters, see pipeline_changedet_params_set(). */
+	struct pipeline_changedet_params params;
+
+	/* Detector, per value: mean scaled by 256, and both CUSUMs */
+	int64_t mean[CONFIG_PIPELINE_MAX_VALUES];
+	int64_t pos[CONFIG_PIPELINE_MAX_VALUES];
+	int64_t neg[CONFIG_PIPELINE_MAX_VALUES];
+	bool primed;
+
+	/* Samples from before a change, oldest at ring_head */
+	struct net_buf *ring[CONFIG_PIPELINE_CHANGEDET_MAX_PRE];
+	uint16_t ring_head;
+	uint16_t ring_count;
+
+	/* Window being gathered */
+	struct net_buf *head;
+	struct net_buf *tail;
+	uint16_t count;
+	uint16_t post_left;
+
+	/* Summary being accumulated */
+	int64_t sum[CONFIG_PIPELINE_MAX_VALUES];
+	struct pipeline_sample first;
+	uint16_t summarized;
+
+	struct pipeline_changedet_stats stats;
+	struct k_spinlock lock;
+	sys_snode_t node;
+};
+
+/** @cond INTERNAL_HIDDEN */
+extern const struct pipeline_stage_api pipeline_changedet_api;
+/** @endcond */
+
+/**
+ * @brief Initializer for a @ref pipeline_changedet, with the parameters
+ * set through Kconfig.
+ */
+#define PIPELINE_CHANGEDET_INITIALIZER()                                       \
+	{                                                                      \
+		.stage = { .api = &pipeline_changedet_api },                   \
+		.params = {                                                    \
+			.alpha_shift = CONFIG_PIPELINE_CHANGEDET_ALPHA_SHIFT,  \
+			.drift = CONFIG_PIPELINE_CHANGEDET_DRIFT,              \
+			.threshold = CONFIG_PIPELINE_CHANGEDET_THRESHOLD,      \
+			.pre = CONFIG_PIPELINE_CHANGEDET_PRE,                  \
+			.post = CONFIG_PIPELINE_CHANGEDET_POST,                \
+			.heartbeat = CONFIG_PIPELINE_CHANGEDET_HEARTBEAT,      \
+		},                                                             \
+	}
+
+/**
+ * @brief Change the parameters of a change detection stage.
+ *
+ * Takes effect from the next sample. The running means are kept.
+ *
+ * @param changedet Stage to configure.
+ * @param params New parameters.
+ *
+ * @retval 0 if successful.
+ * @retval -EINVAL if @p params is out of range, e.g. more pre-change samples
+ *         than CONFIG_PIPELINE_CHANGEDET_MAX_PRE.
+ * @retval -ENOBUFS if a window of pre + 1 + post samples, a summary and a
+ *         sample being acquired do not fit in the buffers of the pipeline.
+ */
+int pipeline_changedet_params_set(
+	struct pipeline_changedet *changedet,
+	const struct pipeline_changedet_params *params);
+
+/**
+ * @brief Get the parameters of a change detection stage.
+ *
+ * @param changedet Stage to query.
+ * @param params Filled with the current parameters.
+ */
+void pipeline_changedet_params_get(struct pipeline_changedet *changedet,
+				   struct pipeline_changedet_params *params);
+
+/**
+ * @brief Get a snapshot of the statistics of a change detection stage.
+ *
+ * @param changedet Stage to query.
+ * @param stats Filled with the current statistics.
+ */
+void pipeline_changedet_stats_get(struct pipeline_changedet *changedet,
+				  struct pipeline_changedet_stats *stats);
+
+/** @brief Callback of pipeline_changedet_foreach(). */
+typedef void (*pipeline_changedet_cb_t)(struct pipeline_changedet *changedet,
+					void *user_data);
+
+/**
+ * @brief Iterate over the change detection stages of started pipelines.
+ *
+ * @param fn Called for every stage, in the order they were started.
+ * @param user_data Passed to @p fn.
+ */
+void pipeline_changedet_foreach(pipeline_changedet_cb_t fn, void *user_data);
+
+#endif /* CONFIG_PIPELINE_CHANGEDET */
+
+#ifdef CONFIG_PIPELINE_ADAPTIVE
+
+/** @brief Adaptive period statistics, cumulative since the start. */
+struct pipeline_adaptive_stats {
+	/** Samples after which the period was shortened. */
+	uint32_t faster;
+	/** Samples after which the period was lengthened. */
+	uint32_t slower;
+	/** Current period. */
+	uint32_t period_ms;
+};
+
+/**
+ * @brief Acquisition period following how fast the values change.
+ *
+ * Each value has a threshold, the change worth a sample. When a value has
+ * moved by more than its threshold since the last change, or since the
+ * previous sample, the period is set to the time it takes to move by one
+ * threshold at that rate. When values
+ * fluctuate from one sample to the next by more than half their threshold,
+ * the period is halved. After @ref hold quiet samples, it is doubled. The
+ * period stays within @ref min_period_ms and @ref max_period_ms.
+ *
+ * Batch stages age batches in milliseconds, so their deadlines hold at any
+ * period; stages counting samples, like the change detection heartbeat,
+ * see them spread further apart while the values are flat.
+ */
+struct pipeline_adaptive {
+	/** Shortest period, while values change fast. */
+	uint32_t min_period_ms;
+	/** Longest period, while values are flat. */
+	uint32_t max_period_ms;
+	/** Threshold of each value, in thousandths of its unit. */
+	const int32_t *thresholds;
+	/** Number of @ref thresholds; later values are not watched. */
+	uint8_t num_thresholds;
+	/** Quiet samples before the period is doubled. */
+	uint8_t hold;
+
+	/* Values at the last change, previous values, and their variance */
+	int64_t ref[CONFIG_PIPELINE_MAX_VALUES];
+	int64_t prev[CONFIG_PIPELINE_MAX_VALUES];
+	int64_t var[CONFIG_PIPELINE_MAX_VALUES];
+	int64_t ref_ms;
+	int64_t prev_ms;
+	uint8_t quiet;
+	bool primed;
+
+	struct pipeline_adaptive_stats stats;
+	struct k_spinlock lock;
+};
+
+/**
+ * @brief Initializer for a @ref pipeline_adaptive.
+ *
+ * @param _min_ms Shortest period.
+ * @param _max_ms Longest period.
+ * @param _thresholds Array of thresholds, one per value watched.
+ * @param _hold Quiet samples before the period is doubled.
+ */
+#define PIPELINE_ADAPTIVE_INITIALIZER(_min_ms, _max_ms, _thresholds, _hold)  \
+	{                                                                      \
+		.min_period_ms = (_min_ms),                                    \
+		.max_period_ms = (_max_ms),                                    \
+		.thresholds = (_thresholds),                                   \
+		.num_thresholds = ARRAY_SIZE(_thresholds),                     \
+		.hold = (_hold),                                               \
+	}
+
+/**
+ * @brief Feed a sample to an adaptive period.
+ *
+ * Called by the acquisition of a pipeline for every sample. Exposed for
+ * sources outside of a pipeline and for tests.
+ *
+ * @param adaptive Adaptive period.
+ * @param sample Sample just acquired.
+ * @param period_ms Period the sample was acquired at.
+ *
+ * @return Period until the next sample.
+ */
+uint32_t pipeline_adaptive_update(struct pipeline_adaptive *adaptive,
+				  const struct pipeline_sample *sample,
+				  uint32_t period_ms);
+
+/**
+ * @brief Start an adaptive period over, as for a new pipeline start.
+ *
+ * @param adaptive Adaptive period.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if its bounds or thresholds are invalid.
+ */
+int pipeline_adaptive_reset(struct pipeline_adaptive *adaptive);
+
+/**
+ * @brief Change the bounds of an adaptive period.
+ *
+ * Takes effect from the next sample. To bring the current period within
+ * the new bounds right away, follow with pipeline_period_set().
+ *
+ * @param adaptive Adaptive period.
+ * @param min_period_ms Shortest period.
+ * @param max_period_ms Longest period.
+ *
+ * @retval 0 if successful.
+ * @retval -EINVAL if the bounds are invalid.
+ */
+int pipeline_adaptive_bounds_set(struct pipeline_adaptive *adaptive,
+				 uint32_t min_period_ms,
+				 uint32_t max_period_ms);
+
+/**
+ * @brief Get a snapshot of the statistics of an adaptive period.
+ *
+ * @param adaptive Adaptive period.
+ * @param stats Filled with the current statistics.
+ */
+void pipeline_adaptive_stats_get(struct pipeline_adaptive *adaptive,
+				 struct pipeline_adaptive_stats *stats);
+
+#endif /* CONFIG_PIPELINE_ADAPTIVE */
+
+/**
+ * @brief Buffer a sink encodes a batch into, see pipeline_payload_alloc().
+ *
+ * Payloads come from a memory slab shared by all pipelines and are
+ * reference counted: a payload encoded once can be handed to several
+ * consumers, say two transports, and goes back to the slab when the last
+ * one is done with it.
+ */
+struct pipeline_payload {
+	/** Bytes of @ref data in use. */
+	size_t len;
+	/** Capacity of @ref data, CONFIG_PIPELINE_PAYLOAD_SIZE. */
+	size_t size;
+	/** References, managed by the pipeline_payload_ functions. */
+	atomic_t ref;
+	/** Payload bytes. */
+	uint8_t data[] __aligned(sizeof(void *));
+};
+
+/** @brief Statistics of the payload slab. */
+struct pipeline_payload_stats {
+	/** Number of payloads in the slab. */
+	uint32_t count;
+	/** Payloads allocated and not yet released. */
+	uint32_t used;
+	/** Most payloads in use at once, the slab high-water mark. */
+	uint32_t max_used;
+	/** Allocations that failed because the slab was exhausted. */
+	uint32_t failures;
+};
+
+/**
+ * @brief Allocate an empty payload with one reference.
+ *
+ * @param timeout How long to wait for a payload to be released when they
+ *                are all in use.
+ *
+ * @return The payload, or NULL if none became available in time.
+ */
+struct pipeline_payload *pipeline_payload_alloc(k_timeout_t timeout);
+
+/**
+ * @brief Take another reference to a payload.
+ *
+ * @param payload Payload to reference.
+ *
+ * @return @p payload.
+ */
+struct pipeline_payload *pipeline_payload_ref(struct pipeline_payload *payload);
+
+/**
+ * @brief Drop a reference to a payload, freeing it with the last one.
+ *
+ * @param payload Payload to release.
+ */
+void pipeline_payload_unref(struct pipeline_payload *payload);
+
+/**
+ * @brief Get a snapshot of the payload slab statistics.
+ *
+ * @param stats Filled with the current statistics.
+ */
+void pipeline_payload_stats_get(struct pipeline_payload_stats *stats);
+
+/** @} */
+
+#endif /* APP_LIB_PIPELINE_H_ */
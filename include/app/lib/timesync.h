@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_TIMESYNC_H_
+#define APP_LIB_TIMESYNC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+
+/**
+ * @defgroup lib_timesync Time synchronization library
+ * @ingroup lib
+ * @{
+ *
+ * @brief Wall clock time from an SNTP server.
+ *
+ * The library keeps an offset from the kernel uptime to Unix time, measured
+ * against CONFIG_TIMESYNC_SERVER once started and then every
+ * CONFIG_TIMESYNC_INTERVAL_S seconds. Small errors found by a resync are
+ * slewed away at no more than CONFIG_TIMESYNC_SLEW_PPM, so the clock never
+ * goes back in time; only errors larger than CONFIG_TIMESYNC_STEP_MS, like
+ * the one of the first synchronization, are stepped.
+ *
+ * Queries run on a thread of the library, so the caller never blocks on the
+ * network unless it asks to.
+ */
+
+/** @brief Time synchronization statistics, cumulative since boot. */
+struct timesync_stats {
+	/** Successful synchronizations. */
+	uint32_t syncs;
+	/** Queries that failed or timed out. */
+	uint32_t failures;
+	/** Synchronizations that stepped the clock instead of slewing it. */
+	uint32_t steps;
+	/** Error found by the last synchronization, server minus local. */
+	int32_t last_error_ms;
+	/** Largest absolute error that was slewed rather than stepped. */
+	uint32_t max_error_ms;
+	/** Round trip time of the last successful query. */
+	uint32_t last_rtt_ms;
+	/** Uptime of the last successful synchronization. */
+	int64_t last_sync_ms;
+	/** Correction still to be slewed away. */
+	int32_t slewing_ms;
+};
+
+/**
+ * @brief Start synchronizing.
+ *
+ * Queries the server right away, then keeps the clock synchronized in the
+ * background, retrying every CONFIG_TIMESYNC_RETRY_S seconds after a failed
+ * query. Call it once the network is up; calling it again forces an
+ * immediate resync.
+ *
+ * @param timeout How long to wait for the first query to complete. The
+ *                library keeps trying in the background after a timeout.
+ *
+ * @retval 0 if the clock is synchronized.
+ * @retval -EAGAIN if the query did not complete within @p timeout.
+ * @retval -errno Negative errno code of the failed query.
+ */
+int timesync_start(k_timeout_t timeout);
+
+/** @brief Stop synchronizing. The clock keeps running on its last offset. */
+void timesync_stop(void);
+
+/** @brief Whether the clock has been synchronized at least once. */
+bool timesync_is_synced(void);
+
+/**
+ * @brief Convert an uptime into Unix time.
+ *
+ * @param uptime_ms Uptime, as returned by k_uptime_get().
+ * @param epoch_ms Filled with the matching milliseconds since the epoch.
+ *
+ * @retval 0 if successful.
+ * @retval -EAGAIN if the clock has never been synchronized.
+ */
+int timesync_to_epoch_ms(int64_t uptime_ms, int64_t *epoch_ms);
+
+/**
+ * @brief Get the current Unix time.
+ *
+ * @param epoch_ms Filled with the milliseconds since the epoch.
+ *
+ * @retval 0 if successful.
+ * @retval -EAGAIN if the clock has never been synchronized.
+ */
+static inline int timesync_now_ms(int64_t *epoch_ms)
+{
+	return timesync_to_epoch_ms(k_uptime_get(), epoch_ms);
+}
+
+/**
+ * @brief Get a snapshot of the synchronization statistics.
+ *
+ * @param stats Filled with the current statistics.
+ */
+void timesync_stats_get(struct timesync_stats *stats);
+
+/** @} */
+
+#endif /* APP_LIB_TIMESYNC_H_ */
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_TRACEPOINTS_H_
+#define APP_LIB_TRACEPOINTS_H_
+
+#include <stdint.h>
+
+#include <zephyr/sys/util.h>
+
+/**
+ * @defgroup lib_tracepoints Stage tracepoints
+ * @ingroup lib
+ * @{
+ *
+ * @brief Spans of time marked in the kernel trace.
+ *
+ * A span is a begin and an end tracepoint of the same name and id, emitted
+ * as tracing named events whose first argument is the phase and second the
+ * id. The id tells apart instances that may run at the same time, such as
+ * the stages of two pipelines; spans of the same name and id never overlap.
+ * Names are stage names, shared by every instance, and at most
+ * @ref TRACEPOINT_NAME_MAX_LEN characters, the length of a CTF named event.
+ *
+ * Record a trace with the CTF format, e.g. on native_sim:
+ *
+ * @code{.unparsed}
+ * CONFIG_TRACING=y
+ * CONFIG_TRACING_CTF=y
+ * CONFIG_TRACING_BACKEND_POSIX=y
+ * CONFIG_TRACEPOINTS=y
+ * @endcode
+ *
+ * then run scripts/trace_report.py on it for the time spent in each stage
+ * and a timeline to open in Perfetto.
+ *
+ * Without CONFIG_TRACEPOINTS the tracepoints compile to nothing.
+ */
+
+/** @brief Longest name of a tracepoint. */
+#define TRACEPOINT_NAME_MAX_LEN 19
+
+/** @brief Phase of a tracepoint, the first argument of its event. */
+enum tracepoint_phase {
+	TRACEPOINT_BEGIN,
+	TRACEPOINT_END,
+};
+
+/** @brief Id of a span from the address of the object it runs for. */
+#define TRACEPOINT_ID(_ptr) ((uint32_t)(uintptr_t)(_ptr))
+
+#ifdef CONFIG_TRACEPOINTS
+
+/**
+ * @brief Mark the beginning of a span.
+ *
+ * @param name Name of the stage.
+ * @param id Instance of the stage.
+ */
+void tracepoint_begin(const char *name, uint32_t id);
+
+/**
+ * @brief Mark the end of a span.
+ *
+ * @param name Name of the stage, as given to tracepoint_begin().
+ * @param id Instance of the stage, as given to tracepoint_begin().
+ */
+void tracepoint_end(const char *name, uint32_t id);
+
+#else
+
+static inline void tracepoint_begin(const char *name, uint32_t id)
+{
+	ARG_UNUSED(name);
+	ARG_UNUSED(id);
+}
+
+static inline void tracepoint_end(const char *name, uint32_t id)
+{
+	ARG_UNUSED(name);
+	ARG_UNUSED(id);
+}
+
+#endif /* CONFIG_TRACEPOINTS */
+
+/** @} */
+
+#endif /* APP_LIB_TRACEPOINTS_H_ */
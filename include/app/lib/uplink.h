@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_UPLINK_H_
+#define APP_LIB_UPLINK_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/kernel.h>
+
+/**
+ * @defgroup lib_uplink Telemetry uplink library
+ * @ingroup lib
+ * @{
+ *
+ * @brief Transport-agnostic telemetry uplink.
+ *
+ * Applications hand encoded payloads to the uplink without knowing how they
+ * travel. The transport backend is selected at build time through Kconfig:
+ * HTTP POST with one connection per message, a single long-lived MQTT
+ * session with pipelined publishes, or confirmable CoAP requests over UDP.
+ */
+
+/** @brief One message to send. */
+struct uplink_msg {
+	/** Short identifier of the message, e.g. a sample window label. */
+	const char *label;
+	/** Encoded payload. */
+	const uint8_t *payload;
+	/** Payload length in bytes. */
+	size_t len;
+	/** MIME type of @p payload, used by backends that carry one. */
+	const char *content_type;
+	/**
+	 * Extra CRLF-terminated header lines for backends that carry headers,
+	 * or NULL. Ignored by the other backends.
+	 */
+	const char *headers;
+	/**
+	 * Path used instead of the peer's for this message, or NULL: the
+	 * HTTP request path, MQTT topic prefix or CoAP resource path.
+	 */
+	const char *path;
+};
+
+/** @brief Longest peer host name, without the terminating NUL. */
+#define UPLINK_HOST_MAX_LEN 63
+
+/** @brief Longest peer path, without the terminating NUL. */
+#define UPLINK_PATH_MAX_LEN 63
+
+/** @brief Path of the backend from Kconfig, where messages go at first. */
+#if defined(CONFIG_UPLINK_BACKEND_HTTP)
+#define UPLINK_PATH_DEFAULT CONFIG_UPLINK_HTTP_PATH
+#elif defined(CONFIG_UPLINK_BACKEND_MQTT)
+#define UPLINK_PATH_DEFAULT CONFIG_UPLINK_MQTT_TOPIC_PREFIX
+#else
+#define UPLINK_PATH_DEFAULT CONFIG_UPLINK_COAP_PATH
+#endif
+
+/**
+ * @brief Where messages are sent.
+ *
+ * Starts out as CONFIG_UPLINK_HOST, CONFIG_UPLINK_PORT and
+ * UPLINK_PATH_DEFAULT.
+ */
+struct uplink_peer {
+	/** Host name or address. */
+	char host[UPLINK_HOST_MAX_LEN + 1];
+	/** Port. */
+	uint16_t port;
+	/** HTTP request path, MQTT topic prefix or CoAP resource path. */
+	char path[UPLINK_PATH_MAX_LEN + 1];
+};
+
+/** @brief Uplink statistics, cumulative since boot. */
+struct uplink_stats {
+	/** Messages handed to the transport. */
+	uint32_t sent;
+	/** Messages confirmed by the peer (HTTP 2xx, MQTT PUBACK, CoAP 2.xx). */
+	uint32_t acked;
+	/** Messages that could not be sent or were rejected. */
+	uint32_t failed;
+	/** Transport sessions established. */
+	uint32_t connects;
+	/**
+	 * Time to establish the last session: TCP and, with TLS, the
+	 * handshake. Zero for connectionless backends.
+	 */
+	uint32_t last_connect_ms;
+	/** Longest session setup seen, typically a full TLS handshake. */
+	uint32_t max_connect_ms;
+	/** Sum of all session setup times. */
+	uint64_t total_connect_ms;
+	/** Payload bytes handed to the transport. */
+	uint64_t payload_bytes;
+	/** Bytes written to the socket, including protocol framing. */
+	uint64_t wire_tx_bytes;
+	/** Bytes read from the socket, including protocol framing. */
+	uint64_t wire_rx_bytes;
+	/**
+	 * Packets sent. Exact for CoAP (datagrams); for the TCP backends an
+	 * estimate counting connection setup and teardown plus one segment
+	 * per socket write, ignoring pure ACKs and segmentation.
+	 */
+	uint32_t packets_tx;
+	/** Packets received, counted like @ref packets_tx. */
+	uint32_t packets_rx;
+	/** Application-level retransmissions (CoAP only). */
+	uint32_t retransmits;
+	/** Time from send to confirmation of the last confirmed message. */
+	uint32_t last_latency_ms;
+	/** Worst send-to-confirmation time seen. */
+	uint32_t max_latency_ms;
+};
+
+/**
+ * @brief Establish the transport session.
+ *
+ * For session-less backends this only resolves the peer address. Sending
+ * connects implicitly, so calling this is optional.
+ *
+ * @retval 0 if successful.
+ * @retval -errno Negative errno code on failure.
+ */
+int uplink_connect(void);
+
+/**
+ * @brief Send one message.
+ *
+ * The payload buffer may be reused as soon as this function returns, even if
+ * the backend confirms delivery asynchronously.
+ *
+ * @param msg Message to send.
+ *
+ * @retval 0 if the message was handed to the transport.
+ * @retval -EAGAIN if too many messages await confirmation.
+ * @retval -errno Other negative errno code on failure.
+ */
+int uplink_send(const struct uplink_msg *msg);
+
+/**
+ * @brief Wait until every sent message has been confirmed.
+ *
+ * @param timeout Maximum time to wait.
+ *
+ * @retval 0 if nothing is outstanding.
+ * @retval -EAGAIN if messages are still unconfirmed after @p timeout.
+ * @retval -ECONNRESET if the session closed with messages unconfirmed
+ *         since the last flush; they are counted as failed.
+ */
+int uplink_flush(k_timeout_t timeout);
+
+/** @brief Close the transport session, if any. */
+void uplink_disconnect(void);
+
+/**
+ * @brief Send to another peer.
+ *
+ * The session to the current peer, if any, is closed; the next message
+ * connects to the new one.
+ *
+ * @param peer New peer.
+ *
+ * @retval 0 if successful.
+ * @retval -EINVAL if the host is empty, the port is 0 or a string is not
+ *         terminated.
+ */
+int uplink_peer_set(const struct uplink_peer *peer);
+
+/**
+ * @brief Get the peer messages are sent to.
+ *
+ * @param peer Filled with the current peer.
+ */
+void uplink_peer_get(struct uplink_peer *peer);
+
+/**
+ * @brief Get a snapshot of the uplink statistics.
+ *
+ * @param stats Filled with the current statistics.
+ */
+void uplink_stats_get(struct uplink_stats *stats);
+
+/** @brief Name of the transport backend compiled in. */
+const char *uplink_backend_name(void);
+
+/** @} */
+
+#endif /* APP_LIB_UPLINK_H_ */
@@ -0,0 +1,369 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+
+#include <app/lib/appconfig.h>
+
+LOG_MODULE_REGISTER(appconfig, CONFIG_APPCONFIG_LOG_LEVEL);
+
+/* Root of the settings keys, "appcfg/<group>/<entry>" */
+#define APPCONFIG_ROOT "appcfg"
+
+static sys_slist_t groups = SYS_SLIST_STATIC_INIT(&groups);
+
+/* Guards the list of groups and the values of their entries */
+static K_MUTEX_DEFINE(lock);
+
+static struct appconfig *find_group(const char *name, size_t len)
+{
+	struct appconfig *cfg;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&groups, cfg, node) {
+		if (strlen(cfg->name) == len &&
+		    strncmp(cfg->name, name, len) == 0) {
+			return cfg;
+		}
+	}
+
+	return NULL;
+}
+
+static struct appconfig_entry *find_entry(struct appconfig *cfg,
+					  const char *name)
+{
+	for (size_t i = 0; i < cfg->num_entries; i++) {
+		if (strcmp(cfg->entries[i].name, name) == 0) {
+			return &cfg->entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static bool uint_valid(const struct appconfig_entry *entry, uint32_t value)
+{
+	return value >= entry->min && value <= entry->max;
+}
+
+static int make_key(char *key, size_t size, const struct appconfig *cfg,
+		    const struct appconfig_entry *entry)
+{
+	int len = snprintk(key, size, APPCONFIG_ROOT "/%s/%s", cfg->name,
+			   entry->name);
+
+	return (len < 0 || len >= (int)size) ? -ENAMETOOLONG : 0;
+}
+
+/* Apply a value loaded from the settings, called with the lock held */
+static int load_entry(struct appconfig_entry *entry, size_t len,
+		      settings_read_cb read_cb, void *cb_arg)
+{
+	if (entry->type == APPCONFIG_UINT) {
+		uint32_t value;
+
+		if (len != sizeof(value) ||
+		    read_cb(cb_arg, &value, sizeof(value)) != sizeof(value) ||
+		    !uint_valid(entry, value)) {
+			return -EINVAL;
+		}
+		*(uint32_t *)entry->value = value;
+	} else {
+		char *str = entry->value;
+
+		/* Saved with the terminating NUL, so "" is not a deletion */
+		if (len == 0 || len > entry->size ||
+		    read_cb(cb_arg, str, len) != len || str[len - 1] != '\0') {
+			return -EINVAL;
+		}
+	}
+
+	return 0;
+}
+
+static int appconfig_settings_set(const char *key, size_t len,
+				  settings_read_cb read_cb, void *cb_arg)
+{
+	struct appconfig_entry *entry = NULL;
+	struct appconfig *cfg;
+	const char *name;
+	size_t group_len;
+	int ret = 0;
+
+	group_len = settings_name_next(key, &name);
+	if (name == NULL) {
+		return -ENOENT;
+	}
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	/* Groups not registered yet load their values when they are */
+	cfg = find_group(key, group_len);
+	if (cfg != NULL) {
+		entry = find_entry(cfg, name);
+		if (entry == NULL) {
+			LOG_WRN("Unknown entry %s", key);
+		}
+	}
+
+	if (entry != NULL) {
+		ret = load_entry(entry, len, read_cb, cb_arg);
+		if (ret < 0) {
+			LOG_WRN("Invalid value of %s ignored", key);
+			if (entry->type == APPCONFIG_STRING) {
+				strcpy(entry->value, entry->def_str);
+			}
+		}
+	}
+
+	k_mutex_unlock(&lock);
+
+	return ret;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(appconfig, APPCONFIG_ROOT, NULL,
+			       appconfig_settings_set, NULL, NULL);
+
+static int set_default(struct appconfig_entry *entry)
+{
+	if (entry->type == APPCONFIG_UINT) {
+		if (!uint_valid(entry, entry->def)) {
+			return -EINVAL;
+		}
+		*(uint32_t *)entry->value = entry->def;
+	} else {
+		if (entry->def_str == NULL ||
+		    strlen(entry->def_str) >= entry->size) {
+			return -EINVAL;
+		}
+		strcpy(entry->value, entry->def_str);
+	}
+
+	return 0;
+}
+
+int appconfig_register(struct appconfig *cfg)
+{
+	char subtree[SETTINGS_MAX_NAME_LEN + 1];
+	int ret;
+
+	for (size_t i = 0; i < cfg->num_entries; i++) {
+		ret = set_default(&cfg->entries[i]);
+		if (ret < 0) {
+			LOG_ERR("%s: invalid entry %s", cfg->name,
+				cfg->entries[i].name);
+			return ret;
+		}
+	}
+
+	ret = settings_subsys_init();
+	if (ret < 0) {
+		return ret;
+	}
+
+	k_mutex_lock(&lock, K_FOREVER);
+	if (find_group(cfg->name, strlen(cfg->name)) != NULL) {
+		k_mutex_unlock(&lock);
+		return -EALREADY;
+	}
+	sys_slist_append(&groups, &cfg->node);
+	k_mutex_unlock(&lock);
+
+	snprintk(subtree, sizeof(subtree), APPCONFIG_ROOT "/%s", cfg->name);
+	ret = settings_load_subtree(subtree);
+	if (ret < 0) {
+		LOG_ERR("%s: loading failed (%d)", cfg->name, ret);
+		k_mutex_lock(&lock, K_FOREVER);
+		(void)sys_slist_find_and_remove(&groups, &cfg->node);
+		k_mutex_unlock(&lock);
+		return ret;
+	}
+
+	return 0;
+}
+
+int appconfig_get_uint(struct appconfig *cfg, const char *name,
+		       uint32_t *value)
+{
+	struct appconfig_entry *entry = find_entry(cfg, name);
+
+	if (entry == NULL) {
+		return -ENOENT;
+	}
+
+	if (entry->type != APPCONFIG_UINT) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&lock, K_FOREVER);
+	*value = *(uint32_t *)entry->value;
+	k_mutex_unlock(&lock);
+
+	return 0;
+}
+
+int appconfig_get_string(struct appconfig *cfg, const char *name, char *buf,
+			 size_t len)
+{
+	struct appconfig_entry *entry = find_entry(cfg, name);
+	int ret = 0;
+
+	if (entry == NULL) {
+		return -ENOENT;
+	}
+
+	if (entry->type != APPCONFIG_STRING) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&lock, K_FOREVER);
+	if (strlen(entry->value) < len) {
+		strcpy(buf, entry->value);
+	} else {
+		ret = -ENOSPC;
+	}
+	k_mutex_unlock(&lock);
+
+	return ret;
+}
+
+/* Save @p value of @p len bytes and make it current, if it changed */
+static int store(struct appconfig *cfg, struct appconfig_entry *entry,
+		 const void *value, size_t len)
+{
+	char key[SETTINGS_MAX_NAME_LEN + 1];
+	bool changed;
+	int ret;
+
+	ret = make_key(key, sizeof(key), cfg, entry);
+	if (ret < 0) {
+		return ret;
+	}
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	changed = entry->type == APPCONFIG_UINT
+			  ? memcmp(entry->value, value, len) != 0
+			  : strcmp(entry->value, value) != 0;
+	if (changed) {
+		ret = settings_save_one(key, value, len);
+	}
+	if (changed && ret == 0) {
+		memcpy(entry->value, value, len);
+	}
+
+	k_mutex_unlock(&lock);
+
+	if (ret < 0) {
+		LOG_ERR("Saving %s failed (%d)", key, ret);
+		return ret;
+	}
+
+	if (changed && cfg->changed != NULL) {
+		cfg->changed(cfg, entry, cfg->user_data);
+	}
+
+	return 0;
+}
+
+int appconfig_set(struct appconfig *cfg, const char *name, const char *value)
+{
+	struct appconfig_entry *entry = find_entry(cfg, name);
+	unsigned long parsed;
+	uint32_t u32;
+	char *end;
+
+	if (entry == NULL) {
+		return -ENOENT;
+	}
+
+	if (entry->type == APPCONFIG_STRING) {
+		if (strlen(value) >= entry->size) {
+			return -EINVAL;
+		}
+		return store(cfg, entry, value, strlen(value) + 1);
+	}
+
+	/* Not base 0, which would take a leading 0 for octal */
+	errno = 0;
+	parsed = strtoul(value, &end,
+			 strncmp(value, "0x", 2) == 0 ? 16 : 10);
+	if (errno != 0 || end == value || *end != '\0' || value[0] == '-' ||
+	    parsed > UINT32_MAX || !uint_valid(entry, (uint32_t)parsed)) {
+		return -EINVAL;
+	}
+	u32 = (uint32_t)parsed;
+
+	return store(cfg, entry, &u32, sizeof(u32));
+}
+
+int appconfig_reset(struct appconfig *cfg, const char *name)
+{
+	struct appconfig_entry *entry = find_entry(cfg, name);
+	char key[SETTINGS_MAX_NAME_LEN + 1];
+	bool changed = false;
+	int ret;
+
+	if (entry == NULL) {
+		return -ENOENT;
+	}
+
+	ret = make_key(key, sizeof(key), cfg, entry);
+	if (ret < 0) {
+		return ret;
+	}
+
+	k_mutex_lock(&lock, K_FOREVER);
+
+	ret = settings_delete(key);
+	if (ret == 0) {
+		changed = entry->type == APPCONFIG_UINT
+				  ? *(uint32_t *)entry->value != entry->def
+				  : strcmp(entry->value, entry->def_str) != 0;
+		(void)set_default(entry);
+	}
+
+	k_mutex_unlock(&lock);
+
+	if (ret < 0) {
+		LOG_ERR("Deleting %s failed (%d)", key, ret);
+		return ret;
+	}
+
+	if (changed && cfg->changed != NULL) {
+		cfg->changed(cfg, entry, cfg->user_data);
+	}
+
+	return 0;
+}
+
+struct appconfig *appconfig_find(const char *name)
+{
+	struct appconfig *cfg;
+
+	k_mutex_lock(&lock, K_FOREVER);
+	cfg = find_group(name, strlen(name));
+	k_mutex_unlock(&lock);
+
+	return cfg;
+}
+
+void appconfig_foreach(appconfig_cb_t fn, void *user_data)
+{
+	struct appconfig *cfg;
+
+	k_mutex_lock(&lock, K_FOREVER);
+	SYS_SLIST_FOR_EACH_CONTAINER(&groups, cfg, node) {
+		fn(cfg, user_data);
+	}
+	k_mutex_unlock(&lock);
+}
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/shell/shell.h>
+
+#include <app/lib/appconfig.h>
+
+struct show_cmd {
+	const struct shell *sh;
+	/* Group to show, or NULL for all */
+	const char *name;
+	int shown;
+};
+
+static void show_entry(const struct shell *sh, struct appconfig *cfg,
+		       const struct appconfig_entry *entry)
+{
+	char str[128];
+	uint32_t value;
+
+	if (entry->type == APPCONFIG_UINT) {
+		(void)appconfig_get_uint(cfg, entry->name, &value);
+		shell_print(sh, "  %-16s %u (%u..%u, default %u)", entry->name,
+			    value, entry->min, entry->max, entry->def);
+	} else if (entry->flags & APPCONFIG_SECRET) {
+		shell_print(sh, "  %-16s ***", entry->name);
+	} else if (appconfig_get_string(cfg, entry->name, str,
+					sizeof(str)) == 0) {
+		shell_print(sh, "  %-16s \"%s\" (default \"%s\")",
+			    entry->name, str, entry->def_str);
+	} else {
+		shell_print(sh, "  %-16s (too long to show)", entry->name);
+	}
+}
+
+static void show_group(struct appconfig *cfg, void *user_data)
+{
+	struct show_cmd *cmd = user_data;
+
+	if (cmd->name != NULL && strcmp(cmd->name, cfg->name) != 0) {
+		return;
+	}
+
+	shell_print(cmd->sh, "%s:", cfg->name);
+	for (size_t i = 0; i < cfg->num_entries; i++) {
+		show_entry(cmd->sh, cfg, &cfg->entries[i]);
+	}
+	cmd->shown++;
+}
+
+static struct appconfig *get_group(const struct shell *sh, const char *name)
+{
+	struct appconfig *cfg = appconfig_find(name);
+
+	if (cfg == NULL) {
+		shell_error(sh, "Unknown group %s", name);
+	}
+
+	return cfg;
+}
+
+static int cmd_show(const struct shell *sh, size_t argc, char **argv)
+{
+	struct show_cmd cmd = {
+		.sh = sh,
+		.name = argc > 1 ? argv[1] : NULL,
+	};
+
+	appconfig_foreach(show_group, &cmd);
+
+	if (cmd.shown == 0) {
+		shell_print(sh, "No such group registered");
+	}
+
+	return 0;
+}
+
+static int cmd_set(const struct shell *sh, size_t argc, char **argv)
+{
+	struct appconfig *cfg = get_group(sh, argv[1]);
+	int err;
+
+	if (cfg == NULL) {
+		return -ENOENT;
+	}
+
+	err = appconfig_set(cfg, argv[2], argv[3]);
+	if (err == -ENOENT) {
+		shell_error(sh, "Unknown entry %s", argv[2]);
+	} else if (err == -EINVAL) {
+		shell_error(sh, "Invalid value for %s", argv[2]);
+	} else if (err < 0) {
+		shell_error(sh, "Saving %s failed (%d)", argv[2], err);
+	}
+
+	return err;
+}
+
+static int cmd_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	struct appconfig *cfg = get_group(sh, argv[1]);
+	int err;
+
+	if (cfg == NULL) {
+		return -ENOENT;
+	}
+
+	err = appconfig_reset(cfg, argv[2]);
+	if (err == -ENOENT) {
+		shell_error(sh, "Unknown entry %s", argv[2]);
+	} else if (err < 0) {
+		shell_error(sh, "Resetting %s failed (%d)", argv[2], err);
+	}
+
+	return err;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(
+	sub_appconfig,
+	SHELL_CMD_ARG(show, NULL,
+		      "Show entries and their values\n"
+		      "Usage: show [group]",
+		      cmd_show, 1, 1),
+	SHELL_CMD_ARG(set, NULL,
+		      "Set and save an entry; quote strings with spaces\n"
+		      "Usage: set <group> <entry> <value>",
+		      cmd_set, 4, 0),
+	SHELL_CMD_ARG(reset, NULL,
+		      "Set an entry back to its default\n"
+		      "Usage: reset <group> <entry>",
+		      cmd_reset, 3, 0),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(appconfig, &sub_appconfig, "Runtime configuration", NULL);
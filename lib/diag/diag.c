@@ -0,0 +1,405 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Live diagnostics over the shell. Every command reads the state it reports
+ * when it runs, so the module costs nothing while nobody is looking, apart
+ * from the kernel's own accounting of thread CPU usage.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+
+#if defined(CONFIG_NET_NATIVE)
+#include <zephyr/net/net_pkt.h>
+#endif
+
+#if defined(CONFIG_WIFI)
+#include <zephyr/net/net_if.h>
+#include <zephyr/net/wifi_mgmt.h>
+#endif
+
+#if defined(CONFIG_PIPELINE)
+#include <app/lib/pipeline.h>
+#endif
+
+#if defined(CONFIG_UPLINK)
+#include <app/lib/uplink.h>
+#endif
+
+/* Default and longest window of "diag cpu" */
+#define CPU_WINDOW_MS     1000
+#define CPU_WINDOW_MAX_MS 60000
+
+static void thread_label(const struct k_thread *thread, char *buf,
+			 size_t len)
+{
+	const char *name = k_thread_name_get((k_tid_t)thread);
+
+	if (name == NULL || name[0] == '\0') {
+		snprintk(buf, len, "%p", thread);
+	} else {
+		snprintk(buf, len, "%s", name);
+	}
+}
+
+#if defined(CONFIG_DIAG_THREAD_CPU)
+
+struct cpu_thread {
+	const struct k_thread *thread;
+	/* Cycles run since boot, then within the window */
+	uint64_t cycles;
+	/* Still there at the end of the window */
+	bool alive;
+};
+
+/* Static rather than on the shell stack; one measurement at a time */
+static struct cpu_thread cpu_threads[CONFIG_DIAG_MAX_THREADS];
+static size_t cpu_count;
+static bool cpu_truncated;
+static K_MUTEX_DEFINE(cpu_lock);
+
+static uint64_t thread_cycles(const struct k_thread *thread)
+{
+	k_thread_runtime_stats_t rt;
+
+	if (k_thread_runtime_stats_get((k_tid_t)thread, &rt) != 0) {
+		return 0;
+	}
+
+	return rt.execution_cycles;
+}
+
+static void cpu_add(const struct k_thread *thread, bool alive)
+{
+	if (cpu_count == ARRAY_SIZE(cpu_threads)) {
+		cpu_truncated = true;
+		return;
+	}
+
+	cpu_threads[cpu_count].thread = thread;
+	cpu_threads[cpu_count].cycles = thread_cycles(thread);
+	cpu_threads[cpu_count].alive = alive;
+	cpu_count++;
+}
+
+static void cpu_begin(const struct k_thread *thread, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	cpu_add(thread, false);
+}
+
+static void cpu_end(const struct k_thread *thread, void *user_data)
+{
+	uint64_t cycles = thread_cycles(thread);
+
+	ARG_UNUSED(user_data);
+
+	for (size_t i = 0; i < cpu_count; i++) {
+		if (cpu_threads[i].thread == thread) {
+			cpu_threads[i].cycles = cycles - cpu_threads[i].cycles;
+			cpu_threads[i].alive = true;
+			return;
+		}
+	}
+
+	/* Started within the window: all it ran, it ran in it */
+	cpu_add(thread, true);
+}
+
+static int cmd_cpu(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t window_ms = CPU_WINDOW_MS;
+	uint64_t total = 0;
+	char label[32];
+	int err = 0;
+
+	if (argc > 1) {
+		window_ms = (uint32_t)shell_strtoul(argv[1], 10, &err);
+		if (err != 0 || window_ms == 0 ||
+		    window_ms > CPU_WINDOW_MAX_MS) {
+			shell_error(sh, "Invalid window %s, 1 to %d ms",
+				    argv[1], CPU_WINDOW_MAX_MS);
+			return -EINVAL;
+		}
+	}
+
+	k_mutex_lock(&cpu_lock, K_FOREVER);
+
+	cpu_count = 0;
+	cpu_truncated = false;
+	k_thread_foreach_unlocked(cpu_begin, NULL);
+	k_msleep(window_ms);
+	k_thread_foreach_unlocked(cpu_end, NULL);
+
+	/* Threads that exited within the window are left out */
+	for (size_t i = 0; i < cpu_count; i++) {
+		if (cpu_threads[i].alive) {
+			total += cpu_threads[i].cycles;
+		}
+	}
+
+	shell_print(sh, "CPU over %u ms:", window_ms);
+	shell_print(sh, "   cpu%%  thread");
+	for (size_t i = 0; i < cpu_count; i++) {
+		uint32_t permille;
+
+		if (!cpu_threads[i].alive) {
+			continue;
+		}
+
+		permille = total == 0 ? 0
+				      : (uint32_t)(cpu_threads[i].cycles *
+						   1000U / total);
+		thread_label(cpu_threads[i].thread, label, sizeof(label));
+		shell_print(sh, "  %3u.%u  %s", permille / 10, permille % 10,
+			    label);
+	}
+	if (cpu_truncated) {
+		shell_warn(sh, "More than %d threads, raise "
+			   "CONFIG_DIAG_MAX_THREADS", CONFIG_DIAG_MAX_THREADS);
+	}
+
+	k_mutex_unlock(&cpu_lock);
+
+	return 0;
+}
+
+SHELL_SUBCMD_ADD((diag), cpu, NULL,
+		 "CPU usage of every thread over a window\n"
+		 "Usage: cpu [window_ms]",
+		 cmd_cpu, 1, 1);
+
+#endif /* CONFIG_DIAG_THREAD_CPU */
+
+static void show_stack(const struct k_thread *thread, void *user_data)
+{
+	const struct shell *sh = user_data;
+	size_t size = thread->stack_info.size;
+	size_t unused;
+	char label[32];
+
+	if (k_thread_stack_space_get(thread, &unused) != 0) {
+		return;
+	}
+
+	thread_label(thread, label, sizeof(label));
+	shell_print(sh, "  %6zu %6zu %3zu%%  %s", size, size - unused,
+		    size == 0 ? 0 : 100 * (size - unused) / size, label);
+}
+
+static int cmd_stacks(const struct shell *sh, size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(sh, "    size   used  use%%  thread");
+	k_thread_foreach_unlocked(show_stack, (void *)sh);
+
+	return 0;
+}
+
+#if defined(CONFIG_NET_NATIVE)
+
+static void show_slab(const struct shell *sh, const char *label,
+		      struct k_mem_slab *slab)
+{
+	uint32_t used = k_mem_slab_num_used_get(slab);
+
+	shell_print(sh, "  %-8s %3u/%-3u packets", label, used,
+		    used + k_mem_slab_num_free_get(slab));
+}
+
+static void show_pool(const struct shell *sh, const char *label,
+		      struct net_buf_pool *pool)
+{
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	uint32_t avail = (uint32_t)atomic_get(&pool->avail_count);
+
+	shell_print(sh, "  %-8s %3u/%-3u buffers", label,
+		    pool->buf_count - avail, pool->buf_count);
+#else
+	shell_print(sh, "  %-8s   ?/%-3u buffers", label, pool->buf_count);
+#endif
+}
+
+static int cmd_net(const struct shell *sh, size_t argc, char **argv)
+{
+	struct net_buf_pool *rx_data;
+	struct net_buf_pool *tx_data;
+	struct k_mem_slab *rx;
+	struct k_mem_slab *tx;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	net_pkt_get_info(&rx, &tx, &rx_data, &tx_data);
+
+	shell_print(sh, "In use:");
+	show_slab(sh, "RX", rx);
+	show_slab(sh, "TX", tx);
+	show_pool(sh, "RX data", rx_data);
+	show_pool(sh, "TX data", tx_data);
+#if !defined(CONFIG_NET_BUF_POOL_USAGE)
+	shell_print(sh, "Buffers in use need CONFIG_NET_BUF_POOL_USAGE");
+#endif
+
+	return 0;
+}
+
+SHELL_SUBCMD_ADD((diag), net, NULL, "Network packets and buffers in use",
+		 cmd_net, 1, 0);
+
+#endif /* CONFIG_NET_NATIVE */
+
+#if defined(CONFIG_WIFI)
+
+static int cmd_wifi(const struct shell *sh, size_t argc, char **argv)
+{
+	struct net_if *iface = net_if_get_first_wifi();
+	struct wifi_iface_status status = { 0 };
+	int ret;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (iface == NULL) {
+		shell_error(sh, "No WiFi interface");
+		return -ENODEV;
+	}
+
+	ret = net_mgmt(NET_REQUEST_WIFI_IFACE_STATUS, iface, &status,
+		       sizeof(status));
+	if (ret < 0) {
+		shell_error(sh, "Status request failed (%d)", ret);
+		return ret;
+	}
+
+	shell_print(sh, "State: %s", wifi_state_txt(status.state));
+	if (status.state < WIFI_STATE_ASSOCIATED) {
+		return 0;
+	}
+
+	shell_print(sh, "SSID: %.*s", (int)status.ssid_len, status.ssid);
+	shell_print(sh, "RSSI: %d dBm", status.rssi);
+	shell_print(sh, "Channel: %u (%s)", status.channel,
+		    wifi_band_txt(status.band));
+	shell_print(sh, "Link: %s, %s", wifi_link_mode_txt(status.link_mode),
+		    wifi_security_txt(status.security));
+
+	return 0;
+}
+
+SHELL_SUBCMD_ADD((diag), wifi, NULL, "WiFi link state and RSSI", cmd_wifi,
+		 1, 0);
+
+#endif /* CONFIG_WIFI */
+
+#if defined(CONFIG_PIPELINE)
+
+struct pipeline_cmd {
+	const struct shell *sh;
+	int shown;
+};
+
+static void show_pipeline(struct pipeline *pipeline, void *user_data)
+{
+	struct pipeline_cmd *cmd = user_data;
+	uint32_t period_ms = pipeline->source->period_ms;
+	struct pipeline_stats stats;
+
+	pipeline_stats_get(pipeline, &stats);
+
+	if (period_ms == 0) {
+		shell_print(cmd->sh, "%s: on demand", pipeline->name);
+	} else {
+		shell_print(cmd->sh, "%s: every %u ms", pipeline->name,
+			    period_ms);
+	}
+	shell_print(cmd->sh,
+		    "  queue %u/%u samples, at most %u; %u acquired, "
+		    "%u skipped, %u errors",
+		    stats.bufs_used, pipeline->pool->buf_count,
+		    stats.bufs_max_used, stats.acquired, stats.no_buf,
+		    stats.acquire_errors);
+	shell_print(cmd->sh, "  %u dropped, %u delivered, %u sink errors",
+		    stats.dropped, stats.delivered, stats.sink_errors);
+	cmd->shown++;
+}
+
+static int cmd_pipeline(const struct shell *sh, size_t argc, char **argv)
+{
+	struct pipeline_cmd cmd = { .sh = sh };
+#if defined(CONFIG_PIPELINE_PAYLOAD)
+	struct pipeline_payload_stats payloads;
+#endif
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	pipeline_foreach(show_pipeline, &cmd);
+
+	if (cmd.shown == 0) {
+		shell_print(sh, "No pipeline started");
+	}
+
+#if defined(CONFIG_PIPELINE_PAYLOAD)
+	pipeline_payload_stats_get(&payloads);
+	shell_print(sh,
+		    "Payloads: %u/%u in use, at most %u; %u allocations "
+		    "failed",
+		    payloads.used, payloads.count, payloads.max_used,
+		    payloads.failures);
+#endif
+
+	return 0;
+}
+
+SHELL_SUBCMD_ADD((diag), pipeline, NULL, "Pipeline queues and sample counts",
+		 cmd_pipeline, 1, 0);
+
+#endif /* CONFIG_PIPELINE */
+
+#if defined(CONFIG_UPLINK)
+
+static int cmd_uplink(const struct shell *sh, size_t argc, char **argv)
+{
+	struct uplink_stats stats;
+	struct uplink_peer peer;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	uplink_peer_get(&peer);
+	uplink_stats_get(&stats);
+
+	shell_print(sh, "%s to %s:%u%s", uplink_backend_name(), peer.host,
+		    peer.port, peer.path);
+	shell_print(sh, "  %u sent, %u acked, %u failed, %u retransmits",
+		    stats.sent, stats.acked, stats.failed, stats.retransmits);
+	shell_print(sh, "  latency last %u ms, max %u ms",
+		    stats.last_latency_ms, stats.max_latency_ms);
+	shell_print(sh, "  %u sessions, setup last %u ms, max %u ms",
+		    stats.connects, stats.last_connect_ms,
+		    stats.max_connect_ms);
+
+	return 0;
+}
+
+SHELL_SUBCMD_ADD((diag), uplink, NULL, "Uplink peer, deliveries and latency",
+		 cmd_uplink, 1, 0);
+
+#endif /* CONFIG_UPLINK */
+
+/* Commands of disabled subsystems are left out where they are defined */
+SHELL_SUBCMD_SET_CREATE(sub_diag, (diag));
+SHELL_SUBCMD_ADD((diag), stacks, NULL, "Stack usage of every thread",
+		 cmd_stacks, 1, 0);
+SHELL_CMD_REGISTER(diag, &sub_diag, "Live diagnostics", NULL);
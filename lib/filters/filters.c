@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/util.h>
+
+#include <app/lib/filters.h>
+
+/* Insertion sort: the fastest for the handful of readings filtered here */
+static void sort(int32_t *values, size_t n)
+{
+	for (size_t i = 1; i < n; i++) {
+		int32_t v = values[i];
+		size_t j = i;
+
+		while (j > 0 && values[j - 1] > v) {
+			values[j] = values[j - 1];
+			j--;
+		}
+		values[j] = v;
+	}
+}
+
+/* Rounded half away from zero, so the filters are symmetric around 0 */
+static int32_t div_round(int64_t sum, size_t n)
+{
+	int64_t half = (int64_t)(n / 2);
+
+	if (sum < 0) {
+		return (int32_t)-((-sum + half) / (int64_t)n);
+	}
+
+	return (int32_t)((sum + half) / (int64_t)n);
+}
+
+int32_t filter_mean(const int32_t *values, size_t n)
+{
+	int64_t sum = 0;
+
+	__ASSERT_NO_MSG(n > 0);
+
+	for (size_t i = 0; i < n; i++) {
+		sum += values[i];
+	}
+
+	return div_round(sum, n);
+}
+
+int32_t filter_median(int32_t *values, size_t n)
+{
+	__ASSERT_NO_MSG(n > 0);
+
+	sort(values, n);
+
+	if (n % 2 == 1) {
+		return values[n / 2];
+	}
+
+	return filter_mean(&values[n / 2 - 1], 2);
+}
+
+int32_t filter_trimmed_mean(int32_t *values, size_t n, size_t trim)
+{
+	__ASSERT_NO_MSG(n > 0);
+
+	if (trim >= n / 2) {
+		return filter_median(values, n);
+	}
+
+	sort(values, n);
+
+	return filter_mean(&values[trim], n - 2 * trim);
+}
+
+int filter_apply(enum filter_type type, int32_t *values, size_t n,
+		 int32_t *out)
+{
+	if (n == 0) {
+		return -EINVAL;
+	}
+
+	switch (type) {
+	case FILTER_MEAN:
+		*out = filter_mean(values, n);
+		break;
+	case FILTER_MEDIAN:
+		*out = filter_median(values, n);
+		break;
+	case FILTER_TRIMMED_MEAN:
+		*out = filter_trimmed_mean(values, n, n / 4);
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+const char *filter_name(enum filter_type type)
+{
+	switch (type) {
+	case FILTER_MEAN:
+		return "mean";
+	case FILTER_MEDIAN:
+		return "median";
+	case FILTER_TRIMMED_MEAN:
+		return "trimmed-mean";
+	default:
+		return NULL;
+	}
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+
+#include <app/lib/footprint.h>
+
+/*
+ * printk rather than logging: the report has to come out as whole lines,
+ * in order, whatever the logging configuration of the app is.
+ */
+
+static void report_thread(const struct k_thread *thread, void *user_data)
+{
+	const char *name = k_thread_name_get((k_tid_t)thread);
+	size_t size = thread->stack_info.size;
+	size_t unused;
+
+	ARG_UNUSED(user_data);
+
+	if (k_thread_stack_space_get(thread, &unused) != 0) {
+		return;
+	}
+
+	if (name == NULL || name[0] == '\0') {
+		printk("footprint: stack %zu %zu %p\n", size, size - unused,
+		       thread);
+	} else {
+		printk("footprint: stack %zu %zu %s\n", size, size - unused,
+		       name);
+	}
+}
+
+void footprint_report(void)
+{
+	printk("footprint: begin\n");
+	k_thread_foreach_unlocked(report_thread, NULL);
+	printk("footprint: end\n");
+}
+
+#if CONFIG_FOOTPRINT_REPORT_DELAY_MS > 0
+
+static void report_work_handler(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	footprint_report();
+}
+
+static K_WORK_DELAYABLE_DEFINE(report_work, report_work_handler);
+
+static int footprint_init(void)
+{
+	k_work_schedule(&report_work, K_MSEC(CONFIG_FOOTPRINT_REPORT_DELAY_MS));
+
+	return 0;
+}
+
+SYS_INIT(footprint_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+#endif /* CONFIG_FOOTPRINT_REPORT_DELAY_MS > 0 */
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include "inference_internal.h"
+
+LOG_MODULE_REGISTER(inference, CONFIG_INFERENCE_LOG_LEVEL);
+
+static K_MUTEX_DEFINE(inference_lock);
+static struct k_spinlock stats_lock;
+static struct inference_stats stats;
+
+int inference_model_set(const struct inference_model *model)
+{
+	int ret;
+
+	if (model == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&inference_lock, K_FOREVER);
+	ret = inference_backend_model_set(model);
+	k_mutex_unlock(&inference_lock);
+
+	return ret;
+}
+
+int inference_classify(struct net_buf *samples,
+		       struct inference_result *result)
+{
+	uint32_t start;
+	uint16_t count = 0;
+	k_spinlock_key_t key;
+	int ret;
+
+	for (struct net_buf *frag = samples; frag != NULL; frag = frag->frags) {
+		count++;
+	}
+	if (count == 0) {
+		return -EINVAL;
+	}
+
+	*result = (struct inference_result){ .samples = count };
+
+	k_mutex_lock(&inference_lock, K_FOREVER);
+	start = k_cycle_get_32();
+	ret = inference_backend_classify(samples, result);
+	result->latency_us = k_cyc_to_us_ceil32(k_cycle_get_32() - start);
+	k_mutex_unlock(&inference_lock);
+
+	key = k_spin_lock(&stats_lock);
+	if (ret < 0) {
+		stats.failures++;
+	} else {
+		stats.runs++;
+		stats.last_latency_us = result->latency_us;
+		stats.max_latency_us = MAX(stats.max_latency_us,
+					   result->latency_us);
+		stats.total_latency_us += result->latency_us;
+	}
+	k_spin_unlock(&stats_lock, key);
+
+	if (ret < 0) {
+		LOG_DBG("%u samples not classified: %d", count, ret);
+	} else {
+		LOG_DBG("%u samples: %s (%u/1000) in %u us", count,
+			result->label, result->score, result->latency_us);
+	}
+
+	return ret;
+}
+
+void inference_stats_get(struct inference_stats *out)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	*out = stats;
+
+	k_spin_unlock(&stats_lock, key);
+
+	out->ram_bytes = inference_backend_ram();
+}
+
+const char *inference_backend_name(void)
+{
+	return inference_backend;
+}
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include <app/lib/pipeline.h>
+
+#include "inference_internal.h"
+
+#define NUM_FEATURES \
+	(CONFIG_PIPELINE_MAX_VALUES * INFERENCE_FEATURES_PER_VALUE)
+
+const char *const inference_backend = "centroid";
+
+static const struct inference_model *model;
+
+int inference_backend_model_set(const struct inference_model *new_model)
+{
+	if (new_model->num_values == 0 ||
+	    new_model->num_values > CONFIG_PIPELINE_MAX_VALUES ||
+	    new_model->num_classes == 0 || new_model->classes == NULL ||
+	    new_model->scale == NULL) {
+		return -EINVAL;
+	}
+
+	for (uint8_t i = 0;
+	     i < new_model->num_values * INFERENCE_FEATURES_PER_VALUE; i++) {
+		if (new_model->scale[i] <= 0) {
+			return -EINVAL;
+		}
+	}
+
+	model = new_model;
+
+	return 0;
+}
+
+size_t inference_backend_ram(void)
+{
+	return sizeof(model);
+}
+
+/* Change from the first to the last sample and range of each value */
+static int extract(struct net_buf *samples, uint8_t num_values,
+		   int32_t *features)
+{
+	const struct pipeline_sample *first = pipeline_sample(samples);
+	int64_t lo[CONFIG_PIPELINE_MAX_VALUES];
+	int64_t hi[CONFIG_PIPELINE_MAX_VALUES];
+	const struct pipeline_sample *last = first;
+
+	if (first->count != num_values) {
+		return -EINVAL;
+	}
+
+	for (uint8_t i = 0; i < num_values; i++) {
+		lo[i] = sensor_value_to_milli(&first->values[i]);
+		hi[i] = lo[i];
+	}
+
+	for (struct net_buf *frag = samples->frags; frag != NULL;
+	     frag = frag->frags) {
+		last = pipeline_sample(frag);
+
+		if (last->count != num_values) {
+			return -EINVAL;
+		}
+
+		for (uint8_t i = 0; i < num_values; i++) {
+			int64_t x = sensor_value_to_milli(&last->values[i]);
+
+			lo[i] = MIN(lo[i], x);
+			hi[i] = MAX(hi[i], x);
+		}
+	}
+
+	for (uint8_t i = 0; i < num_values; i++) {
+		int64_t change = sensor_value_to_milli(&last->values[i]) -
+				 sensor_value_to_milli(&first->values[i]);
+
+		features[2 * i] = (int32_t)CLAMP(change, INT32_MIN, INT32_MAX);
+		features[2 * i + 1] =
+			(int32_t)CLAMP(hi[i] - lo[i], 0, INT32_MAX);
+	}
+
+	return 0;
+}
+
+/* Squared distance in spreads, in millionths */
+static uint64_t distance(const int32_t *features, const int32_t *centroid,
+			 uint8_t n)
+{
+	uint64_t d = 0;
+
+	for (uint8_t i = 0; i < n; i++) {
+		int64_t delta = ((int64_t)features[i] - centroid[i]) * 1000 /
+				model->scale[i];
+
+		d += (uint64_t)(delta * delta);
+	}
+
+	return d;
+}
+
+int inference_backend_classify(struct net_buf *samples,
+			       struct inference_result *result)
+{
+	int32_t features[NUM_FEATURES];
+	uint64_t best = UINT64_MAX;
+	uint64_t weight_sum = 0;
+	uint64_t best_weight = 0;
+	uint8_t n;
+	int ret;
+
+	if (model == NULL) {
+		return -ENODEV;
+	}
+
+	n = model->num_values * INFERENCE_FEATURES_PER_VALUE;
+	ret = extract(samples, model->num_values, features);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/*
+	 * The score weighs each class by its inverse distance, so a window
+	 * halfway between two centroids scores 500.
+	 */
+	for (uint8_t c = 0; c < model->num_classes; c++) {
+		uint64_t d = distance(features, model->classes[c].centroid, n);
+		uint64_t weight = UINT32_MAX / (d / 1000 + 1);
+
+		weight_sum += weight;
+		if (d < best) {
+			best = d;
+			best_weight = weight;
+			result->label = model->classes[c].label;
+		}
+	}
+
+	result->score = (uint16_t)(best_weight * 1000 / weight_sum);
+
+	return 0;
+}
@@ -0,0 +1,37 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_INFERENCE_INTERNAL_H_
+#define APP_LIB_INFERENCE_INTERNAL_H_
+
+#include <app/lib/inference.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Backend interface. Classification is serialized by the caller, so
+ * backends may keep their input buffers static.
+ */
+
+extern const char *const inference_backend;
+
+/* Check and load @p model, which is not NULL */
+int inference_backend_model_set(const struct inference_model *model);
+
+/* Static RAM used by the backend */
+size_t inference_backend_ram(void);
+
+/* Fill in the label and score of @p result for @p samples */
+int inference_backend_classify(struct net_buf *samples,
+			       struct inference_result *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* APP_LIB_INFERENCE_INTERNAL_H_ */
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <new>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include <app/lib/pipeline.h>
+
+#include <tensorflow/lite/micro/micro_interpreter.h>
+#include <tensorflow/lite/micro/micro_mutable_op_resolver.h>
+#include <tensorflow/lite/schema/schema_generated.h>
+
+#include "inference_internal.h"
+
+LOG_MODULE_DECLARE(inference, CONFIG_INFERENCE_LOG_LEVEL);
+
+/* Fully connected layers and the softmax, all the room model is made of */
+using resolver_t = tflite::MicroMutableOpResolver<2>;
+
+static uint8_t arena[CONFIG_INFERENCE_TFLM_ARENA_SIZE] __aligned(16);
+
+/*
+ * The interpreter holds no memory of its own but the arena, so it is built
+ * in place whenever a model is set, rather than allocated.
+ */
+alignas(resolver_t) static uint8_t resolver_buf[sizeof(resolver_t)];
+alignas(tflite::MicroInterpreter) static uint8_t
+	interpreter_buf[sizeof(tflite::MicroInterpreter)];
+
+static tflite::MicroInterpreter *interpreter;
+static const struct inference_model *model;
+static size_t window;
+
+static bool is_float(const TfLiteTensor *tensor)
+{
+	return tensor != nullptr && tensor->type == kTfLiteFloat32;
+}
+
+extern "C" {
+
+const char *const inference_backend = "tflite-micro";
+
+int inference_backend_model_set(const struct inference_model *new_model)
+{
+	static resolver_t *resolver;
+	const tflite::Model *tfl;
+	TfLiteTensor *input;
+	TfLiteTensor *output;
+	size_t sample_bytes;
+
+	if (new_model->tflite == nullptr || new_model->num_values == 0 ||
+	    new_model->num_values > CONFIG_PIPELINE_MAX_VALUES ||
+	    new_model->labels == nullptr || new_model->num_labels == 0) {
+		return -EINVAL;
+	}
+
+	tfl = tflite::GetModel(new_model->tflite);
+	if (tfl->version() != TFLITE_SCHEMA_VERSION) {
+		LOG_ERR("Model schema %u, expected %u", tfl->version(),
+			TFLITE_SCHEMA_VERSION);
+		return -EINVAL;
+	}
+
+	if (resolver == nullptr) {
+		resolver = new (resolver_buf) resolver_t();
+		resolver->AddFullyConnected();
+		resolver->AddSoftmax();
+	}
+
+	if (interpreter != nullptr) {
+		interpreter->~MicroInterpreter();
+	}
+	model = nullptr;
+	interpreter = new (interpreter_buf)
+		tflite::MicroInterpreter(tfl, *resolver, arena, sizeof(arena));
+
+	if (interpreter->AllocateTensors() != kTfLiteOk) {
+		LOG_ERR("Model does not fit %u bytes of arena",
+			CONFIG_INFERENCE_TFLM_ARENA_SIZE);
+		return -ENOMEM;
+	}
+
+	input = interpreter->input(0);
+	output = interpreter->output(0);
+	sample_bytes = new_model->num_values * sizeof(float);
+	if (!is_float(input) || !is_float(output) ||
+	    input->bytes == 0 || input->bytes % sample_bytes != 0 ||
+	    output->bytes != new_model->num_labels * sizeof(float)) {
+		LOG_ERR("Model input or output does not fit");
+		return -EINVAL;
+	}
+
+	window = input->bytes / sample_bytes;
+	model = new_model;
+
+	LOG_INF("Model of %u samples, %u labels, %u of %u arena bytes",
+		(unsigned int)window, model->num_labels,
+		(unsigned int)interpreter->arena_used_bytes(),
+		CONFIG_INFERENCE_TFLM_ARENA_SIZE);
+
+	return 0;
+}
+
+size_t inference_backend_ram(void)
+{
+	return sizeof(arena) + sizeof(resolver_buf) + sizeof(interpreter_buf);
+}
+
+/*
+ * The model is trained on change windows, so they are lined up on their
+ * first sample: a longer window is cut to its first samples, a shorter one
+ * padded with its last sample. Each value is fed as its offset from the
+ * first sample, so that the model sees changes rather than levels.
+ */
+static int fill_input(struct net_buf *samples, float *input)
+{
+	const struct pipeline_sample *first = pipeline_sample(samples);
+	const struct pipeline_sample *sample = first;
+	struct net_buf *frag = samples;
+	size_t pos = 0;
+
+	for (size_t s = 0; s < window; s++) {
+		if (frag != nullptr) {
+			sample = pipeline_sample(frag);
+			frag = frag->frags;
+			if (sample->count != model->num_values) {
+				return -EINVAL;
+			}
+		}
+
+		for (uint8_t i = 0; i < model->num_values; i++) {
+			int64_t offset =
+				sensor_value_to_milli(&sample->values[i]) -
+				sensor_value_to_milli(&first->values[i]);
+
+			input[pos++] = (float)offset / 1000.0f;
+		}
+	}
+
+	return 0;
+}
+
+int inference_backend_classify(struct net_buf *samples,
+			       struct inference_result *result)
+{
+	const float *scores;
+	uint8_t best = 0;
+	int ret;
+
+	if (model == nullptr) {
+		return -ENODEV;
+	}
+
+	ret = fill_input(samples, interpreter->input(0)->data.f);
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (interpreter->Invoke() != kTfLiteOk) {
+		LOG_ERR("Invoke() failed");
+		return -EIO;
+	}
+
+	scores = interpreter->output(0)->data.f;
+	for (uint8_t i = 1; i < model->num_labels; i++) {
+		if (scores[i] > scores[best]) {
+			best = i;
+		}
+	}
+
+	result->label = model->labels[best];
+	result->score = (uint16_t)MIN(scores[best] * 1000.0f, 1000.0f);
+
+	return 0;
+}
+
+} /* extern "C" */
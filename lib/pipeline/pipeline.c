@@ -0,0 +1,524 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include <app/lib/tracepoints.h>
+
+#ifdef CONFIG_PIPELINE_TIMESYNC
+#include <app/lib/timesync.h>
+#endif
+
+#include "pipeline_internal.h"
+
+LOG_MODULE_REGISTER(pipeline, CONFIG_PIPELINE_LOG_LEVEL);
+
+static struct k_work_q pool[CONFIG_PIPELINE_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks, CONFIG_PIPELINE_THREADS,
+				   CONFIG_PIPELINE_THREAD_STACK_SIZE);
+static atomic_t pool_next;
+
+static sys_slist_t pipelines = SYS_SLIST_STATIC_INIT(&pipelines);
+static K_MUTEX_DEFINE(pipelines_lock);
+
+struct k_work_q *pipeline_queue_next(void)
+{
+	return &pool[(atomic_inc(&pool_next) & INT32_MAX) %
+		     CONFIG_PIPELINE_THREADS];
+}
+
+void pipeline_account_dropped(struct pipeline *pipeline, uint32_t samples)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipeline->lock);
+
+	pipeline->stats.dropped += samples;
+
+	k_spin_unlock(&pipeline->lock, key);
+}
+
+void pipeline_account_delivered(struct pipeline *pipeline, uint32_t samples,
+				int err)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipeline->lock);
+
+	pipeline->stats.delivered += samples;
+	if (err < 0) {
+		pipeline->stats.sink_errors++;
+	}
+
+	k_spin_unlock(&pipeline->lock, key);
+}
+
+/*
+ * Every sample buffer records its pipeline in its user data, so the pool
+ * usage can be accounted when the last reference to it goes away.
+ */
+void pipeline_buf_destroy(struct net_buf *buf)
+{
+	struct pipeline *pipeline = *(struct pipeline **)net_buf_user_data(buf);
+	k_spinlock_key_t key = k_spin_lock(&pipeline->lock);
+
+	pipeline->stats.bufs_used--;
+
+	k_spin_unlock(&pipeline->lock, key);
+
+	net_buf_destroy(buf);
+}
+
+static void account_buf_alloc(struct pipeline *pipeline)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipeline->lock);
+
+	pipeline->stats.bufs_used++;
+	pipeline->stats.bufs_max_used = MAX(pipeline->stats.bufs_max_used,
+					    pipeline->stats.bufs_used);
+
+	k_spin_unlock(&pipeline->lock, key);
+}
+
+struct net_buf *pipeline_buf_alloc(struct pipeline *pipeline)
+{
+	struct net_buf *buf = net_buf_alloc(pipeline->pool, K_NO_WAIT);
+
+	if (buf == NULL) {
+		/*
+		 * A stage waiting for more samples before it passes on those
+		 * it holds, like a change detection window, would wait for
+		 * ever: have every stage pass on what it has, once.
+		 */
+		if (!atomic_test_and_set_bit(&pipeline->state,
+					     PIPELINE_STARVED)) {
+			LOG_DBG("%s: out of buffers, flushing",
+				pipeline->name);
+			pipeline_flush(pipeline);
+		}
+		return NULL;
+	}
+
+	atomic_clear_bit(&pipeline->state, PIPELINE_STARVED);
+	*(struct pipeline **)net_buf_user_data(buf) = pipeline;
+	account_buf_alloc(pipeline);
+
+	return buf;
+}
+
+static void account_acquire(struct pipeline *pipeline, uint32_t *counter)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipeline->lock);
+
+	(*counter)++;
+
+	k_spin_unlock(&pipeline->lock, key);
+}
+
+/*
+ * Stages hand buffers over through the FIFO of the next stage and submit
+ * its work item. A work item that is running is resubmitted to the queue it
+ * runs on, so every stage sees its buffers one at a time and in order, even
+ * though the stages of a pipeline are spread over the pool.
+ */
+
+void pipeline_forward(struct pipeline_stage *stage, struct net_buf *buf)
+{
+	struct pipeline_stage *next = stage->next;
+
+	if (next == NULL) {
+		net_buf_unref(buf);
+		return;
+	}
+
+	k_fifo_put(&next->fifo, buf);
+	k_work_submit_to_queue(next->queue, &next->work);
+}
+
+void pipeline_stage_flush(struct pipeline_stage *stage)
+{
+	atomic_set_bit(&stage->flags, PIPELINE_STAGE_FLUSH);
+	k_work_submit_to_queue(stage->queue, &stage->work);
+}
+
+static void stage_work(struct k_work *work)
+{
+	struct pipeline_stage *stage =
+		CONTAINER_OF(work, struct pipeline_stage, work);
+	const char *name = stage->api->name != NULL ? stage->api->name
+						    : "stage";
+	struct net_buf *buf;
+
+	while ((buf = k_fifo_get(&stage->fifo, K_NO_WAIT)) != NULL) {
+		tracepoint_begin(name, TRACEPOINT_ID(stage));
+		buf = stage->api->process(stage, buf);
+		tracepoint_end(name, TRACEPOINT_ID(stage));
+		if (buf != NULL) {
+			pipeline_forward(stage, buf);
+		}
+	}
+
+	/*
+	 * Everything that came in before the flush request has been
+	 * processed and forwarded, so the flush can move on downstream.
+	 */
+	if (atomic_test_and_clear_bit(&stage->flags, PIPELINE_STAGE_FLUSH)) {
+		if (stage->api->flush != NULL) {
+			buf = stage->api->flush(stage);
+			if (buf != NULL) {
+				pipeline_forward(stage, buf);
+			}
+		}
+		if (stage->next != NULL) {
+			pipeline_stage_flush(stage->next);
+		}
+	}
+}
+
+static int acquire_sample(struct pipeline_acquire *source,
+			  struct pipeline_sample *sample)
+{
+	int ret;
+
+	sample->timestamp_ms = k_uptime_get();
+	sample->epoch_ms = 0;
+	sample->flags = 0;
+	sample->count = 0;
+
+#ifdef CONFIG_PIPELINE_TIMESYNC
+	(void)timesync_to_epoch_ms(sample->timestamp_ms, &sample->epoch_ms);
+#endif
+
+	if (source->sensor != NULL) {
+		ret = sensor_sample_fetch(source->sensor);
+		if (ret < 0) {
+			return ret;
+		}
+
+		for (size_t i = 0; i < source->num_channels; i++) {
+			ret = sensor_channel_get(source->sensor,
+						 source->channels[i],
+						 &sample->values[sample->count++]);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+	}
+
+	for (size_t i = 0; i < source->num_gpios; i++) {
+		ret = gpio_pin_get_dt(&source->gpios[i]);
+		if (ret < 0) {
+			return ret;
+		}
+
+		sample->values[sample->count++] =
+			(struct sensor_value){ .val1 = ret };
+	}
+
+	return 0;
+}
+
+/*
+ * Move the next acquisition, scheduled on the current period, to
+ * @p period_ms after the last one, or to now rather than catch up on
+ * missed periods. Called with the pipeline lock held.
+ */
+static void reschedule(struct pipeline *pipeline, uint32_t period_ms)
+{
+	struct pipeline_acquire *source = pipeline->source;
+
+	source->deadline_ms = MAX(source->deadline_ms + period_ms -
+					  source->period_ms,
+				  k_uptime_get());
+	source->period_ms = period_ms;
+
+	if (atomic_test_bit(&pipeline->state, PIPELINE_RUNNING)) {
+		k_work_reschedule_for_queue(
+			source->queue, &source->work,
+			K_TIMEOUT_ABS_MS(source->deadline_ms));
+	}
+}
+
+#ifdef CONFIG_PIPELINE_ADAPTIVE
+static void adapt_period(struct pipeline_acquire *source,
+			 const struct pipeline_sample *sample)
+{
+	struct pipeline *pipeline = source->pipeline;
+	uint32_t prev_ms = source->period_ms;
+	uint32_t period_ms = pipeline_adaptive_update(source->adaptive, sample,
+						      prev_ms);
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&pipeline->lock);
+	/* Unless pipeline_period_set() changed it meanwhile */
+	if (period_ms != prev_ms && source->period_ms == prev_ms) {
+		reschedule(pipeline, period_ms);
+	}
+	k_spin_unlock(&pipeline->lock, key);
+}
+#endif /* CONFIG_PIPELINE_ADAPTIVE */
+
+static void acquire_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct pipeline_acquire *source =
+		CONTAINER_OF(dwork, struct pipeline_acquire, work);
+	struct pipeline *pipeline = source->pipeline;
+	struct net_buf *buf;
+	int ret;
+
+	if (!atomic_test_bit(&pipeline->state, PIPELINE_RUNNING)) {
+		return;
+	}
+
+	/* Next period counted from the deadline, so acquisition does not drift */
+	if (source->period_ms > 0) {
+		k_spinlock_key_t key = k_spin_lock(&pipeline->lock);
+
+		source->deadline_ms += source->period_ms;
+		k_work_schedule_for_queue(source->queue, &source->work,
+					  K_TIMEOUT_ABS_MS(source->deadline_ms));
+		k_spin_unlock(&pipeline->lock, key);
+	}
+
+	buf = pipeline_buf_alloc(pipeline);
+	if (buf == NULL) {
+		LOG_DBG("%s: no buffer, sample skipped", pipeline->name);
+		account_acquire(pipeline, &pipeline->stats.no_buf);
+		return;
+	}
+
+	tracepoint_begin("acquire", TRACEPOINT_ID(source));
+	ret = acquire_sample(source,
+			     net_buf_add(buf, sizeof(struct pipeline_sample)));
+	tracepoint_end("acquire", TRACEPOINT_ID(source));
+	if (ret < 0) {
+		LOG_WRN("%s: acquisition failed (%d)", pipeline->name, ret);
+		account_acquire(pipeline, &pipeline->stats.acquire_errors);
+		net_buf_unref(buf);
+		return;
+	}
+
+	account_acquire(pipeline, &pipeline->stats.acquired);
+
+#ifdef CONFIG_PIPELINE_ADAPTIVE
+	if (source->adaptive != NULL && source->period_ms > 0) {
+		adapt_period(source, pipeline_sample(buf));
+	}
+#endif
+
+	if (pipeline->num_stages == 0) {
+		net_buf_unref(buf);
+		return;
+	}
+
+	k_fifo_put(&pipeline->stages[0]->fifo, buf);
+	k_work_submit_to_queue(pipeline->stages[0]->queue,
+			       &pipeline->stages[0]->work);
+}
+
+static int pipeline_init(struct pipeline *pipeline)
+{
+	struct pipeline_acquire *source = pipeline->source;
+	int ret;
+
+	if (source->num_channels + source->num_gpios >
+	    CONFIG_PIPELINE_MAX_VALUES) {
+		LOG_ERR("%s: %zu values per sample, at most %d", pipeline->name,
+			source->num_channels + source->num_gpios,
+			CONFIG_PIPELINE_MAX_VALUES);
+		return -EINVAL;
+	}
+
+	source->pipeline = pipeline;
+	source->queue = pipeline_queue_next();
+	k_work_init_delayable(&source->work, acquire_work);
+
+	for (size_t i = 0; i < pipeline->num_stages; i++) {
+		struct pipeline_stage *stage = pipeline->stages[i];
+
+		stage->pipeline = pipeline;
+		stage->next = i + 1 < pipeline->num_stages
+				      ? pipeline->stages[i + 1]
+				      : NULL;
+		stage->queue = pipeline_queue_next();
+		k_work_init(&stage->work, stage_work);
+		k_fifo_init(&stage->fifo);
+		atomic_clear(&stage->flags);
+
+		if (stage->api->init != NULL) {
+			ret = stage->api->init(stage);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+	}
+
+	k_mutex_lock(&pipelines_lock, K_FOREVER);
+	sys_slist_append(&pipelines, &pipeline->node);
+	k_mutex_unlock(&pipelines_lock);
+
+	return 0;
+}
+
+int pipeline_start(struct pipeline *pipeline)
+{
+	struct pipeline_acquire *source = pipeline->source;
+	int ret;
+
+	if (source->sensor != NULL && !device_is_ready(source->sensor)) {
+		return -ENODEV;
+	}
+
+	for (size_t i = 0; i < source->num_gpios; i++) {
+		if (!gpio_is_ready_dt(&source->gpios[i])) {
+			return -ENODEV;
+		}
+	}
+
+	if (!atomic_test_and_set_bit(&pipeline->state, PIPELINE_INITIALIZED)) {
+		ret = pipeline_init(pipeline);
+		if (ret < 0) {
+			atomic_clear_bit(&pipeline->state,
+					 PIPELINE_INITIALIZED);
+			return ret;
+		}
+	}
+
+	if (atomic_test_and_set_bit(&pipeline->state, PIPELINE_RUNNING)) {
+		return -EALREADY;
+	}
+
+#ifdef CONFIG_PIPELINE_ADAPTIVE
+	if (source->adaptive != NULL) {
+		ret = pipeline_adaptive_reset(source->adaptive);
+		if (ret < 0) {
+			atomic_clear_bit(&pipeline->state, PIPELINE_RUNNING);
+			return ret;
+		}
+	}
+#endif
+
+	if (source->period_ms > 0) {
+		source->deadline_ms = k_uptime_get();
+		k_work_schedule_for_queue(source->queue, &source->work,
+					  K_NO_WAIT);
+	}
+
+	LOG_DBG("%s: started", pipeline->name);
+
+	return 0;
+}
+
+int pipeline_stop(struct pipeline *pipeline)
+{
+	struct k_work_sync sync;
+
+	if (!atomic_test_and_clear_bit(&pipeline->state, PIPELINE_RUNNING)) {
+		return -EALREADY;
+	}
+
+	(void)k_work_cancel_delayable_sync(&pipeline->source->work, &sync);
+	pipeline_flush(pipeline);
+
+	LOG_DBG("%s: stopped", pipeline->name);
+
+	return 0;
+}
+
+int pipeline_trigger(struct pipeline *pipeline)
+{
+	struct pipeline_acquire *source = pipeline->source;
+
+	if (!atomic_test_bit(&pipeline->state, PIPELINE_RUNNING)) {
+		return -EAGAIN;
+	}
+
+	if (source->period_ms > 0) {
+		return -ENOTSUP;
+	}
+
+	k_work_schedule_for_queue(source->queue, &source->work, K_NO_WAIT);
+
+	return 0;
+}
+
+int pipeline_period_set(struct pipeline *pipeline, uint32_t period_ms)
+{
+	struct pipeline_acquire *source = pipeline->source;
+	k_spinlock_key_t key;
+
+	if (source->period_ms == 0) {
+		return -ENOTSUP;
+	}
+
+	if (period_ms == 0) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_PIPELINE_ADAPTIVE
+	if (source->adaptive != NULL) {
+		period_ms = pipeline_adaptive_period_set(source->adaptive,
+							 period_ms);
+	}
+#endif
+
+	key = k_spin_lock(&pipeline->lock);
+	reschedule(pipeline, period_ms);
+	k_spin_unlock(&pipeline->lock, key);
+
+	LOG_DBG("%s: period %u ms", pipeline->name, period_ms);
+
+	return 0;
+}
+
+void pipeline_flush(struct pipeline *pipeline)
+{
+	if (!atomic_test_bit(&pipeline->state, PIPELINE_INITIALIZED) ||
+	    pipeline->num_stages == 0) {
+		return;
+	}
+
+	pipeline_stage_flush(pipeline->stages[0]);
+}
+
+void pipeline_stats_get(struct pipeline *pipeline,
+			struct pipeline_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipeline->lock);
+
+	*stats = pipeline->stats;
+
+	k_spin_unlock(&pipeline->lock, key);
+}
+
+void pipeline_foreach(pipeline_cb_t fn, void *user_data)
+{
+	struct pipeline *pipeline;
+
+	k_mutex_lock(&pipelines_lock, K_FOREVER);
+	SYS_SLIST_FOR_EACH_CONTAINER(&pipelines, pipeline, node) {
+		fn(pipeline, user_data);
+	}
+	k_mutex_unlock(&pipelines_lock);
+}
+
+static int pipeline_pool_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "pipeline",
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(pool); i++) {
+		k_work_queue_start(&pool[i], pool_stacks[i],
+				   K_THREAD_STACK_SIZEOF(pool_stacks[i]),
+				   CONFIG_PIPELINE_THREAD_PRIORITY, &cfg);
+	}
+
+	return 0;
+}
+
+SYS_INIT(pipeline_pool_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include "pipeline_internal.h"
+
+LOG_MODULE_DECLARE(pipeline, CONFIG_PIPELINE_LOG_LEVEL);
+
+/* Weight of a new difference in the variance, 1 / 2^VAR_SHIFT */
+#define VAR_SHIFT 2
+
+int pipeline_adaptive_reset(struct pipeline_adaptive *adaptive)
+{
+	k_spinlock_key_t key;
+
+	if (adaptive->min_period_ms == 0 ||
+	    adaptive->min_period_ms > adaptive->max_period_ms ||
+	    adaptive->thresholds == NULL || adaptive->num_thresholds == 0) {
+		return -EINVAL;
+	}
+
+	for (uint8_t i = 0; i < adaptive->num_thresholds; i++) {
+		if (adaptive->thresholds[i] <= 0) {
+			return -EINVAL;
+		}
+	}
+
+	adaptive->primed = false;
+	adaptive->quiet = 0;
+
+	key = k_spin_lock(&adaptive->lock);
+	adaptive->stats = (struct pipeline_adaptive_stats){ 0 };
+	k_spin_unlock(&adaptive->lock, key);
+
+	return 0;
+}
+
+/* Restart from @p x at @p t_ms */
+static void rebase(struct pipeline_adaptive *adaptive, const int64_t *x,
+		   uint8_t n, int64_t t_ms)
+{
+	for (uint8_t i = 0; i < n; i++) {
+		adaptive->ref[i] = x[i];
+		adaptive->var[i] = 0;
+	}
+	adaptive->ref_ms = t_ms;
+	adaptive->quiet = 0;
+}
+
+uint32_t pipeline_adaptive_update(struct pipeline_adaptive *adaptive,
+				  const struct pipeline_sample *sample,
+				  uint32_t period_ms)
+{
+	uint8_t n = MIN(sample->count, adaptive->num_thresholds);
+	int64_t elapsed_ms = sample->timestamp_ms - adaptive->ref_ms;
+	int64_t dt_ms = sample->timestamp_ms - adaptive->prev_ms;
+	int64_t x[CONFIG_PIPELINE_MAX_VALUES];
+	int64_t next_ms = INT64_MAX;
+	bool fluctuating = false;
+	k_spinlock_key_t key;
+
+	for (uint8_t i = 0; i < n; i++) {
+		x[i] = sensor_value_to_milli(&sample->values[i]);
+	}
+
+	if (!adaptive->primed) {
+		for (uint8_t i = 0; i < n; i++) {
+			adaptive->prev[i] = x[i];
+		}
+		rebase(adaptive, x, n, sample->timestamp_ms);
+		adaptive->prev_ms = sample->timestamp_ms;
+		adaptive->primed = true;
+		next_ms = period_ms;
+		goto out;
+	}
+
+	for (uint8_t i = 0; i < n; i++) {
+		int64_t threshold = adaptive->thresholds[i];
+		int64_t d = x[i] - adaptive->prev[i];
+		int64_t moved = llabs(x[i] - adaptive->ref[i]);
+
+		adaptive->prev[i] = x[i];
+		adaptive->var[i] += (d * d - adaptive->var[i]) /
+				    (1 << VAR_SHIFT);
+
+		/* RMS difference above half the threshold */
+		if (4 * adaptive->var[i] > threshold * threshold) {
+			fluctuating = true;
+		}
+
+		/*
+		 * Time to move by one threshold at the rate since the last
+		 * change, or since the previous sample for a sudden step
+		 */
+		if (moved >= threshold) {
+			next_ms = MIN(next_ms, threshold * elapsed_ms / moved);
+		}
+		if (llabs(d) >= threshold) {
+			next_ms = MIN(next_ms, threshold * dt_ms / llabs(d));
+		}
+	}
+	adaptive->prev_ms = sample->timestamp_ms;
+
+	if (fluctuating) {
+		next_ms = MIN(next_ms, period_ms / 2);
+	}
+
+	if (next_ms != INT64_MAX) {
+		rebase(adaptive, x, n, sample->timestamp_ms);
+	} else if (++adaptive->quiet >= adaptive->hold) {
+		adaptive->quiet = 0;
+		next_ms = (int64_t)period_ms * 2;
+	} else {
+		next_ms = period_ms;
+	}
+
+out:
+	key = k_spin_lock(&adaptive->lock);
+	next_ms = CLAMP(next_ms, adaptive->min_period_ms,
+			adaptive->max_period_ms);
+	if (next_ms < period_ms) {
+		adaptive->stats.faster++;
+	} else if (next_ms > period_ms) {
+		adaptive->stats.slower++;
+	}
+	adaptive->stats.period_ms = (uint32_t)next_ms;
+	k_spin_unlock(&adaptive->lock, key);
+
+	return (uint32_t)next_ms;
+}
+
+int pipeline_adaptive_bounds_set(struct pipeline_adaptive *adaptive,
+				 uint32_t min_period_ms, uint32_t max_period_ms)
+{
+	k_spinlock_key_t key;
+
+	if (min_period_ms == 0 || min_period_ms > max_period_ms) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&adaptive->lock);
+	adaptive->min_period_ms = min_period_ms;
+	adaptive->max_period_ms = max_period_ms;
+	k_spin_unlock(&adaptive->lock, key);
+
+	return 0;
+}
+
+uint32_t pipeline_adaptive_period_set(struct pipeline_adaptive *adaptive,
+				      uint32_t period_ms)
+{
+	k_spinlock_key_t key = k_spin_lock(&adaptive->lock);
+
+	period_ms = CLAMP(period_ms, adaptive->min_period_ms,
+			  adaptive->max_period_ms);
+	adaptive->stats.period_ms = period_ms;
+
+	k_spin_unlock(&adaptive->lock, key);
+
+	return period_ms;
+}
+
+void pipeline_adaptive_stats_get(struct pipeline_adaptive *adaptive,
+				 struct pipeline_adaptive_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&adaptive->lock);
+
+	*stats = adaptive->stats;
+
+	k_spin_unlock(&adaptive->lock, key);
+}
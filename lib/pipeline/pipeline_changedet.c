@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/slist.h>
+
+#include "pipeline_internal.h"
+
+LOG_MODULE_DECLARE(pipeline, CONFIG_PIPELINE_LOG_LEVEL);
+
+/* Running means are kept in 1/256 of a thousandth, to keep small updates */
+#define MEAN_SCALE 256
+#define MAX_ALPHA_SHIFT 15
+
+static sys_slist_t changedets = SYS_SLIST_STATIC_INIT(&changedets);
+static K_MUTEX_DEFINE(changedets_lock);
+
+static bool params_valid(const struct pipeline_changedet_params *params)
+{
+	return params->alpha_shift <= MAX_ALPHA_SHIFT && params->drift >= 0 &&
+	       params->threshold > 0 &&
+	       params->pre <= CONFIG_PIPELINE_CHANGEDET_MAX_PRE;
+}
+
+/*
+ * A full window, a summary and the sample being acquired must fit in the
+ * pool, or the window would wait for buffers only it can release. Unknown
+ * until the stage is part of a started pipeline, checked again then.
+ */
+static bool params_fit(const struct pipeline_changedet *changedet,
+		       const struct pipeline_changedet_params *params)
+{
+	const struct pipeline *pipeline = changedet->stage.pipeline;
+
+	return pipeline == NULL ||
+	       params->pre + 1U + params->post + 2U <=
+		       pipeline->pool->buf_count;
+}
+
+/*
+ * Update the detector with one sample. Every value feeds a two-sided CUSUM
+ * of its deviations from its running mean; a change restarts the means from
+ * the new levels, so a step is reported once and a ramp keeps reporting.
+ */
+static bool detect(struct pipeline_changedet *changedet,
+		   const struct pipeline_changedet_params *params,
+		   const struct pipeline_sample *sample)
+{
+	int64_t x[CONFIG_PIPELINE_MAX_VALUES];
+	bool change = false;
+
+	for (uint8_t i = 0; i < sample->count; i++) {
+		int64_t d;
+
+		x[i] = sensor_value_to_milli(&sample->values[i]);
+
+		if (!changedet->primed) {
+			continue;
+		}
+
+		d = x[i] - changedet->mean[i] / MEAN_SCALE;
+		changedet->pos[i] = MAX(changedet->pos[i] + d - params->drift,
+					0);
+		changedet->neg[i] = MAX(changedet->neg[i] - d - params->drift,
+					0);
+		changedet->mean[i] += (x[i] * MEAN_SCALE - changedet->mean[i]) /
+				      (1 << params->alpha_shift);
+
+		if (changedet->pos[i] > params->threshold ||
+		    changedet->neg[i] > params->threshold) {
+			change = true;
+		}
+	}
+
+	if (!changedet->primed || change) {
+		for (uint8_t i = 0; i < sample->count; i++) {
+			changedet->mean[i] = x[i] * MEAN_SCALE;
+			changedet->pos[i] = 0;
+			changedet->neg[i] = 0;
+		}
+		changedet->primed = true;
+	}
+
+	return change;
+}
+
+static void stats_inc(struct pipeline_changedet *changedet, uint32_t *counter,
+		      uint32_t n)
+{
+	k_spinlock_key_t key = k_spin_lock(&changedet->lock);
+
+	*counter += n;
+
+	k_spin_unlock(&changedet->lock, key);
+}
+
+static void summarize(struct pipeline_changedet *changedet,
+		      const struct pipeline_sample *sample)
+{
+	if (changedet->summarized == 0) {
+		changedet->first = *sample;
+		memset(changedet->sum, 0, sizeof(changedet->sum));
+	}
+
+	for (uint8_t i = 0; i < sample->count; i++) {
+		changedet->sum[i] += sensor_value_to_milli(&sample->values[i]);
+	}
+	changedet->summarized++;
+}
+
+static struct net_buf *ring_pop(struct pipeline_changedet *changedet)
+{
+	struct net_buf *buf = changedet->ring[changedet->ring_head];
+
+	changedet->ring_head = (changedet->ring_head + 1) %
+			       CONFIG_PIPELINE_CHANGEDET_MAX_PRE;
+	changedet->ring_count--;
+
+	return buf;
+}
+
+/* Release a quiet sample, summarizing it first if there are heartbeats */
+static void ring_release(struct pipeline_changedet *changedet,
+			 uint16_t heartbeat, struct net_buf *buf)
+{
+	if (heartbeat > 0) {
+		summarize(changedet, pipeline_sample(buf));
+	}
+	net_buf_unref(buf);
+}
+
+/*
+ * Keep @p buf as one of the last pre quiet samples. Only the samples leaving
+ * the ring are summarized, those in it may still end up in a window.
+ */
+static void ring_push(struct pipeline_changedet *changedet,
+		      const struct pipeline_changedet_params *params,
+		      struct net_buf *buf)
+{
+	uint16_t pre = params->pre;
+	uint32_t dropped = 0;
+
+	while (changedet->ring_count > 0 && changedet->ring_count >= pre) {
+		ring_release(changedet, params->heartbeat, ring_pop(changedet));
+		dropped++;
+	}
+
+	if (pre == 0) {
+		ring_release(changedet, params->heartbeat, buf);
+		dropped++;
+	} else {
+		changedet->ring[(changedet->ring_head + changedet->ring_count) %
+				CONFIG_PIPELINE_CHANGEDET_MAX_PRE] = buf;
+		changedet->ring_count++;
+	}
+
+	if (dropped > 0) {
+		pipeline_account_dropped(changedet->stage.pipeline, dropped);
+	}
+}
+
+static void window_append(struct pipeline_changedet *changedet,
+			  struct net_buf *buf)
+{
+	if (changedet->head == NULL) {
+		changedet->head = buf;
+	} else {
+		net_buf_frag_insert(changedet->tail, buf);
+	}
+
+	changedet->tail = buf;
+	changedet->count++;
+}
+
+static struct net_buf *window_take(struct pipeline_changedet *changedet)
+{
+	struct net_buf *head = changedet->head;
+	k_spinlock_key_t key = k_spin_lock(&changedet->lock);
+
+	changedet->stats.windows++;
+	changedet->stats.window_samples += changedet->count;
+
+	k_spin_unlock(&changedet->lock, key);
+
+	changedet->head = NULL;
+	changedet->tail = NULL;
+	changedet->count = 0;
+
+	return head;
+}
+
+/* A buffer with the mean of the samples summarized so far, or NULL */
+static struct net_buf *summary_take(struct pipeline_changedet *changedet)
+{
+	struct pipeline_sample *sample;
+	struct net_buf *buf;
+
+	buf = pipeline_buf_alloc(changedet->stage.pipeline);
+	if (buf == NULL) {
+		/* Tried again with the next quiet sample */
+		LOG_DBG("%s: no buffer for a summary",
+			changedet->stage.pipeline->name);
+		return NULL;
+	}
+
+	sample = net_buf_add(buf, sizeof(*sample));
+	*sample = changedet->first;
+	sample->flags |= PIPELINE_SAMPLE_SUMMARY;
+	for (uint8_t i = 0; i < sample->count; i++) {
+		(void)sensor_value_from_milli(&sample->values[i],
+					      changedet->sum[i] /
+						      changedet->summarized);
+	}
+
+	changedet->summarized = 0;
+	stats_inc(changedet, &changedet->stats.heartbeats, 1);
+
+	return buf;
+}
+
+static struct net_buf *changedet_sample(
+	struct pipeline_changedet *changedet,
+	const struct pipeline_changedet_params *params, struct net_buf *buf)
+{
+	const struct pipeline_sample *sample = pipeline_sample(buf);
+	bool in_window = changedet->head != NULL || changedet->post_left > 0;
+
+	stats_inc(changedet, &changedet->stats.samples, 1);
+
+	if (detect(changedet, params, sample)) {
+		stats_inc(changedet, &changedet->stats.changes, 1);
+
+		/* A new window starts with the samples from before */
+		if (!in_window) {
+			while (changedet->ring_count > 0) {
+				window_append(changedet, ring_pop(changedet));
+			}
+			in_window = true;
+		}
+
+		/* The change itself counts as the first of post + 1 */
+		changedet->post_left = params->post + 1;
+	}
+
+	if (in_window) {
+		window_append(changedet, buf);
+		changedet->post_left--;
+
+		if (changedet->post_left == 0 ||
+		    changedet->count >= params->pre + 1 + params->post) {
+			return window_take(changedet);
+		}
+
+		return NULL;
+	}
+
+	ring_push(changedet, params, buf);
+
+	if (params->heartbeat > 0 &&
+	    changedet->summarized >= params->heartbeat) {
+		return summary_take(changedet);
+	}
+
+	return NULL;
+}
+
+static struct net_buf *changedet_process(struct pipeline_stage *stage,
+					 struct net_buf *buf)
+{
+	struct pipeline_changedet *changedet =
+		CONTAINER_OF(stage, struct pipeline_changedet, stage);
+	struct pipeline_changedet_params params;
+	struct net_buf *out = NULL;
+	k_spinlock_key_t key = k_spin_lock(&changedet->lock);
+
+	params = changedet->params;
+
+	k_spin_unlock(&changedet->lock, key);
+
+	/* Single samples are expected, a chain is taken apart */
+	while (buf != NULL) {
+		struct net_buf *next = buf->frags;
+
+		buf->frags = NULL;
+		if (out != NULL) {
+			pipeline_forward(stage, out);
+		}
+		out = changedet_sample(changedet, &params, buf);
+		buf = next;
+	}
+
+	return out;
+}
+
+/* Pass on the window being gathered, or else a partial summary */
+static struct net_buf *changedet_flush(struct pipeline_stage *stage)
+{
+	struct pipeline_changedet *changedet =
+		CONTAINER_OF(stage, struct pipeline_changedet, stage);
+	uint32_t dropped = changedet->ring_count;
+	k_spinlock_key_t key = k_spin_lock(&changedet->lock);
+	uint16_t heartbeat = changedet->params.heartbeat;
+
+	k_spin_unlock(&changedet->lock, key);
+
+	while (changedet->ring_count > 0) {
+		ring_release(changedet, heartbeat, ring_pop(changedet));
+	}
+	if (dropped > 0) {
+		pipeline_account_dropped(stage->pipeline, dropped);
+	}
+
+	changedet->post_left = 0;
+	if (changedet->head != NULL) {
+		return window_take(changedet);
+	}
+
+	if (changedet->summarized > 0) {
+		return summary_take(changedet);
+	}
+
+	return NULL;
+}
+
+static int changedet_init(struct pipeline_stage *stage)
+{
+	struct pipeline_changedet *changedet =
+		CONTAINER_OF(stage, struct pipeline_changedet, stage);
+
+	if (!params_valid(&changedet->params)) {
+		return -EINVAL;
+	}
+
+	if (!params_fit(changedet, &changedet->params)) {
+		LOG_ERR("%s: window of %u samples too large for the pool",
+			stage->pipeline->name,
+			changedet->params.pre + 1U + changedet->params.post);
+		return -ENOBUFS;
+	}
+
+	changedet->primed = false;
+	changedet->ring_head = 0;
+	changedet->ring_count = 0;
+	changedet->head = NULL;
+	changedet->tail = NULL;
+	changedet->count = 0;
+	changedet->post_left = 0;
+	changedet->summarized = 0;
+
+	k_mutex_lock(&changedets_lock, K_FOREVER);
+	(void)sys_slist_find_and_remove(&changedets, &changedet->node);
+	sys_slist_append(&changedets, &changedet->node);
+	k_mutex_unlock(&changedets_lock);
+
+	return 0;
+}
+
+const struct pipeline_stage_api pipeline_changedet_api = {
+	.name = "changedet",
+	.init = changedet_init,
+	.process = changedet_process,
+	.flush = changedet_flush,
+};
+
+int pipeline_changedet_params_set(
+	struct pipeline_changedet *changedet,
+	const struct pipeline_changedet_params *params)
+{
+	k_spinlock_key_t key;
+
+	if (!params_valid(params)) {
+		return -EINVAL;
+	}
+
+	if (!params_fit(changedet, params)) {
+		return -ENOBUFS;
+	}
+
+	key = k_spin_lock(&changedet->lock);
+	changedet->params = *params;
+	k_spin_unlock(&changedet->lock, key);
+
+	return 0;
+}
+
+void pipeline_changedet_params_get(struct pipeline_changedet *changedet,
+				   struct pipeline_changedet_params *params)
+{
+	k_spinlock_key_t key = k_spin_lock(&changedet->lock);
+
+	*params = changedet->params;
+
+	k_spin_unlock(&changedet->lock, key);
+}
+
+void pipeline_changedet_stats_get(struct pipeline_changedet *changedet,
+				  struct pipeline_changedet_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&changedet->lock);
+
+	*stats = changedet->stats;
+
+	k_spin_unlock(&changedet->lock, key);
+}
+
+void pipeline_changedet_foreach(pipeline_changedet_cb_t fn, void *user_data)
+{
+	struct pipeline_changedet *changedet;
+
+	k_mutex_lock(&changedets_lock, K_FOREVER);
+	SYS_SLIST_FOR_EACH_CONTAINER(&changedets, changedet, node) {
+		fn(changedet, user_data);
+	}
+	k_mutex_unlock(&changedets_lock);
+}
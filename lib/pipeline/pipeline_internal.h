@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_PIPELINE_INTERNAL_H_
+#define APP_LIB_PIPELINE_INTERNAL_H_
+
+#include <app/lib/pipeline.h>
+
+/* Bits of pipeline::state */
+#define PIPELINE_INITIALIZED 0
+#define PIPELINE_RUNNING 1
+#define PIPELINE_STARVED 2
+
+/* Bits of pipeline_stage::flags */
+#define PIPELINE_STAGE_FLUSH 0
+
+/* Pick a work queue of the pool, round robin */
+struct k_work_q *pipeline_queue_next(void);
+
+/*
+ * Get an empty buffer of the pipeline's pool, or NULL if all are in use,
+ * flushing the pipeline on the first failure of a shortage
+ */
+struct net_buf *pipeline_buf_alloc(struct pipeline *pipeline);
+
+/* Hand @p buf to the stage after @p stage, or release it after the last */
+void pipeline_forward(struct pipeline_stage *stage, struct net_buf *buf);
+
+/* Ask @p stage to flush once it has processed what it already received */
+void pipeline_stage_flush(struct pipeline_stage *stage);
+
+/* Statistics accounting, safe to call from any thread */
+void pipeline_account_dropped(struct pipeline *pipeline, uint32_t samples);
+void pipeline_account_delivered(struct pipeline *pipeline, uint32_t samples,
+				int err);
+
+#ifdef CONFIG_PIPELINE_ADAPTIVE
+/* Clamp a period set by the application to the bounds and record it */
+uint32_t pipeline_adaptive_period_set(struct pipeline_adaptive *adaptive,
+				      uint32_t period_ms);
+#endif
+
+#endif /* APP_LIB_PIPELINE_INTERNAL_H_ */
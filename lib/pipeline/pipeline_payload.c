@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include "pipeline_internal.h"
+
+LOG_MODULE_DECLARE(pipeline, CONFIG_PIPELINE_LOG_LEVEL);
+
+#define PAYLOAD_BLOCK_SIZE                                                     \
+	ROUND_UP(sizeof(struct pipeline_payload) +                             \
+			 CONFIG_PIPELINE_PAYLOAD_SIZE,                         \
+		 sizeof(void *))
+
+K_MEM_SLAB_DEFINE_STATIC(payload_slab, PAYLOAD_BLOCK_SIZE,
+			 CONFIG_PIPELINE_PAYLOAD_COUNT, sizeof(void *));
+
+static struct pipeline_payload_stats stats = {
+	.count = CONFIG_PIPELINE_PAYLOAD_COUNT,
+};
+static struct k_spinlock stats_lock;
+
+struct pipeline_payload *pipeline_payload_alloc(k_timeout_t timeout)
+{
+	struct pipeline_payload *payload;
+	k_spinlock_key_t key;
+
+	if (k_mem_slab_alloc(&payload_slab, (void **)&payload, timeout) != 0) {
+		key = k_spin_lock(&stats_lock);
+		stats.failures++;
+		k_spin_unlock(&stats_lock, key);
+
+		LOG_DBG("No payload available");
+		return NULL;
+	}
+
+	payload->len = 0;
+	payload->size = CONFIG_PIPELINE_PAYLOAD_SIZE;
+	atomic_set(&payload->ref, 1);
+
+	key = k_spin_lock(&stats_lock);
+	stats.used++;
+	stats.max_used = MAX(stats.max_used, stats.used);
+	k_spin_unlock(&stats_lock, key);
+
+	return payload;
+}
+
+struct pipeline_payload *pipeline_payload_ref(struct pipeline_payload *payload)
+{
+	__ASSERT(atomic_get(&payload->ref) > 0, "payload already freed");
+
+	atomic_inc(&payload->ref);
+
+	return payload;
+}
+
+void pipeline_payload_unref(struct pipeline_payload *payload)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT(atomic_get(&payload->ref) > 0, "payload already freed");
+
+	if (atomic_dec(&payload->ref) != 1) {
+		return;
+	}
+
+	key = k_spin_lock(&stats_lock);
+	stats.used--;
+	k_spin_unlock(&stats_lock, key);
+
+	k_mem_slab_free(&payload_slab, payload);
+}
+
+void pipeline_payload_stats_get(struct pipeline_payload_stats *out)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	*out = stats;
+
+	k_spin_unlock(&stats_lock, key);
+}
@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/shell/shell.h>
+
+#include <app/lib/pipeline.h>
+
+struct changedet_cmd {
+	const struct shell *sh;
+	/* Stage to act on, or -1 for all */
+	int index;
+	int current;
+	/* For "set": parameter name and value */
+	const char *name;
+	long value;
+	int err;
+};
+
+static void show_changedet(struct pipeline_changedet *changedet,
+			   void *user_data)
+{
+	struct changedet_cmd *cmd = user_data;
+	struct pipeline_changedet_params params;
+	struct pipeline_changedet_stats stats;
+	int index = cmd->current++;
+	uint32_t passed;
+
+	if (cmd->index >= 0 && cmd->index != index) {
+		return;
+	}
+
+	pipeline_changedet_params_get(changedet, &params);
+	pipeline_changedet_stats_get(changedet, &stats);
+
+	shell_print(cmd->sh,
+		    "%d: %s alpha_shift %u drift %d threshold %d pre %u "
+		    "post %u heartbeat %u",
+		    index, changedet->stage.pipeline->name, params.alpha_shift,
+		    params.drift, params.threshold, params.pre, params.post,
+		    params.heartbeat);
+	passed = stats.window_samples + stats.heartbeats;
+	shell_print(cmd->sh,
+		    "   %u samples, %u changes, %u windows of %u samples, "
+		    "%u heartbeats, %u%% passed on",
+		    stats.samples, stats.changes, stats.windows,
+		    stats.window_samples, stats.heartbeats,
+		    stats.samples == 0 ? 0 : 100U * passed / stats.samples);
+}
+
+static int set_param(struct pipeline_changedet_params *params,
+		     const char *name, long value)
+{
+	if (strcmp(name, "alpha_shift") == 0) {
+		params->alpha_shift = (uint8_t)CLAMP(value, 0, UINT8_MAX);
+	} else if (strcmp(name, "drift") == 0) {
+		params->drift = (int32_t)value;
+	} else if (strcmp(name, "threshold") == 0) {
+		params->threshold = (int32_t)value;
+	} else if (strcmp(name, "pre") == 0) {
+		params->pre = (uint16_t)CLAMP(value, 0, UINT16_MAX);
+	} else if (strcmp(name, "post") == 0) {
+		params->post = (uint16_t)CLAMP(value, 0, UINT16_MAX);
+	} else if (strcmp(name, "heartbeat") == 0) {
+		params->heartbeat = (uint16_t)CLAMP(value, 0, UINT16_MAX);
+	} else {
+		return -ENOENT;
+	}
+
+	return 0;
+}
+
+static void set_changedet(struct pipeline_changedet *changedet,
+			  void *user_data)
+{
+	struct changedet_cmd *cmd = user_data;
+	struct pipeline_changedet_params params;
+	int index = cmd->current++;
+	int err;
+
+	if (cmd->err != 0 || (cmd->index >= 0 && cmd->index != index)) {
+		return;
+	}
+
+	pipeline_changedet_params_get(changedet, &params);
+
+	err = set_param(&params, cmd->name, cmd->value);
+	if (err == 0) {
+		err = pipeline_changedet_params_set(changedet, &params);
+	}
+
+	if (err == -ENOENT) {
+		shell_error(cmd->sh, "Unknown parameter %s", cmd->name);
+	} else if (err == -ENOBUFS) {
+		shell_error(cmd->sh,
+			    "%d: %s %ld, pre + post + 3 exceeds the %u "
+			    "buffers of %s", index, cmd->name, cmd->value,
+			    changedet->stage.pipeline->pool->buf_count,
+			    changedet->stage.pipeline->name);
+	} else if (err < 0) {
+		shell_error(cmd->sh, "%d: %s %ld out of range", index,
+			    cmd->name, cmd->value);
+	}
+	cmd->err = err;
+}
+
+static int parse_index(const struct shell *sh, size_t argc, char **argv,
+		       size_t pos, int *index)
+{
+	int err = 0;
+
+	*index = -1;
+	if (argc > pos) {
+		*index = (int)shell_strtol(argv[pos], 10, &err);
+		if (err != 0 || *index < 0) {
+			shell_error(sh, "Invalid index %s", argv[pos]);
+			return -EINVAL;
+		}
+	}
+
+	return 0;
+}
+
+static int cmd_changedet_show(const struct shell *sh, size_t argc,
+			      char **argv)
+{
+	struct changedet_cmd cmd = { .sh = sh };
+
+	if (parse_index(sh, argc, argv, 1, &cmd.index) < 0) {
+		return -EINVAL;
+	}
+
+	pipeline_changedet_foreach(show_changedet, &cmd);
+
+	if (cmd.current == 0) {
+		shell_print(sh, "No change detection stage started");
+	}
+
+	return 0;
+}
+
+static int cmd_changedet_set(const struct shell *sh, size_t argc,
+			     char **argv)
+{
+	struct changedet_cmd cmd = { .sh = sh, .name = argv[1] };
+	int err = 0;
+
+	cmd.value = shell_strtol(argv[2], 10, &err);
+	if (err != 0) {
+		shell_error(sh, "Invalid value %s", argv[2]);
+		return -EINVAL;
+	}
+
+	if (parse_index(sh, argc, argv, 3, &cmd.index) < 0) {
+		return -EINVAL;
+	}
+
+	pipeline_changedet_foreach(set_changedet, &cmd);
+
+	return cmd.err;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(
+	sub_changedet,
+	SHELL_CMD_ARG(show, NULL,
+		      "Show parameters and statistics\n"
+		      "Usage: show [index]",
+		      cmd_changedet_show, 1, 1),
+	SHELL_CMD_ARG(set, NULL,
+		      "Set a parameter: alpha_shift, drift, threshold, pre, "
+		      "post or heartbeat\n"
+		      "Usage: set <parameter> <value> [index]",
+		      cmd_changedet_set, 3, 1),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(
+	sub_pipeline,
+	SHELL_CMD(changedet, &sub_changedet, "Change detection stages", NULL),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(pipeline, &sub_pipeline, "Sensor pipelines", NULL);
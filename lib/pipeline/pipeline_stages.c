@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include "pipeline_internal.h"
+
+LOG_MODULE_DECLARE(pipeline, CONFIG_PIPELINE_LOG_LEVEL);
+
+static uint32_t chain_length(struct net_buf *buf)
+{
+	uint32_t n = 0;
+
+	for (; buf != NULL; buf = buf->frags) {
+		n++;
+	}
+
+	return n;
+}
+
+/* Transform: every sample of the buffer in place, unlinking dropped ones */
+
+static struct net_buf *transform_process(struct pipeline_stage *stage,
+					 struct net_buf *buf)
+{
+	struct pipeline_transform *transform =
+		CONTAINER_OF(stage, struct pipeline_transform, stage);
+	struct net_buf *head = buf;
+	struct net_buf *prev = NULL;
+	uint32_t dropped = 0;
+
+	while (buf != NULL) {
+		if (transform->fn(pipeline_sample(buf),
+				  transform->user_data) == 0) {
+			prev = buf;
+			buf = buf->frags;
+			continue;
+		}
+
+		buf = net_buf_frag_del(prev, buf);
+		if (prev == NULL) {
+			head = buf;
+		}
+		dropped++;
+	}
+
+	if (dropped > 0) {
+		pipeline_account_dropped(stage->pipeline, dropped);
+	}
+
+	return head;
+}
+
+const struct pipeline_stage_api pipeline_transform_api = {
+	.name = "transform",
+	.process = transform_process,
+};
+
+/*
+ * Batch: samples are chained behind the first one of the batch, so a batch
+ * is a fragment list of the buffers acquisition filled in.
+ */
+
+static void batch_expired(struct k_timer *timer)
+{
+	struct pipeline_batch *batch =
+		CONTAINER_OF(timer, struct pipeline_batch, timer);
+
+	pipeline_stage_flush(&batch->stage);
+}
+
+static int batch_init(struct pipeline_stage *stage)
+{
+	struct pipeline_batch *batch =
+		CONTAINER_OF(stage, struct pipeline_batch, stage);
+
+	if (batch->size == 0) {
+		return -EINVAL;
+	}
+
+	batch->head = NULL;
+	batch->tail = NULL;
+	batch->count = 0;
+	k_timer_init(&batch->timer, batch_expired, NULL);
+
+	return 0;
+}
+
+static struct net_buf *batch_flush(struct pipeline_stage *stage)
+{
+	struct pipeline_batch *batch =
+		CONTAINER_OF(stage, struct pipeline_batch, stage);
+	struct net_buf *head = batch->head;
+
+	k_timer_stop(&batch->timer);
+	batch->head = NULL;
+	batch->tail = NULL;
+	batch->count = 0;
+
+	return head;
+}
+
+static struct net_buf *batch_process(struct pipeline_stage *stage,
+				     struct net_buf *buf)
+{
+	struct pipeline_batch *batch =
+		CONTAINER_OF(stage, struct pipeline_batch, stage);
+
+	if (batch->head == NULL) {
+		batch->head = buf;
+		if (batch->max_age_ms > 0) {
+			k_timer_start(&batch->timer, K_MSEC(batch->max_age_ms),
+				      K_NO_WAIT);
+		}
+	} else {
+		net_buf_frag_insert(batch->tail, buf);
+	}
+
+	batch->tail = net_buf_frag_last(buf);
+	batch->count += chain_length(buf);
+
+	if (batch->count < batch->size) {
+		return NULL;
+	}
+
+	return batch_flush(stage);
+}
+
+const struct pipeline_stage_api pipeline_batch_api = {
+	.name = "batch",
+	.init = batch_init,
+	.process = batch_process,
+	.flush = batch_flush,
+};
+
+/* Sink: hands the buffer on unchanged, a pipeline may have several */
+
+static struct net_buf *sink_process(struct pipeline_stage *stage,
+				    struct net_buf *buf)
+{
+	struct pipeline_sink *sink =
+		CONTAINER_OF(stage, struct pipeline_sink, stage);
+	uint32_t samples = chain_length(buf);
+	int ret;
+
+	ret = sink->fn(buf, sink->user_data);
+	if (ret < 0) {
+		LOG_WRN("%s: sink failed (%d)", stage->pipeline->name, ret);
+	}
+
+	pipeline_account_delivered(stage->pipeline, samples, ret);
+
+	return buf;
+}
+
+const struct pipeline_stage_api pipeline_sink_api = {
+	.name = "sink",
+	.process = sink_process,
+};
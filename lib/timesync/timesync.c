@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/sntp.h>
+#include <zephyr/net/socket.h>
+
+#include <app/lib/timesync.h>
+
+LOG_MODULE_REGISTER(timesync, CONFIG_TIMESYNC_LOG_LEVEL);
+
+static struct k_work_q queue;
+static K_THREAD_STACK_DEFINE(queue_stack, CONFIG_TIMESYNC_THREAD_STACK_SIZE);
+
+static void sync_work_handler(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(sync_work, sync_work_handler);
+
+/* Signalled after every query, for timesync_start() to wait on */
+static K_SEM_DEFINE(sync_done, 0, 1);
+static int sync_result;
+static atomic_t running;
+
+/*
+ * The clock is the uptime plus an offset. The offset is base_ms, plus the
+ * part of slew_ms applied since slew_start_ms at CONFIG_TIMESYNC_SLEW_PPM.
+ * Slewing at less than 100% keeps the clock monotonic.
+ */
+static struct k_spinlock lock;
+static bool synced;
+static int64_t base_ms;
+static int64_t slew_start_ms;
+static int64_t slew_ms;
+static struct timesync_stats stats;
+
+static int64_t slewed(int64_t uptime_ms)
+{
+	int64_t elapsed = MAX(uptime_ms - slew_start_ms, 0);
+	int64_t max = elapsed * CONFIG_TIMESYNC_SLEW_PPM / 1000000;
+
+	return CLAMP(slew_ms, -max, max);
+}
+
+static int64_t offset_at(int64_t uptime_ms)
+{
+	return base_ms + slewed(uptime_ms);
+}
+
+static int resolve(struct sockaddr_storage *addr, socklen_t *addrlen)
+{
+	struct zsock_addrinfo hints = {
+		.ai_family = AF_INET,
+		.ai_socktype = SOCK_DGRAM,
+	};
+	struct zsock_addrinfo *res = NULL;
+	char port[8];
+	int err;
+
+	snprintk(port, sizeof(port), "%d", CONFIG_TIMESYNC_PORT);
+
+	err = zsock_getaddrinfo(CONFIG_TIMESYNC_SERVER, port, &hints, &res);
+	if (err != 0 || res == NULL) {
+		LOG_ERR("Could not resolve %s (%d)", CONFIG_TIMESYNC_SERVER,
+			err);
+		if (res != NULL) {
+			zsock_freeaddrinfo(res);
+		}
+		return -EHOSTUNREACH;
+	}
+
+	memcpy(addr, res->ai_addr, res->ai_addrlen);
+	*addrlen = res->ai_addrlen;
+	zsock_freeaddrinfo(res);
+
+	return 0;
+}
+
+/*
+ * Query the server. The server time is taken to match the uptime halfway
+ * through the round trip, which is exact for a symmetric path.
+ */
+static int query(int64_t *server_ms, int64_t *uptime_ms, uint32_t *rtt_ms)
+{
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct sntp_ctx ctx;
+	struct sntp_time time;
+	int64_t sent, received;
+	int ret;
+
+	ret = resolve(&addr, &addrlen);
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = sntp_init(&ctx, (struct sockaddr *)&addr, addrlen);
+	if (ret < 0) {
+		return ret;
+	}
+
+	sent = k_uptime_get();
+	ret = sntp_query(&ctx, CONFIG_TIMESYNC_TIMEOUT_MS, &time);
+	received = k_uptime_get();
+	sntp_close(&ctx);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	*server_ms = (int64_t)time.seconds * MSEC_PER_SEC +
+		     (int64_t)(((uint64_t)time.fraction * MSEC_PER_SEC) >> 32);
+	*uptime_ms = sent + (received - sent) / 2;
+	*rtt_ms = (uint32_t)(received - sent);
+
+	return 0;
+}
+
+static void apply(int64_t server_ms, int64_t uptime_ms, uint32_t rtt_ms)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int64_t target = server_ms - uptime_ms;
+	int64_t error = target - offset_at(uptime_ms);
+	bool step = !synced || llabs(error) > CONFIG_TIMESYNC_STEP_MS;
+
+	if (step) {
+		base_ms = target;
+		slew_ms = 0;
+		stats.steps++;
+	} else {
+		/* Keep what was slewed so far and slew from there to target */
+		int64_t now = k_uptime_get();
+
+		base_ms = offset_at(now);
+		slew_start_ms = now;
+		slew_ms = target - base_ms;
+		stats.max_error_ms = MAX(stats.max_error_ms,
+					 (uint32_t)llabs(error));
+	}
+
+	synced = true;
+	stats.syncs++;
+	stats.last_error_ms = (int32_t)CLAMP(error, INT32_MIN, INT32_MAX);
+	stats.last_rtt_ms = rtt_ms;
+	stats.last_sync_ms = uptime_ms;
+
+	k_spin_unlock(&lock, key);
+
+	LOG_INF("%s by %lld ms, rtt %u ms", step ? "Stepped" : "Slewing",
+		(long long)error, rtt_ms);
+}
+
+static void sync_work_handler(struct k_work *work)
+{
+	int64_t server_ms, uptime_ms;
+	uint32_t rtt_ms;
+	k_timeout_t next;
+	int ret;
+
+	ARG_UNUSED(work);
+
+	ret = query(&server_ms, &uptime_ms, &rtt_ms);
+	if (ret == 0) {
+		apply(server_ms, uptime_ms, rtt_ms);
+		next = K_SECONDS(CONFIG_TIMESYNC_INTERVAL_S);
+	} else {
+		k_spinlock_key_t key = k_spin_lock(&lock);
+
+		stats.failures++;
+
+		k_spin_unlock(&lock, key);
+
+		LOG_WRN("Query to %s failed (%d)", CONFIG_TIMESYNC_SERVER,
+			ret);
+		next = K_SECONDS(CONFIG_TIMESYNC_RETRY_S);
+	}
+
+	sync_result = ret;
+	k_sem_give(&sync_done);
+
+	if (atomic_get(&running)) {
+		k_work_schedule_for_queue(&queue, &sync_work, next);
+	}
+}
+
+int timesync_start(k_timeout_t timeout)
+{
+	k_sem_reset(&sync_done);
+	atomic_set(&running, 1);
+	k_work_reschedule_for_queue(&queue, &sync_work, K_NO_WAIT);
+
+	if (k_sem_take(&sync_done, timeout) != 0) {
+		return -EAGAIN;
+	}
+
+	return sync_result;
+}
+
+void timesync_stop(void)
+{
+	struct k_work_sync sync;
+
+	atomic_set(&running, 0);
+	k_work_cancel_delayable_sync(&sync_work, &sync);
+}
+
+bool timesync_is_synced(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	bool ret = synced;
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+int timesync_to_epoch_ms(int64_t uptime_ms, int64_t *epoch_ms)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	int ret = 0;
+
+	if (synced) {
+		*epoch_ms = uptime_ms + offset_at(uptime_ms);
+	} else {
+		ret = -EAGAIN;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return ret;
+}
+
+void timesync_stats_get(struct timesync_stats *out)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	*out = stats;
+	out->slewing_ms = (int32_t)(slew_ms - slewed(k_uptime_get()));
+
+	k_spin_unlock(&lock, key);
+}
+
+static int timesync_init(void)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "timesync",
+	};
+
+	k_work_queue_start(&queue, queue_stack,
+			   K_THREAD_STACK_SIZEOF(queue_stack),
+			   CONFIG_TIMESYNC_THREAD_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(timesync_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
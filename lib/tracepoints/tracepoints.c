@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/tracing/tracing.h>
+
+#include <app/lib/tracepoints.h>
+
+void tracepoint_begin(const char *name, uint32_t id)
+{
+	sys_trace_named_event(name, TRACEPOINT_BEGIN, id);
+}
+
+void tracepoint_end(const char *name, uint32_t id)
+{
+	sys_trace_named_event(name, TRACEPOINT_END, id);
+}
@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/socket.h>
+
+#include <app/lib/tracepoints.h>
+
+#include "uplink_internal.h"
+
+LOG_MODULE_REGISTER(uplink, CONFIG_UPLINK_LOG_LEVEL);
+
+BUILD_ASSERT(sizeof(CONFIG_UPLINK_HOST) <= UPLINK_HOST_MAX_LEN + 1,
+	     "UPLINK_HOST too long");
+BUILD_ASSERT(sizeof(UPLINK_PATH_DEFAULT) <= UPLINK_PATH_MAX_LEN + 1,
+	     "Uplink path too long");
+
+static struct uplink_stats stats;
+static struct k_spinlock stats_lock;
+
+static struct uplink_peer target = {
+	.host = CONFIG_UPLINK_HOST,
+	.port = CONFIG_UPLINK_PORT,
+	.path = UPLINK_PATH_DEFAULT,
+};
+static struct k_spinlock target_lock;
+
+void uplink_account_connect(uint32_t setup_ms)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	stats.connects++;
+	stats.last_connect_ms = setup_ms;
+	stats.max_connect_ms = MAX(stats.max_connect_ms, setup_ms);
+	stats.total_connect_ms += setup_ms;
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+void uplink_account_tx(size_t payload, size_t wire)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	stats.sent++;
+	stats.payload_bytes += payload;
+	stats.wire_tx_bytes += wire;
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+void uplink_account_rx(size_t wire)
+{
+	uplink_account_wire(0, wire);
+}
+
+void uplink_account_wire(size_t tx, size_t rx)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	stats.wire_tx_bytes += tx;
+	stats.wire_rx_bytes += rx;
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+void uplink_account_packets(uint32_t tx, uint32_t rx)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	stats.packets_tx += tx;
+	stats.packets_rx += rx;
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+void uplink_account_retransmit(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	stats.retransmits++;
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+void uplink_account_ack(uint32_t latency_ms)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	stats.acked++;
+	stats.last_latency_ms = latency_ms;
+	stats.max_latency_ms = MAX(stats.max_latency_ms, latency_ms);
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+void uplink_account_fail(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	stats.failed++;
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+int uplink_resolve(int socktype, struct sockaddr_storage *addr,
+		   socklen_t *addrlen)
+{
+	struct zsock_addrinfo hints = {
+		.ai_family = AF_INET,
+		.ai_socktype = socktype,
+	};
+	struct zsock_addrinfo *res = NULL;
+	struct uplink_peer peer;
+	char port[8];
+	int err;
+
+	uplink_peer_get(&peer);
+	snprintk(port, sizeof(port), "%u", peer.port);
+
+	err = zsock_getaddrinfo(peer.host, port, &hints, &res);
+	if (err != 0 || res == NULL) {
+		LOG_ERR("Could not resolve %s (%d)", peer.host, err);
+		if (res != NULL) {
+			zsock_freeaddrinfo(res);
+		}
+		return -EHOSTUNREACH;
+	}
+
+	memcpy(addr, res->ai_addr, res->ai_addrlen);
+	*addrlen = res->ai_addrlen;
+	zsock_freeaddrinfo(res);
+
+	return 0;
+}
+
+int uplink_connect(void)
+{
+	int ret;
+
+	tracepoint_begin("uplink_connect", 0);
+	ret = uplink_backend.connect();
+	tracepoint_end("uplink_connect", 0);
+
+	return ret;
+}
+
+int uplink_send(const struct uplink_msg *msg)
+{
+	int ret;
+
+	tracepoint_begin("uplink_send", TRACEPOINT_ID(msg));
+	ret = uplink_backend.send(msg);
+	tracepoint_end("uplink_send", TRACEPOINT_ID(msg));
+	if (ret < 0) {
+		LOG_WRN("Sending '%s' failed (%d)", msg->label, ret);
+		uplink_account_fail();
+	}
+
+	return ret;
+}
+
+int uplink_flush(k_timeout_t timeout)
+{
+	return uplink_backend.flush(timeout);
+}
+
+void uplink_disconnect(void)
+{
+	uplink_backend.disconnect();
+}
+
+int uplink_peer_set(const struct uplink_peer *peer)
+{
+	k_spinlock_key_t key;
+
+	if (peer->port == 0 || peer->host[0] == '\0' ||
+	    strnlen(peer->host, sizeof(peer->host)) == sizeof(peer->host) ||
+	    strnlen(peer->path, sizeof(peer->path)) == sizeof(peer->path)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&target_lock);
+	target = *peer;
+	k_spin_unlock(&target_lock, key);
+
+	/* Resolved and connected again on the next message */
+	uplink_backend.disconnect();
+
+	LOG_INF("Peer %s:%u %s", peer->host, peer->port, peer->path);
+
+	return 0;
+}
+
+void uplink_peer_get(struct uplink_peer *peer)
+{
+	k_spinlock_key_t key = k_spin_lock(&target_lock);
+
+	*peer = target;
+
+	k_spin_unlock(&target_lock, key);
+}
+
+void uplink_stats_get(struct uplink_stats *out)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	*out = stats;
+
+	k_spin_unlock(&stats_lock, key);
+}
+
+const char *uplink_backend_name(void)
+{
+	return uplink_backend.name;
+}
@@ -0,0 +1,427 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * CoAP uplink backend. Every message is a confirmable POST over UDP, so a
+ * message that fits in one block costs exactly one datagram each way.
+ * Larger messages are sent block-wise (RFC 7959, Block1), one confirmable
+ * request per block. Lost datagrams are retransmitted with the back-off of
+ * RFC 7252 section 4.2, driven by the CoAP library's pending helpers.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/coap.h>
+#include <zephyr/net/socket.h>
+
+#include "uplink_internal.h"
+
+LOG_MODULE_DECLARE(uplink, CONFIG_UPLINK_LOG_LEVEL);
+
+#define BLOCK_BYTES CONFIG_UPLINK_COAP_BLOCK_SIZE
+BUILD_ASSERT(IS_POWER_OF_TWO(BLOCK_BYTES), "CoAP block size must be 2^n");
+
+/* Room for the header, token and options on top of one block */
+#define PDU_SIZE (BLOCK_BYTES + 128)
+
+static struct sockaddr_storage peer;
+static socklen_t peer_len;
+static int sock = -1;
+
+static uint8_t tx_buf[PDU_SIZE];
+static uint8_t rx_buf[PDU_SIZE];
+static char query[64];
+
+static K_MUTEX_DEFINE(coap_lock);
+
+static enum coap_block_size block_szx(size_t bytes)
+{
+	enum coap_block_size szx = COAP_BLOCK_16;
+
+	while (coap_block_size_to_bytes(szx) < bytes && szx < COAP_BLOCK_1024) {
+		szx++;
+	}
+
+	return szx;
+}
+
+static uint16_t content_format(const char *content_type)
+{
+	if (content_type == NULL) {
+		return COAP_CONTENT_FORMAT_APP_OCTET_STREAM;
+	} else if (strcmp(content_type, "application/json") == 0) {
+		return COAP_CONTENT_FORMAT_APP_JSON;
+	} else if (strcmp(content_type, "application/cbor") == 0) {
+		return COAP_CONTENT_FORMAT_APP_CBOR;
+	} else if (strncmp(content_type, "text/plain", 10) == 0) {
+		return COAP_CONTENT_FORMAT_TEXT_PLAIN;
+	}
+
+	return COAP_CONTENT_FORMAT_APP_OCTET_STREAM;
+}
+
+static int coap_send_pdu(const uint8_t *data, size_t len)
+{
+	if (zsock_send(sock, data, len, 0) < 0) {
+		return -errno;
+	}
+
+	uplink_account_wire(len, 0);
+	uplink_account_packets(1, 0);
+
+	return 0;
+}
+
+static void coap_send_empty_ack(const struct coap_packet *con)
+{
+	uint8_t buf[4 + COAP_TOKEN_MAX_LEN];
+	struct coap_packet ack;
+
+	if (coap_ack_init(&ack, con, buf, sizeof(buf), COAP_CODE_EMPTY) == 0) {
+		(void)coap_send_pdu(ack.data, ack.offset);
+	}
+}
+
+/*
+ * Wait up to @p timeout_ms for the response to the request with message
+ * @p id and @p token. Returns 1 with @p rsp parsed, 0 on timeout.
+ * @p acked is set once the peer has acknowledged the request, after which
+ * a separate response may still follow.
+ */
+static int coap_recv_response(struct coap_packet *rsp, uint16_t id,
+			      const uint8_t *token, uint8_t tkl,
+			      uint32_t timeout_ms, bool *acked)
+{
+	k_timepoint_t end = sys_timepoint_calc(K_MSEC(timeout_ms));
+	uint8_t rtoken[COAP_TOKEN_MAX_LEN];
+
+	while (!sys_timepoint_expired(end)) {
+		struct zsock_pollfd fds = {
+			.fd = sock,
+			.events = ZSOCK_POLLIN,
+		};
+		ssize_t len;
+		uint8_t type;
+		int ret;
+
+		ret = zsock_poll(&fds, 1,
+				 k_ticks_to_ms_ceil32(sys_timepoint_timeout(end).ticks));
+		if (ret < 0) {
+			return -errno;
+		} else if (ret == 0) {
+			break;
+		}
+
+		len = zsock_recv(sock, rx_buf, sizeof(rx_buf), ZSOCK_MSG_DONTWAIT);
+		if (len < 0) {
+			if (errno == EAGAIN) {
+				continue;
+			}
+			return -errno;
+		}
+		uplink_account_rx(len);
+		uplink_account_packets(0, 1);
+
+		if (coap_packet_parse(rsp, rx_buf, len, NULL, 0) < 0) {
+			continue;
+		}
+
+		type = coap_header_get_type(rsp);
+		if (type == COAP_TYPE_ACK || type == COAP_TYPE_RESET) {
+			if (coap_header_get_id(rsp) != id) {
+				/* Duplicate ACK of an earlier retransmission */
+				continue;
+			}
+			if (type == COAP_TYPE_RESET) {
+				return -ECONNRESET;
+			}
+			*acked = true;
+			if (coap_header_get_code(rsp) == COAP_CODE_EMPTY) {
+				/* Separate response follows */
+				continue;
+			}
+			return 1;
+		}
+
+		/* Separate response, matched by token */
+		if (coap_header_get_token(rsp, rtoken) != tkl ||
+		    memcmp(rtoken, token, tkl) != 0) {
+			continue;
+		}
+		if (type == COAP_TYPE_CON) {
+			coap_send_empty_ack(rsp);
+		}
+		*acked = true;
+		return 1;
+	}
+
+	return 0;
+}
+
+/* Send confirmable @p req and wait for its response, retransmitting */
+static int coap_exchange(struct coap_packet *req, struct coap_packet *rsp)
+{
+	struct coap_pending pending = { 0 };
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	uint8_t tkl = coap_header_get_token(req, token);
+	uint16_t id = coap_header_get_id(req);
+	bool acked = false;
+	bool first = true;
+	int ret;
+
+	ret = coap_pending_init(&pending, req, (struct sockaddr *)&peer, NULL);
+	if (ret < 0) {
+		return ret;
+	}
+
+	while (coap_pending_cycle(&pending)) {
+		if (!acked) {
+			if (!first) {
+				uplink_account_retransmit();
+			}
+			ret = coap_send_pdu(req->data, req->offset);
+			if (ret < 0) {
+				return ret;
+			}
+			first = false;
+		}
+
+		ret = coap_recv_response(rsp, id, token, tkl, pending.timeout,
+					 &acked);
+		if (ret != 0) {
+			return ret < 0 ? ret : 0;
+		}
+	}
+
+	return -ETIMEDOUT;
+}
+
+static int coap_build_request(struct coap_packet *req,
+			      const struct uplink_msg *msg, const char *path,
+			      const uint8_t *token,
+			      struct coap_block_context *blk,
+			      const uint8_t *data, size_t len)
+{
+	const char *seg = path;
+	int ret;
+
+	ret = coap_packet_init(req, tx_buf, sizeof(tx_buf), COAP_VERSION_1,
+			       COAP_TYPE_CON, COAP_TOKEN_MAX_LEN, token,
+			       COAP_METHOD_POST, coap_next_id());
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* One Uri-Path option per '/' separated segment */
+	while (*seg != '\0') {
+		const char *end = strchr(seg, '/');
+		size_t seg_len = end ? (size_t)(end - seg) : strlen(seg);
+
+		if (seg_len > 0) {
+			ret = coap_packet_append_option(req, COAP_OPTION_URI_PATH,
+							seg, seg_len);
+			if (ret < 0) {
+				return ret;
+			}
+		}
+		seg += seg_len + (end ? 1 : 0);
+	}
+
+	ret = coap_append_option_int(req, COAP_OPTION_CONTENT_FORMAT,
+				     content_format(msg->content_type));
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = coap_packet_append_option(req, COAP_OPTION_URI_QUERY, query,
+					strlen(query));
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (blk != NULL) {
+		ret = coap_append_block1_option(req, blk);
+		if (ret == 0 && blk->current == 0) {
+			/* Announce the total so the peer can refuse early */
+			ret = coap_append_size1_option(req, blk);
+		}
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	ret = coap_packet_append_payload_marker(req);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return coap_packet_append_payload(req, data, len);
+}
+
+static int uplink_coap_open(void)
+{
+	struct uplink_peer target;
+	int ret;
+
+	if (sock >= 0) {
+		return 0;
+	}
+
+	ret = uplink_resolve(SOCK_DGRAM, &peer, &peer_len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	sock = zsock_socket(peer.ss_family, SOCK_DGRAM, IPPROTO_UDP);
+	if (sock < 0) {
+		return -errno;
+	}
+
+	/* Only accept datagrams from the peer */
+	if (zsock_connect(sock, (struct sockaddr *)&peer, peer_len) < 0) {
+		ret = -errno;
+		zsock_close(sock);
+		sock = -1;
+		return ret;
+	}
+
+	uplink_account_connect(0);
+	uplink_peer_get(&target);
+	LOG_INF("CoAP peer %s:%u", target.host, target.port);
+
+	return 0;
+}
+
+static int uplink_coap_connect(void)
+{
+	int ret;
+
+	k_mutex_lock(&coap_lock, K_FOREVER);
+	ret = uplink_coap_open();
+	k_mutex_unlock(&coap_lock);
+
+	return ret;
+}
+
+static int uplink_coap_send(const struct uplink_msg *msg)
+{
+	struct coap_block_context blk;
+	struct coap_packet req;
+	struct coap_packet rsp;
+	struct uplink_peer target;
+	const char *path;
+	uint8_t token[COAP_TOKEN_MAX_LEN];
+	bool blockwise = msg->len > BLOCK_BYTES;
+	int64_t start = k_uptime_get();
+	size_t offset = 0;
+	uint8_t code = 0;
+	int len;
+	int ret;
+
+	uplink_peer_get(&target);
+	path = msg->path ? msg->path : target.path;
+
+	/* Like the PDU buffers, the query is shared and filled under the lock */
+	k_mutex_lock(&coap_lock, K_FOREVER);
+
+	len = snprintk(query, sizeof(query), "label=%s", msg->label);
+	if (len < 0 || len >= (int)sizeof(query)) {
+		ret = -ENAMETOOLONG;
+		goto out;
+	}
+
+	ret = uplink_coap_open();
+	if (ret < 0) {
+		goto out;
+	}
+
+	memcpy(token, coap_next_token(), sizeof(token));
+	if (blockwise) {
+		coap_block_transfer_init(&blk, block_szx(BLOCK_BYTES), msg->len);
+	}
+
+	while (true) {
+		size_t chunk = msg->len;
+
+		if (blockwise) {
+			chunk = MIN(coap_block_size_to_bytes(blk.block_size),
+				    msg->len - offset);
+			blk.current = offset;
+		}
+
+		ret = coap_build_request(&req, msg, path, token,
+					 blockwise ? &blk : NULL,
+					 msg->payload + offset, chunk);
+		if (ret < 0) {
+			LOG_ERR("Cannot build request (%d)", ret);
+			goto out;
+		}
+
+		if (offset == 0) {
+			uplink_account_tx(msg->len, 0);
+		}
+
+		ret = coap_exchange(&req, &rsp);
+		if (ret < 0) {
+			goto out;
+		}
+
+		code = coap_header_get_code(&rsp);
+		offset += chunk;
+
+		if (!blockwise || code != COAP_RESPONSE_CODE_CONTINUE ||
+		    offset >= msg->len) {
+			break;
+		}
+
+		/* The peer may ask for smaller blocks (RFC 7959, 2.3) */
+		ret = coap_get_option_int(&rsp, COAP_OPTION_BLOCK1);
+		if (ret >= 0 && (ret & 0x7) < blk.block_size) {
+			blk.block_size = ret & 0x7;
+		}
+	}
+
+	/* Any 2.xx response */
+	if ((code >> 5) == 2) {
+		uplink_account_ack((uint32_t)(k_uptime_get() - start));
+		ret = 0;
+	} else {
+		LOG_WRN("CoAP response %u.%02u for '%s'", code >> 5, code & 0x1f,
+			msg->label);
+		ret = -EBADMSG;
+	}
+
+out:
+	k_mutex_unlock(&coap_lock);
+	return ret;
+}
+
+static int uplink_coap_flush(k_timeout_t timeout)
+{
+	/* Every request is confirmed before uplink_send() returns */
+	return 0;
+}
+
+static void uplink_coap_disconnect(void)
+{
+	k_mutex_lock(&coap_lock, K_FOREVER);
+	if (sock >= 0) {
+		zsock_close(sock);
+		sock = -1;
+	}
+	k_mutex_unlock(&coap_lock);
+}
+
+const struct uplink_backend_api uplink_backend = {
+	.name = "coap",
+	.connect = uplink_coap_connect,
+	.send = uplink_coap_send,
+	.flush = uplink_coap_flush,
+	.disconnect = uplink_coap_disconnect,
+};
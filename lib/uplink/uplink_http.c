@@ -0,0 +1,299 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/net/tls_credentials.h>
+#include <zephyr/sys/util.h>
+
+#include "uplink_internal.h"
+
+LOG_MODULE_DECLARE(uplink, CONFIG_UPLINK_LOG_LEVEL);
+
+static struct sockaddr_storage peer;
+static socklen_t peer_len;
+static bool resolved;
+
+/* Resolve state and request buffer, shared with uplink_peer_set() callers */
+static K_MUTEX_DEFINE(http_lock);
+
+#if defined(CONFIG_UPLINK_HTTP_TLS)
+#define HTTP_PROTO IPPROTO_TLS_1_2
+#else
+#define HTTP_PROTO IPPROTO_TCP
+#endif
+
+/* Request line and headers, kept static to avoid large stack frames */
+static char req_hdr[CONFIG_UPLINK_HTTP_HEADER_BUF_SIZE];
+
+static int send_all(int sock, const void *buf, size_t len)
+{
+	const uint8_t *p = buf;
+
+	while (len > 0) {
+		ssize_t n = zsock_send(sock, p, len, 0);
+
+		if (n < 0) {
+			return -errno;
+		}
+		uplink_account_packets(1, 0);
+		p += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+/* Read the response, returning the HTTP status code */
+static int recv_status(int sock)
+{
+	char resp[128];
+	int status = -EIO;
+	bool first = true;
+	ssize_t r;
+
+	while ((r = zsock_recv(sock, resp, sizeof(resp) - 1, 0)) > 0) {
+		uplink_account_rx(r);
+		uplink_account_packets(0, 1);
+
+		if (first) {
+			resp[r] = '\0';
+			/* "HTTP/1.1 200 OK" */
+			if (strncmp(resp, "HTTP/1.", 7) == 0 && r > 12) {
+				status = strtol(resp + 9, NULL, 10);
+			}
+			first = false;
+		}
+	}
+
+	return status;
+}
+
+#if defined(CONFIG_UPLINK_TLS_PSK)
+BUILD_ASSERT(sizeof(CONFIG_UPLINK_TLS_PSK_KEY) > 1, "UPLINK_TLS_PSK_KEY not set");
+
+static uint8_t psk[(sizeof(CONFIG_UPLINK_TLS_PSK_KEY) - 1) / 2];
+
+static int tls_register_psk(void)
+{
+	int ret;
+
+	if (hex2bin(CONFIG_UPLINK_TLS_PSK_KEY, strlen(CONFIG_UPLINK_TLS_PSK_KEY),
+		    psk, sizeof(psk)) != sizeof(psk)) {
+		LOG_ERR("UPLINK_TLS_PSK_KEY is not valid hex");
+		return -EINVAL;
+	}
+
+	ret = tls_credential_add(CONFIG_UPLINK_TLS_SEC_TAG, TLS_CREDENTIAL_PSK,
+				 psk, sizeof(psk));
+	if (ret < 0 && ret != -EEXIST) {
+		return ret;
+	}
+
+	ret = tls_credential_add(CONFIG_UPLINK_TLS_SEC_TAG, TLS_CREDENTIAL_PSK_ID,
+				 CONFIG_UPLINK_TLS_PSK_IDENTITY,
+				 strlen(CONFIG_UPLINK_TLS_PSK_IDENTITY));
+	if (ret < 0 && ret != -EEXIST) {
+		return ret;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_UPLINK_TLS_PSK */
+
+#if defined(CONFIG_UPLINK_HTTP_TLS)
+static int tls_setup(int sock, const char *host)
+{
+	static const sec_tag_t sec_tags[] = { CONFIG_UPLINK_TLS_SEC_TAG };
+	int verify = IS_ENABLED(CONFIG_UPLINK_TLS_VERIFY_PEER) ?
+		     TLS_PEER_VERIFY_REQUIRED : TLS_PEER_VERIFY_NONE;
+
+	if (sizeof(CONFIG_UPLINK_TLS_HOSTNAME) > 1) {
+		host = CONFIG_UPLINK_TLS_HOSTNAME;
+	}
+
+	if (zsock_setsockopt(sock, SOL_TLS, TLS_SEC_TAG_LIST, sec_tags,
+			     sizeof(sec_tags)) < 0 ||
+	    zsock_setsockopt(sock, SOL_TLS, TLS_HOSTNAME, host,
+			     strlen(host)) < 0 ||
+	    zsock_setsockopt(sock, SOL_TLS, TLS_PEER_VERIFY, &verify,
+			     sizeof(verify)) < 0) {
+		return -errno;
+	}
+
+#if defined(CONFIG_UPLINK_TLS_SESSION_CACHE)
+	/*
+	 * The session is saved when the socket closes and offered again on
+	 * the next connection to the same peer, so only the first upload
+	 * pays for a full handshake.
+	 */
+	int cache = TLS_SESSION_CACHE_ENABLED;
+
+	if (zsock_setsockopt(sock, SOL_TLS, TLS_SESSION_CACHE, &cache,
+			     sizeof(cache)) < 0) {
+		return -errno;
+	}
+#endif
+
+	return 0;
+}
+#endif /* CONFIG_UPLINK_HTTP_TLS */
+
+/* Called with http_lock held */
+static int uplink_http_open(void)
+{
+	int ret;
+
+	if (resolved) {
+		return 0;
+	}
+
+#if defined(CONFIG_UPLINK_TLS_PSK)
+	ret = tls_register_psk();
+	if (ret < 0) {
+		return ret;
+	}
+#endif
+
+	ret = uplink_resolve(SOCK_STREAM, &peer, &peer_len);
+	if (ret == 0) {
+		resolved = true;
+	}
+
+	return ret;
+}
+
+static int uplink_http_connect(void)
+{
+	int ret;
+
+	k_mutex_lock(&http_lock, K_FOREVER);
+	ret = uplink_http_open();
+	k_mutex_unlock(&http_lock);
+
+	return ret;
+}
+
+static int uplink_http_send(const struct uplink_msg *msg)
+{
+	struct zsock_timeval tv = {
+		.tv_sec = CONFIG_UPLINK_TIMEOUT_MS / 1000,
+		.tv_usec = (CONFIG_UPLINK_TIMEOUT_MS % 1000) * 1000,
+	};
+	int64_t start = k_uptime_get();
+	struct uplink_peer target;
+	int64_t setup_start;
+	int hdr_len;
+	int sock = -1;
+	int ret;
+
+	k_mutex_lock(&http_lock, K_FOREVER);
+
+	ret = uplink_http_open();
+	if (ret < 0) {
+		goto out;
+	}
+
+	uplink_peer_get(&target);
+	hdr_len = snprintk(req_hdr, sizeof(req_hdr),
+			   "POST %s HTTP/1.1\r\n"
+			   "Host: %s\r\n"
+			   "Connection: close\r\n"
+			   "%s"
+			   "Content-Type: %s\r\n"
+			   "Content-Length: %zu\r\n"
+			   "\r\n",
+			   msg->path ? msg->path : target.path, target.host,
+			   msg->headers ? msg->headers : "",
+			   msg->content_type ? msg->content_type :
+					       "application/octet-stream",
+			   msg->len);
+	if (hdr_len < 0 || hdr_len >= (int)sizeof(req_hdr)) {
+		ret = -ENOMEM;
+		goto out;
+	}
+
+	sock = zsock_socket(peer.ss_family, SOCK_STREAM, HTTP_PROTO);
+	if (sock < 0) {
+		ret = -errno;
+		goto out;
+	}
+
+	(void)zsock_setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+#if defined(CONFIG_UPLINK_HTTP_TLS)
+	ret = tls_setup(sock, target.host);
+	if (ret < 0) {
+		LOG_ERR("TLS setup failed (%d)", ret);
+		goto out;
+	}
+#endif
+
+	/* With TLS this includes the handshake */
+	setup_start = k_uptime_get();
+	if (zsock_connect(sock, (struct sockaddr *)&peer, peer_len) < 0) {
+		ret = -errno;
+		/* The address may have changed, resolve again next time */
+		resolved = false;
+		goto out;
+	}
+	uplink_account_connect((uint32_t)(k_uptime_get() - setup_start));
+	uplink_account_packets(UPLINK_TCP_OPEN_PKTS_TX, UPLINK_TCP_OPEN_PKTS_RX);
+
+	ret = send_all(sock, req_hdr, hdr_len);
+	if (ret == 0) {
+		ret = send_all(sock, msg->payload, msg->len);
+	}
+	if (ret < 0) {
+		goto out;
+	}
+
+	uplink_account_tx(msg->len, hdr_len + msg->len);
+
+	ret = recv_status(sock);
+	if (ret >= 200 && ret < 300) {
+		uplink_account_ack((uint32_t)(k_uptime_get() - start));
+		ret = 0;
+	} else {
+		LOG_WRN("HTTP status %d for '%s'", ret, msg->label);
+		ret = (ret < 0) ? ret : -EBADMSG;
+	}
+
+	uplink_account_packets(UPLINK_TCP_CLOSE_PKTS_TX, UPLINK_TCP_CLOSE_PKTS_RX);
+
+out:
+	if (sock >= 0) {
+		zsock_close(sock);
+	}
+	k_mutex_unlock(&http_lock);
+	return ret;
+}
+
+static int uplink_http_flush(k_timeout_t timeout)
+{
+	/* Every POST is confirmed before uplink_send() returns */
+	return 0;
+}
+
+static void uplink_http_disconnect(void)
+{
+	k_mutex_lock(&http_lock, K_FOREVER);
+	resolved = false;
+	k_mutex_unlock(&http_lock);
+}
+
+const struct uplink_backend_api uplink_backend = {
+	.name = "http",
+	.connect = uplink_http_connect,
+	.send = uplink_http_send,
+	.flush = uplink_http_flush,
+	.disconnect = uplink_http_disconnect,
+};
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef APP_LIB_UPLINK_INTERNAL_H_
+#define APP_LIB_UPLINK_INTERNAL_H_
+
+#include <zephyr/net/socket.h>
+
+#include <app/lib/uplink.h>
+
+/* Operations every transport backend provides */
+struct uplink_backend_api {
+	const char *name;
+	int (*connect)(void);
+	int (*send)(const struct uplink_msg *msg);
+	int (*flush)(k_timeout_t timeout);
+	void (*disconnect)(void);
+};
+
+/* Defined by the backend selected in Kconfig */
+extern const struct uplink_backend_api uplink_backend;
+
+/* Statistics accounting, safe to call from any thread */
+void uplink_account_connect(uint32_t setup_ms);
+void uplink_account_tx(size_t payload, size_t wire);
+void uplink_account_rx(size_t wire);
+void uplink_account_wire(size_t tx, size_t rx);
+void uplink_account_packets(uint32_t tx, uint32_t rx);
+void uplink_account_retransmit(void);
+void uplink_account_ack(uint32_t latency_ms);
+void uplink_account_fail(void);
+
+/*
+ * TCP segments the stream backends cannot see, as an estimate: SYN and the
+ * final ACK out, SYN-ACK in; then a FIN and ACK each way on close.
+ */
+#define UPLINK_TCP_OPEN_PKTS_TX 2
+#define UPLINK_TCP_OPEN_PKTS_RX 1
+#define UPLINK_TCP_CLOSE_PKTS_TX 2
+#define UPLINK_TCP_CLOSE_PKTS_RX 2
+
+/* Resolve the host and port of the current peer into @p addr */
+int uplink_resolve(int socktype, struct sockaddr_storage *addr,
+		   socklen_t *addrlen);
+
+#endif /* APP_LIB_UPLINK_INTERNAL_H_ */
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * MQTT uplink backend. One session is kept open for the lifetime of the
+ * application; a receive thread services the socket (PUBACKs, keep-alive),
+ * so publishers never wait for a round trip unless the in-flight window is
+ * full.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/mqtt.h>
+#include <zephyr/net/socket.h>
+
+#include "uplink_internal.h"
+
+LOG_MODULE_DECLARE(uplink, CONFIG_UPLINK_LOG_LEVEL);
+
+#define MAX_INFLIGHT CONFIG_UPLINK_MQTT_MAX_INFLIGHT
+
+static struct mqtt_client client;
+static struct sockaddr_storage broker;
+static uint8_t rx_buffer[CONFIG_UPLINK_MQTT_BUF_SIZE];
+static uint8_t tx_buffer[CONFIG_UPLINK_MQTT_BUF_SIZE];
+static char topic[UPLINK_PATH_MAX_LEN + 64];
+
+static K_MUTEX_DEFINE(session_lock);
+static K_SEM_DEFINE(connack_sem, 0, 1);
+static K_SEM_DEFINE(rx_start, 0, 1);
+static K_SEM_DEFINE(inflight_sem, MAX_INFLIGHT, MAX_INFLIGHT);
+
+static atomic_t connected;
+static atomic_t rx_active;
+static atomic_t inflight;
+/* Publishes the session took down with it since the last flush */
+static atomic_t lost;
+static int connack_result;
+static uint16_t next_msg_id;
+
+/* Send time of each in-flight message, indexed by message id */
+static int64_t sent_at[MAX_INFLIGHT];
+
+/* Size of the MQTT "remaining length" field for @p len */
+static size_t mqtt_varint_len(size_t len)
+{
+	size_t n = 1;
+
+	while (len >= 128) {
+		len /= 128;
+		n++;
+	}
+
+	return n;
+}
+
+static size_t mqtt_publish_wire_len(size_t topic_len, size_t payload_len)
+{
+	size_t remaining = 2 + topic_len + payload_len +
+			   (CONFIG_UPLINK_MQTT_QOS > 0 ? 2 : 0);
+
+	return 1 + mqtt_varint_len(remaining) + remaining;
+}
+
+static void release_inflight(void)
+{
+	/* The session is gone, nothing in flight will be acknowledged */
+	while (atomic_get(&inflight) > 0) {
+		atomic_dec(&inflight);
+		atomic_inc(&lost);
+		uplink_account_fail();
+		k_sem_give(&inflight_sem);
+	}
+}
+
+static void mqtt_evt_handler(struct mqtt_client *c, const struct mqtt_evt *evt)
+{
+	switch (evt->type) {
+	case MQTT_EVT_CONNACK:
+		uplink_account_rx(4);
+		uplink_account_packets(0, 1);
+		connack_result = evt->result;
+		if (evt->result == 0) {
+			atomic_set(&connected, 1);
+		}
+		k_sem_give(&connack_sem);
+		break;
+
+	case MQTT_EVT_DISCONNECT:
+		LOG_INF("MQTT session closed (%d)", evt->result);
+		atomic_set(&connected, 0);
+		atomic_set(&rx_active, 0);
+		release_inflight();
+		break;
+
+	case MQTT_EVT_PUBACK:
+		uplink_account_rx(4);
+		uplink_account_packets(0, 1);
+		if (evt->result == 0) {
+			uint16_t id = evt->param.puback.message_id;
+
+			uplink_account_ack((uint32_t)(k_uptime_get() -
+						      sent_at[id % MAX_INFLIGHT]));
+		} else {
+			uplink_account_fail();
+		}
+		if (atomic_get(&inflight) > 0) {
+			atomic_dec(&inflight);
+			k_sem_give(&inflight_sem);
+		}
+		break;
+
+	case MQTT_EVT_PINGRESP:
+		uplink_account_rx(2);
+		uplink_account_packets(0, 1);
+		break;
+
+	default:
+		break;
+	}
+}
+
+static void uplink_mqtt_rx(void *p1, void *p2, void *p3)
+{
+	struct zsock_pollfd fds;
+	int ret;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (1) {
+		if (!atomic_get(&rx_active)) {
+			k_sem_take(&rx_start, K_FOREVER);
+			continue;
+		}
+
+		fds.fd = client.transport.tcp.sock;
+		fds.events = ZSOCK_POLLIN;
+		fds.revents = 0;
+
+		ret = zsock_poll(&fds, 1, mqtt_keepalive_time_left(&client));
+		if (ret < 0 || (fds.revents & (ZSOCK_POLLERR | ZSOCK_POLLHUP |
+					       ZSOCK_POLLNVAL))) {
+			mqtt_abort(&client);
+			continue;
+		}
+
+		if (fds.revents & ZSOCK_POLLIN) {
+			ret = mqtt_input(&client);
+			if (ret < 0) {
+				LOG_WRN("mqtt_input failed (%d)", ret);
+				mqtt_abort(&client);
+				continue;
+			}
+		}
+
+		/* Returns 0 only when a PINGREQ went out */
+		if (mqtt_live(&client) == 0) {
+			uplink_account_wire(2, 0);
+			uplink_account_packets(1, 0);
+		}
+	}
+}
+
+K_THREAD_DEFINE(uplink_mqtt_rx_tid, CONFIG_UPLINK_MQTT_RX_STACK_SIZE,
+		uplink_mqtt_rx, NULL, NULL, NULL,
+		CONFIG_UPLINK_MQTT_RX_PRIORITY, 0, 0);
+
+static int uplink_mqtt_open(void)
+{
+	struct uplink_peer target;
+	socklen_t broker_len;
+	int64_t start;
+	int ret;
+
+	ret = uplink_resolve(SOCK_STREAM, &broker, &broker_len);
+	if (ret < 0) {
+		return ret;
+	}
+
+	mqtt_client_init(&client);
+
+	client.broker = &broker;
+	client.evt_cb = mqtt_evt_handler;
+	client.client_id.utf8 = (const uint8_t *)CONFIG_UPLINK_MQTT_CLIENT_ID;
+	client.client_id.size = strlen(CONFIG_UPLINK_MQTT_CLIENT_ID);
+	client.protocol_version = MQTT_VERSION_3_1_1;
+	client.clean_session = 1U;
+	client.rx_buf = rx_buffer;
+	client.rx_buf_size = sizeof(rx_buffer);
+	client.tx_buf = tx_buffer;
+	client.tx_buf_size = sizeof(tx_buffer);
+	client.transport.type = MQTT_TRANSPORT_NON_SECURE;
+
+	k_sem_reset(&connack_sem);
+
+	start = k_uptime_get();
+	ret = mqtt_connect(&client);
+	if (ret < 0) {
+		LOG_ERR("mqtt_connect failed (%d)", ret);
+		return ret;
+	}
+
+	/* CONNECT: fixed header, 10 bytes variable header, client id */
+	uplink_account_wire(2 + 10 + 2 + client.client_id.size, 0);
+	uplink_account_packets(UPLINK_TCP_OPEN_PKTS_TX + 1,
+			       UPLINK_TCP_OPEN_PKTS_RX);
+
+	atomic_set(&rx_active, 1);
+	k_sem_give(&rx_start);
+
+	if (k_sem_take(&connack_sem, K_MSEC(CONFIG_UPLINK_TIMEOUT_MS)) != 0) {
+		LOG_ERR("No CONNACK from broker");
+		mqtt_abort(&client);
+		return -ETIMEDOUT;
+	}
+
+	if (connack_result != 0) {
+		LOG_ERR("Broker refused connection (%d)", connack_result);
+		return -ECONNREFUSED;
+	}
+
+	uplink_account_connect((uint32_t)(k_uptime_get() - start));
+
+	uplink_peer_get(&target);
+	LOG_INF("MQTT session to %s:%u open", target.host, target.port);
+
+	return 0;
+}
+
+static int uplink_mqtt_connect(void)
+{
+	int ret = 0;
+
+	k_mutex_lock(&session_lock, K_FOREVER);
+	if (!atomic_get(&connected)) {
+		ret = uplink_mqtt_open();
+	}
+	k_mutex_unlock(&session_lock);
+
+	return ret;
+}
+
+static int uplink_mqtt_send(const struct uplink_msg *msg)
+{
+	struct mqtt_publish_param param = { 0 };
+	struct uplink_peer target;
+	int len;
+	int ret;
+
+	ret = uplink_mqtt_connect();
+	if (ret < 0) {
+		return ret;
+	}
+
+	if (CONFIG_UPLINK_MQTT_QOS > 0) {
+		/* Window of unacknowledged publishes is full */
+		if (k_sem_take(&inflight_sem,
+			       K_MSEC(CONFIG_UPLINK_TIMEOUT_MS)) != 0) {
+			return -EAGAIN;
+		}
+		atomic_inc(&inflight);
+	}
+
+	k_mutex_lock(&session_lock, K_FOREVER);
+
+	/* The topic buffer is shared, filled and published under the lock */
+	uplink_peer_get(&target);
+	len = snprintk(topic, sizeof(topic), "%s/%s",
+		       msg->path ? msg->path : target.path, msg->label);
+	if (len < 0 || len >= (int)sizeof(topic)) {
+		ret = -ENAMETOOLONG;
+		goto unlock;
+	}
+
+	if (++next_msg_id == 0) {
+		next_msg_id = 1;
+	}
+
+	param.message.topic.topic.utf8 = (const uint8_t *)topic;
+	param.message.topic.topic.size = len;
+	param.message.topic.qos = CONFIG_UPLINK_MQTT_QOS;
+	param.message.payload.data = (uint8_t *)msg->payload;
+	param.message.payload.len = msg->len;
+	param.message_id = next_msg_id;
+
+	sent_at[next_msg_id % MAX_INFLIGHT] = k_uptime_get();
+
+	ret = mqtt_publish(&client, &param);
+
+unlock:
+	k_mutex_unlock(&session_lock);
+
+	if (ret < 0) {
+		if (CONFIG_UPLINK_MQTT_QOS > 0 && atomic_get(&inflight) > 0) {
+			atomic_dec(&inflight);
+			k_sem_give(&inflight_sem);
+		}
+		return ret;
+	}
+
+	uplink_account_tx(msg->len, mqtt_publish_wire_len(len, msg->len));
+	uplink_account_packets(1, 0);
+
+	return 0;
+}
+
+static int uplink_mqtt_flush(k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+
+	while (atomic_get(&inflight) > 0) {
+		if (sys_timepoint_expired(end)) {
+			return -EAGAIN;
+		}
+		k_msleep(10);
+	}
+
+	/* Released by a disconnect rather than acknowledged */
+	if (atomic_set(&lost, 0) > 0) {
+		return -ECONNRESET;
+	}
+
+	return 0;
+}
+
+static void uplink_mqtt_disconnect(void)
+{
+	k_mutex_lock(&session_lock, K_FOREVER);
+	if (atomic_get(&connected)) {
+		(void)mqtt_disconnect(&client);
+		uplink_account_wire(2, 0);
+		uplink_account_packets(UPLINK_TCP_CLOSE_PKTS_TX + 1,
+				       UPLINK_TCP_CLOSE_PKTS_RX);
+	}
+	k_mutex_unlock(&session_lock);
+}
+
+const struct uplink_backend_api uplink_backend = {
+	.name = "mqtt",
+	.connect = uplink_mqtt_connect,
+	.send = uplink_mqtt_send,
+	.flush = uplink_mqtt_flush,
+	.disconnect = uplink_mqtt_disconnect,
+};
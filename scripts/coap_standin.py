@@ -0,0 +1,246 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''coap_standin.py
+
+Minimal CoAP (RFC 7252) server used as a stand-in for a telemetry gateway,
+so the uplink library's CoAP backend can be exercised on the LAN or against
+native_sim without extra Python packages.
+
+Any POST or PUT is accepted and answered with a piggybacked 2.04 Changed.
+Block-wise requests (RFC 7959, Block1) are reassembled, with 2.31 Continue
+for every block but the last. Retransmitted requests get the cached reply,
+so each message is counted once. --drop-every N silently drops every Nth
+datagram to exercise retransmission; --max-block asks the client for
+smaller blocks.
+
+Example:
+
+  python scripts/coap_standin.py --port 5683
+  # then build with CONFIG_UPLINK_BACKEND_COAP=y
+  #   CONFIG_UPLINK_HOST="<host ip>"
+'''
+
+import argparse
+import asyncio
+import struct
+
+CON, NON, ACK, RST = range(4)
+
+POST = 0x02
+PUT = 0x03
+CHANGED = 0x44          # 2.04
+CONTINUE = 0x5f         # 2.31
+INCOMPLETE = 0x88       # 4.08
+NOT_ALLOWED = 0x85      # 4.05
+
+OPT_URI_PATH = 11
+OPT_URI_QUERY = 15
+OPT_BLOCK1 = 27
+
+CACHE_SIZE = 64
+
+
+def parse(data):
+    '''Return (type, code, mid, token, options, payload) or None.'''
+    if len(data) < 4 or data[0] >> 6 != 1:
+        return None
+    mtype = (data[0] >> 4) & 3
+    tkl = data[0] & 0x0f
+    code = data[1]
+    mid = struct.unpack_from('!H', data, 2)[0]
+    token = data[4:4 + tkl]
+    pos = 4 + tkl
+    options = []
+    number = 0
+    while pos < len(data) and data[pos] != 0xff:
+        delta = data[pos] >> 4
+        length = data[pos] & 0x0f
+        pos += 1
+        values = []
+        for nibble in (delta, length):
+            if nibble == 13:
+                values.append(data[pos] + 13)
+                pos += 1
+            elif nibble == 14:
+                values.append(struct.unpack_from('!H', data, pos)[0] + 269)
+                pos += 2
+            elif nibble == 15:
+                return None
+            else:
+                values.append(nibble)
+        number += values[0]
+        options.append((number, data[pos:pos + values[1]]))
+        pos += values[1]
+    payload = data[pos + 1:] if pos < len(data) else b''
+    return mtype, code, mid, token, options, payload
+
+
+def uint_bytes(value):
+    out = b''
+    while value:
+        out = bytes([value & 0xff]) + out
+        value >>= 8
+    return out
+
+
+def encode_option(delta, value):
+    def nibble(n):
+        if n < 13:
+            return n, b''
+        if n < 269:
+            return 13, bytes([n - 13])
+        return 14, struct.pack('!H', n - 269)
+
+    d, dext = nibble(delta)
+    l, lext = nibble(len(value))
+    return bytes([(d << 4) | l]) + dext + lext + value
+
+
+def build(mtype, code, mid, token, options=(), payload=b''):
+    out = bytearray([0x40 | (mtype << 4) | len(token), code])
+    out += struct.pack('!H', mid) + token
+    last = 0
+    for number, value in sorted(options):
+        out += encode_option(number - last, value)
+        last = number
+    if payload:
+        out += b'\xff' + payload
+    return bytes(out)
+
+
+class Standin(asyncio.DatagramProtocol):
+    def __init__(self, args):
+        self.args = args
+        self.transport = None
+        self.datagrams = 0
+        self.rx_bytes = 0
+        self.tx_bytes = 0
+        self.dropped = 0
+        self.messages = 0
+        self.payload_bytes = 0
+        # (peer, mid) -> reply, for deduplicating retransmissions
+        self.replies = {}
+        # (peer, path, query) -> reassembled Block1 payload
+        self.partial = {}
+        self.completed = None
+
+    def connection_made(self, transport):
+        self.transport = transport
+
+    def send(self, data, peer):
+        self.tx_bytes += len(data)
+        self.transport.sendto(data, peer)
+
+    def datagram_received(self, data, peer):
+        self.datagrams += 1
+        if self.args.drop_every and self.datagrams % self.args.drop_every == 0:
+            self.dropped += 1
+            return
+        self.rx_bytes += len(data)
+
+        msg = parse(data)
+        if msg is None:
+            return
+        mtype, code, mid, token, options, payload = msg
+
+        if mtype == CON and (peer, mid) in self.replies:
+            self.send(self.replies[(peer, mid)], peer)
+            return
+        if mtype in (ACK, RST):
+            return
+
+        reply_type = ACK if mtype == CON else NON
+        reply_options = []
+        if code not in (POST, PUT):
+            reply_code = NOT_ALLOWED
+        else:
+            reply_code, reply_options = self.on_request(peer, options, payload)
+
+        reply = build(reply_type, reply_code, mid, token, reply_options)
+        if mtype == CON:
+            self.replies[(peer, mid)] = reply
+            if len(self.replies) > CACHE_SIZE:
+                self.replies.pop(next(iter(self.replies)))
+        self.send(reply, peer)
+        if self.completed:
+            print(self.completed + f'; total {self.messages} msgs, '
+                  f'{self.datagrams} datagrams ({self.dropped} dropped), '
+                  f'wire rx {self.rx_bytes} tx {self.tx_bytes}', flush=True)
+            self.completed = None
+
+    def on_request(self, peer, options, payload):
+        path = '/'.join(v.decode(errors='replace')
+                        for n, v in options if n == OPT_URI_PATH)
+        query = '&'.join(v.decode(errors='replace')
+                         for n, v in options if n == OPT_URI_QUERY)
+        block1 = [int.from_bytes(v, 'big') for n, v in options
+                  if n == OPT_BLOCK1]
+        key = (peer, path, query)
+
+        if not block1:
+            self.complete(peer, path, query, payload, 1)
+            return CHANGED, []
+
+        value = block1[0]
+        num, more, szx = value >> 4, (value >> 3) & 1, value & 7
+        size = 16 << szx
+        if num == 0:
+            self.partial[key] = [bytearray(), 0]
+        elif key not in self.partial or \
+                len(self.partial[key][0]) != num * size:
+            return INCOMPLETE, []
+
+        buf = self.partial[key]
+        buf[0] += payload
+        buf[1] += 1
+
+        # Echo the block, possibly asking for smaller ones from now on
+        reply_szx = szx
+        if self.args.max_block and size > self.args.max_block:
+            reply_szx = max(self.args.max_block.bit_length() - 5, 0)
+        echo = (num << 4) | (more << 3) | reply_szx
+
+        if more:
+            return CONTINUE, [(OPT_BLOCK1, uint_bytes(echo))]
+
+        del self.partial[key]
+        self.complete(peer, path, query, bytes(buf[0]), buf[1])
+        return CHANGED, [(OPT_BLOCK1, uint_bytes(echo))]
+
+    def complete(self, peer, path, query, payload, blocks):
+        self.messages += 1
+        self.payload_bytes += len(payload)
+        self.completed = (f'{peer[0]}:{peer[1]} /{path}?{query}: '
+                          f'{len(payload)} bytes in {blocks} block(s)')
+
+
+async def serve(args):
+    loop = asyncio.get_running_loop()
+    await loop.create_datagram_endpoint(lambda: Standin(args),
+                                        local_addr=(args.bind, args.port))
+    print(f'coap-standin listening on {args.bind}:{args.port}', flush=True)
+    await asyncio.Event().wait()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--bind', default='0.0.0.0',
+                        help='address to listen on (default: %(default)s)')
+    parser.add_argument('--port', type=int, default=5683,
+                        help='port to listen on (default: %(default)s)')
+    parser.add_argument('--drop-every', type=int, default=0, metavar='N',
+                        help='drop every Nth received datagram')
+    parser.add_argument('--max-block', type=int, default=0, metavar='BYTES',
+                        help='ask clients for blocks of at most BYTES')
+    args = parser.parse_args()
+
+    try:
+        asyncio.run(serve(args))
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()
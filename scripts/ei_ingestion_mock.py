@@ -0,0 +1,203 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''ei_ingestion_mock.py
+
+Local stand-in for the Edge Impulse ingestion API, for the simulation of
+esp32s3_demo_edgeimpulse on native_sim, or a board on the LAN.
+
+  POST <--path>   takes an upload in the data acquisition format the app
+                  sends (protected, signature, payload with sensors and
+                  values).
+  POST <--results-path>
+                  takes the result of an on-device classification, a JSON
+                  object with a 'class'.
+                  Both answer 200, 401 without the --api-key as x-api-key,
+                  or 400 if the body is not what the path takes.
+  GET /stats      what was received so far, as JSON: uploads, heartbeats,
+                  windows and results, values, body bytes, rejected
+                  uploads, and labels received more than once.
+
+--fail-every N answers 500 to every Nth upload without keeping it, so the
+device's count of failed uploads can be checked against the mock's.
+
+Example:
+
+  python scripts/ei_ingestion_mock.py --port 8080 --api-key ei_sim
+  curl http://127.0.0.1:8080/stats
+'''
+
+import argparse
+import json
+import threading
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+
+class Received:
+    '''Uploads received, shared by the handler threads.'''
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.uploads = 0
+        self.heartbeats = 0
+        self.windows = 0
+        self.results = 0
+        self.values = 0
+        self.bytes = 0
+        self.rejected = 0
+        self.failed = 0
+        self.labels = set()
+        self.duplicates = 0
+
+    def as_dict(self):
+        with self.lock:
+            return {
+                'uploads': self.uploads,
+                'heartbeats': self.heartbeats,
+                'windows': self.windows,
+                'results': self.results,
+                'values': self.values,
+                'bytes': self.bytes,
+                'rejected': self.rejected,
+                'failed': self.failed,
+                'duplicates': self.duplicates,
+            }
+
+
+def count_values(upload):
+    '''Values of a data acquisition upload, None if it is not one.'''
+    try:
+        payload = upload['payload']
+        sensors = len(payload['sensors'])
+        values = payload['values']
+        upload['protected']['ver']
+    except (KeyError, TypeError):
+        return None
+    if not isinstance(values, list) or \
+            any(len(value) != sensors for value in values):
+        return None
+    return len(values)
+
+
+class MockHandler(BaseHTTPRequestHandler):
+    protocol_version = 'HTTP/1.1'
+    server_version = 'ei-ingestion-mock/1.0'
+
+    def reply(self, status, body):
+        data = json.dumps(body).encode()
+        self.send_response(status)
+        self.send_header('Content-Type', 'application/json')
+        self.send_header('Content-Length', str(len(data)))
+        self.end_headers()
+        self.wfile.write(data)
+
+    def do_GET(self):
+        if self.path != '/stats':
+            self.send_error(404)
+            return
+        self.reply(200, self.server.received.as_dict())
+
+    def do_POST(self):
+        length = int(self.headers.get('Content-Length', 0))
+        body = self.rfile.read(length)
+        received = self.server.received
+        label = self.headers.get('x-label', '-')
+
+        if self.path not in (self.server.path, self.server.results_path):
+            self.send_error(404)
+            return
+
+        api_key = self.server.api_key
+        if api_key and self.headers.get('x-api-key') != api_key:
+            with received.lock:
+                received.rejected += 1
+            self.reply(401, {'success': False, 'error': 'bad API key'})
+            return
+
+        try:
+            upload = json.loads(body)
+        except ValueError:
+            upload = None
+        result = self.path == self.server.results_path
+        if result:
+            values = None
+            valid = isinstance(upload, dict) and 'class' in upload
+        else:
+            values = count_values(upload) if isinstance(upload, dict) \
+                else None
+            valid = values is not None
+        if not valid:
+            with received.lock:
+                received.rejected += 1
+            self.reply(400, {'success': False, 'error': 'bad upload'})
+            return
+
+        with received.lock:
+            attempt = received.uploads + received.failed + 1
+            fail = self.server.fail_every and \
+                attempt % self.server.fail_every == 0
+            if fail:
+                received.failed += 1
+            else:
+                received.uploads += 1
+                received.bytes += len(body)
+                if result:
+                    received.results += 1
+                else:
+                    received.values += values
+                    if label.endswith('_heartbeat'):
+                        received.heartbeats += 1
+                    else:
+                        received.windows += 1
+                if label != '-':
+                    received.duplicates += label in received.labels
+                    received.labels.add(label)
+
+        if fail:
+            self.reply(500, {'success': False, 'error': 'injected failure'})
+        else:
+            self.reply(200, {'success': True, 'files': [f'{label}.json']})
+        if not self.server.quiet:
+            self.log_message('POST %s [%s]: %d bytes, %s%s', self.path,
+                             label, len(body),
+                             'result' if result else f'{values} values',
+                             ' FAILED' if fail else '')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--bind', default='127.0.0.1',
+                        help='address to listen on (default: %(default)s)')
+    parser.add_argument('--port', type=int, default=8080,
+                        help='port to listen on (default: %(default)s)')
+    parser.add_argument('--path', default='/api/training/data',
+                        help='upload path (default: %(default)s)')
+    parser.add_argument('--results-path', default='/api/results',
+                        help='path of classification results '
+                             '(default: %(default)s)')
+    parser.add_argument('--api-key',
+                        help='x-api-key uploads must carry, any if not given')
+    parser.add_argument('--fail-every', type=int, default=0, metavar='N',
+                        help='answer 500 to every Nth upload')
+    parser.add_argument('--quiet', action='store_true',
+                        help='do not log every upload')
+    args = parser.parse_args()
+
+    server = ThreadingHTTPServer((args.bind, args.port), MockHandler)
+    server.received = Received()
+    server.path = args.path
+    server.results_path = args.results_path
+    server.api_key = args.api_key
+    server.fail_every = args.fail_every
+    server.quiet = args.quiet
+    print(f'ei-ingestion-mock listening on {args.bind}:{args.port}')
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    print(json.dumps(server.received.as_dict()))
+
+
+if __name__ == '__main__':
+    main()
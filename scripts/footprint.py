@@ -0,0 +1,295 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''footprint.py
+
+west footprint: build the apps, run each one through a scenario and report
+its thread stack high-water marks next to the RAM and ROM usage of its image.
+
+The apps are built with CONFIG_FOOTPRINT (lib/footprint), which prints the
+stack usage of every thread once the scenario has run for its duration. The
+scenario of an app is described by an optional apps/<app>/footprint.yaml:
+
+  board: native_sim        # board to use unless -b is given
+  duration_ms: 20000       # how long the app runs before stacks are measured
+  extra_configs:           # added to the build, like in testcase.yaml
+    - CONFIG_FOO=y
+  standins:                # started before the app, stopped after it
+    - scripts/http_standin.py --bind 127.0.0.1 --port 8080
+
+Every app has a scenario on qemu_x86, its peripherals emulated and its
+network peers stood in for, so that a plain `west footprint` reports usable
+stack numbers. Apps are only run on native_sim and QEMU boards; for other
+boards only the image is analysed. native_sim threads run on host stacks,
+so their stack numbers are listed without a verdict: use a QEMU board, or
+read the report off real hardware, to size stacks.
+'''
+
+import json
+import os
+import re
+import shlex
+import signal
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+import yaml
+from elftools.elf.constants import SH_FLAGS
+from elftools.elf.elffile import ELFFile
+from west import log
+from west.commands import WestCommand
+
+REPO = Path(__file__).resolve().parents[1]
+APPS = REPO / 'apps'
+
+DEFAULT_BOARD = 'qemu_x86'
+DEFAULT_DURATION_MS = 10000
+# Time to boot and print the report, on top of the scenario duration
+RUN_MARGIN_S = 30
+
+STACK_RE = re.compile(r'footprint: stack (\d+) (\d+) (.+?)\s*$')
+END_RE = re.compile(r'footprint: end')
+
+# Stacks using more than this are flagged as at risk, less as oversized
+HIGH_USE = 0.90
+LOW_USE = 0.40
+
+
+def runnable(board):
+    return board == 'native_sim' or board.startswith('qemu_')
+
+
+def load_scenario(app_dir):
+    path = app_dir / 'footprint.yaml'
+    if not path.exists():
+        return {}
+    with open(path) as f:
+        return yaml.safe_load(f) or {}
+
+
+def image_usage(elf_path, top):
+    '''RAM and ROM used by an image, and its largest objects in RAM.
+
+    Writable sections count as RAM, and also as ROM unless they are zero
+    initialised, since their initial values are stored in the image.
+    '''
+    rom = ram = 0
+    ram_ranges = []
+
+    with open(elf_path, 'rb') as f:
+        elf = ELFFile(f)
+
+        for sec in elf.iter_sections():
+            flags = sec['sh_flags']
+            size = sec['sh_size']
+            if not flags & SH_FLAGS.SHF_ALLOC or size == 0:
+                continue
+            if flags & SH_FLAGS.SHF_WRITE:
+                ram += size
+                ram_ranges.append((sec['sh_addr'], sec['sh_addr'] + size))
+                if sec['sh_type'] != 'SHT_NOBITS':
+                    rom += size
+            else:
+                rom += size
+
+        objects = []
+        symtab = elf.get_section_by_name('.symtab')
+        for sym in symtab.iter_symbols() if symtab else []:
+            if sym['st_info']['type'] != 'STT_OBJECT' or sym['st_size'] == 0:
+                continue
+            addr = sym['st_value']
+            if any(lo <= addr < hi for lo, hi in ram_ranges):
+                objects.append((sym['st_size'], sym.name))
+
+    objects.sort(reverse=True)
+
+    return {
+        'rom': rom,
+        'ram': ram,
+        'ram_objects': [{'name': n, 'size': s} for s, n in objects[:top]],
+    }
+
+
+class Footprint(WestCommand):
+
+    def __init__(self):
+        super().__init__(
+            'footprint',
+            'report stack, RAM and ROM footprint of the apps',
+            __doc__.split('\n', 2)[2])
+
+    def do_add_parser(self, parser_adder):
+        import argparse
+
+        parser = parser_adder.add_parser(
+            self.name, help=self.help, description=self.description,
+            formatter_class=argparse.RawDescriptionHelpFormatter)
+        parser.add_argument('apps', nargs='*',
+                            help='apps to analyse (default: all of apps/)')
+        parser.add_argument('-b', '--board',
+                            help='board to build for, overriding the '
+                                 f'scenarios (default: {DEFAULT_BOARD})')
+        parser.add_argument('-d', '--build-dir', default='build/footprint',
+                            help='root of the build directories')
+        parser.add_argument('--duration-ms', type=int,
+                            help='scenario duration, overriding the scenarios')
+        parser.add_argument('--no-run', action='store_true',
+                            help='only analyse the images')
+        parser.add_argument('--top', type=int, default=10,
+                            help='number of largest RAM objects to list')
+        parser.add_argument('--json', metavar='FILE',
+                            help='also write the results to FILE')
+
+        return parser
+
+    def do_run(self, args, unknown_args):
+        names = args.apps or sorted(p.name for p in APPS.iterdir()
+                                    if (p / 'CMakeLists.txt').exists())
+        results = []
+
+        for name in names:
+            app_dir = APPS / name
+            if not app_dir.is_dir():
+                log.die(f'no app {name} in {APPS}')
+            results.append(self.footprint(app_dir, args))
+
+        for result in results:
+            self.print_result(result)
+
+        if args.json:
+            with open(args.json, 'w') as f:
+                json.dump(results, f, indent=2)
+            log.inf(f'Results written to {args.json}')
+
+        failed = [r['app'] for r in results if r.get('error')]
+        if failed:
+            log.die('footprint failed for: ' + ', '.join(failed))
+
+    def footprint(self, app_dir, args):
+        scenario = load_scenario(app_dir)
+        board = args.board or scenario.get('board', DEFAULT_BOARD)
+        duration_ms = args.duration_ms or scenario.get('duration_ms',
+                                                       DEFAULT_DURATION_MS)
+        build_dir = (Path(args.build_dir) /
+                     f'{app_dir.name}-{board.replace("/", "_")}')
+        result = {'app': app_dir.name, 'board': board, 'stacks': None}
+
+        log.banner(f'{app_dir.name} on {board}')
+
+        configs = ['CONFIG_FOOTPRINT=y',
+                   f'CONFIG_FOOTPRINT_REPORT_DELAY_MS={duration_ms}']
+        configs += scenario.get('extra_configs', [])
+        cmd = ['west', 'build', '-p', 'always', '-b', board,
+               '-d', str(build_dir), str(app_dir), '--']
+        cmd += [f'-D{c}' for c in configs]
+
+        if subprocess.run(cmd).returncode != 0:
+            result['error'] = 'build failed'
+            return result
+
+        result.update(image_usage(build_dir / 'zephyr' / 'zephyr.elf',
+                                  args.top))
+
+        if args.no_run or not runnable(board):
+            return result
+
+        try:
+            result['stacks'] = self.run_scenario(
+                build_dir, board, scenario.get('standins', []),
+                duration_ms / 1000 + RUN_MARGIN_S)
+        except RuntimeError as e:
+            result['error'] = str(e)
+
+        return result
+
+    def run_scenario(self, build_dir, board, standins, timeout_s):
+        helpers = []
+        for standin in standins:
+            cmd = shlex.split(standin)
+            if cmd[0].endswith('.py'):
+                cmd.insert(0, sys.executable)
+            helpers.append(subprocess.Popen(cmd, cwd=REPO))
+        if helpers:
+            time.sleep(1)
+
+        if board == 'native_sim':
+            cmd = [str(build_dir / 'zephyr' / 'zephyr.exe')]
+        else:
+            cmd = ['west', 'build', '-d', str(build_dir), '-t', 'run']
+
+        # A session of its own, so QEMU goes down with west and ninja
+        proc = subprocess.Popen(cmd, stdout=subprocess.PIPE,
+                                stderr=subprocess.STDOUT, text=True,
+                                errors='replace', start_new_session=True)
+        stacks = []
+        done = False
+        deadline = time.monotonic() + timeout_s
+
+        try:
+            os.set_blocking(proc.stdout.fileno(), False)
+            pending = ''
+            while not done and time.monotonic() < deadline:
+                chunk = proc.stdout.read()
+                if not chunk:
+                    if proc.poll() is not None:
+                        break
+                    time.sleep(0.1)
+                    continue
+                pending += chunk
+                *lines, pending = pending.split('\n')
+                for line in lines:
+                    log.dbg(line, level=log.VERBOSE_VERY)
+                    m = STACK_RE.search(line)
+                    if m:
+                        stacks.append({'thread': m.group(3),
+                                       'size': int(m.group(1)),
+                                       'used': int(m.group(2))})
+                    elif END_RE.search(line):
+                        done = True
+        finally:
+            if proc.poll() is None:
+                os.killpg(proc.pid, signal.SIGTERM)
+            proc.wait()
+            for helper in helpers:
+                helper.terminate()
+                helper.wait()
+
+        if not done:
+            raise RuntimeError('no footprint report within '
+                               f'{timeout_s:.0f} s')
+
+        return stacks
+
+    @staticmethod
+    def print_result(result):
+        log.banner(f'{result["app"]} ({result["board"]})')
+
+        if 'rom' in result:
+            log.inf(f'  ROM {result["rom"]:>9} B   RAM {result["ram"]:>9} B')
+
+        if result['stacks']:
+            host_stacks = result['board'] == 'native_sim'
+            if host_stacks:
+                log.wrn('native_sim threads run on host stacks, '
+                        'stack usage is not representative')
+            log.inf(f'  {"thread":<24} {"size":>6} {"used":>6} '
+                    f'{"free":>6} {"use":>5}')
+            for s in result['stacks']:
+                use = s['used'] / s['size'] if s['size'] else 0
+                note = ''
+                if not host_stacks and use > HIGH_USE:
+                    note = '  <- at risk'
+                elif not host_stacks and use < LOW_USE:
+                    note = '  <- oversized'
+                log.inf(f'  {s["thread"]:<24} {s["size"]:>6} {s["used"]:>6} '
+                        f'{s["size"] - s["used"]:>6} {use:>5.0%}{note}')
+
+        if result.get('ram_objects'):
+            log.inf('  largest RAM objects:')
+            for o in result['ram_objects']:
+                log.inf(f'    {o["name"]:<40} {o["size"]:>8} B')
+
+        if result.get('error'):
+            log.err(f'  {result["error"]}')
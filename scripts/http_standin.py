@@ -0,0 +1,286 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''http_standin.py
+
+Local HTTP server used as a stand-in for the remote servers the apps talk to,
+so download throughput can be measured on the LAN or against native_sim.
+
+  GET /blob/<size>   returns <size> bytes (suffix K or M allowed) of a
+                     deterministic pattern, byte i being (i * 31 + 7) & 0xff
+  GET /<path>        serves files from --root, if given
+  GET /LoremIpsum.txt a short text, unless --root provides one
+  POST <any path>    reads and discards the body, answering 200 with a
+                     small JSON receipt, like an ingestion endpoint
+
+Range requests are honoured (206 with Content-Range, ETag and If-Range),
+unless --no-ranges is given. --drop-after N closes every connection after
+N body bytes, to exercise resumable downloads. Other misbehaviours, each
+counting the GETs of every path on its own:
+
+  --chunked               whole bodies go chunked, without Content-Length
+  --fail-after N          GETs after the first N answer 503
+  --etag-change-after N   GETs after the first N see another ETag, and
+                          ranges are served whatever If-Range says
+  --resize-after N        GETs after the first N are told a total size one
+                          byte larger in Content-Range
+
+Example:
+
+  python scripts/http_standin.py --port 8080
+  # then build Zephyr_WiFi with
+  #   CONFIG_APP_HTTP_HOST="<host ip>" CONFIG_APP_HTTP_PORT=8080
+  #   CONFIG_APP_HTTP_BENCH_PATH="/blob/4M"
+'''
+
+import argparse
+import hashlib
+import os
+import re
+import threading
+import time
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+
+CHUNK = 16 * 1024
+
+LOREM = (b'Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do '
+         b'eiusmod tempor incididunt ut labore et dolore magna aliqua.\r\n')
+
+
+def parse_size(text):
+    m = re.fullmatch(r'(\d+)([KkMm]?)', text)
+    if not m:
+        return None
+    scale = {'': 1, 'k': 1024, 'm': 1024 * 1024}[m.group(2).lower()]
+    return int(m.group(1)) * scale
+
+
+# The pattern repeats every 256 bytes, so slice it out of a precomputed block
+_PERIOD = bytes(((i * 31 + 7) & 0xff) for i in range(256))
+_BLOCK = _PERIOD * (CHUNK // 256 + 2)
+
+
+def pattern(offset, length):
+    out = bytearray()
+    while length > 0:
+        start = offset % 256
+        n = min(length, len(_BLOCK) - start)
+        out += _BLOCK[start:start + n]
+        offset += n
+        length -= n
+    return bytes(out)
+
+
+class StandinHandler(BaseHTTPRequestHandler):
+    protocol_version = 'HTTP/1.1'
+    server_version = 'http-standin/1.0'
+
+    def resolve(self):
+        '''Return (size, reader) for the requested path, or None.'''
+        if self.path.startswith('/blob/'):
+            size = parse_size(self.path[len('/blob/'):])
+            if size is None:
+                return None
+            return size, pattern
+
+        root = self.server.root
+        local = None
+        if root is not None:
+            local = os.path.realpath(os.path.join(root, self.path.lstrip('/')))
+            if not local.startswith(os.path.realpath(root)) or \
+                    not os.path.isfile(local):
+                local = None
+
+        if local is None:
+            if self.path == '/LoremIpsum.txt':
+                return len(LOREM), lambda offset, length: \
+                    LOREM[offset:offset + length]
+            return None
+
+        def reader(offset, length):
+            with open(local, 'rb') as f:
+                f.seek(offset)
+                return f.read(length)
+
+        return os.path.getsize(local), reader
+
+    def parse_range(self, size, etag):
+        '''Return (first, last) for a satisfiable Range header, else None.
+        If-Range is not checked when @p etag is None.'''
+        value = self.headers.get('Range')
+        if value is None or not self.server.ranges:
+            return None
+        if_range = self.headers.get('If-Range')
+        if etag is not None and if_range is not None and if_range != etag:
+            return None
+        m = re.fullmatch(r'bytes=(\d*)-(\d*)', value.strip())
+        if not m or (m.group(1) == '' and m.group(2) == ''):
+            return None
+        if m.group(1) == '':
+            first = max(size - int(m.group(2)), 0)
+            last = size - 1
+        else:
+            first = int(m.group(1))
+            last = int(m.group(2)) if m.group(2) else size - 1
+        return first, min(last, size - 1)
+
+    def do_GET(self):
+        found = self.resolve()
+        if found is None:
+            self.send_error(404)
+            return
+        size, reader = found
+        server = self.server
+        with server.lock:
+            server.gets[self.path] = server.gets.get(self.path, 0) + 1
+            gets = server.gets[self.path]
+
+        if server.fail_after and gets > server.fail_after:
+            self.send_error(503)
+            return
+
+        version = f'{self.path}:{size}'
+        changed = server.etag_change_after and \
+            gets > server.etag_change_after
+        if changed:
+            version += ':changed'
+        etag = '"%s"' % hashlib.sha1(version.encode()).hexdigest()[:16]
+        total = size
+        if server.resize_after and gets > server.resize_after:
+            total += 1
+
+        byte_range = self.parse_range(size, None if changed else etag)
+        if byte_range is not None and byte_range[0] >= size:
+            self.send_response(416)
+            self.send_header('Content-Range', f'bytes */{total}')
+            self.send_header('Content-Length', '0')
+            self.end_headers()
+            return
+
+        if byte_range is None:
+            first, last = 0, size - 1
+            self.send_response(200)
+        else:
+            first, last = byte_range
+            self.send_response(206)
+            self.send_header('Content-Range', f'bytes {first}-{last}/{total}')
+        length = last - first + 1
+        chunked = server.chunked and byte_range is None
+
+        self.send_header('Content-Type', 'application/octet-stream')
+        if chunked:
+            self.send_header('Transfer-Encoding', 'chunked')
+        else:
+            self.send_header('Content-Length', str(length))
+        self.send_header('ETag', etag)
+        if server.ranges:
+            self.send_header('Accept-Ranges', 'bytes')
+        self.end_headers()
+
+        start = time.monotonic()
+        sent = self.send_body(reader, first, length, chunked)
+        elapsed = max(time.monotonic() - start, 1e-6)
+        self.log_message('%s [%d-%d]: %d bytes in %.3f s (%.1f kbit/s)%s',
+                         self.path, first, last, sent, elapsed,
+                         sent * 8 / elapsed / 1000,
+                         '' if sent == length else ' DROPPED')
+
+    def do_POST(self):
+        length = int(self.headers.get('Content-Length', 0))
+        body = self.rfile.read(length)
+        self.server.posts += 1
+        self.server.post_bytes += len(body)
+
+        reply = ('{"received":%d,"count":%d}' %
+                 (len(body), self.server.posts)).encode()
+        self.send_response(200)
+        self.send_header('Content-Type', 'application/json')
+        self.send_header('Content-Length', str(len(reply)))
+        self.end_headers()
+        self.wfile.write(reply)
+        self.log_message('POST %s [%s]: %d bytes (total %d posts, %d bytes)',
+                         self.path, self.headers.get('x-label', '-'),
+                         len(body), self.server.posts, self.server.post_bytes)
+
+    def send_body(self, reader, offset, length, chunked=False):
+        limit = length
+        if self.server.drop_after:
+            limit = min(length, self.server.drop_after)
+
+        sent = 0
+        while sent < limit:
+            n = min(CHUNK, limit - sent)
+            data = reader(offset + sent, n)
+            if chunked:
+                data = b'%x\r\n%s\r\n' % (n, data)
+            try:
+                self.wfile.write(data)
+            except (BrokenPipeError, ConnectionResetError):
+                break
+            sent += n
+
+        if chunked and sent == length:
+            self.wfile.write(b'0\r\n\r\n')
+
+        if sent < length:
+            # Simulate a flaky link: drop the connection mid-body
+            self.close_connection = True
+            self.wfile.flush()
+            self.connection.shutdown(2)
+        return sent
+
+
+def init_server(server, root=None, drop_after=0, ranges=True, chunked=False,
+                fail_after=0, etag_change_after=0, resize_after=0):
+    '''Settings and counters StandinHandler expects on its server.'''
+    server.root = root
+    server.drop_after = drop_after
+    server.ranges = ranges
+    server.chunked = chunked
+    server.fail_after = fail_after
+    server.etag_change_after = etag_change_after
+    server.resize_after = resize_after
+    server.lock = threading.Lock()
+    server.gets = {}
+    server.posts = 0
+    server.post_bytes = 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--bind', default='0.0.0.0',
+                        help='address to listen on (default: %(default)s)')
+    parser.add_argument('--port', type=int, default=8080,
+                        help='port to listen on (default: %(default)s)')
+    parser.add_argument('--root', help='directory to serve files from')
+    parser.add_argument('--drop-after', type=int, default=0, metavar='BYTES',
+                        help='close each connection after BYTES body bytes')
+    parser.add_argument('--no-ranges', action='store_true',
+                        help='ignore Range headers, like a basic server')
+    parser.add_argument('--chunked', action='store_true',
+                        help='send whole bodies with chunked encoding')
+    parser.add_argument('--fail-after', type=int, default=0, metavar='N',
+                        help='answer 503 to GETs of a path after N of them')
+    parser.add_argument('--etag-change-after', type=int, default=0,
+                        metavar='N',
+                        help='change the ETag of a path after N GETs')
+    parser.add_argument('--resize-after', type=int, default=0, metavar='N',
+                        help='report a total one byte larger after N GETs')
+    args = parser.parse_args()
+
+    server = ThreadingHTTPServer((args.bind, args.port), StandinHandler)
+    init_server(server, root=args.root, drop_after=args.drop_after,
+                ranges=not args.no_ranges, chunked=args.chunked,
+                fail_after=args.fail_after,
+                etag_change_after=args.etag_change_after,
+                resize_after=args.resize_after)
+    print(f'http-standin listening on {args.bind}:{args.port}')
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,184 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''mqtt_standin.py
+
+Minimal MQTT 3.1.1 broker used as a stand-in for the telemetry backend, so
+the uplink library can be exercised on the LAN or against native_sim without
+installing a real broker.
+
+Only what a publishing device needs is implemented: CONNECT, PUBLISH with
+QoS 0 or 1 (answered with PUBACK), SUBSCRIBE (acknowledged, nothing is
+forwarded), PINGREQ and DISCONNECT. Every session prints a summary line with
+the message rate and the bytes seen on the wire.
+
+Example:
+
+  python scripts/mqtt_standin.py --port 1883
+  # then build with CONFIG_UPLINK_BACKEND_MQTT=y
+  #   CONFIG_UPLINK_HOST="<host ip>" CONFIG_UPLINK_PORT=1883
+'''
+
+import argparse
+import asyncio
+import struct
+import time
+
+CONNECT = 1
+CONNACK = 2
+PUBLISH = 3
+PUBACK = 4
+SUBSCRIBE = 8
+SUBACK = 9
+PINGREQ = 12
+PINGRESP = 13
+DISCONNECT = 14
+
+
+async def read_packet(reader):
+    '''Return (type, flags, body, wire_length) of the next control packet.'''
+    head = await reader.readexactly(1)
+    remaining = 0
+    multiplier = 1
+    header_len = 1
+    while True:
+        b = (await reader.readexactly(1))[0]
+        header_len += 1
+        remaining += (b & 0x7f) * multiplier
+        if not b & 0x80:
+            break
+        multiplier *= 128
+        if header_len > 5:
+            raise ValueError('malformed remaining length')
+    body = await reader.readexactly(remaining) if remaining else b''
+    return head[0] >> 4, head[0] & 0x0f, body, header_len + remaining
+
+
+class Session:
+    def __init__(self, server, reader, writer):
+        self.server = server
+        self.reader = reader
+        self.writer = writer
+        self.peer = writer.get_extra_info('peername')
+        self.client_id = '?'
+        self.messages = 0
+        self.payload_bytes = 0
+        self.rx_bytes = 0
+        self.tx_bytes = 0
+        self.first = None
+        self.last = None
+
+    def send(self, data):
+        self.tx_bytes += len(data)
+        self.writer.write(data)
+
+    def on_connect(self, body):
+        # Protocol name, level, flags, keep-alive, then the client id
+        name_len = struct.unpack_from('!H', body)[0]
+        offset = 2 + name_len + 4
+        id_len = struct.unpack_from('!H', body, offset)[0]
+        self.client_id = body[offset + 2:offset + 2 + id_len].decode(
+            errors='replace')
+        self.send(bytes([CONNACK << 4, 2, 0, 0]))
+
+    def on_publish(self, flags, body):
+        qos = (flags >> 1) & 3
+        topic_len = struct.unpack_from('!H', body)[0]
+        topic = body[2:2 + topic_len].decode(errors='replace')
+        offset = 2 + topic_len
+        if qos > 0:
+            msg_id = struct.unpack_from('!H', body, offset)[0]
+            offset += 2
+        payload = body[offset:]
+
+        now = time.monotonic()
+        if self.first is None:
+            self.first = now
+        self.last = now
+        self.messages += 1
+        self.payload_bytes += len(payload)
+        if self.server.verbose:
+            print(f'{self.client_id}: {topic} qos {qos}, {len(payload)} bytes')
+
+        if qos == 1 and not self.server.no_ack:
+            self.send(bytes([PUBACK << 4, 2]) + struct.pack('!H', msg_id))
+        elif qos == 2:
+            raise ValueError('QoS 2 not supported')
+
+    def on_subscribe(self, body):
+        msg_id = struct.unpack_from('!H', body)[0]
+        # Count the topic filters, granting QoS 0 to each
+        offset = 2
+        granted = bytearray()
+        while offset < len(body):
+            flen = struct.unpack_from('!H', body, offset)[0]
+            offset += 2 + flen + 1
+            granted.append(0)
+        self.send(bytes([SUBACK << 4, 2 + len(granted)]) +
+                  struct.pack('!H', msg_id) + bytes(granted))
+
+    async def run(self):
+        try:
+            while True:
+                ptype, flags, body, wire = await read_packet(self.reader)
+                self.rx_bytes += wire
+                if ptype == CONNECT:
+                    self.on_connect(body)
+                elif ptype == PUBLISH:
+                    self.on_publish(flags, body)
+                elif ptype == SUBSCRIBE:
+                    self.on_subscribe(body)
+                elif ptype == PINGREQ:
+                    self.send(bytes([PINGRESP << 4, 0]))
+                elif ptype == DISCONNECT:
+                    break
+                await self.writer.drain()
+        except (asyncio.IncompleteReadError, ConnectionError):
+            pass
+        except ValueError as e:
+            print(f'{self.client_id}: {e}, closing')
+        finally:
+            self.writer.close()
+            self.report()
+
+    def report(self):
+        span = (self.last - self.first) if self.messages > 1 else 0
+        rate = (self.messages - 1) / span if span > 0 else 0
+        print(f'session {self.client_id} {self.peer[0]}:{self.peer[1]}: '
+              f'{self.messages} msgs, {self.payload_bytes} payload bytes, '
+              f'wire rx {self.rx_bytes} tx {self.tx_bytes}, '
+              f'{rate:.1f} msgs/s', flush=True)
+
+
+async def serve(args):
+    async def handle(reader, writer):
+        await Session(args, reader, writer).run()
+
+    server = await asyncio.start_server(handle, args.bind, args.port)
+    print(f'mqtt-standin listening on {args.bind}:{args.port}', flush=True)
+    async with server:
+        await server.serve_forever()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--bind', default='0.0.0.0',
+                        help='address to listen on (default: %(default)s)')
+    parser.add_argument('--port', type=int, default=1883,
+                        help='port to listen on (default: %(default)s)')
+    parser.add_argument('--no-ack', action='store_true',
+                        help='never send PUBACK, to exercise the in-flight '
+                             'window')
+    parser.add_argument('-v', '--verbose', action='store_true',
+                        help='print every PUBLISH')
+    args = parser.parse_args()
+
+    try:
+        asyncio.run(serve(args))
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,135 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''perf_baseline.py
+
+Compare the benchmark results of a twister run of tests/perf with
+tests/perf/baseline.csv, and record them as the new baseline.
+
+The benchmarks print one line per result, which twister keeps in the logs
+of every test in its output directory:
+
+  PERF <platform> <benchmark>: <ns> ns/op, ...
+
+The comparison lists every result next to its baseline. As the tests
+themselves do, it exits with 1 if a result on a platform the tests are
+gated on is slower than its tolerance allows, or has no row while others
+of that platform have; elsewhere slower results are only reported.
+--update writes the results into the baseline file instead, keeping the
+tolerance of existing rows and giving new rows --tolerance; rows of
+benchmarks that did not run are left alone.
+
+Example, on the reference machine:
+
+  west twister -p native_sim -p qemu_cortex_m0 -T tests/perf
+  python scripts/perf_baseline.py twister-out --update
+'''
+
+import argparse
+import re
+import sys
+from pathlib import Path
+
+BASELINE = Path(__file__).resolve().parents[1] / 'tests' / 'perf' / \
+    'baseline.csv'
+HEADER = 'platform,benchmark,ns_per_op,tolerance_pct'
+RESULT_RE = re.compile(r'PERF (\S+) (\S+): (\d+) ns/op')
+# Platforms the gate holds on, as in tests/perf/common/perf.cmake
+GATED_PLATFORMS = ('qemu_cortex_m0',)
+
+
+def read_results(outdir):
+    '''{(platform, benchmark): ns_per_op} from the logs under outdir.'''
+    results = {}
+    for log in sorted(Path(outdir).rglob('*.log')):
+        for line in log.read_text(errors='replace').splitlines():
+            m = RESULT_RE.search(line)
+            if m:
+                # Later runs of the same benchmark replace earlier ones
+                results[(m.group(1), m.group(2))] = int(m.group(3))
+    return results
+
+
+def read_baseline(path):
+    '''Comment lines of the file, and its rows keyed like the results.'''
+    comments = []
+    rows = {}
+    for line in path.read_text().splitlines():
+        if line.startswith('#') or not line.strip():
+            comments.append(line)
+        elif line != HEADER:
+            platform, benchmark, ns_per_op, tolerance = line.split(',')
+            rows[(platform, benchmark)] = (int(ns_per_op), int(tolerance))
+    return comments, rows
+
+
+def write_baseline(path, comments, rows):
+    lines = comments + [HEADER]
+    lines += [f'{platform},{benchmark},{ns},{tolerance}'
+              for (platform, benchmark), (ns, tolerance)
+              in sorted(rows.items())]
+    path.write_text('\n'.join(lines) + '\n')
+
+
+def compare(results, rows):
+    '''Print results next to their baseline, return the regressions and
+    the results missing a required row, on gated platforms.'''
+    regressions = 0
+    missing = 0
+    recorded = {platform for platform, _ in rows}
+    print(f'{"platform":<16} {"benchmark":<24} {"ns/op":>10} '
+          f'{"baseline":>10} {"change":>8}')
+    for key, ns in sorted(results.items()):
+        platform, benchmark = key
+        if key not in rows:
+            required = platform in GATED_PLATFORMS and \
+                platform in recorded
+            missing += required
+            print(f'{platform:<16} {benchmark:<24} {ns:>10} {"-":>10}'
+                  f'{"           MISSING" if required else ""}')
+            continue
+        base, tolerance = rows[key]
+        change = 100.0 * (ns - base) / base
+        slow = ns > base * (100 + tolerance) / 100
+        gated = platform in GATED_PLATFORMS
+        regressions += slow and gated
+        verdict = ''
+        if slow:
+            verdict = '  REGRESSION' if gated else '  REGRESSION (not gated)'
+        print(f'{platform:<16} {benchmark:<24} {ns:>10} {base:>10} '
+              f'{change:>+7.1f}%{verdict}')
+    return regressions, missing
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('outdir', help='twister output directory')
+    parser.add_argument('--baseline', type=Path, default=BASELINE,
+                        help='baseline file (default: %(default)s)')
+    parser.add_argument('--update', action='store_true',
+                        help='record the results as the new baseline')
+    parser.add_argument('--tolerance', type=int, default=20,
+                        metavar='PERCENT',
+                        help='tolerance of new rows (default: %(default)s)')
+    args = parser.parse_args()
+
+    results = read_results(args.outdir)
+    if not results:
+        sys.exit(f'perf_baseline: no PERF results under {args.outdir}')
+
+    comments, rows = read_baseline(args.baseline)
+    regressions, missing = compare(results, rows)
+
+    if args.update:
+        for key, ns in results.items():
+            rows[key] = (ns, rows.get(key, (0, args.tolerance))[1])
+        write_baseline(args.baseline, comments, rows)
+        print(f'{len(results)} results recorded in {args.baseline}')
+    elif regressions or missing:
+        print(f'{regressions} regressions, {missing} missing baselines')
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()
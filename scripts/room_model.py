@@ -0,0 +1,575 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''room_model.py
+
+Train the room event classifier of esp32s3_demo_edgeimpulse for the
+TensorFlow Lite Micro backend of lib/inference, and cut the windows it is
+tested on from the app's recorded trace.
+
+The model takes a change window of the app as lib/inference feeds it: 13
+samples (4 before the change, the change and 8 after) of temperature and
+humidity, each as its offset from the first sample of the window, in C and
+%RH. It is a fully connected network, 26 inputs, 16 ReLU units and a
+softmax over the classes, in float32: about 2 KiB of weights.
+
+It is trained on synthetic windows of each event, with random amplitudes,
+time constants, sampling periods between 10 s and 5 min, detection delay
+and sensor noise, from a fixed seed. It is written as a TFLite flatbuffer
+with the flatbuffers package alone, then read back and run with numpy to
+check that the file holds the trained network.
+
+The test windows are cut from sim/week.csv around the events its header
+describes, and at quiet times, at sampling periods of 1, 3 and 5 minutes.
+They are not used for training. They are written as a C header for
+tests/lib/inference, which runs them through the backend on the device.
+
+Needs numpy and flatbuffers. Rerun after changing the window, the classes
+or the trace:
+
+  python scripts/room_model.py
+'''
+
+import argparse
+import sys
+from pathlib import Path
+
+import flatbuffers
+import numpy as np
+
+ROOT = Path(__file__).resolve().parents[1]
+APP = ROOT / 'apps' / 'esp32s3_demo_edgeimpulse'
+TRACE = APP / 'sim' / 'week.csv'
+MODEL = APP / 'model' / 'room.tflite'
+WINDOWS = ROOT / 'tests' / 'lib' / 'inference' / 'src' / 'week_windows.h'
+
+# In the order of the model outputs, as in the app's src/model.c
+LABELS = ('steady', 'heating', 'cooling', 'airing', 'shower')
+STEADY, HEATING, COOLING, AIRING, SHOWER = range(len(LABELS))
+
+# CONFIG_PIPELINE_CHANGEDET_PRE and _POST of the app
+PRE = 4
+POST = 8
+WINDOW = PRE + 1 + POST
+VALUES = 2
+HIDDEN = 16
+
+# Inputs are divided by these before the first layer, so that both values
+# weigh the same in training; the division is folded into its weights
+INPUT_SCALE = np.array([1.0, 5.0] * WINDOW, dtype=np.float32)
+
+DAY_S = 24 * 3600
+
+
+# Synthetic training windows
+
+def rise(t_s, tau_s):
+    '''Exponential approach from 0 to 1, from t = 0.'''
+    return np.where(t_s > 0, 1 - np.exp(-np.maximum(t_s, 0) / tau_s), 0)
+
+
+def synth_window(rng, label):
+    '''One window of @p label, as offsets in C and %RH, shape (13, 2).'''
+    period_s = rng.uniform(10, 300)
+    # The change detection fires on the change sample or a little later
+    delay = rng.integers(0, 3)
+    t = (np.arange(WINDOW) - PRE + delay) * period_s
+    t += rng.uniform(0, period_s)
+    temp = np.zeros(WINDOW)
+    hum = np.zeros(WINDOW)
+
+    if label in (HEATING, COOLING):
+        sign = 1 if label == HEATING else -1
+        amp = sign * rng.uniform(0.8, 4.0)
+        # Initial rate from 2 to 20 C an hour
+        ramp_s = abs(amp) / rng.uniform(2, 20) * 3600
+        if rng.random() < 0.5:
+            # Radiator at full power up to the set point
+            temp = amp * np.clip(t / ramp_s, 0, 1)
+        else:
+            temp = amp * rise(t, ramp_s)
+        # Relative humidity moves against the temperature
+        hum = -rng.uniform(0.8, 2.5) * temp
+    elif label == AIRING:
+        open_s = rng.uniform(300, 1200)
+        drop = rise(t, rng.uniform(60, 300)) * (t < open_s)
+        back = rise(open_s, 180) * np.exp(
+            -np.maximum(t - open_s, 0) / rng.uniform(600, 2400)) * \
+            (t >= open_s)
+        shape = drop + back
+        temp = -rng.uniform(1.0, 4.0) * shape
+        hum = rng.choice([-1, 1]) * rng.uniform(1.5, 8.0) * shape
+    elif label == SHOWER:
+        up_s = rng.uniform(60, 600)
+        shape = np.clip(t / up_s, 0, 1) * np.exp(
+            -np.maximum(t - up_s, 0) / rng.uniform(900, 3600))
+        hum = rng.uniform(6.0, 25.0) * shape
+        temp = rng.uniform(0.05, 1.0) * shape
+    else:
+        # Drift, such as the sun on a wall, up to 0.5 C an hour
+        drift = rng.uniform(-0.5, 0.5) / 3600
+        temp = drift * (t - t[0])
+        hum = -rng.uniform(0.8, 2.5) * temp
+
+    temp += rng.normal(0, rng.uniform(0, 0.04), WINDOW)
+    hum += rng.normal(0, rng.uniform(0, 0.15), WINDOW)
+    window = np.stack([temp, hum], axis=1)
+    return window - window[0]
+
+
+def synth_set(rng, per_class):
+    x, y = [], []
+    for label in range(len(LABELS)):
+        for _ in range(per_class):
+            x.append(synth_window(rng, label).reshape(-1))
+            y.append(label)
+    return np.array(x, dtype=np.float32), np.array(y)
+
+
+# Test windows from the recorded trace
+
+def read_trace(path):
+    rows = [line.split(',') for line in path.read_text().splitlines()
+            if line[:1].isdigit()]
+    return np.array([[float(v) for v in row] for row in rows])
+
+
+def week_events():
+    '''(start_s, label) of the events described in the header of
+    week.csv, Monday 00:00 being 0.'''
+    events = []
+    for day in range(7):
+        on_h = 6.5 if day < 5 else 7.5
+        events.append((day * DAY_S + on_h * 3600, HEATING))
+        events.append((day * DAY_S + 22 * 3600, COOLING))
+    # Saturday's heating left off, back to the setback at midnight
+    events.append((6 * DAY_S, HEATING))
+    # Shower on Tuesday, window opened on Thursday
+    events.append((1 * DAY_S + 7 * 3600 + 40 * 60, SHOWER))
+    events.append((3 * DAY_S + 14 * 3600 + 5 * 60, AIRING))
+    return sorted(events)
+
+
+# Quiet hours of every day, the afternoon ones with the sun drifting,
+# unless an event started less than QUIET_AFTER_S before
+QUIET_H = (2, 4, 11, 13, 15, 17, 20)
+QUIET_AFTER_S = 2 * 3600
+
+
+def cut(trace, change_s, period_s):
+    '''Window whose sample PRE is at change_s, in milli-units.'''
+    t = change_s + (np.arange(WINDOW) - PRE) * period_s
+    if t[0] < trace[0, 0] or t[-1] > trace[-1, 0]:
+        return None
+    temp = np.interp(t, trace[:, 0], trace[:, 1])
+    hum = np.interp(t, trace[:, 0], trace[:, 2])
+    return np.rint(np.stack([temp, hum], axis=1) * 1000).astype(int)
+
+
+def week_windows(trace):
+    '''(label, period_s, change_s, window) cut from the trace.'''
+    windows = []
+    for period_s in (60, 180, 300):
+        for start_s, label in week_events():
+            # The detection fires on the first sample after the start,
+            # or up to two samples later
+            first_s = (start_s // period_s + 1) * period_s
+            for delay in range(3):
+                change_s = int(first_s + delay * period_s)
+                w = cut(trace, change_s, period_s)
+                if w is not None:
+                    windows.append((label, period_s, change_s, w))
+        for day in range(7):
+            for hour in QUIET_H:
+                change_s = day * DAY_S + hour * 3600
+                if any(0 <= change_s - start_s < QUIET_AFTER_S
+                       for start_s, _ in week_events()):
+                    continue
+                w = cut(trace, change_s, period_s)
+                if w is not None:
+                    windows.append((STEADY, period_s, change_s, w))
+    return windows
+
+
+def week_set(windows):
+    x = [((w - w[0]) / 1000.0).reshape(-1) for _, _, _, w in windows]
+    y = [label for label, _, _, _ in windows]
+    return np.array(x, dtype=np.float32), np.array(y)
+
+
+# Training
+
+def forward(params, x):
+    w1, b1, w2, b2 = params
+    h = np.maximum(x @ w1.T + b1, 0)
+    logits = h @ w2.T + b2
+    e = np.exp(logits - logits.max(axis=1, keepdims=True))
+    return h, e / e.sum(axis=1, keepdims=True)
+
+
+def train(x, y, rng, epochs, batch=64, lr=3e-3):
+    '''Fully connected network on x / INPUT_SCALE, with Adam.'''
+    n_in = x.shape[1]
+    n_out = len(LABELS)
+    params = [
+        rng.normal(0, np.sqrt(2 / n_in), (HIDDEN, n_in)),
+        np.zeros(HIDDEN),
+        rng.normal(0, np.sqrt(1 / HIDDEN), (n_out, HIDDEN)),
+        np.zeros(n_out),
+    ]
+    m = [np.zeros_like(p) for p in params]
+    v = [np.zeros_like(p) for p in params]
+    xs = x / INPUT_SCALE
+    onehot = np.eye(n_out)[y]
+    step = 0
+
+    for _ in range(epochs):
+        order = rng.permutation(len(xs))
+        for i in range(0, len(xs), batch):
+            idx = order[i:i + batch]
+            xb, tb = xs[idx], onehot[idx]
+            h, p = forward(params, xb)
+            d_logits = (p - tb) / len(idx)
+            d_h = (d_logits @ params[2]) * (h > 0)
+            grads = [d_h.T @ xb, d_h.sum(axis=0),
+                     d_logits.T @ h, d_logits.sum(axis=0)]
+            step += 1
+            for k, g in enumerate(grads):
+                m[k] = 0.9 * m[k] + 0.1 * g
+                v[k] = 0.999 * v[k] + 0.001 * g * g
+                m_hat = m[k] / (1 - 0.9 ** step)
+                v_hat = v[k] / (1 - 0.999 ** step)
+                params[k] -= lr * m_hat / (np.sqrt(v_hat) + 1e-8)
+
+    w1, b1, w2, b2 = params
+    # Fold the input scale into the first layer
+    return [(w1 / INPUT_SCALE).astype(np.float32), b1.astype(np.float32),
+            w2.astype(np.float32), b2.astype(np.float32)]
+
+
+# TFLite flatbuffer, schema version 3 (tensorflow/lite/schema/schema.fbs)
+
+TFLITE_VERSION = 3
+FLOAT32 = 0
+FULLY_CONNECTED = 9
+SOFTMAX = 25
+FULLY_CONNECTED_OPTIONS = 8
+SOFTMAX_OPTIONS = 9
+RELU = 1
+
+
+def fb_int_vector(b, values):
+    b.StartVector(4, len(values), 4)
+    for value in reversed(values):
+        b.PrependInt32(value)
+    return b.EndVector()
+
+
+def fb_offset_vector(b, offsets):
+    b.StartVector(4, len(offsets), 4)
+    for offset in reversed(offsets):
+        b.PrependUOffsetTRelative(offset)
+    return b.EndVector()
+
+
+def fb_buffer(b, data):
+    data_off = None
+    if data is not None:
+        raw = data.astype('<f4').tobytes()
+        # Buffer.data is force_align: 16
+        b.StartVector(1, len(raw), 16)
+        b.head -= len(raw)
+        b.Bytes[b.head:b.head + len(raw)] = raw
+        data_off = b.EndVector()
+    b.StartObject(1)
+    if data_off is not None:
+        b.PrependUOffsetTRelativeSlot(0, data_off, 0)
+    return b.EndObject()
+
+
+def fb_tensor(b, name, shape, buffer):
+    name_off = b.CreateString(name)
+    shape_off = fb_int_vector(b, shape)
+    b.StartObject(4)
+    b.PrependUOffsetTRelativeSlot(0, shape_off, 0)
+    b.PrependInt8Slot(1, FLOAT32, 0)
+    b.PrependUint32Slot(2, buffer, 0)
+    b.PrependUOffsetTRelativeSlot(3, name_off, 0)
+    return b.EndObject()
+
+
+def fb_operator(b, opcode, inputs, outputs, options_type, options):
+    in_off = fb_int_vector(b, inputs)
+    out_off = fb_int_vector(b, outputs)
+    b.StartObject(5)
+    b.PrependUint32Slot(0, opcode, 0)
+    b.PrependUOffsetTRelativeSlot(1, in_off, 0)
+    b.PrependUOffsetTRelativeSlot(2, out_off, 0)
+    b.PrependUint8Slot(3, options_type, 0)
+    b.PrependUOffsetTRelativeSlot(4, options, 0)
+    return b.EndObject()
+
+
+def fb_opcode(b, code):
+    b.StartObject(4)
+    b.PrependInt8Slot(0, code, 0)
+    b.PrependInt32Slot(3, code, 0)
+    return b.EndObject()
+
+
+def write_tflite(params):
+    w1, b1, w2, b2 = params
+    b = flatbuffers.Builder(4096)
+
+    # Buffer 0 is the empty one of the tensors computed at run time
+    buffers = [fb_buffer(b, None)] + [fb_buffer(b, p) for p in params]
+
+    n_in, n_out = w1.shape[1], w2.shape[0]
+    tensors = [
+        fb_tensor(b, 'window', [1, n_in], 0),
+        fb_tensor(b, 'dense/weights', list(w1.shape), 1),
+        fb_tensor(b, 'dense/bias', list(b1.shape), 2),
+        fb_tensor(b, 'dense', [1, HIDDEN], 0),
+        fb_tensor(b, 'logits/weights', list(w2.shape), 3),
+        fb_tensor(b, 'logits/bias', list(b2.shape), 4),
+        fb_tensor(b, 'logits', [1, n_out], 0),
+        fb_tensor(b, 'classes', [1, n_out], 0),
+    ]
+
+    b.StartObject(1)
+    b.PrependInt8Slot(0, RELU, 0)
+    dense_options = b.EndObject()
+    b.StartObject(1)
+    b.PrependInt8Slot(0, 0, 0)
+    logits_options = b.EndObject()
+    b.StartObject(1)
+    b.PrependFloat32Slot(0, 1.0, 0.0)
+    softmax_options = b.EndObject()
+
+    operators = [
+        fb_operator(b, 0, [0, 1, 2], [3], FULLY_CONNECTED_OPTIONS,
+                    dense_options),
+        fb_operator(b, 0, [3, 4, 5], [6], FULLY_CONNECTED_OPTIONS,
+                    logits_options),
+        fb_operator(b, 1, [6], [7], SOFTMAX_OPTIONS, softmax_options),
+    ]
+
+    tensors_off = fb_offset_vector(b, tensors)
+    inputs_off = fb_int_vector(b, [0])
+    outputs_off = fb_int_vector(b, [7])
+    operators_off = fb_offset_vector(b, operators)
+    name_off = b.CreateString('main')
+    b.StartObject(5)
+    b.PrependUOffsetTRelativeSlot(0, tensors_off, 0)
+    b.PrependUOffsetTRelativeSlot(1, inputs_off, 0)
+    b.PrependUOffsetTRelativeSlot(2, outputs_off, 0)
+    b.PrependUOffsetTRelativeSlot(3, operators_off, 0)
+    b.PrependUOffsetTRelativeSlot(4, name_off, 0)
+    subgraph = b.EndObject()
+
+    opcodes_off = fb_offset_vector(b, [fb_opcode(b, FULLY_CONNECTED),
+                                       fb_opcode(b, SOFTMAX)])
+    subgraphs_off = fb_offset_vector(b, [subgraph])
+    description_off = b.CreateString(
+        'Room events: ' + ', '.join(LABELS) + '. scripts/room_model.py')
+    buffers_off = fb_offset_vector(b, buffers)
+    b.StartObject(5)
+    b.PrependUint32Slot(0, TFLITE_VERSION, 0)
+    b.PrependUOffsetTRelativeSlot(1, opcodes_off, 0)
+    b.PrependUOffsetTRelativeSlot(2, subgraphs_off, 0)
+    b.PrependUOffsetTRelativeSlot(3, description_off, 0)
+    b.PrependUOffsetTRelativeSlot(4, buffers_off, 0)
+    model = b.EndObject()
+    b.Finish(model, file_identifier=b'TFL3')
+    return bytes(b.Output())
+
+
+class FbTable:
+    '''Read access to a flatbuffer table by field index.'''
+
+    def __init__(self, buf, pos):
+        self.t = flatbuffers.table.Table(buf, pos)
+
+    def _off(self, field):
+        return self.t.Offset(4 + 2 * field)
+
+    def scalar(self, field, kind, default=0):
+        off = self._off(field)
+        return self.t.Get(kind, off + self.t.Pos) if off else default
+
+    def table(self, field):
+        off = self._off(field)
+        return FbTable(self.t.Bytes, self.t.Indirect(off + self.t.Pos)) \
+            if off else None
+
+    def tables(self, field):
+        off = self._off(field)
+        if not off:
+            return []
+        start = self.t.Vector(off)
+        return [FbTable(self.t.Bytes, self.t.Indirect(start + 4 * i))
+                for i in range(self.t.VectorLen(off))]
+
+    def ints(self, field):
+        off = self._off(field)
+        if not off:
+            return []
+        start = self.t.Vector(off)
+        return [flatbuffers.encode.Get(flatbuffers.packer.int32,
+                                       self.t.Bytes, start + 4 * i)
+                for i in range(self.t.VectorLen(off))]
+
+    def data(self, field):
+        off = self._off(field)
+        if not off:
+            return b''
+        start = self.t.Vector(off)
+        return bytes(self.t.Bytes[start:start + self.t.VectorLen(off)])
+
+
+def run_tflite(data, x):
+    '''Run the graph of a flatbuffer written by write_tflite() with numpy,
+    reading everything from the file.'''
+    N = flatbuffers.number_types
+    buf = bytearray(data)
+    if buf[4:8] != b'TFL3':
+        raise ValueError('not a TFLite flatbuffer')
+    model = FbTable(buf, flatbuffers.encode.Get(
+        flatbuffers.packer.uoffset, buf, 0))
+    if model.scalar(0, N.Uint32Flags) != TFLITE_VERSION:
+        raise ValueError('unexpected schema version')
+    codes = [c.scalar(3, N.Int32Flags) for c in model.tables(1)]
+    buffers = [b.data(0) for b in model.tables(4)]
+    subgraph = model.tables(2)[0]
+    tensors = subgraph.tables(0)
+    values = {}
+    for i, tensor in enumerate(tensors):
+        raw = buffers[tensor.scalar(2, N.Uint32Flags)]
+        if raw:
+            if raw and (len(raw) % 4 or tensor.scalar(1, N.Int8Flags)):
+                raise ValueError(f'tensor {i} is not float32')
+            values[i] = np.frombuffer(raw, '<f4').reshape(tensor.ints(0))
+    values[subgraph.ints(1)[0]] = x
+    for op in subgraph.tables(3):
+        code = codes[op.scalar(0, N.Uint32Flags)]
+        ins = [values[i] for i in op.ints(1)]
+        options = op.table(4)
+        if code == FULLY_CONNECTED:
+            out = ins[0] @ ins[1].T + ins[2]
+            if options.scalar(0, N.Int8Flags) == RELU:
+                out = np.maximum(out, 0)
+        elif code == SOFTMAX:
+            beta = options.scalar(0, N.Float32Flags)
+            e = np.exp(beta * (ins[0] - ins[0].max(axis=1, keepdims=True)))
+            out = e / e.sum(axis=1, keepdims=True)
+        else:
+            raise ValueError(f'unexpected operator {code}')
+        values[op.ints(2)[0]] = out
+    return values[subgraph.ints(2)[0]]
+
+
+# Outputs
+
+def write_windows(path, windows, trace_path):
+    rel = trace_path.relative_to(ROOT).as_posix()
+    lines = [
+        '/*',
+        ' * Copyright (c) 2025 John O\'Sullivan',
+        ' *',
+        ' * SPDX-License-Identifier: Apache-2.0',
+        ' */',
+        '',
+        '/*',
+        ' * Generated by scripts/room_model.py, do not edit. Windows around',
+        f' * the events of {rel}',
+        ' * and at quiet times.',
+        ' */',
+        '',
+        '#ifndef WEEK_WINDOWS_H_',
+        '#define WEEK_WINDOWS_H_',
+        '',
+        '#include <stdint.h>',
+        '',
+        f'#define WEEK_WINDOW {WINDOW}',
+        '',
+        'struct week_window {',
+        '\tconst char *label;',
+        '\tuint16_t period_s;',
+        '\tuint32_t change_s;',
+        '\tint32_t milli[WEEK_WINDOW][2];',
+        '};',
+        '',
+        'static const struct week_window week_windows[] = {',
+    ]
+    for label, period_s, change_s, w in windows:
+        lines.append(f'\t{{ "{LABELS[label]}", {period_s}, {change_s},')
+        pairs = [f'{{ {t}, {h} }}' for t, h in w]
+        row = '\t  {'
+        for pair in pairs:
+            if len(row.expandtabs(8)) + len(pair) + 2 > 80:
+                lines.append(row)
+                row = '\t   '
+            row += f' {pair},'
+        lines.append(row[:-1] + ' } },')
+    lines += ['};', '', '#endif /* WEEK_WINDOWS_H_ */', '']
+    path.write_text('\n'.join(lines))
+
+
+def confusion(y, predicted):
+    matrix = np.zeros((len(LABELS), len(LABELS)), dtype=int)
+    for truth, guess in zip(y, predicted):
+        matrix[truth, guess] += 1
+    return matrix
+
+
+def print_confusion(title, y, predicted):
+    matrix = confusion(y, predicted)
+    print(f'{title}: {100.0 * np.mean(y == predicted):.1f}% correct '
+          f'of {len(y)}')
+    for i, row in enumerate(matrix):
+        print(f'  {LABELS[i]:<8}' + ''.join(f' {n:4d}' for n in row))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--seed', type=int, default=1,
+                        help='seed of the training set (default: '
+                        '%(default)s)')
+    parser.add_argument('--per-class', type=int, default=3000,
+                        help='training windows per class (default: '
+                        '%(default)s)')
+    parser.add_argument('--epochs', type=int, default=60,
+                        help='training epochs (default: %(default)s)')
+    args = parser.parse_args()
+
+    rng = np.random.default_rng(args.seed)
+    x, y = synth_set(rng, args.per_class)
+    x_check, y_check = synth_set(rng, args.per_class // 5)
+    params = train(x, y, rng, args.epochs)
+
+    data = write_tflite(params)
+    MODEL.parent.mkdir(exist_ok=True)
+    MODEL.write_bytes(data)
+
+    # Everything below runs the file just written
+    data = MODEL.read_bytes()
+    _, expected = forward(params, x_check)
+    got = run_tflite(data, x_check)
+    if not np.allclose(got, expected, atol=1e-5):
+        sys.exit('room_model: the flatbuffer does not hold the network')
+
+    windows = week_windows(read_trace(TRACE))
+    write_windows(WINDOWS, windows, TRACE)
+    x_week, y_week = week_set(windows)
+
+    print(f'{MODEL.relative_to(ROOT)}: {len(data)} bytes')
+    print(f'{WINDOWS.relative_to(ROOT)}: {len(windows)} windows')
+    print_confusion('synthetic, held out', y_check,
+                    run_tflite(data, x_check).argmax(axis=1))
+    print_confusion('sim/week.csv', y_week,
+                    run_tflite(data, x_week).argmax(axis=1))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,109 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''sntp_standin.py
+
+Minimal SNTP (RFC 4330) server used as a stand-in for an NTP pool server,
+so the timesync library can be exercised on the LAN or against native_sim
+without root privileges or extra Python packages.
+
+Every client request is answered with the host clock, shifted by an offset.
+--offsets takes a comma-separated list of offsets in milliseconds applied to
+successive replies, the last one sticking, so a test can make the clock
+drift or jump between synchronizations. --drop-every N silently drops every
+Nth request to exercise retries.
+
+Example:
+
+  python scripts/sntp_standin.py --port 12300
+  # then build with CONFIG_TIMESYNC_SERVER="<host ip>"
+  #   CONFIG_TIMESYNC_PORT=12300
+'''
+
+import argparse
+import asyncio
+import struct
+import time
+
+# Seconds between the NTP era (1900) and the Unix epoch
+NTP_EPOCH_OFFSET = 2208988800
+
+MODE_CLIENT = 3
+MODE_SERVER = 4
+STRATUM = 2
+
+PACKET = struct.Struct('!BBbbII4sIIIIIIII')
+
+
+def ntp_timestamp(unix_s):
+    seconds = int(unix_s)
+    fraction = int((unix_s - seconds) * (1 << 32)) & 0xffffffff
+    return (seconds + NTP_EPOCH_OFFSET) & 0xffffffff, fraction
+
+
+class Standin(asyncio.DatagramProtocol):
+
+    def __init__(self, args):
+        self.args = args
+        self.offsets = [int(v) for v in args.offsets.split(',')]
+        self.requests = 0
+        self.replies = 0
+
+    def connection_made(self, transport):
+        self.transport = transport
+
+    def datagram_received(self, data, peer):
+        received = time.time()
+        self.requests += 1
+
+        if len(data) < PACKET.size or data[0] & 7 != MODE_CLIENT:
+            return
+        if self.args.drop_every and self.requests % self.args.drop_every == 0:
+            print(f'SNTP {peer[0]}:{peer[1]} dropped', flush=True)
+            return
+
+        offset_ms = self.offsets[min(self.replies, len(self.offsets) - 1)]
+        self.replies += 1
+
+        version = (data[0] >> 3) & 7
+        # The client's transmit timestamp comes back as the originate one
+        orig_s, orig_f = struct.unpack_from('!II', data, 40)
+        recv_s, recv_f = ntp_timestamp(received + offset_ms / 1000)
+        tx_s, tx_f = ntp_timestamp(time.time() + offset_ms / 1000)
+
+        reply = PACKET.pack((version << 3) | MODE_SERVER, STRATUM, 4, -20,
+                            0, 0, b'LOCL', tx_s, tx_f, orig_s, orig_f,
+                            recv_s, recv_f, tx_s, tx_f)
+        self.transport.sendto(reply, peer)
+        print(f'SNTP {peer[0]}:{peer[1]} offset {offset_ms} ms', flush=True)
+
+
+async def serve(args):
+    loop = asyncio.get_running_loop()
+    await loop.create_datagram_endpoint(lambda: Standin(args),
+                                        local_addr=(args.bind, args.port))
+    print(f'sntp-standin listening on {args.bind}:{args.port}', flush=True)
+    await asyncio.Event().wait()
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--bind', default='0.0.0.0',
+                        help='address to listen on (default: %(default)s)')
+    parser.add_argument('--port', type=int, default=123,
+                        help='port to listen on (default: %(default)s)')
+    parser.add_argument('--offsets', default='0', metavar='MS[,MS...]',
+                        help='clock offset of successive replies, in ms')
+    parser.add_argument('--drop-every', type=int, default=0, metavar='N',
+                        help='drop every Nth request')
+    args = parser.parse_args()
+
+    try:
+        asyncio.run(serve(args))
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,124 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''tls_standin.py
+
+HTTPS variant of http_standin.py, used to measure what TLS costs the
+uplink: every connection prints one line with the negotiated protocol and
+cipher, whether the session was resumed, and how long the handshake took
+as seen from the server (which includes the device's key exchange work).
+
+  TLS 127.0.0.1:40112 TLSv1.2 ECDHE-ECDSA-AES128-GCM-SHA256 full 41.2 ms
+  TLS 127.0.0.1:40114 TLSv1.2 ECDHE-ECDSA-AES128-GCM-SHA256 resumed 1.3 ms
+
+Without --cert, a throw-away self-signed P-256 certificate is generated with
+the openssl command line tool; build the device with
+CONFIG_UPLINK_TLS_VERIFY_PEER=n in that case. TLS is capped at 1.2, like the
+device's IPPROTO_TLS_1_2 sockets. Sessions are resumed through session
+tickets (RFC 5077) only, as Python's server keeps no session ID cache, so
+the device's mbedTLS needs MBEDTLS_SSL_SESSION_TICKETS. --psk serves
+TLS-PSK instead of certificates (needs Python 3.13 or later).
+
+Example:
+
+  python scripts/tls_standin.py --port 8443
+  # then build with CONFIG_UPLINK_HTTP_TLS=y CONFIG_UPLINK_PORT=8443
+  #   CONFIG_UPLINK_HOST="<host ip>" CONFIG_UPLINK_TLS_VERIFY_PEER=n
+'''
+
+import argparse
+import os
+import ssl
+import subprocess
+import sys
+import tempfile
+import time
+from http.server import ThreadingHTTPServer
+
+from http_standin import StandinHandler, init_server
+
+
+class TlsHandler(StandinHandler):
+    server_version = 'tls-standin/1.0'
+
+    def setup(self):
+        start = time.monotonic()
+        try:
+            self.request.do_handshake()
+        except (ssl.SSLError, OSError) as e:
+            print(f'TLS {self.client_address[0]}:{self.client_address[1]} '
+                  f'handshake failed: {e}', flush=True)
+            raise
+        elapsed = (time.monotonic() - start) * 1000
+
+        cipher = self.request.cipher()
+        print(f'TLS {self.client_address[0]}:{self.client_address[1]} '
+              f'{self.request.version()} {cipher[0] if cipher else "?"} '
+              f'{"resumed" if self.request.session_reused else "full"} '
+              f'{elapsed:.1f} ms', flush=True)
+        super().setup()
+
+    def log_message(self, format, *args):
+        print('%s - %s' % (self.address_string(), format % args), flush=True)
+
+
+def self_signed(directory):
+    cert = os.path.join(directory, 'cert.pem')
+    key = os.path.join(directory, 'key.pem')
+    subprocess.run(['openssl', 'req', '-x509', '-newkey', 'ec',
+                    '-pkeyopt', 'ec_paramgen_curve:prime256v1', '-nodes',
+                    '-keyout', key, '-out', cert, '-days', '1',
+                    '-subj', '/CN=localhost',
+                    '-addext', 'subjectAltName=DNS:localhost,IP:127.0.0.1'],
+                   check=True, capture_output=True)
+    return cert, key
+
+
+def make_context(args, directory):
+    ctx = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    ctx.maximum_version = ssl.TLSVersion.TLSv1_2
+
+    if args.psk:
+        if not hasattr(ctx, 'set_psk_server_callback'):
+            sys.exit('--psk needs Python 3.13 or later')
+        identity, _, key = args.psk.partition(':')
+        secret = bytes.fromhex(key)
+        ctx.set_ciphers('PSK')
+        ctx.set_psk_server_callback(
+            lambda ident: secret if ident == identity else b'')
+        return ctx
+
+    cert, key = (args.cert, args.key) if args.cert else self_signed(directory)
+    ctx.load_cert_chain(cert, key)
+    return ctx
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--bind', default='0.0.0.0',
+                        help='address to listen on (default: %(default)s)')
+    parser.add_argument('--port', type=int, default=8443,
+                        help='port to listen on (default: %(default)s)')
+    parser.add_argument('--cert', help='PEM certificate chain')
+    parser.add_argument('--key', help='PEM private key for --cert')
+    parser.add_argument('--psk', metavar='IDENTITY:HEXKEY',
+                        help='serve TLS-PSK instead of certificates')
+    args = parser.parse_args()
+
+    with tempfile.TemporaryDirectory() as directory:
+        ctx = make_context(args, directory)
+
+        server = ThreadingHTTPServer((args.bind, args.port), TlsHandler)
+        server.socket = ctx.wrap_socket(server.socket, server_side=True,
+                                        do_handshake_on_connect=False)
+        init_server(server)
+        print(f'tls-standin listening on {args.bind}:{args.port}', flush=True)
+        try:
+            server.serve_forever()
+        except KeyboardInterrupt:
+            pass
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,618 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''trace_report.py
+
+Per-stage latency breakdown and timeline of a CTF trace recorded with the
+stage tracepoints of lib/tracepoints, without babeltrace or other packages.
+
+The stream is decoded with the TSDL metadata Zephyr ships for its CTF
+format, read from the trace directory if a copy is there, from --metadata,
+or from $ZEPHYR_BASE/subsys/tracing/ctf/tsdl/metadata. Tracepoints are named
+events whose first argument is the phase (0 begin, 1 end) and second the
+id of the instance; a begin and an end of the same name and id make a span.
+Thread switches, when traced, tell which thread each span ran on and give
+the timeline a track per thread.
+
+The breakdown lists every stage with the number of spans and their total,
+mean, median, 95th percentile and longest duration. --timeline writes the
+spans in the Chrome trace event format, which ui.perfetto.dev and
+chrome://tracing open.
+
+Example, after running a native_sim build with tracing.conf:
+
+  python scripts/trace_report.py build/zephyr/channel0_0 \\
+      --timeline trace.json
+'''
+
+import argparse
+import json
+import os
+import re
+import sys
+from pathlib import Path
+
+NAMED_EVENT = 'named_event'
+SWITCHED_IN = 'thread_switched_in'
+SWITCHED_OUT = 'thread_switched_out'
+
+PHASE_BEGIN = 0
+PHASE_END = 1
+
+ZEPHYR_METADATA = Path('subsys') / 'tracing' / 'ctf' / 'tsdl' / 'metadata'
+
+
+class MetadataError(Exception):
+    pass
+
+
+# --------------------------------------------------------------------------
+# TSDL metadata: only what Zephyr's CTF format uses, a packet-less stream of
+# events made of integers, enumerations, strings and fixed-size arrays
+# --------------------------------------------------------------------------
+
+class Int:
+    def __init__(self, size, signed=False, align=8):
+        self.size = size
+        self.signed = signed
+        self.align = align
+
+
+class Str:
+    align = 8
+
+
+class Array:
+    def __init__(self, elem, length):
+        self.elem = elem
+        self.length = length
+        self.align = elem.align
+
+
+class Struct:
+    def __init__(self, fields):
+        self.fields = fields
+        self.align = max((t.align for _, t in fields), default=8)
+
+
+TOKEN_RE = re.compile(r'''
+    (?P<string>"(?:[^"\\]|\\.)*")
+  | (?P<number>0[xX][0-9a-fA-F]+|\d+)
+  | (?P<ident>[A-Za-z_][A-Za-z0-9_.]*)
+  | (?P<punct>:=|[{}\[\];:=,()<>-])
+''', re.VERBOSE)
+
+
+def tokenize(text):
+    text = re.sub(r'/\*.*?\*/', ' ', text, flags=re.S)
+    text = re.sub(r'//[^\n]*', ' ', text)
+    tokens = []
+    pos = 0
+    while pos < len(text):
+        if text[pos].isspace():
+            pos += 1
+            continue
+        m = TOKEN_RE.match(text, pos)
+        if m is None:
+            raise MetadataError(f'unexpected {text[pos:pos + 20]!r}')
+        tokens.append(m.group(0))
+        pos = m.end()
+    return tokens
+
+
+class Metadata:
+    '''Event layouts parsed from a TSDL metadata file.'''
+
+    def __init__(self, data):
+        if data[:4] == b'\x57\x1d\xd1\x75':
+            raise MetadataError('packetized metadata is not supported')
+        self.tokens = tokenize(data.decode(errors='replace'))
+        self.pos = 0
+        self.aliases = {}
+        self.named_types = {}
+        self.header = None
+        self.events = {}
+        self.clock_freq = 1000000000
+        self.little_endian = True
+        while self.pos < len(self.tokens):
+            self.statement()
+        if self.header is None:
+            raise MetadataError('no stream event header')
+
+    # Tokens
+
+    def peek(self, offset=0):
+        i = self.pos + offset
+        return self.tokens[i] if i < len(self.tokens) else None
+
+    def next(self):
+        tok = self.peek()
+        if tok is None:
+            raise MetadataError('unexpected end of metadata')
+        self.pos += 1
+        return tok
+
+    def expect(self, tok):
+        got = self.next()
+        if got != tok:
+            raise MetadataError(f'expected {tok!r}, got {got!r}')
+
+    def skip_block(self):
+        '''Skip a {...} block, the opening brace being next.'''
+        self.expect('{')
+        depth = 1
+        while depth:
+            tok = self.next()
+            depth += {'{': 1, '}': -1}.get(tok, 0)
+
+    def attributes(self):
+        '''key = value; pairs of a {...} block, values as token lists.'''
+        attrs = {}
+        self.expect('{')
+        while self.peek() != '}':
+            key = self.next()
+            self.expect('=')
+            value = []
+            while self.peek() != ';':
+                value.append(self.next())
+            self.expect(';')
+            attrs[key] = value
+        self.expect('}')
+        return attrs
+
+    # Statements
+
+    def statement(self):
+        tok = self.peek()
+        if tok == 'typealias':
+            self.next()
+            target = self.type_spec()
+            self.expect(':=')
+            name = self.type_name()
+            self.aliases[name] = target
+            self.expect(';')
+        elif tok in ('struct', 'enum', 'integer', 'string'):
+            self.type_spec()
+            self.expect(';')
+        elif tok == 'typedef':
+            self.next()
+            target = self.type_spec()
+            name, typ = self.declarator(target)
+            self.aliases[name] = typ
+            self.expect(';')
+        elif tok == 'trace':
+            self.next()
+            attrs = self.attributes()
+            self.little_endian = attrs.get('byte_order', ['le'])[0] != 'be'
+            self.expect(';')
+        elif tok == 'clock':
+            self.next()
+            attrs = self.attributes()
+            if 'freq' in attrs:
+                self.clock_freq = int(attrs['freq'][0], 0)
+            self.expect(';')
+        elif tok == 'stream':
+            self.next()
+            self.stream()
+            self.expect(';')
+        elif tok == 'event':
+            self.next()
+            self.event()
+            self.expect(';')
+        else:
+            # env, callsite and anything else carry nothing to decode
+            self.next()
+            if self.peek() == '{':
+                self.skip_block()
+            while self.peek() is not None and self.next() != ';':
+                pass
+
+    def stream(self):
+        self.expect('{')
+        while self.peek() != '}':
+            key = self.next()
+            self.expect(':=')
+            typ = self.type_spec()
+            self.expect(';')
+            if key == 'event.header':
+                self.header = typ
+            elif key.startswith('packet.'):
+                raise MetadataError(f'{key} is not supported')
+        self.expect('}')
+
+    def event(self):
+        name = None
+        event_id = None
+        fields = Struct([])
+        self.expect('{')
+        while self.peek() != '}':
+            key = self.next()
+            if key == 'fields':
+                self.expect(':=')
+                fields = self.type_spec()
+            else:
+                self.expect('=')
+                value = []
+                while self.peek() != ';':
+                    value.append(self.next())
+                if key == 'name':
+                    name = ''.join(value).strip('"')
+                elif key == 'id':
+                    event_id = int(value[0], 0)
+            self.expect(';')
+        self.expect('}')
+        if name is None or event_id is None:
+            raise MetadataError('event without a name or an id')
+        self.events[event_id] = (name, fields)
+
+    # Types
+
+    def type_name(self):
+        '''A possibly multi-word type name, e.g. "unsigned int".'''
+        words = [self.next()]
+        while self.peek() != ';':
+            words.append(self.next())
+        return ' '.join(words)
+
+    def type_spec(self):
+        tok = self.next()
+        if tok == 'integer':
+            attrs = self.attributes()
+            return Int(int(attrs['size'][0], 0),
+                       attrs.get('signed', ['false'])[0] in ('true', '1'),
+                       int(attrs.get('align', ['8'])[0], 0))
+        if tok == 'string':
+            if self.peek() == '{':
+                self.skip_block()
+            return Str()
+        if tok == 'struct':
+            return self.struct_spec()
+        if tok == 'enum':
+            return self.enum_spec()
+        if tok == 'floating_point':
+            attrs = self.attributes()
+            return Int(int(attrs['exp_dig'][0], 0) +
+                       int(attrs['mant_dig'][0], 0),
+                       align=int(attrs.get('align', ['8'])[0], 0))
+        name = tok
+        while self.peek() not in (None, ';', ':=', '[') and \
+                self.peek(1) not in (';', '[', ':='):
+            name += ' ' + self.next()
+        if name not in self.aliases:
+            raise MetadataError(f'unknown type {name!r}')
+        return self.aliases[name]
+
+    def struct_spec(self):
+        name = None
+        if self.peek() != '{':
+            name = self.next()
+            if self.peek() != '{':
+                return self.named_types[('struct', name)]
+        self.expect('{')
+        fields = []
+        while self.peek() != '}':
+            fields.append(self.declarator(self.type_spec()))
+            self.expect(';')
+        self.expect('}')
+        if self.peek() == 'align':
+            self.next()
+            self.expect('(')
+            self.next()
+            self.expect(')')
+        typ = Struct(fields)
+        if name is not None:
+            self.named_types[('struct', name)] = typ
+        return typ
+
+    def enum_spec(self):
+        name = None
+        if self.peek() not in (':', '{'):
+            name = self.next()
+            if self.peek() not in (':', '{'):
+                return self.named_types[('enum', name)]
+        base = self.aliases.get('int', Int(32, True))
+        if self.peek() == ':':
+            self.next()
+            base = self.type_spec()
+        self.skip_block()
+        if name is not None:
+            self.named_types[('enum', name)] = base
+        return base
+
+    def declarator(self, typ):
+        name = self.next()
+        lengths = []
+        while self.peek() == '[':
+            self.next()
+            lengths.append(self.next())
+            self.expect(']')
+        for length in reversed(lengths):
+            if not re.fullmatch(r'0[xX][0-9a-fA-F]+|\d+', length):
+                raise MetadataError(f'sequence {name}[{length}] is not '
+                                    f'supported')
+            typ = Array(typ, int(length, 0))
+        return name, typ
+
+
+# --------------------------------------------------------------------------
+# Event stream
+# --------------------------------------------------------------------------
+
+class Decoder:
+    def __init__(self, meta, data):
+        self.meta = meta
+        self.data = data
+        self.pos = 0
+        self.order = '<' if meta.little_endian else '>'
+
+    def align(self, bits):
+        step = max(bits // 8, 1)
+        self.pos = (self.pos + step - 1) // step * step
+
+    def read(self, typ):
+        self.align(typ.align)
+        if isinstance(typ, Int):
+            if typ.size % 8:
+                raise MetadataError('bit fields are not supported')
+            size = typ.size // 8
+            raw = self.data[self.pos:self.pos + size]
+            if len(raw) < size:
+                raise EOFError
+            self.pos += size
+            return int.from_bytes(raw, 'little' if self.order == '<'
+                                  else 'big', signed=typ.signed)
+        if isinstance(typ, Str):
+            end = self.data.find(b'\0', self.pos)
+            if end < 0:
+                raise EOFError
+            value = self.data[self.pos:end].decode(errors='replace')
+            self.pos = end + 1
+            return value
+        if isinstance(typ, Array):
+            if isinstance(typ.elem, Int) and typ.elem.size == 8:
+                raw = self.data[self.pos:self.pos + typ.length]
+                if len(raw) < typ.length:
+                    raise EOFError
+                self.pos += typ.length
+                return raw.split(b'\0', 1)[0].decode(errors='replace')
+            return [self.read(typ.elem) for _ in range(typ.length)]
+        values = {name: self.read(t) for name, t in typ.fields}
+        if len(typ.fields) == 1 and isinstance(typ.fields[0][1], Array):
+            # Zephyr bounds its strings in a struct of a single char array
+            return next(iter(values.values()))
+        return values
+
+    def events(self):
+        '''(timestamp in cycles of the trace clock, name, fields).'''
+        while self.pos < len(self.data):
+            start = self.pos
+            try:
+                header = self.read(self.meta.header)
+                event_id = header['id']
+                if event_id not in self.meta.events:
+                    raise MetadataError(f'unknown event id {event_id} at '
+                                        f'offset {start}')
+                name, fields = self.meta.events[event_id]
+                values = self.read(fields)
+            except EOFError:
+                # Cut short by the end of the recording
+                return
+            yield header['timestamp'], name, values
+
+
+def unwrap(timestamps, bits):
+    '''Make timestamps of a counter that wraps around monotonic.'''
+    offset = 0
+    last = None
+    for ts in timestamps:
+        if last is not None and ts < last:
+            offset += 1 << bits
+        last = ts
+        yield ts + offset
+
+
+def load(trace, metadata=None):
+    trace = Path(trace)
+    if trace.is_dir():
+        streams = sorted(p for p in trace.iterdir()
+                         if p.name.startswith('channel'))
+        if not streams:
+            raise FileNotFoundError(f'no channel stream in {trace}')
+        stream = streams[0]
+    else:
+        stream = trace
+
+    if metadata is None:
+        candidates = [stream.parent / 'metadata']
+        if 'ZEPHYR_BASE' in os.environ:
+            candidates.append(Path(os.environ['ZEPHYR_BASE']) /
+                              ZEPHYR_METADATA)
+        metadata = next((p for p in candidates if p.is_file()), None)
+        if metadata is None:
+            raise FileNotFoundError('no metadata next to the stream and '
+                                    'ZEPHYR_BASE not set, use --metadata')
+
+    meta = Metadata(Path(metadata).read_bytes())
+    events = list(Decoder(meta, stream.read_bytes()).events())
+    ts_bits = dict(meta.header.fields)['timestamp'].size
+    timestamps = unwrap((ts for ts, _, _ in events), ts_bits)
+    scale = 1e6 / meta.clock_freq
+    return [(ts * scale, name, values)
+            for ts, (_, name, values) in zip(timestamps, events)]
+
+
+# --------------------------------------------------------------------------
+# Spans and reports, times in microseconds
+# --------------------------------------------------------------------------
+
+class Span:
+    def __init__(self, name, ident, begin, thread):
+        self.name = name
+        self.ident = ident
+        self.begin = begin
+        self.end = None
+        self.thread = thread
+
+    @property
+    def duration(self):
+        return self.end - self.begin
+
+
+def spans_of(events):
+    '''Spans of the tracepoints, and run slices of the threads.
+
+    Returns (spans, slices, unmatched) where slices are (thread, begin, end)
+    and unmatched counts tracepoints missing their other half.
+    '''
+    spans = []
+    slices = []
+    open_spans = {}
+    unmatched = 0
+    running = None
+    running_since = None
+
+    for ts, name, fields in events:
+        if name == SWITCHED_IN:
+            running = fields.get('name') or f'{fields["thread_id"]:#x}'
+            running_since = ts
+        elif name == SWITCHED_OUT:
+            if running is not None:
+                slices.append((running, running_since, ts))
+            running = None
+        elif name == NAMED_EVENT:
+            key = (fields['name'], fields['arg1'])
+            if fields['arg0'] == PHASE_BEGIN:
+                if key in open_spans:
+                    unmatched += 1
+                open_spans[key] = Span(fields['name'], fields['arg1'], ts,
+                                       running)
+            elif fields['arg0'] == PHASE_END:
+                span = open_spans.pop(key, None)
+                if span is None:
+                    unmatched += 1
+                    continue
+                span.end = ts
+                spans.append(span)
+
+    unmatched += len(open_spans)
+    spans.sort(key=lambda s: s.begin)
+    return spans, slices, unmatched
+
+
+def percentile(values, fraction):
+    '''Nearest-rank percentile of sorted values.'''
+    rank = max(int(round(fraction * len(values) + 0.5)) - 1, 0)
+    return values[min(rank, len(values) - 1)]
+
+
+def breakdown(spans):
+    '''Statistics per stage, in order of first appearance.'''
+    stages = {}
+    for span in spans:
+        stages.setdefault(span.name, []).append(span.duration)
+
+    rows = []
+    for name, durations in stages.items():
+        durations.sort()
+        rows.append({
+            'stage': name,
+            'count': len(durations),
+            'total_us': sum(durations),
+            'mean_us': sum(durations) / len(durations),
+            'p50_us': percentile(durations, 0.50),
+            'p95_us': percentile(durations, 0.95),
+            'max_us': durations[-1],
+        })
+    return rows
+
+
+def print_breakdown(rows, span_us, unmatched):
+    print(f'{"stage":<20} {"count":>6} {"total ms":>10} {"mean ms":>9} '
+          f'{"p50 ms":>9} {"p95 ms":>9} {"max ms":>9} {"share":>6}')
+    for row in rows:
+        share = 100.0 * row['total_us'] / span_us if span_us else 0.0
+        print(f'{row["stage"]:<20} {row["count"]:>6} '
+              f'{row["total_us"] / 1000:>10.3f} '
+              f'{row["mean_us"] / 1000:>9.3f} '
+              f'{row["p50_us"] / 1000:>9.3f} '
+              f'{row["p95_us"] / 1000:>9.3f} '
+              f'{row["max_us"] / 1000:>9.3f} {share:>5.1f}%')
+    print(f'Share of the {span_us / 1000:.3f} ms from the first span to the '
+          f'last; nested stages count in both')
+    if unmatched:
+        print(f'{unmatched} tracepoints without their begin or end, e.g. '
+              f'cut off by the end of the recording')
+
+
+def timeline(spans, slices):
+    '''Chrome trace events: a track per stage, and one per thread.'''
+    events = [
+        {'ph': 'M', 'name': 'process_name', 'pid': 1,
+         'args': {'name': 'Stages'}},
+        {'ph': 'M', 'name': 'process_name', 'pid': 2,
+         'args': {'name': 'Threads'}},
+    ]
+    tracks = {}
+
+    def track(pid, name):
+        if (pid, name) not in tracks:
+            tracks[(pid, name)] = len(tracks) + 1
+            events.append({'ph': 'M', 'name': 'thread_name', 'pid': pid,
+                           'tid': tracks[(pid, name)],
+                           'args': {'name': name}})
+        return tracks[(pid, name)]
+
+    for span in spans:
+        events.append({'ph': 'X', 'name': span.name, 'pid': 1,
+                       'tid': track(1, span.name), 'ts': span.begin,
+                       'dur': span.duration,
+                       'args': {'id': f'{span.ident:#x}',
+                                'thread': span.thread}})
+    for thread, begin, end in slices:
+        events.append({'ph': 'X', 'name': thread, 'pid': 2,
+                       'tid': track(2, thread), 'ts': begin,
+                       'dur': end - begin})
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ms'}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+        formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('trace',
+                        help='CTF stream (e.g. channel0_0) or trace directory')
+    parser.add_argument('--metadata', metavar='FILE',
+                        help='TSDL metadata of the stream')
+    parser.add_argument('--timeline', metavar='FILE',
+                        help='write a Chrome/Perfetto timeline here')
+    parser.add_argument('--json', metavar='FILE',
+                        help='write the breakdown here as JSON')
+    args = parser.parse_args()
+
+    try:
+        events = load(args.trace, args.metadata)
+    except (OSError, MetadataError) as e:
+        sys.exit(f'trace_report: {e}')
+
+    spans, slices, unmatched = spans_of(events)
+    if not spans:
+        sys.exit('trace_report: no tracepoints in the trace, was it built '
+                 'with CONFIG_TRACEPOINTS?')
+
+    rows = breakdown(spans)
+    span_us = max(s.end for s in spans) - spans[0].begin
+    print_breakdown(rows, span_us, unmatched)
+
+    if args.json:
+        with open(args.json, 'w') as f:
+            json.dump({'stages': rows, 'span_us': span_us,
+                       'unmatched': unmatched}, f, indent=2)
+    if args.timeline:
+        with open(args.timeline, 'w') as f:
+            json.dump(timeline(spans, slices), f)
+        print(f'Timeline written to {args.timeline}, open it in '
+              f'ui.perfetto.dev')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test blink-gpio-led-group driver
+ *
+ * Two LEDs share one 10 ms tick. Every transition must land on that tick,
+ * whenever the LED was started, and pattern steps are rounded to it.
+ */
+
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/ztest.h>
+
+#include <app/drivers/blink.h>
+
+#define LED_A_NODE DT_NODELABEL(group_led_a)
+#define LED_B_NODE DT_NODELABEL(group_led_b)
+#define TICK_MS DT_PROP(DT_PARENT(LED_A_NODE), tick_ms)
+
+#define TOLERANCE_MS 2
+#define MAX_EDGES 32
+
+static const struct device *const led_a = DEVICE_DT_GET(LED_A_NODE);
+static const struct device *const led_b = DEVICE_DT_GET(LED_B_NODE);
+static const struct device *const port =
+	DEVICE_DT_GET(DT_GPIO_CTLR(LED_A_NODE, led_gpios));
+
+static uint32_t edges_a[MAX_EDGES];
+static uint32_t edges_b[MAX_EDGES];
+static size_t num_a;
+static size_t num_b;
+
+/* Logical LED levels; B is wired active low */
+static int level_a(void)
+{
+	return gpio_emul_output_get(port, DT_GPIO_PIN(LED_A_NODE, led_gpios));
+}
+
+static int level_b(void)
+{
+	return !gpio_emul_output_get(port, DT_GPIO_PIN(LED_B_NODE, led_gpios));
+}
+
+static void record(int64_t start, uint32_t duration_ms)
+{
+	int last_a = level_a();
+	int last_b = level_b();
+
+	num_a = 0;
+	num_b = 0;
+
+	while (k_uptime_get() - start < duration_ms) {
+		uint32_t now = (uint32_t)(k_uptime_get() - start);
+		int a = level_a();
+		int b = level_b();
+
+		if (a != last_a && num_a < MAX_EDGES) {
+			edges_a[num_a++] = now;
+		}
+		if (b != last_b && num_b < MAX_EDGES) {
+			edges_b[num_b++] = now;
+		}
+		last_a = a;
+		last_b = b;
+		k_busy_wait(100);
+	}
+}
+
+/* Distance of @p t from the tick grid that @p ref lies on */
+static uint32_t off_grid(uint32_t t, uint32_t ref)
+{
+	uint32_t phase = (t - ref) % TICK_MS;
+
+	return MIN(phase, TICK_MS - phase);
+}
+
+ZTEST(blink_gpio_led_group, test_phase_aligned)
+{
+	int64_t start;
+
+	start = k_uptime_get();
+	zassert_ok(blink_set_period_ms(led_a, 100));
+
+	/* Start B off the grid, it must still toggle on A's ticks */
+	k_msleep(33);
+	zassert_ok(blink_set_period_ms(led_b, 50));
+
+	record(start, 520);
+
+	zassert_equal(num_a, 5, "%zu toggles of A, expected 5", num_a);
+	zassert_true(num_b >= 8, "%zu toggles of B, expected at least 8",
+		     num_b);
+
+	for (size_t i = 0; i < num_a; i++) {
+		zassert_within(edges_a[i], (i + 1) * 100, TOLERANCE_MS,
+			       "A toggled at %u ms", edges_a[i]);
+	}
+	for (size_t i = 0; i < num_b; i++) {
+		zassert_true(off_grid(edges_b[i], edges_a[0]) <= TOLERANCE_MS,
+			     "B toggled at %u ms, off the tick grid", edges_b[i]);
+		if (i > 0) {
+			zassert_within(edges_b[i] - edges_b[i - 1], 50,
+				       TOLERANCE_MS);
+		}
+	}
+}
+
+ZTEST(blink_gpio_led_group, test_pattern_rounded_to_ticks)
+{
+	static const struct blink_step steps[] = {
+		/* 25 ms rounds to 3 ticks, 35 ms to 4 */
+		{ .on_ms = 25, .off_ms = 35, .count = 2 },
+	};
+	const struct blink_pattern pattern = {
+		.steps = steps,
+		.num_steps = ARRAY_SIZE(steps),
+		.repeat = 1,
+	};
+	static const uint32_t expected[] = { 0, 30, 70, 100 };
+	int64_t start;
+
+	start = k_uptime_get();
+	zassert_ok(blink_set_pattern(led_a, &pattern));
+	record(start, 300);
+
+	zassert_equal(num_a, ARRAY_SIZE(expected), "%zu transitions", num_a);
+	zassert_true(edges_a[0] <= TICK_MS + TOLERANCE_MS,
+		     "pattern started %u ms late", edges_a[0]);
+	for (size_t i = 1; i < num_a; i++) {
+		zassert_within(edges_a[i] - edges_a[0], expected[i],
+			       TOLERANCE_MS, "transition %zu at +%u ms", i,
+			       edges_a[i] - edges_a[0]);
+	}
+	zassert_equal(level_a(), 0, "LED should be off once the pattern ends");
+}
+
+ZTEST(blink_gpio_led_group, test_active_low_and_steady)
+{
+	static const struct blink_step on[] = {
+		{ .on_ms = 100, .off_ms = 0, .count = 1 },
+	};
+	const struct blink_pattern pattern = {
+		.steps = on,
+		.num_steps = ARRAY_SIZE(on),
+		.repeat = BLINK_PATTERN_FOREVER,
+	};
+
+	zassert_equal(level_b(), 0, "active-low LED should start off");
+
+	zassert_ok(blink_set_pattern(led_b, &pattern));
+	zassert_equal(level_b(), 1);
+
+	zassert_ok(blink_set_period_ms(led_a, 30));
+	record(k_uptime_get(), 200);
+	zassert_true(num_a > 0, "A should blink");
+	zassert_equal(num_b, 0, "a steady LED must not be touched by ticks");
+
+	zassert_ok(blink_off(led_b));
+	zassert_equal(level_b(), 0);
+}
+
+ZTEST(blink_gpio_led_group, test_invalid_pattern)
+{
+	struct blink_pattern pattern = { 0 };
+
+	zassert_equal(blink_set_pattern(led_a, &pattern), -EINVAL);
+}
+
+static void *group_setup(void)
+{
+	zassert_true(device_is_ready(led_a), "LED A not ready");
+	zassert_true(device_is_ready(led_b), "LED B not ready");
+
+	return NULL;
+}
+
+static void group_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(blink_off(led_a));
+	zassert_ok(blink_off(led_b));
+	/* Let the shared timer notice it is idle */
+	k_msleep(2 * TICK_MS);
+}
+
+ZTEST_SUITE(blink_gpio_led_group, NULL, group_setup, group_before, NULL,
+	    NULL);
@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test blink-gpio-led driver
+ *
+ * This suite drives a blink-gpio-led instance wired to the GPIO emulator and
+ * checks the timing of every LED transition against the pattern it plays.
+ */
+
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/ztest.h>
+
+#include <app/drivers/blink.h>
+
+#define LED_NODE DT_NODELABEL(blink_led)
+#define LED_PIN DT_GPIO_PIN(LED_NODE, led_gpios)
+
+/* Allowed deviation of a transition from its nominal time */
+#define TOLERANCE_MS 2
+
+#define MAX_EDGES 64
+
+struct edge {
+	uint32_t t_ms;
+	int level;
+};
+
+static const struct device *const blink = DEVICE_DT_GET(LED_NODE);
+static const struct device *const port =
+	DEVICE_DT_GET(DT_GPIO_CTLR(LED_NODE, led_gpios));
+
+static struct edge edges[MAX_EDGES];
+static struct edge expected[MAX_EDGES];
+
+static int led_level(void)
+{
+	return gpio_emul_output_get(port, LED_PIN);
+}
+
+/* Record LED transitions until @p duration_ms after @p start */
+static size_t record(int64_t start, uint32_t duration_ms)
+{
+	int last = led_level();
+	size_t n = 0;
+
+	while (k_uptime_get() - start < duration_ms) {
+		int level = led_level();
+
+		if (level != last && n < MAX_EDGES) {
+			edges[n].t_ms = (uint32_t)(k_uptime_get() - start);
+			edges[n].level = level;
+			n++;
+		}
+		last = level;
+		k_busy_wait(100);
+	}
+
+	return n;
+}
+
+/* Transitions a pattern should produce, starting from an LED that is off */
+static size_t expand(const struct blink_pattern *p)
+{
+	uint32_t t = 0;
+	int level = 0;
+	size_t n = 0;
+
+	for (int pass = 0; pass < p->repeat; pass++) {
+		for (int i = 0; i < p->num_steps; i++) {
+			const struct blink_step *s = &p->steps[i];
+
+			for (int k = 0; k < MAX(s->count, 1); k++) {
+				if (s->on_ms > 0) {
+					if (level != 1 && t > 0) {
+						expected[n++] = (struct edge){ t, 1 };
+					}
+					level = 1;
+					t += s->on_ms;
+				}
+				if (s->off_ms > 0) {
+					if (level != 0) {
+						expected[n++] = (struct edge){ t, 0 };
+					}
+					level = 0;
+					t += s->off_ms;
+				}
+			}
+		}
+	}
+
+	if (level != 0) {
+		expected[n++] = (struct edge){ t, 0 };
+	}
+
+	return n;
+}
+
+static void check_edges(size_t n, size_t n_expected)
+{
+	for (size_t i = 0; i < MIN(n, n_expected); i++) {
+		zassert_equal(edges[i].level, expected[i].level,
+			      "edge %zu: level %d, expected %d", i, edges[i].level,
+			      expected[i].level);
+		zassert_within(edges[i].t_ms, expected[i].t_ms, TOLERANCE_MS,
+			       "edge %zu at %u ms, expected %u ms", i,
+			       edges[i].t_ms, expected[i].t_ms);
+	}
+	zassert_equal(n, n_expected, "%zu transitions, expected %zu", n,
+		      n_expected);
+}
+
+ZTEST(blink_gpio_led, test_pattern_timing)
+{
+	static const struct blink_step steps[] = {
+		{ .on_ms = 50, .off_ms = 50, .count = 3 },
+		{ .on_ms = 200, .off_ms = 100, .count = 1 },
+	};
+	const struct blink_pattern pattern = {
+		.steps = steps,
+		.num_steps = ARRAY_SIZE(steps),
+		.repeat = 2,
+	};
+	size_t n_expected = expand(&pattern);
+	int64_t start;
+	size_t n;
+
+	start = k_uptime_get();
+	zassert_ok(blink_set_pattern(blink, &pattern));
+	zassert_equal(led_level(), 1, "pattern should start with the LED on");
+
+	/* Twice 600 ms, then nothing more may happen */
+	n = record(start, 1500);
+
+	check_edges(n, n_expected);
+	zassert_equal(led_level(), 0, "LED should be off once the pattern ends");
+}
+
+ZTEST(blink_gpio_led, test_pattern_pauses_and_zero_count)
+{
+	static const struct blink_step steps[] = {
+		/* Start with a pause, then one 50 ms flash (count 0 is 1) */
+		{ .on_ms = 0, .off_ms = 100, .count = 1 },
+		{ .on_ms = 50, .off_ms = 0, .count = 0 },
+	};
+	const struct blink_pattern pattern = {
+		.steps = steps,
+		.num_steps = ARRAY_SIZE(steps),
+		.repeat = 1,
+	};
+	size_t n_expected = expand(&pattern);
+	int64_t start;
+	size_t n;
+
+	start = k_uptime_get();
+	zassert_ok(blink_set_pattern(blink, &pattern));
+	n = record(start, 300);
+
+	check_edges(n, n_expected);
+}
+
+ZTEST(blink_gpio_led, test_pattern_steps_copied)
+{
+	struct blink_step steps[] = {
+		{ .on_ms = 30, .off_ms = 70, .count = 2 },
+	};
+	const struct blink_pattern pattern = {
+		.steps = steps,
+		.num_steps = ARRAY_SIZE(steps),
+		.repeat = 1,
+	};
+	size_t n_expected = expand(&pattern);
+	int64_t start;
+	size_t n;
+
+	start = k_uptime_get();
+	zassert_ok(blink_set_pattern(blink, &pattern));
+
+	/* The driver must keep playing what it was given */
+	steps[0].on_ms = 500;
+	steps[0].count = 10;
+
+	n = record(start, 400);
+	check_edges(n, n_expected);
+}
+
+ZTEST(blink_gpio_led, test_steady_pattern)
+{
+	static const struct blink_step on[] = {
+		{ .on_ms = 100, .off_ms = 0, .count = 1 },
+	};
+	const struct blink_pattern pattern = {
+		.steps = on,
+		.num_steps = ARRAY_SIZE(on),
+		.repeat = BLINK_PATTERN_FOREVER,
+	};
+
+	zassert_ok(blink_set_pattern(blink, &pattern));
+	zassert_equal(led_level(), 1);
+	zassert_equal(record(k_uptime_get(), 500), 0,
+		      "a steady pattern should not toggle the LED");
+}
+
+ZTEST(blink_gpio_led, test_period_replaces_pattern)
+{
+	static const struct blink_step fast[] = {
+		{ .on_ms = 10, .off_ms = 10, .count = 1 },
+	};
+	const struct blink_pattern pattern = {
+		.steps = fast,
+		.num_steps = ARRAY_SIZE(fast),
+		.repeat = BLINK_PATTERN_FOREVER,
+	};
+	int64_t start;
+	size_t n;
+
+	zassert_ok(blink_set_pattern(blink, &pattern));
+	k_msleep(35);
+
+	start = k_uptime_get();
+	zassert_ok(blink_set_period_ms(blink, 100));
+	n = record(start, 450);
+
+	zassert_equal(n, 4, "%zu toggles in 450 ms at a 100 ms period", n);
+	for (size_t i = 0; i < n; i++) {
+		zassert_within(edges[i].t_ms, (i + 1) * 100, TOLERANCE_MS);
+	}
+
+	zassert_ok(blink_off(blink));
+	zassert_equal(led_level(), 0);
+	zassert_equal(record(k_uptime_get(), 250), 0, "LED should stay off");
+}
+
+ZTEST(blink_gpio_led, test_invalid_patterns)
+{
+	static const struct blink_step zero[] = {
+		{ .on_ms = 0, .off_ms = 0, .count = 5 },
+	};
+	static const struct blink_step many[CONFIG_BLINK_PATTERN_MAX_STEPS + 1] = {
+		[0] = { .on_ms = 10, .off_ms = 10 },
+	};
+	struct blink_pattern pattern = { 0 };
+
+	zassert_equal(blink_set_pattern(blink, &pattern), -EINVAL,
+		      "NULL steps accepted");
+
+	pattern.steps = zero;
+	zassert_equal(blink_set_pattern(blink, &pattern), -EINVAL,
+		      "empty pattern accepted");
+
+	pattern.num_steps = ARRAY_SIZE(zero);
+	zassert_equal(blink_set_pattern(blink, &pattern), -EINVAL,
+		      "pattern without duration accepted");
+
+	pattern.steps = many;
+	pattern.num_steps = ARRAY_SIZE(many);
+	zassert_equal(blink_set_pattern(blink, &pattern), -EINVAL,
+		      "too long pattern accepted");
+}
+
+static void *blink_setup(void)
+{
+	zassert_true(device_is_ready(blink), "blink device not ready");
+
+	return NULL;
+}
+
+static void blink_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(blink_off(blink));
+}
+
+ZTEST_SUITE(blink_gpio_led, NULL, blink_setup, blink_before, NULL, NULL);
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test blink-pwm-led driver
+ *
+ * The LED is driven by the fake PWM controller, which records every
+ * setting. Blinking that the hardware can do must be set up with a single
+ * call and then cost nothing more.
+ */
+
+#include <zephyr/drivers/pwm/pwm_fake.h>
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+
+#include <app/drivers/blink.h>
+
+DEFINE_FFF_GLOBALS;
+
+#define PWM_LED_NODE DT_NODELABEL(pwm_led)
+
+/* The fake controller runs at 1 MHz */
+#define US_PER_MS 1000U
+#define DIM_PERIOD_US (DT_PWMS_PERIOD(PWM_LED_NODE) / NSEC_PER_USEC)
+
+#define TOLERANCE_MS 2
+#define MAX_CALLS 32
+
+struct pwm_call {
+	uint32_t t_ms;
+	uint32_t period;
+	uint32_t pulse;
+};
+
+static const struct device *const led = DEVICE_DT_GET(PWM_LED_NODE);
+
+static struct pwm_call calls[MAX_CALLS];
+static size_t num_calls;
+static int64_t start;
+
+static int record_set_cycles(const struct device *dev, uint32_t channel,
+			     uint32_t period, uint32_t pulse,
+			     pwm_flags_t flags)
+{
+	if (num_calls < MAX_CALLS) {
+		calls[num_calls++] = (struct pwm_call){
+			.t_ms = (uint32_t)(k_uptime_get() - start),
+			.period = period,
+			.pulse = pulse,
+		};
+	}
+
+	return 0;
+}
+
+ZTEST(blink_pwm_led, test_period_in_hardware)
+{
+	zassert_ok(blink_set_period_ms(led, 500));
+	k_msleep(3000);
+
+	zassert_equal(num_calls, 1, "%zu PWM updates, expected 1", num_calls);
+	zassert_equal(calls[0].period, 1000 * US_PER_MS);
+	zassert_equal(calls[0].pulse, 500 * US_PER_MS);
+}
+
+ZTEST(blink_pwm_led, test_single_step_pattern_in_hardware)
+{
+	static const struct blink_step heartbeat[] = {
+		{ .on_ms = 100, .off_ms = 300, .count = 1 },
+	};
+	const struct blink_pattern pattern = {
+		.steps = heartbeat,
+		.num_steps = ARRAY_SIZE(heartbeat),
+		.repeat = BLINK_PATTERN_FOREVER,
+	};
+
+	zassert_ok(blink_set_pattern(led, &pattern));
+	k_msleep(2000);
+
+	zassert_equal(num_calls, 1, "%zu PWM updates, expected 1", num_calls);
+	zassert_equal(calls[0].period, 400 * US_PER_MS);
+	zassert_equal(calls[0].pulse, 100 * US_PER_MS);
+}
+
+ZTEST(blink_pwm_led, test_slow_period_falls_back_to_timer)
+{
+	/* A 6 s PWM period does not fit the API's nanoseconds */
+	zassert_ok(blink_set_period_ms(led, 3000));
+	k_msleep(6500);
+
+	zassert_equal(num_calls, 3, "%zu PWM updates, expected 3", num_calls);
+	zassert_equal(calls[0].pulse, 0, "should start off");
+	for (size_t i = 1; i < num_calls; i++) {
+		zassert_within(calls[i].t_ms, i * 3000, TOLERANCE_MS);
+		zassert_equal(calls[i].period, DIM_PERIOD_US);
+		zassert_equal(calls[i].pulse, (i % 2) ? DIM_PERIOD_US : 0);
+	}
+}
+
+ZTEST(blink_pwm_led, test_pattern_in_software)
+{
+	static const struct blink_step steps[] = {
+		{ .on_ms = 50, .off_ms = 50, .count = 2 },
+	};
+	const struct blink_pattern pattern = {
+		.steps = steps,
+		.num_steps = ARRAY_SIZE(steps),
+		.repeat = 1,
+	};
+
+	zassert_ok(blink_set_pattern(led, &pattern));
+	k_msleep(300);
+
+	/* on, off, on, off, then off for good at the end */
+	zassert_equal(num_calls, 5, "%zu PWM updates, expected 5", num_calls);
+	for (size_t i = 0; i < num_calls; i++) {
+		zassert_within(calls[i].t_ms, i * 50, TOLERANCE_MS);
+		zassert_equal(calls[i].pulse,
+			      (i < 4 && i % 2 == 0) ? DIM_PERIOD_US : 0);
+	}
+}
+
+ZTEST(blink_pwm_led, test_brightness_and_fade)
+{
+	zassert_ok(blink_set_brightness(led, 100, 0));
+	zassert_equal(num_calls, 1);
+	zassert_equal(calls[0].pulse, DIM_PERIOD_US);
+
+	zassert_ok(blink_set_brightness(led, 40, 0));
+	zassert_equal(calls[1].pulse, DIM_PERIOD_US * 40 / 100);
+
+	num_calls = 0;
+	start = k_uptime_get();
+	zassert_ok(blink_set_brightness(led, 0, 100));
+	k_msleep(300);
+
+	zassert_within(num_calls, 100 / CONFIG_BLINK_PWM_LED_FADE_STEP_MS, 1,
+		       "%zu fade steps", num_calls);
+	for (size_t i = 1; i < num_calls; i++) {
+		zassert_true(calls[i].pulse < calls[i - 1].pulse,
+			     "fade step %zu does not dim", i);
+	}
+	zassert_equal(calls[num_calls - 1].pulse, 0);
+	zassert_within(calls[num_calls - 1].t_ms, 100,
+		       CONFIG_BLINK_PWM_LED_FADE_STEP_MS);
+
+	zassert_equal(blink_set_brightness(led, 101, 0), -EINVAL);
+}
+
+ZTEST(blink_pwm_led, test_brightness_not_supported)
+{
+	const struct device *gpio_led = DEVICE_DT_GET(DT_NODELABEL(blink_led));
+
+	zassert_equal(blink_set_brightness(gpio_led, 50, 0), -ENOSYS);
+}
+
+static void *pwm_led_setup(void)
+{
+	zassert_true(device_is_ready(led), "PWM LED not ready");
+
+	return NULL;
+}
+
+static void pwm_led_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(blink_off(led));
+
+	RESET_FAKE(fake_pwm_set_cycles);
+	fake_pwm_set_cycles_fake.custom_fake = record_set_cycles;
+	num_calls = 0;
+	start = k_uptime_get();
+}
+
+ZTEST_SUITE(blink_pwm_led, NULL, pwm_led_setup, pwm_led_before, NULL, NULL);
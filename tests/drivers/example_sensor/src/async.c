@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test example_sensor asynchronous reads
+ *
+ * Reads both example sensor instances through RTIO, alone and batched in a
+ * single submission, and decodes the frames with the sensor's decoder.
+ */
+
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/ztest.h>
+
+#define SENSOR_A_NODE DT_NODELABEL(example_sensor)
+#define SENSOR_B_NODE DT_NODELABEL(example_sensor_b)
+
+static const struct device *const sensor_a = DEVICE_DT_GET(SENSOR_A_NODE);
+static const struct device *const sensor_b = DEVICE_DT_GET(SENSOR_B_NODE);
+static const struct device *const port =
+	DEVICE_DT_GET(DT_GPIO_CTLR(SENSOR_A_NODE, input_gpios));
+
+static const struct sensor_chan_spec prox = { SENSOR_CHAN_PROX, 0 };
+
+SENSOR_DT_READ_IODEV(iodev_a, SENSOR_A_NODE, { SENSOR_CHAN_PROX, 0 });
+SENSOR_DT_READ_IODEV(iodev_b, SENSOR_B_NODE, { SENSOR_CHAN_PROX, 0 });
+SENSOR_DT_READ_IODEV(iodev_temp, SENSOR_A_NODE, { SENSOR_CHAN_AMBIENT_TEMP, 0 });
+
+RTIO_DEFINE_WITH_MEMPOOL(sensor_rtio, 4, 4, 8, 16, sizeof(void *));
+
+/* Decode the one reading of a frame */
+static struct sensor_byte_data decode(const struct device *dev,
+				      const uint8_t *buf)
+{
+	const struct sensor_decoder_api *decoder;
+	struct sensor_byte_data data = { 0 };
+	uint16_t frames;
+	uint32_t fit = 0;
+
+	zassert_ok(sensor_get_decoder(dev, &decoder));
+	zassert_ok(decoder->get_frame_count(buf, prox, &frames));
+	zassert_equal(frames, 1);
+	zassert_equal(decoder->decode(buf, prox, &fit, 1, &data), 1);
+	zassert_equal(data.header.reading_count, 1);
+
+	/* Everything has been decoded */
+	zassert_equal(decoder->decode(buf, prox, &fit, 1, &data), 0);
+
+	return data;
+}
+
+ZTEST(example_sensor_async, test_read)
+{
+	uint8_t buf[16];
+	struct sensor_byte_data data;
+	int64_t before, after;
+
+	zassert_ok(gpio_emul_input_set(port,
+				       DT_GPIO_PIN(SENSOR_A_NODE, input_gpios),
+				       1));
+
+	before = k_uptime_get();
+	zassert_ok(sensor_read(&iodev_a, &sensor_rtio, buf, sizeof(buf)));
+	after = k_uptime_get();
+
+	data = decode(sensor_a, buf);
+	zassert_equal(data.readings[0].is_near, 1);
+	zassert_true(data.header.base_timestamp_ns >= before * NSEC_PER_MSEC &&
+		     data.header.base_timestamp_ns <=
+			     (after + 1) * NSEC_PER_MSEC,
+		     "reading not timestamped when it was taken");
+}
+
+ZTEST(example_sensor_async, test_batched_read)
+{
+	const struct device *devs[] = { sensor_a, sensor_b };
+	struct rtio_iodev *iodevs[] = { &iodev_a, &iodev_b };
+	bool seen[ARRAY_SIZE(devs)] = { false };
+	struct rtio_sqe *sqe;
+
+	/* A reads 0; B is active low, so a low input reads 1 */
+	zassert_ok(gpio_emul_input_set(port,
+				       DT_GPIO_PIN(SENSOR_A_NODE, input_gpios),
+				       0));
+	zassert_ok(gpio_emul_input_set(port,
+				       DT_GPIO_PIN(SENSOR_B_NODE, input_gpios),
+				       0));
+
+	for (size_t i = 0; i < ARRAY_SIZE(devs); i++) {
+		sqe = rtio_sqe_acquire(&sensor_rtio);
+		zassert_not_null(sqe);
+		rtio_sqe_prep_read_with_pool(sqe, iodevs[i], RTIO_PRIO_NORM,
+					     (void *)devs[i]);
+	}
+
+	/* One submission for both sensors */
+	zassert_ok(rtio_submit(&sensor_rtio, ARRAY_SIZE(devs)));
+
+	for (size_t i = 0; i < ARRAY_SIZE(devs); i++) {
+		struct rtio_cqe *cqe = rtio_cqe_consume_block(&sensor_rtio);
+		const struct device *dev = cqe->userdata;
+		struct sensor_byte_data data;
+		uint8_t *buf;
+		uint32_t buf_len;
+
+		zassert_ok(cqe->result, "read failed (%d)", cqe->result);
+		zassert_ok(rtio_cqe_get_mempool_buffer(&sensor_rtio, cqe, &buf,
+						       &buf_len));
+		rtio_cqe_release(&sensor_rtio, cqe);
+
+		data = decode(dev, buf);
+		rtio_release_buffer(&sensor_rtio, buf, buf_len);
+
+		zassert_equal(data.readings[0].is_near, dev == sensor_b,
+			      "%s read %d", dev->name,
+			      data.readings[0].is_near);
+		seen[dev == sensor_b] = true;
+	}
+
+	zassert_true(seen[0] && seen[1], "a completion is missing");
+}
+
+ZTEST(example_sensor_async, test_unsupported_channel)
+{
+	const struct sensor_decoder_api *decoder;
+	uint8_t buf[16] = { 0 };
+	uint16_t frames;
+
+	zassert_equal(sensor_read(&iodev_temp, &sensor_rtio, buf, sizeof(buf)),
+		      -ENOTSUP);
+
+	zassert_ok(sensor_get_decoder(sensor_a, &decoder));
+	zassert_equal(decoder->get_frame_count(
+			      buf,
+			      (struct sensor_chan_spec){ SENSOR_CHAN_AMBIENT_TEMP,
+							 0 },
+			      &frames),
+		      -ENOTSUP);
+}
+
+ZTEST_SUITE(example_sensor_async, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test example_sensor triggers
+ *
+ * This suite drives the example sensor's input through the GPIO emulator and
+ * checks when, and how often, trigger handlers run: one call per debounced
+ * change, debounce-interval-ms after the last edge, with the time of the
+ * first edge as the event timestamp.
+ */
+
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/ztest.h>
+
+#include <app/drivers/sensor/example_sensor.h>
+
+#define SENSOR_NODE DT_NODELABEL(example_sensor)
+#define INPUT_PIN DT_GPIO_PIN(SENSOR_NODE, input_gpios)
+#define DEBOUNCE_MS DT_PROP(SENSOR_NODE, debounce_interval_ms)
+
+/* Allowed deviation from the nominal time */
+#define TOLERANCE_MS 2
+
+static const struct device *const sensor = DEVICE_DT_GET(SENSOR_NODE);
+static const struct device *const port =
+	DEVICE_DT_GET(DT_GPIO_CTLR(SENSOR_NODE, input_gpios));
+
+static const struct sensor_trigger data_ready = {
+	.type = SENSOR_TRIG_DATA_READY,
+	.chan = SENSOR_CHAN_PROX,
+};
+
+static const struct sensor_trigger near_far = {
+	.type = SENSOR_TRIG_NEAR_FAR,
+	.chan = SENSOR_CHAN_PROX,
+};
+
+static K_SEM_DEFINE(triggered, 0, K_SEM_MAX_LIMIT);
+static atomic_t calls;
+static int64_t called_at;
+
+static void handler(const struct device *dev,
+		    const struct sensor_trigger *trig)
+{
+	ARG_UNUSED(dev);
+	ARG_UNUSED(trig);
+
+	called_at = k_uptime_get();
+	atomic_inc(&calls);
+	k_sem_give(&triggered);
+}
+
+static void set_input(int level)
+{
+	zassert_ok(gpio_emul_input_set(port, INPUT_PIN, level));
+}
+
+static int64_t fetch_timestamp_ms(int *state)
+{
+	struct sensor_value val;
+
+	zassert_ok(sensor_sample_fetch(sensor));
+	zassert_ok(sensor_channel_get(sensor, SENSOR_CHAN_PROX, &val));
+	*state = val.val1;
+
+	zassert_ok(sensor_channel_get(
+		sensor,
+		(enum sensor_channel)SENSOR_CHAN_EXAMPLE_SENSOR_TIMESTAMP,
+		&val));
+
+	return (int64_t)val.val1 * MSEC_PER_SEC + val.val2 / USEC_PER_MSEC;
+}
+
+ZTEST(example_sensor, test_trigger_latency)
+{
+	int64_t edge;
+	int state;
+
+	zassert_ok(sensor_trigger_set(sensor, &data_ready, handler));
+
+	edge = k_uptime_get();
+	set_input(1);
+
+	zassert_ok(k_sem_take(&triggered, K_MSEC(10 * DEBOUNCE_MS)),
+		   "no trigger");
+	zassert_within(called_at - edge, DEBOUNCE_MS, TOLERANCE_MS,
+		       "handler ran %lld ms after the edge", called_at - edge);
+
+	zassert_within(fetch_timestamp_ms(&state), edge, 1,
+		       "timestamp is not the edge time");
+	zassert_equal(state, 1);
+}
+
+ZTEST(example_sensor, test_bounces_are_merged)
+{
+	int64_t first_edge, last_edge;
+	int state;
+
+	zassert_ok(sensor_trigger_set(sensor, &data_ready, handler));
+
+	/* Contact bounce, each level shorter than the debounce interval */
+	first_edge = k_uptime_get();
+	for (int i = 0; i < 4; i++) {
+		set_input(i % 2 == 0);
+		k_msleep(DEBOUNCE_MS / 4);
+	}
+	last_edge = k_uptime_get();
+	set_input(1);
+
+	k_msleep(5 * DEBOUNCE_MS);
+
+	zassert_equal(atomic_get(&calls), 1, "%ld handler calls, expected 1",
+		      atomic_get(&calls));
+	zassert_within(called_at - last_edge, DEBOUNCE_MS, TOLERANCE_MS,
+		       "handler ran %lld ms after the last edge",
+		       called_at - last_edge);
+	zassert_within(fetch_timestamp_ms(&state), first_edge, 1,
+		       "timestamp should be the first edge of the burst");
+	zassert_equal(state, 1);
+}
+
+ZTEST(example_sensor, test_glitch_ignored)
+{
+	zassert_ok(sensor_trigger_set(sensor, &data_ready, handler));
+
+	set_input(1);
+	k_msleep(DEBOUNCE_MS / 2);
+	set_input(0);
+
+	k_msleep(5 * DEBOUNCE_MS);
+	zassert_equal(atomic_get(&calls), 0,
+		      "a glitch back to the same level was reported");
+}
+
+ZTEST(example_sensor, test_near_far_on_activation_only)
+{
+	zassert_ok(sensor_trigger_set(sensor, &near_far, handler));
+
+	set_input(1);
+	k_msleep(2 * DEBOUNCE_MS);
+	zassert_equal(atomic_get(&calls), 1, "activation not reported");
+
+	set_input(0);
+	k_msleep(2 * DEBOUNCE_MS);
+	zassert_equal(atomic_get(&calls), 1, "deactivation reported");
+}
+
+ZTEST(example_sensor, test_disabled_trigger)
+{
+	zassert_ok(sensor_trigger_set(sensor, &data_ready, handler));
+	zassert_ok(sensor_trigger_set(sensor, &data_ready, NULL));
+
+	set_input(1);
+	k_msleep(2 * DEBOUNCE_MS);
+	zassert_equal(atomic_get(&calls), 0, "removed handler was called");
+}
+
+ZTEST(example_sensor, test_unsupported_trigger)
+{
+	const struct sensor_trigger tap = {
+		.type = SENSOR_TRIG_TAP,
+		.chan = SENSOR_CHAN_PROX,
+	};
+
+	zassert_equal(sensor_trigger_set(sensor, &tap, handler), -ENOTSUP);
+}
+
+static void *example_sensor_setup(void)
+{
+	zassert_true(device_is_ready(sensor), "sensor not ready");
+
+	return NULL;
+}
+
+static void example_sensor_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zassert_ok(sensor_trigger_set(sensor, &data_ready, NULL));
+	zassert_ok(sensor_trigger_set(sensor, &near_far, NULL));
+	set_input(0);
+
+	atomic_clear(&calls);
+	k_sem_reset(&triggered);
+}
+
+ZTEST_SUITE(example_sensor, NULL, example_sensor_setup, example_sensor_before,
+	    NULL, NULL);
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test example_sensor edge FIFO streaming
+ *
+ * A timer toggles the input of a streaming instance every tick while the
+ * test consumes FIFO watermark frames. Every edge must come out exactly once
+ * or be counted as an overflow, in order, with one wakeup per batch.
+ */
+
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/rtio/rtio.h>
+#include <zephyr/ztest.h>
+
+#include <app/drivers/sensor/example_sensor.h>
+
+#define STREAM_NODE DT_NODELABEL(example_sensor_stream)
+#define STREAM_PIN DT_GPIO_PIN(STREAM_NODE, input_gpios)
+#define WATERMARK DT_PROP(STREAM_NODE, fifo_watermark)
+#define FIFO_SIZE CONFIG_EXAMPLE_SENSOR_FIFO_SIZE
+
+/* A multiple of the watermark, so no edges are left behind in the FIFO */
+#define STRESS_EDGES 1000
+#define OVERFLOW_EDGES (FIFO_SIZE + 68)
+
+BUILD_ASSERT(STRESS_EDGES % WATERMARK == 0);
+
+static const struct device *const sensor = DEVICE_DT_GET(STREAM_NODE);
+static const struct device *const port =
+	DEVICE_DT_GET(DT_GPIO_CTLR(STREAM_NODE, input_gpios));
+
+static const struct sensor_chan_spec prox = { SENSOR_CHAN_PROX, 0 };
+
+SENSOR_DT_STREAM_IODEV(iodev_stream, STREAM_NODE,
+		       { SENSOR_TRIG_FIFO_WATERMARK, SENSOR_STREAM_DATA_INCLUDE });
+
+RTIO_DEFINE_WITH_MEMPOOL(stream_rtio, 4, 4, 32, 64, sizeof(void *));
+
+/* Room for a full FIFO worth of decoded readings */
+static union {
+	struct sensor_byte_data data;
+	uint8_t raw[sizeof(struct sensor_byte_data) +
+		    (FIFO_SIZE - 1) * sizeof(((struct sensor_byte_data *)0)
+						     ->readings[0])];
+} decoded;
+
+struct totals {
+	uint32_t frames;
+	uint32_t events;
+	uint32_t overflows;
+	uint32_t min_batch;
+	uint64_t last_ns;
+	int last_state;
+};
+
+static struct rtio_sqe *stream_handle;
+static int level;
+static atomic_t toggles_left;
+
+static void toggle(struct k_timer *timer)
+{
+	if (atomic_dec(&toggles_left) <= 0) {
+		k_timer_stop(timer);
+		return;
+	}
+
+	level = !level;
+	(void)gpio_emul_input_set(port, STREAM_PIN, level);
+}
+
+static K_TIMER_DEFINE(toggle_timer, toggle, NULL);
+
+/* Check and account one frame */
+static void check_frame(const uint8_t *buf, struct totals *t)
+{
+	const struct example_sensor_frame_header *hdr =
+		(const struct example_sensor_frame_header *)buf;
+	const struct sensor_decoder_api *decoder;
+	uint32_t fit = 0;
+	int n;
+
+	zassert_ok(sensor_get_decoder(sensor, &decoder));
+	zassert_true(decoder->has_trigger(buf, SENSOR_TRIG_FIFO_WATERMARK));
+
+	t->frames++;
+	t->overflows += hdr->overflows;
+	t->min_batch = MIN(t->min_batch, hdr->count);
+
+	while ((n = decoder->decode(buf, prox, &fit, FIFO_SIZE,
+				    &decoded.data)) > 0) {
+		for (int i = 0; i < n; i++) {
+			uint64_t ns = decoded.data.header.base_timestamp_ns +
+				      decoded.data.readings[i].timestamp_delta;
+			int state = decoded.data.readings[i].is_near;
+
+			zassert_true(ns >= t->last_ns, "event %u went back in time",
+				     t->events);
+			/* Without losses, every edge flips the level */
+			if (hdr->overflows == 0 && t->last_state >= 0) {
+				zassert_not_equal(state, t->last_state,
+						  "event %u: edge missing",
+						  t->events);
+			}
+			t->last_ns = ns;
+			t->last_state = state;
+			t->events++;
+		}
+	}
+	zassert_equal(fit, hdr->count, "not every event was decoded");
+}
+
+/* Consume frames until @p edges are accounted for, or @p timeout_ms */
+static void consume(uint32_t edges, uint32_t timeout_ms, struct totals *t)
+{
+	int64_t deadline = k_uptime_get() + timeout_ms;
+
+	*t = (struct totals){ .min_batch = UINT32_MAX, .last_state = -1 };
+
+	while (t->events + t->overflows < edges &&
+	       k_uptime_get() < deadline) {
+		struct rtio_cqe *cqe = rtio_cqe_consume(&stream_rtio);
+		uint8_t *buf;
+		uint32_t buf_len;
+
+		if (cqe == NULL) {
+			k_msleep(1);
+			continue;
+		}
+
+		zassert_ok(cqe->result, "stream failed (%d)", cqe->result);
+		zassert_ok(rtio_cqe_get_mempool_buffer(&stream_rtio, cqe, &buf,
+						       &buf_len));
+		rtio_cqe_release(&stream_rtio, cqe);
+
+		check_frame(buf, t);
+		rtio_release_buffer(&stream_rtio, buf, buf_len);
+	}
+}
+
+ZTEST(example_sensor_stream, test_a_stress)
+{
+	struct totals t;
+
+	atomic_set(&toggles_left, STRESS_EDGES);
+	k_timer_start(&toggle_timer, K_TICKS(1), K_TICKS(1));
+
+	consume(STRESS_EDGES, 5 * STRESS_EDGES, &t);
+
+	printk("stream: %u edges in %u frames (min batch %u), %u overflows\n",
+	       t.events, t.frames, t.min_batch, t.overflows);
+
+	zassert_equal(t.events + t.overflows, STRESS_EDGES,
+		      "%u events and %u overflows for %u edges", t.events,
+		      t.overflows, STRESS_EDGES);
+	zassert_equal(t.overflows, 0, "a prompt consumer should lose nothing");
+	zassert_true(t.min_batch >= WATERMARK, "woken up below the watermark");
+	zassert_true(t.frames <= STRESS_EDGES / WATERMARK,
+		     "%u wakeups for %u edges", t.frames, STRESS_EDGES);
+}
+
+ZTEST(example_sensor_stream, test_b_overflow)
+{
+	struct sensor_value val;
+	struct totals t;
+	int32_t before;
+
+	zassert_ok(sensor_sample_fetch(sensor));
+	zassert_ok(sensor_channel_get(
+		sensor,
+		(enum sensor_channel)SENSOR_CHAN_EXAMPLE_SENSOR_FIFO_OVERFLOWS,
+		&val));
+	before = val.val1;
+
+	/* Keep the draining work item off the CPU while edges pour in */
+	k_sched_lock();
+	for (int i = 0; i < OVERFLOW_EDGES; i++) {
+		level = !level;
+		zassert_ok(gpio_emul_input_set(port, STREAM_PIN, level));
+	}
+	k_sched_unlock();
+
+	consume(OVERFLOW_EDGES, 1000, &t);
+
+	zassert_equal(t.events, FIFO_SIZE, "%u events kept, expected %u",
+		      t.events, FIFO_SIZE);
+	zassert_equal(t.overflows, OVERFLOW_EDGES - FIFO_SIZE);
+
+	zassert_ok(sensor_sample_fetch(sensor));
+	zassert_ok(sensor_channel_get(
+		sensor,
+		(enum sensor_channel)SENSOR_CHAN_EXAMPLE_SENSOR_FIFO_OVERFLOWS,
+		&val));
+	zassert_equal(val.val1 - before, OVERFLOW_EDGES - FIFO_SIZE,
+		      "overflow counter off");
+}
+
+static void *stream_setup(void)
+{
+	zassert_true(device_is_ready(sensor), "sensor not ready");
+	zassert_ok(sensor_stream(&iodev_stream, &stream_rtio, NULL,
+				 &stream_handle));
+
+	return NULL;
+}
+
+ZTEST_SUITE(example_sensor_stream, NULL, stream_setup, NULL, NULL, NULL);
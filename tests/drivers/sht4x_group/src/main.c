@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test sht4x-group
+ *
+ * Groups of 1 to 8 emulated SHT40s are fetched and compared with fetching
+ * the same sensors one after the other through the sensirion,sht4x driver.
+ * The emulator NACKs reads until a conversion is done, so every fetch that
+ * succeeds has waited for it. Oversampled low repeatability fetches are then
+ * compared with single ones for noise, conversion time and bus traffic, on
+ * the emulator's model of the datasheet repeatability.
+ */
+
+#include <zephyr/drivers/emul.h>
+#include <zephyr/drivers/sensor.h>
+#include <zephyr/ztest.h>
+
+#include <app/drivers/sensor/sht4x_group.h>
+#include <app/lib/filters.h>
+#include <app/lib/pipeline.h>
+
+#define NUM_SENSORS 8
+#define ROUNDS 10
+
+/* Conversion time of the emulated sensors at high repeatability */
+#define CONVERSION_US 8200
+
+#define SENSOR_EMUL(i, _) EMUL_DT_GET(DT_NODELABEL(ths##i))
+#define SENSOR_DEV(i, _) DEVICE_DT_GET(DT_NODELABEL(ths##i))
+
+static const struct emul *const emuls[] = {
+	LISTIFY(NUM_SENSORS, SENSOR_EMUL, (,))
+};
+
+static const struct device *const sensors[] = {
+	LISTIFY(NUM_SENSORS, SENSOR_DEV, (,))
+};
+
+static const struct {
+	const struct device *dev;
+	size_t size;
+} groups[] = {
+	{ DEVICE_DT_GET(DT_NODELABEL(group_1)),
+	  SHT4X_GROUP_DT_NUM_SENSORS(DT_NODELABEL(group_1)) },
+	{ DEVICE_DT_GET(DT_NODELABEL(group_2)),
+	  SHT4X_GROUP_DT_NUM_SENSORS(DT_NODELABEL(group_2)) },
+	{ DEVICE_DT_GET(DT_NODELABEL(group_4)),
+	  SHT4X_GROUP_DT_NUM_SENSORS(DT_NODELABEL(group_4)) },
+	{ DEVICE_DT_GET(DT_NODELABEL(group_8)),
+	  SHT4X_GROUP_DT_NUM_SENSORS(DT_NODELABEL(group_8)) },
+};
+
+/* Distinct levels per sensor: 20.5 C + i, 40 %RH + 5 i */
+static void set_levels(void)
+{
+	for (int i = 0; i < NUM_SENSORS; i++) {
+		sht4x_emul_set(emuls[i], 20500 + 1000 * i, 40000 + 5000 * i);
+		sht4x_emul_set_fail(emuls[i], false);
+	}
+}
+
+static void check_value(const struct device *dev, enum sensor_channel chan,
+			int32_t expected_milli)
+{
+	struct sensor_value val;
+
+	zassert_ok(sensor_channel_get(dev, chan, &val));
+	/* Within the 16-bit resolution of the sensor */
+	zassert_within(sensor_value_to_milli(&val), expected_milli, 5,
+		       "channel %d: %lld", chan,
+		       (long long)sensor_value_to_milli(&val));
+}
+
+ZTEST(sht4x_group, test_values)
+{
+	const struct device *group = groups[ARRAY_SIZE(groups) - 1].dev;
+	enum sensor_channel beyond = SENSOR_CHAN_SHT4X_GROUP_TEMP(NUM_SENSORS);
+	struct sensor_value val;
+
+	zassert_ok(sensor_sample_fetch(group));
+
+	for (int i = 0; i < NUM_SENSORS; i++) {
+		check_value(group, SENSOR_CHAN_SHT4X_GROUP_TEMP(i),
+			    20500 + 1000 * i);
+		check_value(group, SENSOR_CHAN_SHT4X_GROUP_HUM(i),
+			    40000 + 5000 * i);
+	}
+
+	/* The common channels read the first sensor */
+	check_value(group, SENSOR_CHAN_AMBIENT_TEMP, 20500);
+	check_value(group, SENSOR_CHAN_HUMIDITY, 40000);
+
+	zassert_equal(sensor_channel_get(group, beyond, &val), -ENOTSUP);
+	zassert_equal(sensor_channel_get(group, SENSOR_CHAN_PRESS, &val),
+		      -ENOTSUP);
+	zassert_equal(sensor_sample_fetch_chan(group, SENSOR_CHAN_PRESS),
+		      -ENOTSUP);
+}
+
+ZTEST(sht4x_group, test_missing_sensor)
+{
+	const struct device *group = groups[2].dev;
+	struct sensor_value val;
+
+	sht4x_emul_set_fail(emuls[1], true);
+
+	/* The others still get read */
+	zassert_equal(sensor_sample_fetch(group), -EIO);
+	zassert_equal(sensor_channel_get(group, SENSOR_CHAN_SHT4X_GROUP_TEMP(1),
+					 &val),
+		      -ENODATA);
+	check_value(group, SENSOR_CHAN_SHT4X_GROUP_TEMP(0), 20500);
+	check_value(group, SENSOR_CHAN_SHT4X_GROUP_HUM(3), 55000);
+
+	sht4x_emul_set_fail(emuls[1], false);
+	zassert_ok(sensor_sample_fetch(group));
+	check_value(group, SENSOR_CHAN_SHT4X_GROUP_TEMP(1), 21500);
+}
+
+/* Mean time of a fetch of the first @p n sensors, one after the other */
+static uint32_t serial_ms(size_t n)
+{
+	int64_t start = k_uptime_get();
+
+	for (int r = 0; r < ROUNDS; r++) {
+		for (size_t i = 0; i < n; i++) {
+			zassert_ok(sensor_sample_fetch(sensors[i]));
+		}
+	}
+
+	return (uint32_t)((k_uptime_get() - start) / ROUNDS);
+}
+
+/* Mean time of a fetch of @p group */
+static uint32_t group_ms(const struct device *group)
+{
+	int64_t start = k_uptime_get();
+
+	for (int r = 0; r < ROUNDS; r++) {
+		zassert_ok(sensor_sample_fetch(group));
+	}
+
+	return (uint32_t)((k_uptime_get() - start) / ROUNDS);
+}
+
+ZTEST(sht4x_group, test_scaling)
+{
+	for (size_t g = 0; g < ARRAY_SIZE(groups); g++) {
+		struct sht4x_emul_stats before, after;
+		uint32_t serial, grouped;
+
+		sht4x_emul_stats_get(emuls[0], &before);
+		serial = serial_ms(groups[g].size);
+		grouped = group_ms(groups[g].dev);
+		sht4x_emul_stats_get(emuls[0], &after);
+
+		printk("sht4x_group: %zu sensors, %u ms one by one, "
+		       "%u ms grouped\n",
+		       groups[g].size, serial, grouped);
+
+		/* Every round measured every sensor, both ways */
+		zassert_equal(after.measurements - before.measurements,
+			      2 * ROUNDS);
+
+		/* One conversion after the other, or all at once */
+		zassert_true(serial * USEC_PER_MSEC >=
+				     groups[g].size * CONVERSION_US,
+			     "%zu sensors: %u ms one by one", groups[g].size,
+			     serial);
+		zassert_true(grouped * USEC_PER_MSEC < 2 * CONVERSION_US,
+			     "%zu sensors: %u ms grouped", groups[g].size,
+			     grouped);
+	}
+}
+
+/* Oversampling: noise against conversion time */
+
+#define NOISE_FETCHES 100
+#define NOISE_SEED 1
+#define LEVEL_TEMP 20500
+#define LEVEL_HUM 40000
+
+/* 9 bits per byte at 100 kHz */
+#define BUS_US_PER_BYTE 90
+
+struct noise_config {
+	const struct device *group;
+	const struct emul *emul;
+	const char *name;
+	uint8_t oversampling;
+	enum filter_type filter;
+};
+
+struct noise_result {
+	/* Per fetch, of the sensor */
+	uint32_t conversion_us;
+	uint32_t bus_us;
+	/* RMS error from the true level, in milli-units */
+	uint32_t temp_rms;
+	uint32_t hum_rms;
+};
+
+static uint32_t isqrt(uint64_t x)
+{
+	uint64_t r = 0;
+
+	for (uint64_t bit = 1ULL << 62; bit != 0; bit >>= 2) {
+		if (x >= r + bit) {
+			x -= r + bit;
+			r = (r >> 1) + bit;
+		} else {
+			r >>= 1;
+		}
+	}
+
+	return (uint32_t)r;
+}
+
+static struct noise_result measure_noise(const struct noise_config *config)
+{
+	struct sht4x_emul_stats before, after;
+	struct noise_result result;
+	uint64_t temp_sq = 0;
+	uint64_t hum_sq = 0;
+
+	zassert_ok(sensor_attr_set(config->group, SENSOR_CHAN_ALL,
+				   SENSOR_ATTR_OVERSAMPLING,
+				   &(struct sensor_value){
+					   .val1 = config->oversampling }));
+	zassert_ok(sensor_attr_set(
+		config->group, SENSOR_CHAN_ALL,
+		(enum sensor_attribute)SENSOR_ATTR_SHT4X_GROUP_FILTER,
+		&(struct sensor_value){ .val1 = config->filter }));
+
+	sht4x_emul_set(config->emul, LEVEL_TEMP, LEVEL_HUM);
+	sht4x_emul_set_noise(config->emul, NOISE_SEED);
+	sht4x_emul_stats_get(config->emul, &before);
+
+	for (int f = 0; f < NOISE_FETCHES; f++) {
+		struct sensor_value temp, hum;
+		int64_t dt, dh;
+
+		zassert_ok(sensor_sample_fetch(config->group));
+		zassert_ok(sensor_channel_get(config->group,
+					      SENSOR_CHAN_AMBIENT_TEMP, &temp));
+		zassert_ok(sensor_channel_get(config->group,
+					      SENSOR_CHAN_HUMIDITY, &hum));
+
+		dt = sensor_value_to_milli(&temp) - LEVEL_TEMP;
+		dh = sensor_value_to_milli(&hum) - LEVEL_HUM;
+		temp_sq += (uint64_t)(dt * dt);
+		hum_sq += (uint64_t)(dh * dh);
+	}
+
+	sht4x_emul_stats_get(config->emul, &after);
+	sht4x_emul_set_noise(config->emul, 0);
+
+	result.conversion_us =
+		(after.conversion_us - before.conversion_us) / NOISE_FETCHES;
+	result.bus_us = (after.bus_bytes - before.bus_bytes) *
+			BUS_US_PER_BYTE / NOISE_FETCHES;
+	result.temp_rms = isqrt(temp_sq / NOISE_FETCHES);
+	result.hum_rms = isqrt(hum_sq / NOISE_FETCHES);
+
+	printk("sht4x_group: %-7s x%u %-12s conversion %5u us, bus %4u us, "
+	       "noise %3u mC %3u m%%RH\n",
+	       config->name, config->oversampling, filter_name(config->filter),
+	       result.conversion_us, result.bus_us, result.temp_rms,
+	       result.hum_rms);
+
+	return result;
+}
+
+/*
+ * The noise is seeded, so the results do not change from run to run:
+ *
+ *   high    x1 median        8200 us conversion, noise  41 mC  80 m%RH
+ *   medium  x1 median        4500 us conversion, noise  72 mC 150 m%RH
+ *   low     x1 median        1700 us conversion, noise 103 mC 251 m%RH
+ *   low     x4 mean          6800 us conversion, noise  49 mC 120 m%RH
+ *   low     x4 median        6800 us conversion, noise  53 mC 130 m%RH
+ *   low     x8 trimmed-mean 13600 us conversion, noise  40 mC 104 m%RH
+ *
+ * The bus takes 810 us per reading. The assertions keep some margin around
+ * these, so that a change of the noise generator does not break them.
+ */
+ZTEST(sht4x_group, test_oversampling)
+{
+	const struct device *low = DEVICE_DT_GET(DT_NODELABEL(group_low));
+	const struct emul *low_emul = EMUL_DT_GET(DT_NODELABEL(ths_low));
+	const struct noise_config configs[] = {
+		{ groups[0].dev, emuls[0], "high", 1, FILTER_MEDIAN },
+		{ DEVICE_DT_GET(DT_NODELABEL(group_medium)),
+		  EMUL_DT_GET(DT_NODELABEL(ths_medium)), "medium", 1,
+		  FILTER_MEDIAN },
+		{ low, low_emul, "low", 1, FILTER_MEDIAN },
+		{ low, low_emul, "low", 4, FILTER_MEAN },
+		{ low, low_emul, "low", 4, FILTER_MEDIAN },
+		{ low, low_emul, "low", 8, FILTER_TRIMMED_MEAN },
+	};
+	struct noise_result r[ARRAY_SIZE(configs)];
+
+	for (size_t c = 0; c < ARRAY_SIZE(configs); c++) {
+		r[c] = measure_noise(&configs[c]);
+	}
+
+	/* The emulator follows the datasheet */
+	zassert_true(r[0].temp_rms < r[1].temp_rms &&
+		     r[1].temp_rms < r[2].temp_rms);
+
+	/* Four low repeatability readings convert faster than one high */
+	zassert_equal(r[3].conversion_us, 4 * r[2].conversion_us);
+	zassert_true(r[3].conversion_us < r[0].conversion_us);
+
+	/* Noise down by about the square root of the number of readings */
+	zassert_true(r[3].temp_rms * 100 <= r[2].temp_rms * 65,
+		     "mean of 4: %u mC", r[3].temp_rms);
+	zassert_true(r[4].temp_rms * 100 <= r[2].temp_rms * 75,
+		     "median of 4: %u mC", r[4].temp_rms);
+	zassert_true(r[5].temp_rms * 100 <= r[2].temp_rms * 55,
+		     "trimmed mean of 8: %u mC", r[5].temp_rms);
+
+	/* Below medium repeatability noise, at less than high's cost */
+	zassert_true(r[3].temp_rms < r[1].temp_rms);
+
+	zassert_equal(sensor_attr_set(low, SENSOR_CHAN_ALL,
+				      SENSOR_ATTR_OVERSAMPLING,
+				      &(struct sensor_value){ .val1 = 0 }),
+		      -EINVAL);
+	zassert_equal(sensor_attr_set(
+			      low, SENSOR_CHAN_ALL,
+			      (enum sensor_attribute)
+				      SENSOR_ATTR_SHT4X_GROUP_FILTER,
+			      &(struct sensor_value){ .val1 = 42 }),
+		      -EINVAL);
+}
+
+/* Results of a group go down a pipeline as one sample */
+
+#define PIPELINE_GROUP DT_NODELABEL(group_4)
+#define PIPELINE_SENSORS SHT4X_GROUP_DT_NUM_SENSORS(PIPELINE_GROUP)
+
+#define GROUP_CHANNELS(i, _)                                                   \
+	SENSOR_CHAN_SHT4X_GROUP_TEMP(i), SENSOR_CHAN_SHT4X_GROUP_HUM(i)
+
+static const enum sensor_channel group_channels[] = {
+	LISTIFY(PIPELINE_SENSORS, GROUP_CHANNELS, (,))
+};
+
+static struct pipeline_acquire group_source = {
+	.sensor = DEVICE_DT_GET(PIPELINE_GROUP),
+	.channels = group_channels,
+	.num_channels = ARRAY_SIZE(group_channels),
+};
+
+K_MSGQ_DEFINE(group_samples, sizeof(struct pipeline_sample), 2, 8);
+
+static int keep_sample(struct net_buf *buf, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	return k_msgq_put(&group_samples, pipeline_sample(buf), K_NO_WAIT);
+}
+
+static struct pipeline_sink group_sink =
+	PIPELINE_SINK_INITIALIZER(keep_sample, NULL);
+
+PIPELINE_DEFINE(group_pipeline, 2, &group_source, &group_sink.stage);
+
+ZTEST(sht4x_group, test_pipeline)
+{
+	struct pipeline_sample sample;
+
+	zassert_ok(pipeline_start(&group_pipeline));
+	zassert_ok(pipeline_trigger(&group_pipeline));
+	zassert_ok(k_msgq_get(&group_samples, &sample, K_MSEC(100)));
+	zassert_ok(pipeline_stop(&group_pipeline));
+
+	zassert_equal(sample.count, 2 * PIPELINE_SENSORS);
+	for (int i = 0; i < PIPELINE_SENSORS; i++) {
+		zassert_within(sensor_value_to_milli(&sample.values[2 * i]),
+			       20500 + 1000 * i, 5);
+		zassert_within(sensor_value_to_milli(&sample.values[2 * i + 1]),
+			       40000 + 5000 * i, 5);
+	}
+}
+
+static void sht4x_group_before(void *fixture)
+{
+	const struct device *low = DEVICE_DT_GET(DT_NODELABEL(group_low));
+
+	ARG_UNUSED(fixture);
+
+	set_levels();
+	zassert_ok(sensor_attr_set(low, SENSOR_CHAN_ALL,
+				   SENSOR_ATTR_OVERSAMPLING,
+				   &(struct sensor_value){ .val1 = 1 }));
+}
+
+ZTEST_SUITE(sht4x_group, NULL, NULL, sht4x_group_before, NULL, NULL);
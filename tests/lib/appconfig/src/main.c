@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test appconfig library
+ *
+ * Groups of entries are registered over settings in NVS on the flash
+ * simulator, erased before the suite. A reboot is simulated by putting the
+ * values in RAM back to their defaults and loading them again from flash.
+ * The last test retimes a running pipeline from the change callback, as an
+ * application would.
+ */
+
+#include <string.h>
+
+#include <zephyr/settings/settings.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/ztest.h>
+
+#include <app/lib/appconfig.h>
+#include <app/lib/pipeline.h>
+
+#define TOLERANCE_MS 2
+
+static struct appconfig_entry test_entries[] = {
+	APPCONFIG_UINT("count", 10, 1, 100),
+	APPCONFIG_STRING("name", 16, "device", 0),
+	APPCONFIG_STRING("secret", 16, "hunter2", APPCONFIG_SECRET),
+};
+
+static int changes;
+static const struct appconfig_entry *last_changed;
+
+static void count_change(struct appconfig *cfg,
+			 const struct appconfig_entry *entry, void *user_data)
+{
+	ARG_UNUSED(cfg);
+	ARG_UNUSED(user_data);
+
+	changes++;
+	last_changed = entry;
+}
+
+static struct appconfig test_cfg =
+	APPCONFIG_INITIALIZER("test", test_entries, count_change, NULL);
+
+/*
+ * What a reboot does to the values: back to the defaults, as at
+ * registration, then only what flash remembers
+ */
+static void reboot(struct appconfig *cfg)
+{
+	for (size_t i = 0; i < cfg->num_entries; i++) {
+		struct appconfig_entry *entry = &cfg->entries[i];
+
+		if (entry->type == APPCONFIG_UINT) {
+			*(uint32_t *)entry->value = entry->def;
+		} else {
+			strcpy(entry->value, entry->def_str);
+		}
+	}
+
+	zassert_ok(settings_load_subtree("appcfg"));
+}
+
+static uint32_t get_uint(struct appconfig *cfg, const char *name)
+{
+	uint32_t value = 0;
+
+	zassert_ok(appconfig_get_uint(cfg, name, &value));
+
+	return value;
+}
+
+static const char *get_string(struct appconfig *cfg, const char *name)
+{
+	static char buf[16];
+
+	zassert_ok(appconfig_get_string(cfg, name, buf, sizeof(buf)));
+
+	return buf;
+}
+
+ZTEST(appconfig, test_defaults)
+{
+	char small[4];
+	uint32_t value;
+
+	zassert_equal(appconfig_find("test"), &test_cfg);
+	zassert_is_null(appconfig_find("none"));
+
+	zassert_equal(get_uint(&test_cfg, "count"), 10);
+	zassert_str_equal(get_string(&test_cfg, "name"), "device");
+	zassert_str_equal(get_string(&test_cfg, "secret"), "hunter2");
+
+	zassert_equal(appconfig_get_uint(&test_cfg, "none", &value), -ENOENT);
+	zassert_equal(appconfig_get_uint(&test_cfg, "name", &value), -EINVAL);
+	zassert_equal(appconfig_get_string(&test_cfg, "count", small,
+					   sizeof(small)),
+		      -EINVAL);
+	zassert_equal(appconfig_get_string(&test_cfg, "name", small,
+					   sizeof(small)),
+		      -ENOSPC);
+
+	zassert_equal(appconfig_register(&test_cfg), -EALREADY);
+}
+
+ZTEST(appconfig, test_invalid)
+{
+	zassert_equal(appconfig_set(&test_cfg, "none", "1"), -ENOENT);
+	zassert_equal(appconfig_set(&test_cfg, "count", "0"), -EINVAL);
+	zassert_equal(appconfig_set(&test_cfg, "count", "101"), -EINVAL);
+	zassert_equal(appconfig_set(&test_cfg, "count", "-5"), -EINVAL);
+	zassert_equal(appconfig_set(&test_cfg, "count", "12abc"), -EINVAL);
+	zassert_equal(appconfig_set(&test_cfg, "count", ""), -EINVAL);
+	zassert_equal(appconfig_set(&test_cfg, "count", "99999999999"),
+		      -EINVAL);
+	zassert_equal(appconfig_set(&test_cfg, "name", "sixteen chars!!!"),
+		      -EINVAL);
+	zassert_equal(changes, 0, "rejected values reported as changes");
+
+	/* Decimal even with a leading zero, hexadecimal with 0x */
+	zassert_ok(appconfig_set(&test_cfg, "count", "010"));
+	zassert_equal(get_uint(&test_cfg, "count"), 10);
+	zassert_ok(appconfig_set(&test_cfg, "count", "0x20"));
+	zassert_equal(get_uint(&test_cfg, "count"), 32);
+}
+
+ZTEST(appconfig, test_persistence)
+{
+	zassert_ok(appconfig_set(&test_cfg, "count", "42"));
+	zassert_ok(appconfig_set(&test_cfg, "name", "edge"));
+	/* An empty string is a value, not a deletion */
+	zassert_ok(appconfig_set(&test_cfg, "secret", ""));
+
+	reboot(&test_cfg);
+
+	zassert_equal(get_uint(&test_cfg, "count"), 42);
+	zassert_str_equal(get_string(&test_cfg, "name"), "edge");
+	zassert_str_equal(get_string(&test_cfg, "secret"), "");
+}
+
+ZTEST(appconfig, test_reset)
+{
+	zassert_ok(appconfig_set(&test_cfg, "name", "edge"));
+	zassert_ok(appconfig_reset(&test_cfg, "name"));
+	zassert_str_equal(get_string(&test_cfg, "name"), "device");
+	zassert_equal(changes, 2);
+
+	/* Forgotten by flash too */
+	reboot(&test_cfg);
+	zassert_str_equal(get_string(&test_cfg, "name"), "device");
+
+	/* Already at the default */
+	zassert_ok(appconfig_reset(&test_cfg, "name"));
+	zassert_equal(changes, 2);
+	zassert_equal(appconfig_reset(&test_cfg, "none"), -ENOENT);
+}
+
+ZTEST(appconfig, test_changed)
+{
+	zassert_ok(appconfig_set(&test_cfg, "count", "7"));
+	zassert_equal(changes, 1);
+	zassert_equal(last_changed, &test_entries[0]);
+
+	/* The same value again is not a change */
+	zassert_ok(appconfig_set(&test_cfg, "count", "7"));
+	zassert_equal(changes, 1);
+
+	zassert_ok(appconfig_set(&test_cfg, "name", "other"));
+	zassert_equal(changes, 2);
+	zassert_equal(last_changed, &test_entries[1]);
+}
+
+/* Values saved before the group is registered, e.g. by an earlier boot */
+
+static struct appconfig_entry boot_entries[] = {
+	APPCONFIG_UINT("count", 10, 1, 100),
+	APPCONFIG_UINT("limit", 50, 1, 100),
+	APPCONFIG_STRING("name", 16, "device", 0),
+};
+
+static struct appconfig boot_cfg =
+	APPCONFIG_INITIALIZER("boot", boot_entries, count_change, NULL);
+
+ZTEST(appconfig, test_load_at_register)
+{
+	uint32_t count = 7;
+	uint32_t limit = 500;
+
+	zassert_ok(settings_save_one("appcfg/boot/count", &count,
+				     sizeof(count)));
+	/* Out of range, left at the default */
+	zassert_ok(settings_save_one("appcfg/boot/limit", &limit,
+				     sizeof(limit)));
+	zassert_ok(settings_save_one("appcfg/boot/name", "saved",
+				     sizeof("saved")));
+
+	zassert_ok(appconfig_register(&boot_cfg));
+
+	zassert_equal(get_uint(&boot_cfg, "count"), 7);
+	zassert_equal(get_uint(&boot_cfg, "limit"), 50);
+	zassert_str_equal(get_string(&boot_cfg, "name"), "saved");
+	zassert_equal(changes, 0, "loaded values reported as changes");
+}
+
+/* A sampling period applied to a running pipeline without a restart */
+
+static struct appconfig_entry rate_entries[] = {
+	APPCONFIG_UINT("period_ms", 1000, 10, 60000),
+};
+
+static struct pipeline_acquire ticker = {
+	.period_ms = 1000,
+};
+
+static int64_t last_sample_ms;
+static K_SEM_DEFINE(sampled, 0, 16);
+
+static int record_sample(struct net_buf *samples, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	last_sample_ms = pipeline_sample(samples)->timestamp_ms;
+	k_sem_give(&sampled);
+
+	return 0;
+}
+
+static struct pipeline_sink ticker_sink =
+	PIPELINE_SINK_INITIALIZER(record_sample, NULL);
+
+PIPELINE_DEFINE(ticks, 4, &ticker, &ticker_sink.stage);
+
+static void retime(struct appconfig *cfg, const struct appconfig_entry *entry,
+		   void *user_data)
+{
+	uint32_t period_ms;
+
+	ARG_UNUSED(user_data);
+
+	zassert_ok(appconfig_get_uint(cfg, entry->name, &period_ms));
+	zassert_ok(pipeline_period_set(&ticks, period_ms));
+}
+
+static struct appconfig rate_cfg =
+	APPCONFIG_INITIALIZER("rate", rate_entries, retime, NULL);
+
+ZTEST(appconfig, test_live_period)
+{
+	int64_t prev_ms;
+
+	zassert_ok(appconfig_register(&rate_cfg));
+	zassert_ok(pipeline_period_set(&ticks,
+				       get_uint(&rate_cfg, "period_ms")));
+
+	zassert_ok(pipeline_start(&ticks));
+	zassert_ok(k_sem_take(&sampled, K_MSEC(100)));
+
+	/* The next sample is due in a second, not after this change */
+	zassert_ok(appconfig_set(&rate_cfg, "period_ms", "20"));
+	zassert_ok(k_sem_take(&sampled, K_MSEC(100)));
+	prev_ms = last_sample_ms;
+
+	for (int i = 0; i < 3; i++) {
+		zassert_ok(k_sem_take(&sampled, K_MSEC(100)));
+		zassert_within(last_sample_ms - prev_ms, 20, TOLERANCE_MS,
+			       "sample %d after %lld ms", i,
+			       last_sample_ms - prev_ms);
+		prev_ms = last_sample_ms;
+	}
+
+	zassert_ok(pipeline_stop(&ticks));
+
+	/* And it is still the period after a reboot */
+	reboot(&rate_cfg);
+	zassert_equal(get_uint(&rate_cfg, "period_ms"), 20);
+}
+
+static void *appconfig_setup(void)
+{
+	const struct flash_area *fa;
+
+	/* Start from empty settings, whatever earlier runs left */
+	zassert_ok(flash_area_open(FIXED_PARTITION_ID(storage_partition),
+				   &fa));
+	zassert_ok(flash_area_erase(fa, 0, fa->fa_size));
+	flash_area_close(fa);
+
+	zassert_ok(appconfig_register(&test_cfg));
+
+	return NULL;
+}
+
+static void appconfig_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Every test starts from the defaults */
+	for (size_t i = 0; i < test_cfg.num_entries; i++) {
+		zassert_ok(appconfig_reset(&test_cfg, test_entries[i].name));
+	}
+	changes = 0;
+	last_changed = NULL;
+}
+
+ZTEST_SUITE(appconfig, NULL, appconfig_setup, appconfig_before, NULL, NULL);
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test diag library
+ *
+ * Commands run on the shell dummy backend and their output is checked. A
+ * thread busy about two thirds of the time gives "diag cpu" something to
+ * measure: k_busy_wait() advances the simulated clock on native_sim.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/shell/shell_dummy.h>
+#include <zephyr/ztest.h>
+
+#include <app/lib/pipeline.h>
+
+static void busy_loop(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_busy_wait(2000);
+		k_msleep(1);
+	}
+}
+
+K_THREAD_DEFINE(busy, 1024, busy_loop, NULL, NULL, NULL, 5, 0, 0);
+
+static struct pipeline_acquire ticker = {
+	.period_ms = 100,
+};
+
+static int discard(struct net_buf *samples, void *user_data)
+{
+	ARG_UNUSED(samples);
+	ARG_UNUSED(user_data);
+
+	return 0;
+}
+
+static struct pipeline_sink ticker_sink =
+	PIPELINE_SINK_INITIALIZER(discard, NULL);
+
+PIPELINE_DEFINE(probe, 4, &ticker, &ticker_sink.stage);
+
+static const char *run(const char *cmd)
+{
+	const struct shell *sh = shell_backend_dummy_get_ptr();
+	size_t len;
+
+	shell_backend_dummy_clear_output(sh);
+	zassert_ok(shell_execute_cmd(sh, cmd), "%s failed", cmd);
+
+	return shell_backend_dummy_get_output(sh, &len);
+}
+
+/* The line of the output ending with @p name */
+static const char *find_line(const char *out, const char *name)
+{
+	const char *line = out;
+
+	while (line != NULL && *line != '\0') {
+		const char *end = strpbrk(line, "\r\n");
+		size_t len = end == NULL ? strlen(line) : (size_t)(end - line);
+
+		if (len >= strlen(name) &&
+		    strncmp(line + len - strlen(name), name,
+			    strlen(name)) == 0) {
+			return line;
+		}
+		line = end == NULL ? NULL : end + 1;
+	}
+
+	return NULL;
+}
+
+ZTEST(diag, test_cpu)
+{
+	const char *out;
+	const char *line;
+	unsigned int whole;
+	unsigned int tenths;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_DIAG_THREAD_CPU);
+
+	out = run("diag cpu 300");
+	zassert_not_null(strstr(out, "CPU over 300 ms"), "%s", out);
+
+	line = find_line(out, "busy");
+	zassert_not_null(line, "%s", out);
+	zassert_equal(sscanf(line, " %u.%u", &whole, &tenths), 2, "%s", line);
+	zassert_within(whole, 66, 10, "%s", out);
+
+	line = find_line(out, "idle");
+	zassert_not_null(line, "%s", out);
+
+	zassert_not_ok(shell_execute_cmd(shell_backend_dummy_get_ptr(),
+					 "diag cpu 0"));
+}
+
+ZTEST(diag, test_stacks)
+{
+	const char *out = run("diag stacks");
+
+	zassert_not_null(strstr(out, "size"), "%s", out);
+	zassert_not_null(find_line(out, "busy"), "%s", out);
+}
+
+ZTEST(diag, test_pipeline)
+{
+	const char *out = run("diag pipeline");
+
+	zassert_not_null(strstr(out, "No pipeline started"), "%s", out);
+
+	zassert_ok(pipeline_start(&probe));
+	k_msleep(250);
+	out = run("diag pipeline");
+	zassert_ok(pipeline_stop(&probe));
+
+	zassert_not_null(strstr(out, "probe: every 100 ms"), "%s", out);
+	zassert_not_null(strstr(out, "queue 0/4 samples"), "%s", out);
+	zassert_not_null(strstr(out, "3 acquired"), "%s", out);
+}
+
+static void *diag_setup(void)
+{
+	const struct shell *sh = shell_backend_dummy_get_ptr();
+
+	zassert_true(WAIT_FOR(shell_ready(sh), 20000, k_msleep(1)),
+		     "shell not ready");
+
+	return NULL;
+}
+
+ZTEST_SUITE(diag, NULL, diag_setup, NULL, NULL, NULL);
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test filters library
+ *
+ * The filters are checked on hand-picked readings, then on noisy readings
+ * with outliers, where the median and trimmed mean must stay close to the
+ * true level while the mean is pulled away.
+ */
+
+#include <stdlib.h>
+
+#include <zephyr/ztest.h>
+
+#include <app/lib/filters.h>
+
+ZTEST(filters, test_mean)
+{
+	zassert_equal(filter_mean((const int32_t[]){ 7 }, 1), 7);
+	zassert_equal(filter_mean((const int32_t[]){ 1, 2, 3, 4 }, 4), 3);
+	zassert_equal(filter_mean((const int32_t[]){ 1, 2, 3, 3 }, 4), 2);
+	/* Halves round away from zero, on both sides */
+	zassert_equal(filter_mean((const int32_t[]){ 1, 2 }, 2), 2);
+	zassert_equal(filter_mean((const int32_t[]){ -1, -2 }, 2), -2);
+	/* No overflow on large readings */
+	zassert_equal(filter_mean((const int32_t[]){ INT32_MAX, INT32_MAX,
+						      INT32_MAX }, 3),
+		      INT32_MAX);
+	zassert_equal(filter_mean((const int32_t[]){ INT32_MIN, INT32_MIN }, 2),
+		      INT32_MIN);
+}
+
+ZTEST(filters, test_median)
+{
+	int32_t odd[] = { 5, -3, 9, 1, 4 };
+	int32_t even[] = { 10, 2, 8, 4 };
+	int32_t dups[] = { 3, 3, 1, 3 };
+
+	zassert_equal(filter_median(odd, ARRAY_SIZE(odd)), 4);
+	/* Sorted in place */
+	for (size_t i = 1; i < ARRAY_SIZE(odd); i++) {
+		zassert_true(odd[i - 1] <= odd[i]);
+	}
+
+	zassert_equal(filter_median(even, ARRAY_SIZE(even)), 6);
+	zassert_equal(filter_median(dups, ARRAY_SIZE(dups)), 3);
+	zassert_equal(filter_median((int32_t[]){ -5 }, 1), -5);
+}
+
+ZTEST(filters, test_trimmed_mean)
+{
+	int32_t values[] = { 100, 1, 2, 3, 4, 5, 6, -100 };
+
+	zassert_equal(filter_trimmed_mean(values, ARRAY_SIZE(values), 0), 3);
+	zassert_equal(filter_trimmed_mean(values, ARRAY_SIZE(values), 1), 4);
+	zassert_equal(filter_trimmed_mean(values, ARRAY_SIZE(values), 2), 4);
+	/* Trimming everything falls back to the median */
+	zassert_equal(filter_trimmed_mean(values, ARRAY_SIZE(values), 4),
+		      filter_median(values, ARRAY_SIZE(values)));
+	zassert_equal(filter_trimmed_mean((int32_t[]){ 1, 50, 2 }, 3, 1), 2);
+}
+
+ZTEST(filters, test_apply)
+{
+	int32_t values[] = { 9, 1, 5, 3, 7, 1000, 4, 6 };
+	int32_t out;
+
+	zassert_ok(filter_apply(FILTER_MEAN, values, ARRAY_SIZE(values),
+				&out));
+	zassert_equal(out, 129);
+	zassert_ok(filter_apply(FILTER_MEDIAN, values, ARRAY_SIZE(values),
+				&out));
+	zassert_equal(out, 6);
+	/* A quarter trimmed at each end: 4 5 6 7 */
+	zassert_ok(filter_apply(FILTER_TRIMMED_MEAN, values,
+				ARRAY_SIZE(values), &out));
+	zassert_equal(out, 6);
+
+	zassert_equal(filter_apply(FILTER_MEAN, values, 0, &out), -EINVAL);
+	zassert_equal(filter_apply((enum filter_type)42, values, 1, &out),
+		      -EINVAL);
+
+	zassert_str_equal(filter_name(FILTER_MEDIAN), "median");
+	zassert_str_equal(filter_name(FILTER_TRIMMED_MEAN), "trimmed-mean");
+	zassert_is_null(filter_name((enum filter_type)42));
+}
+
+#define LEVEL 21000
+#define ROUNDS 200
+#define READINGS 8
+
+static uint32_t rand_state;
+
+/* Deterministic, uniform in [-amplitude, amplitude] */
+static int32_t uniform(int32_t amplitude)
+{
+	rand_state = rand_state * 1664525U + 1013904223U;
+
+	return (int32_t)((rand_state >> 8) % (uint32_t)(2 * amplitude + 1)) -
+	       amplitude;
+}
+
+/*
+ * Readings with noise of 100 and, in one round out of four, one spike of
+ * 5000, as from a disturbed conversion. Returns the mean absolute error of
+ * the filtered level.
+ */
+static uint32_t error_with_spikes(enum filter_type type)
+{
+	int64_t error = 0;
+
+	rand_state = 1;
+
+	for (int r = 0; r < ROUNDS; r++) {
+		int32_t values[READINGS];
+		int32_t out;
+
+		for (int i = 0; i < READINGS; i++) {
+			values[i] = LEVEL + uniform(100);
+		}
+		if (r % 4 == 0) {
+			values[r % READINGS] += 5000;
+		}
+
+		zassert_ok(filter_apply(type, values, READINGS, &out));
+		error += abs(out - LEVEL);
+	}
+
+	return (uint32_t)(error / ROUNDS);
+}
+
+ZTEST(filters, test_outliers)
+{
+	uint32_t mean = error_with_spikes(FILTER_MEAN);
+	uint32_t median = error_with_spikes(FILTER_MEDIAN);
+	uint32_t trimmed = error_with_spikes(FILTER_TRIMMED_MEAN);
+
+	printk("filters: error with spikes, mean %u, median %u, "
+	       "trimmed mean %u\n",
+	       mean, median, trimmed);
+
+	/* A spike moves the mean by 5000 / 8, the others barely */
+	zassert_true(mean > 100, "mean %u", mean);
+	zassert_true(median < 50, "median %u", median);
+	zassert_true(trimmed < 50, "trimmed mean %u", trimmed);
+}
+
+ZTEST_SUITE(filters, NULL, NULL, NULL, NULL, NULL);
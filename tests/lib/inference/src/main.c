@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test inference library
+ *
+ * Windows like those passed on by a change detection stage around a change
+ * (4 samples before, the change and 8 after) are classified with the
+ * backend compiled in, and the latency and RAM of each classification are
+ * reported. The windows are cut by scripts/room_model.py from the week the
+ * esp32s3_demo_edgeimpulse application replays on native_sim, around the
+ * events its header lists and at quiet times, at sampling periods of 1, 3
+ * and 5 minutes. That trace is itself simulated, but the TFLite Micro
+ * model was trained on synthetic windows of its own, not on these.
+ */
+
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+#include <app/lib/inference.h>
+#include <app/lib/pipeline.h>
+
+#include "week_windows.h"
+
+#define WINDOW WEEK_WINDOW
+#define NUM_EVENTS ((int)ARRAY_SIZE(labels))
+
+NET_BUF_POOL_FIXED_DEFINE(window_pool, WINDOW, sizeof(struct pipeline_sample),
+			  0, NULL);
+
+/* Events of the week, as labelled by both models */
+static const char *const labels[] = {
+	"steady", "heating", "cooling", "airing", "shower",
+};
+
+#ifdef CONFIG_INFERENCE_BACKEND_CENTROID
+
+/* 243 of the 297 windows, 81%: 43 heating or cooling ones read steady */
+#define MIN_CORRECT_PCT 75
+
+/* Features: change and range of the temperature, then of the humidity */
+static const struct inference_class classes[] = {
+	{ "steady", { 0, 100, 0, 300 } },
+	{ "heating", { 2200, 2200, -2000, 2000 } },
+	{ "cooling", { -2200, 2200, 2000, 2000 } },
+	{ "airing", { -500, 1800, 1000, 5500 } },
+	{ "shower", { 600, 600, 20000, 20000 } },
+};
+
+static const int32_t scale[] = { 700, 700, 2500, 2500 };
+
+static const struct inference_model model = {
+	.num_values = 2,
+	.scale = scale,
+	.classes = classes,
+	.num_classes = ARRAY_SIZE(classes),
+};
+
+static const struct inference_model bad_model = {
+	.num_values = 2,
+	.scale = (const int32_t[]){ 700, 0, 2500, 2500 },
+	.classes = classes,
+	.num_classes = 1,
+};
+
+#elif defined(CONFIG_INFERENCE_BACKEND_TFLM)
+
+/* 285 of the 297 windows, 96%, when run with numpy by room_model.py */
+#define MIN_CORRECT_PCT 90
+
+/* The application's model, see its CMakeLists.txt */
+static const uint8_t room_tflite[] __aligned(16) = {
+#include "room.tflite.inc"
+};
+
+static const struct inference_model model = {
+	.tflite = room_tflite,
+	.num_values = 2,
+	.labels = labels,
+	.num_labels = ARRAY_SIZE(labels),
+};
+
+/* One output short of the model */
+static const struct inference_model bad_model = {
+	.tflite = room_tflite,
+	.num_values = 2,
+	.labels = labels,
+	.num_labels = ARRAY_SIZE(labels) - 1,
+};
+
+#endif
+
+static struct net_buf *make_window(const struct week_window *week)
+{
+	struct net_buf *head = NULL;
+
+	for (int i = 0; i < WINDOW; i++) {
+		struct net_buf *buf = net_buf_alloc(&window_pool, K_NO_WAIT);
+		struct pipeline_sample *sample;
+
+		zassert_not_null(buf, "window pool exhausted");
+
+		sample = net_buf_add(buf, sizeof(*sample));
+		*sample = (struct pipeline_sample){ .count = 2 };
+		for (int v = 0; v < 2; v++) {
+			(void)sensor_value_from_milli(&sample->values[v],
+						      week->milli[i][v]);
+		}
+
+		if (head == NULL) {
+			head = buf;
+		} else {
+			net_buf_frag_add(head, buf);
+		}
+	}
+
+	return head;
+}
+
+static int label_index(const char *label)
+{
+	for (int c = 0; c < NUM_EVENTS; c++) {
+		if (strcmp(label, labels[c]) == 0) {
+			return c;
+		}
+	}
+
+	return -1;
+}
+
+ZTEST(inference, test_a_no_model)
+{
+	struct inference_result result;
+	struct net_buf *window = make_window(&week_windows[0]);
+
+	zassert_equal(inference_classify(window, &result), -ENODEV);
+	net_buf_unref(window);
+
+	zassert_equal(inference_model_set(NULL), -EINVAL);
+	zassert_equal(inference_model_set(&bad_model), -EINVAL,
+		      "malformed model accepted");
+}
+
+ZTEST(inference, test_b_mismatch)
+{
+	struct inference_result result;
+	struct net_buf *window;
+
+	zassert_ok(inference_model_set(&model));
+
+	window = make_window(&week_windows[0]);
+	pipeline_sample(window->frags)->count = 1;
+	zassert_equal(inference_classify(window, &result), -EINVAL);
+	net_buf_unref(window);
+
+	zassert_equal(inference_classify(NULL, &result), -EINVAL);
+}
+
+ZTEST(inference, test_c_dataset)
+{
+	uint32_t confusion[NUM_EVENTS][NUM_EVENTS] = { 0 };
+	struct inference_stats before, after;
+	size_t unused_stack = 0;
+	uint32_t correct = 0;
+	uint32_t runs;
+
+	zassert_ok(inference_model_set(&model));
+	inference_stats_get(&before);
+
+	for (size_t n = 0; n < ARRAY_SIZE(week_windows); n++) {
+		struct net_buf *window = make_window(&week_windows[n]);
+		int event = label_index(week_windows[n].label);
+		struct inference_result result;
+		int found;
+
+		zassert_ok(inference_classify(window, &result));
+		zassert_equal(result.samples, WINDOW);
+		zassert_true(result.score <= 1000);
+		net_buf_unref(window);
+
+		found = label_index(result.label);
+		zassert_true(event >= 0 && found >= 0, "unknown label");
+		confusion[event][found]++;
+		correct += found == event;
+	}
+
+	inference_stats_get(&after);
+	runs = after.runs - before.runs;
+	zassert_equal(runs, ARRAY_SIZE(week_windows));
+	zassert_equal(after.failures, before.failures);
+
+	(void)k_thread_stack_space_get(k_current_get(), &unused_stack);
+
+	for (int e = 0; e < NUM_EVENTS; e++) {
+		printk("inference: %-8s", labels[e]);
+		for (int c = 0; c < NUM_EVENTS; c++) {
+			printk(" %3u", confusion[e][c]);
+		}
+		printk("\n");
+	}
+	printk("inference: %s, %u windows, %u%% correct, latency avg %u us "
+	       "max %u us, RAM %u bytes static, stack %u bytes free\n",
+	       inference_backend_name(), runs, 100U * correct / runs,
+	       (uint32_t)((after.total_latency_us - before.total_latency_us) /
+			  runs),
+	       after.max_latency_us, after.ram_bytes, (uint32_t)unused_stack);
+
+	zassert_true(correct * 100 >= runs * MIN_CORRECT_PCT,
+		     "%u of %u correct", correct, runs);
+}
+
+ZTEST_SUITE(inference, NULL, NULL, NULL, NULL, NULL);
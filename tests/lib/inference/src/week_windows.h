@@ -0,0 +1,1812 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Generated by scripts/room_model.py, do not edit. Windows around
+ * the events of apps/esp32s3_demo_edgeimpulse/sim/week.csv
+ * and at quiet times.
+ */
+
+#ifndef WEEK_WINDOWS_H_
+#define WEEK_WINDOWS_H_
+
+#include <stdint.h>
+
+#define WEEK_WINDOW 13
+
+struct week_window {
+	const char *label;
+	uint16_t period_s;
+	uint32_t change_s;
+	int32_t milli[WEEK_WINDOW][2];
+};
+
+static const struct week_window week_windows[] = {
+	{ "heating", 60, 23460,
+	  { { 17664, 51736 }, { 17746, 51604 }, { 17828, 51472 },
+	    { 17910, 51340 }, { 17982, 51224 }, { 18054, 51108 },
+	    { 18126, 50992 }, { 18198, 50876 }, { 18270, 50760 },
+	    { 18334, 50658 }, { 18398, 50556 }, { 18462, 50454 },
+	    { 18526, 50352 } } },
+	{ "heating", 60, 23520,
+	  { { 17746, 51604 }, { 17828, 51472 }, { 17910, 51340 },
+	    { 17982, 51224 }, { 18054, 51108 }, { 18126, 50992 },
+	    { 18198, 50876 }, { 18270, 50760 }, { 18334, 50658 },
+	    { 18398, 50556 }, { 18462, 50454 }, { 18526, 50352 },
+	    { 18590, 50250 } } },
+	{ "heating", 60, 23580,
+	  { { 17828, 51472 }, { 17910, 51340 }, { 17982, 51224 },
+	    { 18054, 51108 }, { 18126, 50992 }, { 18198, 50876 },
+	    { 18270, 50760 }, { 18334, 50658 }, { 18398, 50556 },
+	    { 18462, 50454 }, { 18526, 50352 }, { 18590, 50250 },
+	    { 18648, 50160 } } },
+	{ "cooling", 60, 79260,
+	  { { 20836, 46664 }, { 20754, 46796 }, { 20672, 46928 },
+	    { 20590, 47060 }, { 20518, 47176 }, { 20446, 47292 },
+	    { 20374, 47408 }, { 20302, 47524 }, { 20230, 47640 },
+	    { 20166, 47742 }, { 20102, 47844 }, { 20038, 47946 },
+	    { 19974, 48048 } } },
+	{ "cooling", 60, 79320,
+	  { { 20754, 46796 }, { 20672, 46928 }, { 20590, 47060 },
+	    { 20518, 47176 }, { 20446, 47292 }, { 20374, 47408 },
+	    { 20302, 47524 }, { 20230, 47640 }, { 20166, 47742 },
+	    { 20102, 47844 }, { 20038, 47946 }, { 19974, 48048 },
+	    { 19910, 48150 } } },
+	{ "cooling", 60, 79380,
+	  { { 20672, 46928 }, { 20590, 47060 }, { 20518, 47176 },
+	    { 20446, 47292 }, { 20374, 47408 }, { 20302, 47524 },
+	    { 20230, 47640 }, { 20166, 47742 }, { 20102, 47844 },
+	    { 20038, 47946 }, { 19974, 48048 }, { 19910, 48150 },
+	    { 19852, 48240 } } },
+	{ "heating", 60, 109860,
+	  { { 17664, 51736 }, { 17746, 51604 }, { 17828, 51472 },
+	    { 17910, 51340 }, { 17982, 51224 }, { 18054, 51108 },
+	    { 18126, 50992 }, { 18198, 50876 }, { 18270, 50760 },
+	    { 18334, 50658 }, { 18398, 50556 }, { 18462, 50454 },
+	    { 18526, 50352 } } },
+	{ "heating", 60, 109920,
+	  { { 17746, 51604 }, { 17828, 51472 }, { 17910, 51340 },
+	    { 17982, 51224 }, { 18054, 51108 }, { 18126, 50992 },
+	    { 18198, 50876 }, { 18270, 50760 }, { 18334, 50658 },
+	    { 18398, 50556 }, { 18462, 50454 }, { 18526, 50352 },
+	    { 18590, 50250 } } },
+	{ "heating", 60, 109980,
+	  { { 17828, 51472 }, { 17910, 51340 }, { 17982, 51224 },
+	    { 18054, 51108 }, { 18126, 50992 }, { 18198, 50876 },
+	    { 18270, 50760 }, { 18334, 50658 }, { 18398, 50556 },
+	    { 18462, 50454 }, { 18526, 50352 }, { 18590, 50250 },
+	    { 18648, 50160 } } },
+	{ "shower", 60, 114060,
+	  { { 20418, 54526 }, { 20432, 58104 }, { 20446, 61682 },
+	    { 20460, 65260 }, { 20474, 64860 }, { 20488, 64460 },
+	    { 20502, 64060 }, { 20516, 63660 }, { 20530, 63260 },
+	    { 20540, 62904 }, { 20550, 62548 }, { 20560, 62192 },
+	    { 20570, 61836 } } },
+	{ "shower", 60, 114120,
+	  { { 20432, 58104 }, { 20446, 61682 }, { 20460, 65260 },
+	    { 20474, 64860 }, { 20488, 64460 }, { 20502, 64060 },
+	    { 20516, 63660 }, { 20530, 63260 }, { 20540, 62904 },
+	    { 20550, 62548 }, { 20560, 62192 }, { 20570, 61836 },
+	    { 20580, 61480 } } },
+	{ "shower", 60, 114180,
+	  { { 20446, 61682 }, { 20460, 65260 }, { 20474, 64860 },
+	    { 20488, 64460 }, { 20502, 64060 }, { 20516, 63660 },
+	    { 20530, 63260 }, { 20540, 62904 }, { 20550, 62548 },
+	    { 20560, 62192 }, { 20570, 61836 }, { 20580, 61480 },
+	    { 20590, 61162 } } },
+	{ "cooling", 60, 165660,
+	  { { 20836, 46664 }, { 20754, 46796 }, { 20672, 46928 },
+	    { 20590, 47060 }, { 20518, 47176 }, { 20446, 47292 },
+	    { 20374, 47408 }, { 20302, 47524 }, { 20230, 47640 },
+	    { 20166, 47742 }, { 20102, 47844 }, { 20038, 47946 },
+	    { 19974, 48048 } } },
+	{ "cooling", 60, 165720,
+	  { { 20754, 46796 }, { 20672, 46928 }, { 20590, 47060 },
+	    { 20518, 47176 }, { 20446, 47292 }, { 20374, 47408 },
+	    { 20302, 47524 }, { 20230, 47640 }, { 20166, 47742 },
+	    { 20102, 47844 }, { 20038, 47946 }, { 19974, 48048 },
+	    { 19910, 48150 } } },
+	{ "cooling", 60, 165780,
+	  { { 20672, 46928 }, { 20590, 47060 }, { 20518, 47176 },
+	    { 20446, 47292 }, { 20374, 47408 }, { 20302, 47524 },
+	    { 20230, 47640 }, { 20166, 47742 }, { 20102, 47844 },
+	    { 20038, 47946 }, { 19974, 48048 }, { 19910, 48150 },
+	    { 19852, 48240 } } },
+	{ "heating", 60, 196260,
+	  { { 17664, 51736 }, { 17746, 51604 }, { 17828, 51472 },
+	    { 17910, 51340 }, { 17982, 51224 }, { 18054, 51108 },
+	    { 18126, 50992 }, { 18198, 50876 }, { 18270, 50760 },
+	    { 18334, 50658 }, { 18398, 50556 }, { 18462, 50454 },
+	    { 18526, 50352 } } },
+	{ "heating", 60, 196320,
+	  { { 17746, 51604 }, { 17828, 51472 }, { 17910, 51340 },
+	    { 17982, 51224 }, { 18054, 51108 }, { 18126, 50992 },
+	    { 18198, 50876 }, { 18270, 50760 }, { 18334, 50658 },
+	    { 18398, 50556 }, { 18462, 50454 }, { 18526, 50352 },
+	    { 18590, 50250 } } },
+	{ "heating", 60, 196380,
+	  { { 17828, 51472 }, { 17910, 51340 }, { 17982, 51224 },
+	    { 18054, 51108 }, { 18126, 50992 }, { 18198, 50876 },
+	    { 18270, 50760 }, { 18334, 50658 }, { 18398, 50556 },
+	    { 18462, 50454 }, { 18526, 50352 }, { 18590, 50250 },
+	    { 18648, 50160 } } },
+	{ "cooling", 60, 252060,
+	  { { 20836, 46664 }, { 20754, 46796 }, { 20672, 46928 },
+	    { 20590, 47060 }, { 20518, 47176 }, { 20446, 47292 },
+	    { 20374, 47408 }, { 20302, 47524 }, { 20230, 47640 },
+	    { 20166, 47742 }, { 20102, 47844 }, { 20038, 47946 },
+	    { 19974, 48048 } } },
+	{ "cooling", 60, 252120,
+	  { { 20754, 46796 }, { 20672, 46928 }, { 20590, 47060 },
+	    { 20518, 47176 }, { 20446, 47292 }, { 20374, 47408 },
+	    { 20302, 47524 }, { 20230, 47640 }, { 20166, 47742 },
+	    { 20102, 47844 }, { 20038, 47946 }, { 19974, 48048 },
+	    { 19910, 48150 } } },
+	{ "cooling", 60, 252180,
+	  { { 20672, 46928 }, { 20590, 47060 }, { 20518, 47176 },
+	    { 20446, 47292 }, { 20374, 47408 }, { 20302, 47524 },
+	    { 20230, 47640 }, { 20166, 47742 }, { 20102, 47844 },
+	    { 20038, 47946 }, { 19974, 48048 }, { 19910, 48150 },
+	    { 19852, 48240 } } },
+	{ "heating", 60, 282660,
+	  { { 17664, 51736 }, { 17746, 51604 }, { 17828, 51472 },
+	    { 17910, 51340 }, { 17982, 51224 }, { 18054, 51108 },
+	    { 18126, 50992 }, { 18198, 50876 }, { 18270, 50760 },
+	    { 18334, 50658 }, { 18398, 50556 }, { 18462, 50454 },
+	    { 18526, 50352 } } },
+	{ "heating", 60, 282720,
+	  { { 17746, 51604 }, { 17828, 51472 }, { 17910, 51340 },
+	    { 17982, 51224 }, { 18054, 51108 }, { 18126, 50992 },
+	    { 18198, 50876 }, { 18270, 50760 }, { 18334, 50658 },
+	    { 18398, 50556 }, { 18462, 50454 }, { 18526, 50352 },
+	    { 18590, 50250 } } },
+	{ "heating", 60, 282780,
+	  { { 17828, 51472 }, { 17910, 51340 }, { 17982, 51224 },
+	    { 18054, 51108 }, { 18126, 50992 }, { 18198, 50876 },
+	    { 18270, 50760 }, { 18334, 50658 }, { 18398, 50556 },
+	    { 18462, 50454 }, { 18526, 50352 }, { 18590, 50250 },
+	    { 18648, 50160 } } },
+	{ "airing", 60, 309960,
+	  { { 20908, 42440 }, { 20342, 41290 }, { 19776, 40140 },
+	    { 19210, 38990 }, { 19052, 38656 }, { 18894, 38322 },
+	    { 18736, 37988 }, { 18578, 37654 }, { 18420, 37320 },
+	    { 18376, 37218 }, { 18332, 37116 }, { 18288, 37014 },
+	    { 18244, 36912 } } },
+	{ "airing", 60, 310020,
+	  { { 20342, 41290 }, { 19776, 40140 }, { 19210, 38990 },
+	    { 19052, 38656 }, { 18894, 38322 }, { 18736, 37988 },
+	    { 18578, 37654 }, { 18420, 37320 }, { 18376, 37218 },
+	    { 18332, 37116 }, { 18288, 37014 }, { 18244, 36912 },
+	    { 18200, 36810 } } },
+	{ "airing", 60, 310080,
+	  { { 19776, 40140 }, { 19210, 38990 }, { 19052, 38656 },
+	    { 18894, 38322 }, { 18736, 37988 }, { 18578, 37654 },
+	    { 18420, 37320 }, { 18376, 37218 }, { 18332, 37116 },
+	    { 18288, 37014 }, { 18244, 36912 }, { 18200, 36810 },
+	    { 18324, 37044 } } },
+	{ "cooling", 60, 338460,
+	  { { 20836, 46664 }, { 20754, 46796 }, { 20672, 46928 },
+	    { 20590, 47060 }, { 20518, 47176 }, { 20446, 47292 },
+	    { 20374, 47408 }, { 20302, 47524 }, { 20230, 47640 },
+	    { 20166, 47742 }, { 20102, 47844 }, { 20038, 47946 },
+	    { 19974, 48048 } } },
+	{ "cooling", 60, 338520,
+	  { { 20754, 46796 }, { 20672, 46928 }, { 20590, 47060 },
+	    { 20518, 47176 }, { 20446, 47292 }, { 20374, 47408 },
+	    { 20302, 47524 }, { 20230, 47640 }, { 20166, 47742 },
+	    { 20102, 47844 }, { 20038, 47946 }, { 19974, 48048 },
+	    { 19910, 48150 } } },
+	{ "cooling", 60, 338580,
+	  { { 20672, 46928 }, { 20590, 47060 }, { 20518, 47176 },
+	    { 20446, 47292 }, { 20374, 47408 }, { 20302, 47524 },
+	    { 20230, 47640 }, { 20166, 47742 }, { 20102, 47844 },
+	    { 20038, 47946 }, { 19974, 48048 }, { 19910, 48150 },
+	    { 19852, 48240 } } },
+	{ "heating", 60, 369060,
+	  { { 17664, 51736 }, { 17746, 51604 }, { 17828, 51472 },
+	    { 17910, 51340 }, { 17982, 51224 }, { 18054, 51108 },
+	    { 18126, 50992 }, { 18198, 50876 }, { 18270, 50760 },
+	    { 18334, 50658 }, { 18398, 50556 }, { 18462, 50454 },
+	    { 18526, 50352 } } },
+	{ "heating", 60, 369120,
+	  { { 17746, 51604 }, { 17828, 51472 }, { 17910, 51340 },
+	    { 17982, 51224 }, { 18054, 51108 }, { 18126, 50992 },
+	    { 18198, 50876 }, { 18270, 50760 }, { 18334, 50658 },
+	    { 18398, 50556 }, { 18462, 50454 }, { 18526, 50352 },
+	    { 18590, 50250 } } },
+	{ "heating", 60, 369180,
+	  { { 17828, 51472 }, { 17910, 51340 }, { 17982, 51224 },
+	    { 18054, 51108 }, { 18126, 50992 }, { 18198, 50876 },
+	    { 18270, 50760 }, { 18334, 50658 }, { 18398, 50556 },
+	    { 18462, 50454 }, { 18526, 50352 }, { 18590, 50250 },
+	    { 18648, 50160 } } },
+	{ "cooling", 60, 424860,
+	  { { 20836, 46664 }, { 20754, 46796 }, { 20672, 46928 },
+	    { 20590, 47060 }, { 20518, 47176 }, { 20446, 47292 },
+	    { 20374, 47408 }, { 20302, 47524 }, { 20230, 47640 },
+	    { 20166, 47742 }, { 20102, 47844 }, { 20038, 47946 },
+	    { 19974, 48048 } } },
+	{ "cooling", 60, 424920,
+	  { { 20754, 46796 }, { 20672, 46928 }, { 20590, 47060 },
+	    { 20518, 47176 }, { 20446, 47292 }, { 20374, 47408 },
+	    { 20302, 47524 }, { 20230, 47640 }, { 20166, 47742 },
+	    { 20102, 47844 }, { 20038, 47946 }, { 19974, 48048 },
+	    { 19910, 48150 } } },
+	{ "cooling", 60, 424980,
+	  { { 20672, 46928 }, { 20590, 47060 }, { 20518, 47176 },
+	    { 20446, 47292 }, { 20374, 47408 }, { 20302, 47524 },
+	    { 20230, 47640 }, { 20166, 47742 }, { 20102, 47844 },
+	    { 20038, 47946 }, { 19974, 48048 }, { 19910, 48150 },
+	    { 19852, 48240 } } },
+	{ "heating", 60, 459060,
+	  { { 17664, 51736 }, { 17746, 51604 }, { 17828, 51472 },
+	    { 17910, 51340 }, { 17982, 51224 }, { 18054, 51108 },
+	    { 18126, 50992 }, { 18198, 50876 }, { 18270, 50760 },
+	    { 18334, 50658 }, { 18398, 50556 }, { 18462, 50454 },
+	    { 18526, 50352 } } },
+	{ "heating", 60, 459120,
+	  { { 17746, 51604 }, { 17828, 51472 }, { 17910, 51340 },
+	    { 17982, 51224 }, { 18054, 51108 }, { 18126, 50992 },
+	    { 18198, 50876 }, { 18270, 50760 }, { 18334, 50658 },
+	    { 18398, 50556 }, { 18462, 50454 }, { 18526, 50352 },
+	    { 18590, 50250 } } },
+	{ "heating", 60, 459180,
+	  { { 17828, 51472 }, { 17910, 51340 }, { 17982, 51224 },
+	    { 18054, 51108 }, { 18126, 50992 }, { 18198, 50876 },
+	    { 18270, 50760 }, { 18334, 50658 }, { 18398, 50556 },
+	    { 18462, 50454 }, { 18526, 50352 }, { 18590, 50250 },
+	    { 18648, 50160 } } },
+	{ "cooling", 60, 511260,
+	  { { 17836, 50264 }, { 17754, 50396 }, { 17672, 50528 },
+	    { 17590, 50660 }, { 17518, 50776 }, { 17446, 50892 },
+	    { 17374, 51008 }, { 17302, 51124 }, { 17230, 51240 },
+	    { 17166, 51342 }, { 17102, 51444 }, { 17038, 51546 },
+	    { 16974, 51648 } } },
+	{ "cooling", 60, 511320,
+	  { { 17754, 50396 }, { 17672, 50528 }, { 17590, 50660 },
+	    { 17518, 50776 }, { 17446, 50892 }, { 17374, 51008 },
+	    { 17302, 51124 }, { 17230, 51240 }, { 17166, 51342 },
+	    { 17102, 51444 }, { 17038, 51546 }, { 16974, 51648 },
+	    { 16910, 51750 } } },
+	{ "cooling", 60, 511380,
+	  { { 17672, 50528 }, { 17590, 50660 }, { 17518, 50776 },
+	    { 17446, 50892 }, { 17374, 51008 }, { 17302, 51124 },
+	    { 17230, 51240 }, { 17166, 51342 }, { 17102, 51444 },
+	    { 17038, 51546 }, { 16974, 51648 }, { 16910, 51750 },
+	    { 16852, 51840 } } },
+	{ "heating", 60, 518460,
+	  { { 15802, 53992 }, { 16368, 53328 }, { 16934, 52664 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "heating", 60, 518520,
+	  { { 16368, 53328 }, { 16934, 52664 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "heating", 60, 518580,
+	  { { 16934, 52664 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "heating", 60, 545460,
+	  { { 17664, 51736 }, { 17746, 51604 }, { 17828, 51472 },
+	    { 17910, 51340 }, { 17982, 51224 }, { 18054, 51108 },
+	    { 18126, 50992 }, { 18198, 50876 }, { 18270, 50760 },
+	    { 18334, 50658 }, { 18398, 50556 }, { 18462, 50454 },
+	    { 18526, 50352 } } },
+	{ "heating", 60, 545520,
+	  { { 17746, 51604 }, { 17828, 51472 }, { 17910, 51340 },
+	    { 17982, 51224 }, { 18054, 51108 }, { 18126, 50992 },
+	    { 18198, 50876 }, { 18270, 50760 }, { 18334, 50658 },
+	    { 18398, 50556 }, { 18462, 50454 }, { 18526, 50352 },
+	    { 18590, 50250 } } },
+	{ "heating", 60, 545580,
+	  { { 17828, 51472 }, { 17910, 51340 }, { 17982, 51224 },
+	    { 18054, 51108 }, { 18126, 50992 }, { 18198, 50876 },
+	    { 18270, 50760 }, { 18334, 50658 }, { 18398, 50556 },
+	    { 18462, 50454 }, { 18526, 50352 }, { 18590, 50250 },
+	    { 18648, 50160 } } },
+	{ "cooling", 60, 597660,
+	  { { 20836, 46664 }, { 20754, 46796 }, { 20672, 46928 },
+	    { 20590, 47060 }, { 20518, 47176 }, { 20446, 47292 },
+	    { 20374, 47408 }, { 20302, 47524 }, { 20230, 47640 },
+	    { 20166, 47742 }, { 20102, 47844 }, { 20038, 47946 },
+	    { 19974, 48048 } } },
+	{ "cooling", 60, 597720,
+	  { { 20754, 46796 }, { 20672, 46928 }, { 20590, 47060 },
+	    { 20518, 47176 }, { 20446, 47292 }, { 20374, 47408 },
+	    { 20302, 47524 }, { 20230, 47640 }, { 20166, 47742 },
+	    { 20102, 47844 }, { 20038, 47946 }, { 19974, 48048 },
+	    { 19910, 48150 } } },
+	{ "cooling", 60, 597780,
+	  { { 20672, 46928 }, { 20590, 47060 }, { 20518, 47176 },
+	    { 20446, 47292 }, { 20374, 47408 }, { 20302, 47524 },
+	    { 20230, 47640 }, { 20166, 47742 }, { 20102, 47844 },
+	    { 20038, 47946 }, { 19974, 48048 }, { 19910, 48150 },
+	    { 19852, 48240 } } },
+	{ "steady", 60, 7200,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 14400,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 39600,
+	  { { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46408 }, { 21000, 46406 },
+	    { 21000, 46404 } } },
+	{ "steady", 60, 46800,
+	  { { 21560, 45496 }, { 21570, 45482 }, { 21580, 45468 },
+	    { 21590, 45454 }, { 21600, 45440 }, { 21608, 45426 },
+	    { 21616, 45412 }, { 21624, 45398 }, { 21632, 45384 },
+	    { 21640, 45370 }, { 21650, 45356 }, { 21660, 45342 },
+	    { 21670, 45328 } } },
+	{ "steady", 60, 54000,
+	  { { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44482 }, { 22200, 44484 },
+	    { 22200, 44486 } } },
+	{ "steady", 60, 61200,
+	  { { 21632, 45384 }, { 21624, 45398 }, { 21616, 45412 },
+	    { 21608, 45426 }, { 21600, 45440 }, { 21590, 45454 },
+	    { 21580, 45468 }, { 21570, 45482 }, { 21560, 45496 },
+	    { 21550, 45510 }, { 21542, 45526 }, { 21534, 45542 },
+	    { 21526, 45558 } } },
+	{ "steady", 60, 72000,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 60, 93600,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 100800,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 126000,
+	  { { 21000, 46636 }, { 21000, 46632 }, { 21000, 46628 },
+	    { 21000, 46624 }, { 21000, 46620 }, { 21000, 46614 },
+	    { 21000, 46608 }, { 21000, 46602 }, { 21000, 46596 },
+	    { 21000, 46590 }, { 21000, 46586 }, { 21000, 46582 },
+	    { 21000, 46578 } } },
+	{ "steady", 60, 133200,
+	  { { 21560, 45514 }, { 21570, 45498 }, { 21580, 45482 },
+	    { 21590, 45466 }, { 21600, 45450 }, { 21608, 45436 },
+	    { 21616, 45422 }, { 21624, 45408 }, { 21632, 45394 },
+	    { 21640, 45380 }, { 21650, 45366 }, { 21660, 45352 },
+	    { 21670, 45338 } } },
+	{ "steady", 60, 140400,
+	  { { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44482 }, { 22200, 44484 },
+	    { 22200, 44486 } } },
+	{ "steady", 60, 147600,
+	  { { 21632, 45384 }, { 21624, 45398 }, { 21616, 45412 },
+	    { 21608, 45426 }, { 21600, 45440 }, { 21590, 45454 },
+	    { 21580, 45468 }, { 21570, 45482 }, { 21560, 45496 },
+	    { 21550, 45510 }, { 21542, 45526 }, { 21534, 45542 },
+	    { 21526, 45558 } } },
+	{ "steady", 60, 158400,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 60, 180000,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 187200,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 212400,
+	  { { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46408 }, { 21000, 46406 },
+	    { 21000, 46404 } } },
+	{ "steady", 60, 219600,
+	  { { 21560, 45496 }, { 21570, 45482 }, { 21580, 45468 },
+	    { 21590, 45454 }, { 21600, 45440 }, { 21608, 45426 },
+	    { 21616, 45412 }, { 21624, 45398 }, { 21632, 45384 },
+	    { 21640, 45370 }, { 21650, 45356 }, { 21660, 45342 },
+	    { 21670, 45328 } } },
+	{ "steady", 60, 226800,
+	  { { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44482 }, { 22200, 44484 },
+	    { 22200, 44486 } } },
+	{ "steady", 60, 234000,
+	  { { 21632, 45384 }, { 21624, 45398 }, { 21616, 45412 },
+	    { 21608, 45426 }, { 21600, 45440 }, { 21590, 45454 },
+	    { 21580, 45468 }, { 21570, 45482 }, { 21560, 45496 },
+	    { 21550, 45510 }, { 21542, 45526 }, { 21534, 45542 },
+	    { 21526, 45558 } } },
+	{ "steady", 60, 244800,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 60, 266400,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 273600,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 298800,
+	  { { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46408 }, { 21000, 46406 },
+	    { 21000, 46404 } } },
+	{ "steady", 60, 306000,
+	  { { 21560, 45496 }, { 21570, 45482 }, { 21580, 45468 },
+	    { 21590, 45454 }, { 21600, 45440 }, { 21608, 45426 },
+	    { 21616, 45412 }, { 21624, 45398 }, { 21632, 45384 },
+	    { 21640, 45370 }, { 21650, 45356 }, { 21660, 45342 },
+	    { 21670, 45328 } } },
+	{ "steady", 60, 320400,
+	  { { 21620, 45346 }, { 21610, 45362 }, { 21600, 45378 },
+	    { 21590, 45394 }, { 21580, 45410 }, { 21572, 45426 },
+	    { 21564, 45442 }, { 21556, 45458 }, { 21548, 45474 },
+	    { 21540, 45490 }, { 21532, 45506 }, { 21524, 45522 },
+	    { 21516, 45538 } } },
+	{ "steady", 60, 331200,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 60, 352800,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 360000,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 385200,
+	  { { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46408 }, { 21000, 46406 },
+	    { 21000, 46404 } } },
+	{ "steady", 60, 392400,
+	  { { 21560, 45496 }, { 21570, 45482 }, { 21580, 45468 },
+	    { 21590, 45454 }, { 21600, 45440 }, { 21608, 45426 },
+	    { 21616, 45412 }, { 21624, 45398 }, { 21632, 45384 },
+	    { 21640, 45370 }, { 21650, 45356 }, { 21660, 45342 },
+	    { 21670, 45328 } } },
+	{ "steady", 60, 399600,
+	  { { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44482 }, { 22200, 44484 },
+	    { 22200, 44486 } } },
+	{ "steady", 60, 406800,
+	  { { 21632, 45384 }, { 21624, 45398 }, { 21616, 45412 },
+	    { 21608, 45426 }, { 21600, 45440 }, { 21590, 45454 },
+	    { 21580, 45468 }, { 21570, 45482 }, { 21560, 45496 },
+	    { 21550, 45510 }, { 21542, 45526 }, { 21534, 45542 },
+	    { 21526, 45558 } } },
+	{ "steady", 60, 417600,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 60, 439200,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 446400,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 471600,
+	  { { 20604, 46878 }, { 20598, 46886 }, { 20592, 46894 },
+	    { 20586, 46902 }, { 20580, 46910 }, { 20574, 46916 },
+	    { 20568, 46922 }, { 20562, 46928 }, { 20556, 46934 },
+	    { 20550, 46940 }, { 20544, 46948 }, { 20538, 46956 },
+	    { 20532, 46964 } } },
+	{ "steady", 60, 478800,
+	  { { 20392, 46904 }, { 20394, 46898 }, { 20396, 46892 },
+	    { 20398, 46886 }, { 20400, 46880 }, { 20402, 46874 },
+	    { 20404, 46868 }, { 20406, 46862 }, { 20408, 46856 },
+	    { 20410, 46850 }, { 20412, 46844 }, { 20414, 46838 },
+	    { 20416, 46832 } } },
+	{ "steady", 60, 486000,
+	  { { 20224, 46848 }, { 20218, 46856 }, { 20212, 46864 },
+	    { 20206, 46872 }, { 20200, 46880 }, { 20194, 46888 },
+	    { 20188, 46896 }, { 20182, 46904 }, { 20176, 46912 },
+	    { 20170, 46920 }, { 20162, 46930 }, { 20154, 46940 },
+	    { 20146, 46950 } } },
+	{ "steady", 60, 493200,
+	  { { 18864, 48712 }, { 18848, 48734 }, { 18832, 48756 },
+	    { 18816, 48778 }, { 18800, 48800 }, { 18784, 48822 },
+	    { 18768, 48844 }, { 18752, 48866 }, { 18736, 48888 },
+	    { 18720, 48910 }, { 18704, 48934 }, { 18688, 48958 },
+	    { 18672, 48982 } } },
+	{ "steady", 60, 504000,
+	  { { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 18000, 50000 } } },
+	{ "steady", 60, 525600,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 532800,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 60, 558000,
+	  { { 20980, 46430 }, { 20980, 46430 }, { 20980, 46430 },
+	    { 20980, 46430 }, { 20980, 46430 }, { 20982, 46428 },
+	    { 20984, 46426 }, { 20986, 46424 }, { 20988, 46422 },
+	    { 20990, 46420 }, { 20990, 46420 }, { 20990, 46420 },
+	    { 20990, 46420 } } },
+	{ "steady", 60, 565200,
+	  { { 21560, 45496 }, { 21570, 45482 }, { 21580, 45468 },
+	    { 21590, 45454 }, { 21600, 45440 }, { 21608, 45426 },
+	    { 21616, 45412 }, { 21624, 45398 }, { 21632, 45384 },
+	    { 21640, 45370 }, { 21650, 45356 }, { 21660, 45342 },
+	    { 21670, 45328 } } },
+	{ "steady", 60, 572400,
+	  { { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44480 }, { 22200, 44482 }, { 22200, 44484 },
+	    { 22200, 44486 } } },
+	{ "steady", 60, 579600,
+	  { { 21632, 45384 }, { 21624, 45398 }, { 21616, 45412 },
+	    { 21608, 45426 }, { 21600, 45440 }, { 21590, 45454 },
+	    { 21580, 45468 }, { 21570, 45482 }, { 21560, 45496 },
+	    { 21550, 45510 }, { 21542, 45526 }, { 21534, 45542 },
+	    { 21526, 45558 } } },
+	{ "steady", 60, 590400,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "heating", 180, 23580,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17664, 51736 },
+	    { 17910, 51340 }, { 18126, 50992 }, { 18334, 50658 },
+	    { 18526, 50352 }, { 18706, 50070 }, { 18880, 49800 },
+	    { 19030, 49560 }, { 19174, 49330 }, { 19306, 49120 },
+	    { 19426, 48922 } } },
+	{ "heating", 180, 23760,
+	  { { 17500, 52000 }, { 17664, 51736 }, { 17910, 51340 },
+	    { 18126, 50992 }, { 18334, 50658 }, { 18526, 50352 },
+	    { 18706, 50070 }, { 18880, 49800 }, { 19030, 49560 },
+	    { 19174, 49330 }, { 19306, 49120 }, { 19426, 48922 },
+	    { 19540, 48730 } } },
+	{ "heating", 180, 23940,
+	  { { 17664, 51736 }, { 17910, 51340 }, { 18126, 50992 },
+	    { 18334, 50658 }, { 18526, 50352 }, { 18706, 50070 },
+	    { 18880, 49800 }, { 19030, 49560 }, { 19174, 49330 },
+	    { 19306, 49120 }, { 19426, 48922 }, { 19540, 48730 },
+	    { 19642, 48568 } } },
+	{ "cooling", 180, 79380,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 20836, 46664 },
+	    { 20590, 47060 }, { 20374, 47408 }, { 20166, 47742 },
+	    { 19974, 48048 }, { 19794, 48330 }, { 19620, 48600 },
+	    { 19470, 48840 }, { 19326, 49070 }, { 19194, 49280 },
+	    { 19074, 49478 } } },
+	{ "cooling", 180, 79560,
+	  { { 21000, 46400 }, { 20836, 46664 }, { 20590, 47060 },
+	    { 20374, 47408 }, { 20166, 47742 }, { 19974, 48048 },
+	    { 19794, 48330 }, { 19620, 48600 }, { 19470, 48840 },
+	    { 19326, 49070 }, { 19194, 49280 }, { 19074, 49478 },
+	    { 18960, 49670 } } },
+	{ "cooling", 180, 79740,
+	  { { 20836, 46664 }, { 20590, 47060 }, { 20374, 47408 },
+	    { 20166, 47742 }, { 19974, 48048 }, { 19794, 48330 },
+	    { 19620, 48600 }, { 19470, 48840 }, { 19326, 49070 },
+	    { 19194, 49280 }, { 19074, 49478 }, { 18960, 49670 },
+	    { 18858, 49832 } } },
+	{ "heating", 180, 109980,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17664, 51736 },
+	    { 17910, 51340 }, { 18126, 50992 }, { 18334, 50658 },
+	    { 18526, 50352 }, { 18706, 50070 }, { 18880, 49800 },
+	    { 19030, 49560 }, { 19174, 49330 }, { 19306, 49120 },
+	    { 19426, 48922 } } },
+	{ "heating", 180, 110160,
+	  { { 17500, 52000 }, { 17664, 51736 }, { 17910, 51340 },
+	    { 18126, 50992 }, { 18334, 50658 }, { 18526, 50352 },
+	    { 18706, 50070 }, { 18880, 49800 }, { 19030, 49560 },
+	    { 19174, 49330 }, { 19306, 49120 }, { 19426, 48922 },
+	    { 19540, 48730 } } },
+	{ "heating", 180, 110340,
+	  { { 17664, 51736 }, { 17910, 51340 }, { 18126, 50992 },
+	    { 18334, 50658 }, { 18526, 50352 }, { 18706, 50070 },
+	    { 18880, 49800 }, { 19030, 49560 }, { 19174, 49330 },
+	    { 19306, 49120 }, { 19426, 48922 }, { 19540, 48730 },
+	    { 19642, 48568 } } },
+	{ "shower", 180, 114120,
+	  { { 20310, 47500 }, { 20358, 47422 }, { 20404, 50948 },
+	    { 20446, 61682 }, { 20488, 64460 }, { 20530, 63260 },
+	    { 20560, 62192 }, { 20590, 61162 }, { 20620, 60208 },
+	    { 20646, 59318 }, { 20670, 58460 }, { 20694, 57698 },
+	    { 20718, 56962 } } },
+	{ "shower", 180, 114300,
+	  { { 20358, 47422 }, { 20404, 50948 }, { 20446, 61682 },
+	    { 20488, 64460 }, { 20530, 63260 }, { 20560, 62192 },
+	    { 20590, 61162 }, { 20620, 60208 }, { 20646, 59318 },
+	    { 20670, 58460 }, { 20694, 57698 }, { 20718, 56962 },
+	    { 20742, 56278 } } },
+	{ "shower", 180, 114480,
+	  { { 20404, 50948 }, { 20446, 61682 }, { 20488, 64460 },
+	    { 20530, 63260 }, { 20560, 62192 }, { 20590, 61162 },
+	    { 20620, 60208 }, { 20646, 59318 }, { 20670, 58460 },
+	    { 20694, 57698 }, { 20718, 56962 }, { 20742, 56278 },
+	    { 20762, 55642 } } },
+	{ "cooling", 180, 165780,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 20836, 46664 },
+	    { 20590, 47060 }, { 20374, 47408 }, { 20166, 47742 },
+	    { 19974, 48048 }, { 19794, 48330 }, { 19620, 48600 },
+	    { 19470, 48840 }, { 19326, 49070 }, { 19194, 49280 },
+	    { 19074, 49478 } } },
+	{ "cooling", 180, 165960,
+	  { { 21000, 46400 }, { 20836, 46664 }, { 20590, 47060 },
+	    { 20374, 47408 }, { 20166, 47742 }, { 19974, 48048 },
+	    { 19794, 48330 }, { 19620, 48600 }, { 19470, 48840 },
+	    { 19326, 49070 }, { 19194, 49280 }, { 19074, 49478 },
+	    { 18960, 49670 } } },
+	{ "cooling", 180, 166140,
+	  { { 20836, 46664 }, { 20590, 47060 }, { 20374, 47408 },
+	    { 20166, 47742 }, { 19974, 48048 }, { 19794, 48330 },
+	    { 19620, 48600 }, { 19470, 48840 }, { 19326, 49070 },
+	    { 19194, 49280 }, { 19074, 49478 }, { 18960, 49670 },
+	    { 18858, 49832 } } },
+	{ "heating", 180, 196380,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17664, 51736 },
+	    { 17910, 51340 }, { 18126, 50992 }, { 18334, 50658 },
+	    { 18526, 50352 }, { 18706, 50070 }, { 18880, 49800 },
+	    { 19030, 49560 }, { 19174, 49330 }, { 19306, 49120 },
+	    { 19426, 48922 } } },
+	{ "heating", 180, 196560,
+	  { { 17500, 52000 }, { 17664, 51736 }, { 17910, 51340 },
+	    { 18126, 50992 }, { 18334, 50658 }, { 18526, 50352 },
+	    { 18706, 50070 }, { 18880, 49800 }, { 19030, 49560 },
+	    { 19174, 49330 }, { 19306, 49120 }, { 19426, 48922 },
+	    { 19540, 48730 } } },
+	{ "heating", 180, 196740,
+	  { { 17664, 51736 }, { 17910, 51340 }, { 18126, 50992 },
+	    { 18334, 50658 }, { 18526, 50352 }, { 18706, 50070 },
+	    { 18880, 49800 }, { 19030, 49560 }, { 19174, 49330 },
+	    { 19306, 49120 }, { 19426, 48922 }, { 19540, 48730 },
+	    { 19642, 48568 } } },
+	{ "cooling", 180, 252180,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 20836, 46664 },
+	    { 20590, 47060 }, { 20374, 47408 }, { 20166, 47742 },
+	    { 19974, 48048 }, { 19794, 48330 }, { 19620, 48600 },
+	    { 19470, 48840 }, { 19326, 49070 }, { 19194, 49280 },
+	    { 19074, 49478 } } },
+	{ "cooling", 180, 252360,
+	  { { 21000, 46400 }, { 20836, 46664 }, { 20590, 47060 },
+	    { 20374, 47408 }, { 20166, 47742 }, { 19974, 48048 },
+	    { 19794, 48330 }, { 19620, 48600 }, { 19470, 48840 },
+	    { 19326, 49070 }, { 19194, 49280 }, { 19074, 49478 },
+	    { 18960, 49670 } } },
+	{ "cooling", 180, 252540,
+	  { { 20836, 46664 }, { 20590, 47060 }, { 20374, 47408 },
+	    { 20166, 47742 }, { 19974, 48048 }, { 19794, 48330 },
+	    { 19620, 48600 }, { 19470, 48840 }, { 19326, 49070 },
+	    { 19194, 49280 }, { 19074, 49478 }, { 18960, 49670 },
+	    { 18858, 49832 } } },
+	{ "heating", 180, 282780,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17664, 51736 },
+	    { 17910, 51340 }, { 18126, 50992 }, { 18334, 50658 },
+	    { 18526, 50352 }, { 18706, 50070 }, { 18880, 49800 },
+	    { 19030, 49560 }, { 19174, 49330 }, { 19306, 49120 },
+	    { 19426, 48922 } } },
+	{ "heating", 180, 282960,
+	  { { 17500, 52000 }, { 17664, 51736 }, { 17910, 51340 },
+	    { 18126, 50992 }, { 18334, 50658 }, { 18526, 50352 },
+	    { 18706, 50070 }, { 18880, 49800 }, { 19030, 49560 },
+	    { 19174, 49330 }, { 19306, 49120 }, { 19426, 48922 },
+	    { 19540, 48730 } } },
+	{ "heating", 180, 283140,
+	  { { 17664, 51736 }, { 17910, 51340 }, { 18126, 50992 },
+	    { 18334, 50658 }, { 18526, 50352 }, { 18706, 50070 },
+	    { 18880, 49800 }, { 19030, 49560 }, { 19174, 49330 },
+	    { 19306, 49120 }, { 19426, 48922 }, { 19540, 48730 },
+	    { 19642, 48568 } } },
+	{ "airing", 180, 309960,
+	  { { 22004, 44790 }, { 22022, 44764 }, { 22040, 44740 },
+	    { 20342, 41290 }, { 19052, 38656 }, { 18578, 37654 },
+	    { 18332, 37116 }, { 18200, 36810 }, { 18572, 37512 },
+	    { 18926, 38178 }, { 19244, 38772 }, { 19526, 39306 },
+	    { 19790, 39810 } } },
+	{ "airing", 180, 310140,
+	  { { 22022, 44764 }, { 22040, 44740 }, { 20342, 41290 },
+	    { 19052, 38656 }, { 18578, 37654 }, { 18332, 37116 },
+	    { 18200, 36810 }, { 18572, 37512 }, { 18926, 38178 },
+	    { 19244, 38772 }, { 19526, 39306 }, { 19790, 39810 },
+	    { 20018, 40230 } } },
+	{ "airing", 180, 310320,
+	  { { 22040, 44740 }, { 20342, 41290 }, { 19052, 38656 },
+	    { 18578, 37654 }, { 18332, 37116 }, { 18200, 36810 },
+	    { 18572, 37512 }, { 18926, 38178 }, { 19244, 38772 },
+	    { 19526, 39306 }, { 19790, 39810 }, { 20018, 40230 },
+	    { 20232, 40630 } } },
+	{ "cooling", 180, 338580,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 20836, 46664 },
+	    { 20590, 47060 }, { 20374, 47408 }, { 20166, 47742 },
+	    { 19974, 48048 }, { 19794, 48330 }, { 19620, 48600 },
+	    { 19470, 48840 }, { 19326, 49070 }, { 19194, 49280 },
+	    { 19074, 49478 } } },
+	{ "cooling", 180, 338760,
+	  { { 21000, 46400 }, { 20836, 46664 }, { 20590, 47060 },
+	    { 20374, 47408 }, { 20166, 47742 }, { 19974, 48048 },
+	    { 19794, 48330 }, { 19620, 48600 }, { 19470, 48840 },
+	    { 19326, 49070 }, { 19194, 49280 }, { 19074, 49478 },
+	    { 18960, 49670 } } },
+	{ "cooling", 180, 338940,
+	  { { 20836, 46664 }, { 20590, 47060 }, { 20374, 47408 },
+	    { 20166, 47742 }, { 19974, 48048 }, { 19794, 48330 },
+	    { 19620, 48600 }, { 19470, 48840 }, { 19326, 49070 },
+	    { 19194, 49280 }, { 19074, 49478 }, { 18960, 49670 },
+	    { 18858, 49832 } } },
+	{ "heating", 180, 369180,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17664, 51736 },
+	    { 17910, 51340 }, { 18126, 50992 }, { 18334, 50658 },
+	    { 18526, 50352 }, { 18706, 50070 }, { 18880, 49800 },
+	    { 19030, 49560 }, { 19174, 49330 }, { 19306, 49120 },
+	    { 19426, 48922 } } },
+	{ "heating", 180, 369360,
+	  { { 17500, 52000 }, { 17664, 51736 }, { 17910, 51340 },
+	    { 18126, 50992 }, { 18334, 50658 }, { 18526, 50352 },
+	    { 18706, 50070 }, { 18880, 49800 }, { 19030, 49560 },
+	    { 19174, 49330 }, { 19306, 49120 }, { 19426, 48922 },
+	    { 19540, 48730 } } },
+	{ "heating", 180, 369540,
+	  { { 17664, 51736 }, { 17910, 51340 }, { 18126, 50992 },
+	    { 18334, 50658 }, { 18526, 50352 }, { 18706, 50070 },
+	    { 18880, 49800 }, { 19030, 49560 }, { 19174, 49330 },
+	    { 19306, 49120 }, { 19426, 48922 }, { 19540, 48730 },
+	    { 19642, 48568 } } },
+	{ "cooling", 180, 424980,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 20836, 46664 },
+	    { 20590, 47060 }, { 20374, 47408 }, { 20166, 47742 },
+	    { 19974, 48048 }, { 19794, 48330 }, { 19620, 48600 },
+	    { 19470, 48840 }, { 19326, 49070 }, { 19194, 49280 },
+	    { 19074, 49478 } } },
+	{ "cooling", 180, 425160,
+	  { { 21000, 46400 }, { 20836, 46664 }, { 20590, 47060 },
+	    { 20374, 47408 }, { 20166, 47742 }, { 19974, 48048 },
+	    { 19794, 48330 }, { 19620, 48600 }, { 19470, 48840 },
+	    { 19326, 49070 }, { 19194, 49280 }, { 19074, 49478 },
+	    { 18960, 49670 } } },
+	{ "cooling", 180, 425340,
+	  { { 20836, 46664 }, { 20590, 47060 }, { 20374, 47408 },
+	    { 20166, 47742 }, { 19974, 48048 }, { 19794, 48330 },
+	    { 19620, 48600 }, { 19470, 48840 }, { 19326, 49070 },
+	    { 19194, 49280 }, { 19074, 49478 }, { 18960, 49670 },
+	    { 18858, 49832 } } },
+	{ "heating", 180, 459180,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17664, 51736 },
+	    { 17910, 51340 }, { 18126, 50992 }, { 18334, 50658 },
+	    { 18526, 50352 }, { 18706, 50070 }, { 18880, 49800 },
+	    { 19030, 49560 }, { 19174, 49330 }, { 19306, 49120 },
+	    { 19426, 48922 } } },
+	{ "heating", 180, 459360,
+	  { { 17500, 52000 }, { 17664, 51736 }, { 17910, 51340 },
+	    { 18126, 50992 }, { 18334, 50658 }, { 18526, 50352 },
+	    { 18706, 50070 }, { 18880, 49800 }, { 19030, 49560 },
+	    { 19174, 49330 }, { 19306, 49120 }, { 19426, 48922 },
+	    { 19540, 48730 } } },
+	{ "heating", 180, 459540,
+	  { { 17664, 51736 }, { 17910, 51340 }, { 18126, 50992 },
+	    { 18334, 50658 }, { 18526, 50352 }, { 18706, 50070 },
+	    { 18880, 49800 }, { 19030, 49560 }, { 19174, 49330 },
+	    { 19306, 49120 }, { 19426, 48922 }, { 19540, 48730 },
+	    { 19642, 48568 } } },
+	{ "cooling", 180, 511380,
+	  { { 18000, 50000 }, { 18000, 50000 }, { 17836, 50264 },
+	    { 17590, 50660 }, { 17374, 51008 }, { 17166, 51342 },
+	    { 16974, 51648 }, { 16794, 51930 }, { 16620, 52200 },
+	    { 16470, 52440 }, { 16326, 52670 }, { 16194, 52880 },
+	    { 16074, 53078 } } },
+	{ "cooling", 180, 511560,
+	  { { 18000, 50000 }, { 17836, 50264 }, { 17590, 50660 },
+	    { 17374, 51008 }, { 17166, 51342 }, { 16974, 51648 },
+	    { 16794, 51930 }, { 16620, 52200 }, { 16470, 52440 },
+	    { 16326, 52670 }, { 16194, 52880 }, { 16074, 53078 },
+	    { 15960, 53270 } } },
+	{ "cooling", 180, 511740,
+	  { { 17836, 50264 }, { 17590, 50660 }, { 17374, 51008 },
+	    { 17166, 51342 }, { 16974, 51648 }, { 16794, 51930 },
+	    { 16620, 52200 }, { 16470, 52440 }, { 16326, 52670 },
+	    { 16194, 52880 }, { 16074, 53078 }, { 15960, 53270 },
+	    { 15858, 53432 } } },
+	{ "heating", 180, 518580,
+	  { { 14694, 55288 }, { 14676, 55312 }, { 15802, 53992 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "heating", 180, 518760,
+	  { { 14676, 55312 }, { 15802, 53992 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "heating", 180, 518940,
+	  { { 15802, 53992 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "heating", 180, 545580,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17664, 51736 },
+	    { 17910, 51340 }, { 18126, 50992 }, { 18334, 50658 },
+	    { 18526, 50352 }, { 18706, 50070 }, { 18880, 49800 },
+	    { 19030, 49560 }, { 19174, 49330 }, { 19306, 49120 },
+	    { 19426, 48922 } } },
+	{ "heating", 180, 545760,
+	  { { 17500, 52000 }, { 17664, 51736 }, { 17910, 51340 },
+	    { 18126, 50992 }, { 18334, 50658 }, { 18526, 50352 },
+	    { 18706, 50070 }, { 18880, 49800 }, { 19030, 49560 },
+	    { 19174, 49330 }, { 19306, 49120 }, { 19426, 48922 },
+	    { 19540, 48730 } } },
+	{ "heating", 180, 545940,
+	  { { 17664, 51736 }, { 17910, 51340 }, { 18126, 50992 },
+	    { 18334, 50658 }, { 18526, 50352 }, { 18706, 50070 },
+	    { 18880, 49800 }, { 19030, 49560 }, { 19174, 49330 },
+	    { 19306, 49120 }, { 19426, 48922 }, { 19540, 48730 },
+	    { 19642, 48568 } } },
+	{ "cooling", 180, 597780,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 20836, 46664 },
+	    { 20590, 47060 }, { 20374, 47408 }, { 20166, 47742 },
+	    { 19974, 48048 }, { 19794, 48330 }, { 19620, 48600 },
+	    { 19470, 48840 }, { 19326, 49070 }, { 19194, 49280 },
+	    { 19074, 49478 } } },
+	{ "cooling", 180, 597960,
+	  { { 21000, 46400 }, { 20836, 46664 }, { 20590, 47060 },
+	    { 20374, 47408 }, { 20166, 47742 }, { 19974, 48048 },
+	    { 19794, 48330 }, { 19620, 48600 }, { 19470, 48840 },
+	    { 19326, 49070 }, { 19194, 49280 }, { 19074, 49478 },
+	    { 18960, 49670 } } },
+	{ "cooling", 180, 598140,
+	  { { 20836, 46664 }, { 20590, 47060 }, { 20374, 47408 },
+	    { 20166, 47742 }, { 19974, 48048 }, { 19794, 48330 },
+	    { 19620, 48600 }, { 19470, 48840 }, { 19326, 49070 },
+	    { 19194, 49280 }, { 19074, 49478 }, { 18960, 49670 },
+	    { 18858, 49832 } } },
+	{ "steady", 180, 7200,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 14400,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 39600,
+	  { { 20996, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46408 }, { 21000, 46402 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 180, 46800,
+	  { { 21490, 45622 }, { 21518, 45574 }, { 21542, 45526 },
+	    { 21570, 45482 }, { 21600, 45440 }, { 21624, 45398 },
+	    { 21650, 45356 }, { 21680, 45314 }, { 21706, 45272 },
+	    { 21730, 45230 }, { 21754, 45194 }, { 21778, 45156 },
+	    { 21802, 45114 } } },
+	{ "steady", 180, 54000,
+	  { { 22196, 44494 }, { 22200, 44488 }, { 22200, 44482 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44482 }, { 22200, 44488 }, { 22196, 44494 },
+	    { 22190, 44500 }, { 22184, 44506 }, { 22178, 44514 },
+	    { 22172, 44526 } } },
+	{ "steady", 180, 61200,
+	  { { 21706, 45272 }, { 21680, 45314 }, { 21650, 45356 },
+	    { 21624, 45398 }, { 21600, 45440 }, { 21570, 45482 },
+	    { 21542, 45526 }, { 21518, 45574 }, { 21490, 45622 },
+	    { 21460, 45670 }, { 21430, 45712 }, { 21400, 45756 },
+	    { 21370, 45804 } } },
+	{ "steady", 180, 72000,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 180, 93600,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 100800,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 126000,
+	  { { 20996, 46682 }, { 21000, 46664 }, { 21000, 46646 },
+	    { 21000, 46632 }, { 21000, 46620 }, { 21000, 46602 },
+	    { 21000, 46586 }, { 21000, 46574 }, { 21000, 46566 },
+	    { 21000, 46560 }, { 21000, 46548 }, { 21000, 46536 },
+	    { 21000, 46524 } } },
+	{ "steady", 180, 133200,
+	  { { 21490, 45642 }, { 21518, 45594 }, { 21542, 45546 },
+	    { 21570, 45498 }, { 21600, 45450 }, { 21624, 45408 },
+	    { 21650, 45366 }, { 21680, 45324 }, { 21706, 45282 },
+	    { 21730, 45240 }, { 21754, 45204 }, { 21778, 45166 },
+	    { 21802, 45124 } } },
+	{ "steady", 180, 140400,
+	  { { 22196, 44494 }, { 22200, 44488 }, { 22200, 44482 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44482 }, { 22200, 44488 }, { 22196, 44494 },
+	    { 22190, 44500 }, { 22184, 44506 }, { 22178, 44514 },
+	    { 22172, 44526 } } },
+	{ "steady", 180, 147600,
+	  { { 21706, 45272 }, { 21680, 45314 }, { 21650, 45356 },
+	    { 21624, 45398 }, { 21600, 45440 }, { 21570, 45482 },
+	    { 21542, 45526 }, { 21518, 45574 }, { 21490, 45622 },
+	    { 21460, 45670 }, { 21430, 45712 }, { 21400, 45756 },
+	    { 21370, 45804 } } },
+	{ "steady", 180, 158400,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 180, 180000,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 187200,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 212400,
+	  { { 20996, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46408 }, { 21000, 46402 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 180, 219600,
+	  { { 21490, 45622 }, { 21518, 45574 }, { 21542, 45526 },
+	    { 21570, 45482 }, { 21600, 45440 }, { 21624, 45398 },
+	    { 21650, 45356 }, { 21680, 45314 }, { 21706, 45272 },
+	    { 21730, 45230 }, { 21754, 45194 }, { 21778, 45156 },
+	    { 21802, 45114 } } },
+	{ "steady", 180, 226800,
+	  { { 22196, 44494 }, { 22200, 44488 }, { 22200, 44482 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44482 }, { 22200, 44488 }, { 22196, 44494 },
+	    { 22190, 44500 }, { 22184, 44506 }, { 22178, 44514 },
+	    { 22172, 44526 } } },
+	{ "steady", 180, 234000,
+	  { { 21706, 45272 }, { 21680, 45314 }, { 21650, 45356 },
+	    { 21624, 45398 }, { 21600, 45440 }, { 21570, 45482 },
+	    { 21542, 45526 }, { 21518, 45574 }, { 21490, 45622 },
+	    { 21460, 45670 }, { 21430, 45712 }, { 21400, 45756 },
+	    { 21370, 45804 } } },
+	{ "steady", 180, 244800,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 180, 266400,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 273600,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 298800,
+	  { { 20996, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46408 }, { 21000, 46402 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 180, 306000,
+	  { { 21490, 45622 }, { 21518, 45574 }, { 21542, 45526 },
+	    { 21570, 45482 }, { 21600, 45440 }, { 21624, 45398 },
+	    { 21650, 45356 }, { 21680, 45314 }, { 21706, 45272 },
+	    { 21730, 45230 }, { 21754, 45194 }, { 21778, 45156 },
+	    { 21802, 45114 } } },
+	{ "steady", 180, 320400,
+	  { { 21682, 45222 }, { 21662, 45266 }, { 21638, 45314 },
+	    { 21610, 45362 }, { 21580, 45410 }, { 21556, 45458 },
+	    { 21532, 45506 }, { 21508, 45554 }, { 21480, 45602 },
+	    { 21450, 45650 }, { 21420, 45698 }, { 21390, 45746 },
+	    { 21360, 45794 } } },
+	{ "steady", 180, 331200,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 180, 352800,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 360000,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 385200,
+	  { { 20996, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46408 }, { 21000, 46402 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 180, 392400,
+	  { { 21490, 45622 }, { 21518, 45574 }, { 21542, 45526 },
+	    { 21570, 45482 }, { 21600, 45440 }, { 21624, 45398 },
+	    { 21650, 45356 }, { 21680, 45314 }, { 21706, 45272 },
+	    { 21730, 45230 }, { 21754, 45194 }, { 21778, 45156 },
+	    { 21802, 45114 } } },
+	{ "steady", 180, 399600,
+	  { { 22196, 44494 }, { 22200, 44488 }, { 22200, 44482 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44482 }, { 22200, 44488 }, { 22196, 44494 },
+	    { 22190, 44500 }, { 22184, 44506 }, { 22178, 44514 },
+	    { 22172, 44526 } } },
+	{ "steady", 180, 406800,
+	  { { 21706, 45272 }, { 21680, 45314 }, { 21650, 45356 },
+	    { 21624, 45398 }, { 21600, 45440 }, { 21570, 45482 },
+	    { 21542, 45526 }, { 21518, 45574 }, { 21490, 45622 },
+	    { 21460, 45670 }, { 21430, 45712 }, { 21400, 45756 },
+	    { 21370, 45804 } } },
+	{ "steady", 180, 417600,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 180, 439200,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 446400,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 471600,
+	  { { 20662, 46818 }, { 20642, 46838 }, { 20618, 46862 },
+	    { 20598, 46886 }, { 20580, 46910 }, { 20562, 46928 },
+	    { 20544, 46948 }, { 20526, 46972 }, { 20508, 46996 },
+	    { 20490, 47020 }, { 20472, 47044 }, { 20452, 47066 },
+	    { 20428, 47084 } } },
+	{ "steady", 180, 478800,
+	  { { 20366, 46966 }, { 20374, 46942 }, { 20386, 46918 },
+	    { 20394, 46898 }, { 20400, 46880 }, { 20406, 46862 },
+	    { 20412, 46844 }, { 20418, 46826 }, { 20424, 46808 },
+	    { 20430, 46790 }, { 20436, 46778 }, { 20440, 46764 },
+	    { 20440, 46746 } } },
+	{ "steady", 180, 486000,
+	  { { 20272, 46798 }, { 20254, 46816 }, { 20236, 46834 },
+	    { 20218, 46856 }, { 20200, 46880 }, { 20182, 46904 },
+	    { 20162, 46930 }, { 20138, 46960 }, { 20114, 46990 },
+	    { 20090, 47020 }, { 20066, 47050 }, { 20040, 47082 },
+	    { 20010, 47118 } } },
+	{ "steady", 180, 493200,
+	  { { 18982, 48536 }, { 18936, 48602 }, { 18894, 48668 },
+	    { 18848, 48734 }, { 18800, 48800 }, { 18752, 48866 },
+	    { 18704, 48934 }, { 18656, 49006 }, { 18608, 49078 },
+	    { 18560, 49150 }, { 18512, 49216 }, { 18462, 49284 },
+	    { 18408, 49356 } } },
+	{ "steady", 180, 504000,
+	  { { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 18000, 50000 } } },
+	{ "steady", 180, 525600,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 532800,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 180, 558000,
+	  { { 20980, 46434 }, { 20980, 46430 }, { 20980, 46430 },
+	    { 20980, 46430 }, { 20980, 46430 }, { 20986, 46424 },
+	    { 20990, 46420 }, { 20990, 46420 }, { 20990, 46420 },
+	    { 20990, 46420 }, { 20990, 46420 }, { 20990, 46418 },
+	    { 20990, 46412 } } },
+	{ "steady", 180, 565200,
+	  { { 21490, 45622 }, { 21518, 45574 }, { 21542, 45526 },
+	    { 21570, 45482 }, { 21600, 45440 }, { 21624, 45398 },
+	    { 21650, 45356 }, { 21680, 45314 }, { 21706, 45272 },
+	    { 21730, 45230 }, { 21754, 45194 }, { 21778, 45156 },
+	    { 21802, 45114 } } },
+	{ "steady", 180, 572400,
+	  { { 22196, 44494 }, { 22200, 44488 }, { 22200, 44482 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44482 }, { 22200, 44488 }, { 22196, 44494 },
+	    { 22190, 44500 }, { 22184, 44506 }, { 22178, 44514 },
+	    { 22172, 44526 } } },
+	{ "steady", 180, 579600,
+	  { { 21706, 45272 }, { 21680, 45314 }, { 21650, 45356 },
+	    { 21624, 45398 }, { 21600, 45440 }, { 21570, 45482 },
+	    { 21542, 45526 }, { 21518, 45574 }, { 21490, 45622 },
+	    { 21460, 45670 }, { 21430, 45712 }, { 21400, 45756 },
+	    { 21370, 45804 } } },
+	{ "steady", 180, 590400,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "heating", 300, 23700,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17910, 51340 }, { 18270, 50760 }, { 18590, 50250 },
+	    { 18880, 49800 }, { 19130, 49400 }, { 19350, 49050 },
+	    { 19540, 48730 }, { 19710, 48460 }, { 19860, 48220 },
+	    { 20000, 48000 } } },
+	{ "heating", 300, 24000,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17910, 51340 },
+	    { 18270, 50760 }, { 18590, 50250 }, { 18880, 49800 },
+	    { 19130, 49400 }, { 19350, 49050 }, { 19540, 48730 },
+	    { 19710, 48460 }, { 19860, 48220 }, { 20000, 48000 },
+	    { 20120, 47820 } } },
+	{ "heating", 300, 24300,
+	  { { 17500, 52000 }, { 17910, 51340 }, { 18270, 50760 },
+	    { 18590, 50250 }, { 18880, 49800 }, { 19130, 49400 },
+	    { 19350, 49050 }, { 19540, 48730 }, { 19710, 48460 },
+	    { 19860, 48220 }, { 20000, 48000 }, { 20120, 47820 },
+	    { 20220, 47650 } } },
+	{ "cooling", 300, 79500,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 20590, 47060 }, { 20230, 47640 }, { 19910, 48150 },
+	    { 19620, 48600 }, { 19370, 49000 }, { 19150, 49350 },
+	    { 18960, 49670 }, { 18790, 49940 }, { 18640, 50180 },
+	    { 18500, 50400 } } },
+	{ "cooling", 300, 79800,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 20590, 47060 },
+	    { 20230, 47640 }, { 19910, 48150 }, { 19620, 48600 },
+	    { 19370, 49000 }, { 19150, 49350 }, { 18960, 49670 },
+	    { 18790, 49940 }, { 18640, 50180 }, { 18500, 50400 },
+	    { 18380, 50580 } } },
+	{ "cooling", 300, 80100,
+	  { { 21000, 46400 }, { 20590, 47060 }, { 20230, 47640 },
+	    { 19910, 48150 }, { 19620, 48600 }, { 19370, 49000 },
+	    { 19150, 49350 }, { 18960, 49670 }, { 18790, 49940 },
+	    { 18640, 50180 }, { 18500, 50400 }, { 18380, 50580 },
+	    { 18280, 50750 } } },
+	{ "heating", 300, 110100,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17910, 51340 }, { 18270, 50760 }, { 18590, 50250 },
+	    { 18880, 49800 }, { 19130, 49400 }, { 19350, 49050 },
+	    { 19540, 48730 }, { 19710, 48460 }, { 19860, 48220 },
+	    { 20000, 48000 } } },
+	{ "heating", 300, 110400,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17910, 51340 },
+	    { 18270, 50760 }, { 18590, 50250 }, { 18880, 49800 },
+	    { 19130, 49400 }, { 19350, 49050 }, { 19540, 48730 },
+	    { 19710, 48460 }, { 19860, 48220 }, { 20000, 48000 },
+	    { 20120, 47820 } } },
+	{ "heating", 300, 110700,
+	  { { 17500, 52000 }, { 17910, 51340 }, { 18270, 50760 },
+	    { 18590, 50250 }, { 18880, 49800 }, { 19130, 49400 },
+	    { 19350, 49050 }, { 19540, 48730 }, { 19710, 48460 },
+	    { 19860, 48220 }, { 20000, 48000 }, { 20120, 47820 },
+	    { 20220, 47650 } } },
+	{ "shower", 300, 114300,
+	  { { 20220, 47650 }, { 20310, 47500 }, { 20390, 47370 },
+	    { 20460, 65260 }, { 20530, 63260 }, { 20580, 61480 },
+	    { 20630, 59890 }, { 20670, 58460 }, { 20710, 57190 },
+	    { 20750, 56050 }, { 20780, 55030 }, { 20800, 54120 },
+	    { 20830, 53300 } } },
+	{ "shower", 300, 114600,
+	  { { 20310, 47500 }, { 20390, 47370 }, { 20460, 65260 },
+	    { 20530, 63260 }, { 20580, 61480 }, { 20630, 59890 },
+	    { 20670, 58460 }, { 20710, 57190 }, { 20750, 56050 },
+	    { 20780, 55030 }, { 20800, 54120 }, { 20830, 53300 },
+	    { 20850, 52570 } } },
+	{ "shower", 300, 114900,
+	  { { 20390, 47370 }, { 20460, 65260 }, { 20530, 63260 },
+	    { 20580, 61480 }, { 20630, 59890 }, { 20670, 58460 },
+	    { 20710, 57190 }, { 20750, 56050 }, { 20780, 55030 },
+	    { 20800, 54120 }, { 20830, 53300 }, { 20850, 52570 },
+	    { 20860, 51920 } } },
+	{ "cooling", 300, 165900,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 20590, 47060 }, { 20230, 47640 }, { 19910, 48150 },
+	    { 19620, 48600 }, { 19370, 49000 }, { 19150, 49350 },
+	    { 18960, 49670 }, { 18790, 49940 }, { 18640, 50180 },
+	    { 18500, 50400 } } },
+	{ "cooling", 300, 166200,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 20590, 47060 },
+	    { 20230, 47640 }, { 19910, 48150 }, { 19620, 48600 },
+	    { 19370, 49000 }, { 19150, 49350 }, { 18960, 49670 },
+	    { 18790, 49940 }, { 18640, 50180 }, { 18500, 50400 },
+	    { 18380, 50580 } } },
+	{ "cooling", 300, 166500,
+	  { { 21000, 46400 }, { 20590, 47060 }, { 20230, 47640 },
+	    { 19910, 48150 }, { 19620, 48600 }, { 19370, 49000 },
+	    { 19150, 49350 }, { 18960, 49670 }, { 18790, 49940 },
+	    { 18640, 50180 }, { 18500, 50400 }, { 18380, 50580 },
+	    { 18280, 50750 } } },
+	{ "heating", 300, 196500,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17910, 51340 }, { 18270, 50760 }, { 18590, 50250 },
+	    { 18880, 49800 }, { 19130, 49400 }, { 19350, 49050 },
+	    { 19540, 48730 }, { 19710, 48460 }, { 19860, 48220 },
+	    { 20000, 48000 } } },
+	{ "heating", 300, 196800,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17910, 51340 },
+	    { 18270, 50760 }, { 18590, 50250 }, { 18880, 49800 },
+	    { 19130, 49400 }, { 19350, 49050 }, { 19540, 48730 },
+	    { 19710, 48460 }, { 19860, 48220 }, { 20000, 48000 },
+	    { 20120, 47820 } } },
+	{ "heating", 300, 197100,
+	  { { 17500, 52000 }, { 17910, 51340 }, { 18270, 50760 },
+	    { 18590, 50250 }, { 18880, 49800 }, { 19130, 49400 },
+	    { 19350, 49050 }, { 19540, 48730 }, { 19710, 48460 },
+	    { 19860, 48220 }, { 20000, 48000 }, { 20120, 47820 },
+	    { 20220, 47650 } } },
+	{ "cooling", 300, 252300,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 20590, 47060 }, { 20230, 47640 }, { 19910, 48150 },
+	    { 19620, 48600 }, { 19370, 49000 }, { 19150, 49350 },
+	    { 18960, 49670 }, { 18790, 49940 }, { 18640, 50180 },
+	    { 18500, 50400 } } },
+	{ "cooling", 300, 252600,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 20590, 47060 },
+	    { 20230, 47640 }, { 19910, 48150 }, { 19620, 48600 },
+	    { 19370, 49000 }, { 19150, 49350 }, { 18960, 49670 },
+	    { 18790, 49940 }, { 18640, 50180 }, { 18500, 50400 },
+	    { 18380, 50580 } } },
+	{ "cooling", 300, 252900,
+	  { { 21000, 46400 }, { 20590, 47060 }, { 20230, 47640 },
+	    { 19910, 48150 }, { 19620, 48600 }, { 19370, 49000 },
+	    { 19150, 49350 }, { 18960, 49670 }, { 18790, 49940 },
+	    { 18640, 50180 }, { 18500, 50400 }, { 18380, 50580 },
+	    { 18280, 50750 } } },
+	{ "heating", 300, 282900,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17910, 51340 }, { 18270, 50760 }, { 18590, 50250 },
+	    { 18880, 49800 }, { 19130, 49400 }, { 19350, 49050 },
+	    { 19540, 48730 }, { 19710, 48460 }, { 19860, 48220 },
+	    { 20000, 48000 } } },
+	{ "heating", 300, 283200,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17910, 51340 },
+	    { 18270, 50760 }, { 18590, 50250 }, { 18880, 49800 },
+	    { 19130, 49400 }, { 19350, 49050 }, { 19540, 48730 },
+	    { 19710, 48460 }, { 19860, 48220 }, { 20000, 48000 },
+	    { 20120, 47820 } } },
+	{ "heating", 300, 283500,
+	  { { 17500, 52000 }, { 17910, 51340 }, { 18270, 50760 },
+	    { 18590, 50250 }, { 18880, 49800 }, { 19130, 49400 },
+	    { 19350, 49050 }, { 19540, 48730 }, { 19710, 48460 },
+	    { 19860, 48220 }, { 20000, 48000 }, { 20120, 47820 },
+	    { 20220, 47650 } } },
+	{ "airing", 300, 310200,
+	  { { 21980, 44830 }, { 22010, 44780 }, { 22040, 44740 },
+	    { 19210, 38990 }, { 18420, 37320 }, { 18200, 36810 },
+	    { 18820, 37980 }, { 19350, 38970 }, { 19790, 39810 },
+	    { 20170, 40510 }, { 20480, 41110 }, { 20750, 41620 },
+	    { 20980, 42050 } } },
+	{ "airing", 300, 310500,
+	  { { 22010, 44780 }, { 22040, 44740 }, { 19210, 38990 },
+	    { 18420, 37320 }, { 18200, 36810 }, { 18820, 37980 },
+	    { 19350, 38970 }, { 19790, 39810 }, { 20170, 40510 },
+	    { 20480, 41110 }, { 20750, 41620 }, { 20980, 42050 },
+	    { 21170, 42420 } } },
+	{ "airing", 300, 310800,
+	  { { 22040, 44740 }, { 19210, 38990 }, { 18420, 37320 },
+	    { 18200, 36810 }, { 18820, 37980 }, { 19350, 38970 },
+	    { 19790, 39810 }, { 20170, 40510 }, { 20480, 41110 },
+	    { 20750, 41620 }, { 20980, 42050 }, { 21170, 42420 },
+	    { 21330, 42740 } } },
+	{ "cooling", 300, 338700,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 20590, 47060 }, { 20230, 47640 }, { 19910, 48150 },
+	    { 19620, 48600 }, { 19370, 49000 }, { 19150, 49350 },
+	    { 18960, 49670 }, { 18790, 49940 }, { 18640, 50180 },
+	    { 18500, 50400 } } },
+	{ "cooling", 300, 339000,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 20590, 47060 },
+	    { 20230, 47640 }, { 19910, 48150 }, { 19620, 48600 },
+	    { 19370, 49000 }, { 19150, 49350 }, { 18960, 49670 },
+	    { 18790, 49940 }, { 18640, 50180 }, { 18500, 50400 },
+	    { 18380, 50580 } } },
+	{ "cooling", 300, 339300,
+	  { { 21000, 46400 }, { 20590, 47060 }, { 20230, 47640 },
+	    { 19910, 48150 }, { 19620, 48600 }, { 19370, 49000 },
+	    { 19150, 49350 }, { 18960, 49670 }, { 18790, 49940 },
+	    { 18640, 50180 }, { 18500, 50400 }, { 18380, 50580 },
+	    { 18280, 50750 } } },
+	{ "heating", 300, 369300,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17910, 51340 }, { 18270, 50760 }, { 18590, 50250 },
+	    { 18880, 49800 }, { 19130, 49400 }, { 19350, 49050 },
+	    { 19540, 48730 }, { 19710, 48460 }, { 19860, 48220 },
+	    { 20000, 48000 } } },
+	{ "heating", 300, 369600,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17910, 51340 },
+	    { 18270, 50760 }, { 18590, 50250 }, { 18880, 49800 },
+	    { 19130, 49400 }, { 19350, 49050 }, { 19540, 48730 },
+	    { 19710, 48460 }, { 19860, 48220 }, { 20000, 48000 },
+	    { 20120, 47820 } } },
+	{ "heating", 300, 369900,
+	  { { 17500, 52000 }, { 17910, 51340 }, { 18270, 50760 },
+	    { 18590, 50250 }, { 18880, 49800 }, { 19130, 49400 },
+	    { 19350, 49050 }, { 19540, 48730 }, { 19710, 48460 },
+	    { 19860, 48220 }, { 20000, 48000 }, { 20120, 47820 },
+	    { 20220, 47650 } } },
+	{ "cooling", 300, 425100,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 20590, 47060 }, { 20230, 47640 }, { 19910, 48150 },
+	    { 19620, 48600 }, { 19370, 49000 }, { 19150, 49350 },
+	    { 18960, 49670 }, { 18790, 49940 }, { 18640, 50180 },
+	    { 18500, 50400 } } },
+	{ "cooling", 300, 425400,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 20590, 47060 },
+	    { 20230, 47640 }, { 19910, 48150 }, { 19620, 48600 },
+	    { 19370, 49000 }, { 19150, 49350 }, { 18960, 49670 },
+	    { 18790, 49940 }, { 18640, 50180 }, { 18500, 50400 },
+	    { 18380, 50580 } } },
+	{ "cooling", 300, 425700,
+	  { { 21000, 46400 }, { 20590, 47060 }, { 20230, 47640 },
+	    { 19910, 48150 }, { 19620, 48600 }, { 19370, 49000 },
+	    { 19150, 49350 }, { 18960, 49670 }, { 18790, 49940 },
+	    { 18640, 50180 }, { 18500, 50400 }, { 18380, 50580 },
+	    { 18280, 50750 } } },
+	{ "heating", 300, 459300,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17910, 51340 }, { 18270, 50760 }, { 18590, 50250 },
+	    { 18880, 49800 }, { 19130, 49400 }, { 19350, 49050 },
+	    { 19540, 48730 }, { 19710, 48460 }, { 19860, 48220 },
+	    { 20000, 48000 } } },
+	{ "heating", 300, 459600,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17910, 51340 },
+	    { 18270, 50760 }, { 18590, 50250 }, { 18880, 49800 },
+	    { 19130, 49400 }, { 19350, 49050 }, { 19540, 48730 },
+	    { 19710, 48460 }, { 19860, 48220 }, { 20000, 48000 },
+	    { 20120, 47820 } } },
+	{ "heating", 300, 459900,
+	  { { 17500, 52000 }, { 17910, 51340 }, { 18270, 50760 },
+	    { 18590, 50250 }, { 18880, 49800 }, { 19130, 49400 },
+	    { 19350, 49050 }, { 19540, 48730 }, { 19710, 48460 },
+	    { 19860, 48220 }, { 20000, 48000 }, { 20120, 47820 },
+	    { 20220, 47650 } } },
+	{ "cooling", 300, 511500,
+	  { { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 17590, 50660 }, { 17230, 51240 }, { 16910, 51750 },
+	    { 16620, 52200 }, { 16370, 52600 }, { 16150, 52950 },
+	    { 15960, 53270 }, { 15790, 53540 }, { 15640, 53780 },
+	    { 15500, 54000 } } },
+	{ "cooling", 300, 511800,
+	  { { 18000, 50000 }, { 18000, 50000 }, { 17590, 50660 },
+	    { 17230, 51240 }, { 16910, 51750 }, { 16620, 52200 },
+	    { 16370, 52600 }, { 16150, 52950 }, { 15960, 53270 },
+	    { 15790, 53540 }, { 15640, 53780 }, { 15500, 54000 },
+	    { 15380, 54180 } } },
+	{ "cooling", 300, 512100,
+	  { { 18000, 50000 }, { 17590, 50660 }, { 17230, 51240 },
+	    { 16910, 51750 }, { 16620, 52200 }, { 16370, 52600 },
+	    { 16150, 52950 }, { 15960, 53270 }, { 15790, 53540 },
+	    { 15640, 53780 }, { 15500, 54000 }, { 15380, 54180 },
+	    { 15280, 54350 } } },
+	{ "heating", 300, 518700,
+	  { { 14720, 55240 }, { 14700, 55280 }, { 14670, 55320 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "heating", 300, 519000,
+	  { { 14700, 55280 }, { 14670, 55320 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "heating", 300, 519300,
+	  { { 14670, 55320 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "heating", 300, 545700,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17910, 51340 }, { 18270, 50760 }, { 18590, 50250 },
+	    { 18880, 49800 }, { 19130, 49400 }, { 19350, 49050 },
+	    { 19540, 48730 }, { 19710, 48460 }, { 19860, 48220 },
+	    { 20000, 48000 } } },
+	{ "heating", 300, 546000,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17910, 51340 },
+	    { 18270, 50760 }, { 18590, 50250 }, { 18880, 49800 },
+	    { 19130, 49400 }, { 19350, 49050 }, { 19540, 48730 },
+	    { 19710, 48460 }, { 19860, 48220 }, { 20000, 48000 },
+	    { 20120, 47820 } } },
+	{ "heating", 300, 546300,
+	  { { 17500, 52000 }, { 17910, 51340 }, { 18270, 50760 },
+	    { 18590, 50250 }, { 18880, 49800 }, { 19130, 49400 },
+	    { 19350, 49050 }, { 19540, 48730 }, { 19710, 48460 },
+	    { 19860, 48220 }, { 20000, 48000 }, { 20120, 47820 },
+	    { 20220, 47650 } } },
+	{ "cooling", 300, 597900,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 20590, 47060 }, { 20230, 47640 }, { 19910, 48150 },
+	    { 19620, 48600 }, { 19370, 49000 }, { 19150, 49350 },
+	    { 18960, 49670 }, { 18790, 49940 }, { 18640, 50180 },
+	    { 18500, 50400 } } },
+	{ "cooling", 300, 598200,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 20590, 47060 },
+	    { 20230, 47640 }, { 19910, 48150 }, { 19620, 48600 },
+	    { 19370, 49000 }, { 19150, 49350 }, { 18960, 49670 },
+	    { 18790, 49940 }, { 18640, 50180 }, { 18500, 50400 },
+	    { 18380, 50580 } } },
+	{ "cooling", 300, 598500,
+	  { { 21000, 46400 }, { 20590, 47060 }, { 20230, 47640 },
+	    { 19910, 48150 }, { 19620, 48600 }, { 19370, 49000 },
+	    { 19150, 49350 }, { 18960, 49670 }, { 18790, 49940 },
+	    { 18640, 50180 }, { 18500, 50400 }, { 18380, 50580 },
+	    { 18280, 50750 } } },
+	{ "steady", 300, 7200,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 14400,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 39600,
+	  { { 20990, 46410 }, { 20990, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 300, 46800,
+	  { { 21410, 45740 }, { 21460, 45670 }, { 21510, 45590 },
+	    { 21550, 45510 }, { 21600, 45440 }, { 21640, 45370 },
+	    { 21690, 45300 }, { 21730, 45230 }, { 21770, 45170 },
+	    { 21810, 45100 }, { 21850, 45040 }, { 21880, 44980 },
+	    { 21920, 44930 } } },
+	{ "steady", 300, 54000,
+	  { { 22180, 44510 }, { 22190, 44500 }, { 22200, 44490 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44490 }, { 22190, 44500 }, { 22180, 44510 },
+	    { 22170, 44530 }, { 22160, 44550 }, { 22140, 44570 },
+	    { 22130, 44600 } } },
+	{ "steady", 300, 61200,
+	  { { 21770, 45170 }, { 21730, 45230 }, { 21690, 45300 },
+	    { 21640, 45370 }, { 21600, 45440 }, { 21550, 45510 },
+	    { 21510, 45590 }, { 21460, 45670 }, { 21410, 45740 },
+	    { 21360, 45820 }, { 21310, 45900 }, { 21260, 45980 },
+	    { 21210, 46070 } } },
+	{ "steady", 300, 72000,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 300, 93600,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 100800,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 126000,
+	  { { 20990, 46740 }, { 20990, 46700 }, { 21000, 46670 },
+	    { 21000, 46640 }, { 21000, 46620 }, { 21000, 46590 },
+	    { 21000, 46570 }, { 21000, 46560 }, { 21000, 46540 },
+	    { 21000, 46520 }, { 21000, 46510 }, { 21000, 46500 },
+	    { 21000, 46490 } } },
+	{ "steady", 300, 133200,
+	  { { 21410, 45770 }, { 21460, 45690 }, { 21510, 45610 },
+	    { 21550, 45530 }, { 21600, 45450 }, { 21640, 45380 },
+	    { 21690, 45310 }, { 21730, 45240 }, { 21770, 45180 },
+	    { 21810, 45110 }, { 21850, 45050 }, { 21880, 44990 },
+	    { 21920, 44940 } } },
+	{ "steady", 300, 140400,
+	  { { 22180, 44510 }, { 22190, 44500 }, { 22200, 44490 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44490 }, { 22190, 44500 }, { 22180, 44510 },
+	    { 22170, 44530 }, { 22160, 44550 }, { 22140, 44570 },
+	    { 22130, 44600 } } },
+	{ "steady", 300, 147600,
+	  { { 21770, 45170 }, { 21730, 45230 }, { 21690, 45300 },
+	    { 21640, 45370 }, { 21600, 45440 }, { 21550, 45510 },
+	    { 21510, 45590 }, { 21460, 45670 }, { 21410, 45740 },
+	    { 21360, 45820 }, { 21310, 45900 }, { 21260, 45980 },
+	    { 21210, 46070 } } },
+	{ "steady", 300, 158400,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 300, 180000,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 187200,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 212400,
+	  { { 20990, 46410 }, { 20990, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 300, 219600,
+	  { { 21410, 45740 }, { 21460, 45670 }, { 21510, 45590 },
+	    { 21550, 45510 }, { 21600, 45440 }, { 21640, 45370 },
+	    { 21690, 45300 }, { 21730, 45230 }, { 21770, 45170 },
+	    { 21810, 45100 }, { 21850, 45040 }, { 21880, 44980 },
+	    { 21920, 44930 } } },
+	{ "steady", 300, 226800,
+	  { { 22180, 44510 }, { 22190, 44500 }, { 22200, 44490 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44490 }, { 22190, 44500 }, { 22180, 44510 },
+	    { 22170, 44530 }, { 22160, 44550 }, { 22140, 44570 },
+	    { 22130, 44600 } } },
+	{ "steady", 300, 234000,
+	  { { 21770, 45170 }, { 21730, 45230 }, { 21690, 45300 },
+	    { 21640, 45370 }, { 21600, 45440 }, { 21550, 45510 },
+	    { 21510, 45590 }, { 21460, 45670 }, { 21410, 45740 },
+	    { 21360, 45820 }, { 21310, 45900 }, { 21260, 45980 },
+	    { 21210, 46070 } } },
+	{ "steady", 300, 244800,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 300, 266400,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 273600,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 298800,
+	  { { 20990, 46410 }, { 20990, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 300, 306000,
+	  { { 21410, 45740 }, { 21460, 45670 }, { 21510, 45590 },
+	    { 21550, 45510 }, { 21600, 45440 }, { 21640, 45370 },
+	    { 21690, 45300 }, { 21730, 45230 }, { 21770, 45170 },
+	    { 21810, 45100 }, { 21850, 45040 }, { 21880, 44980 },
+	    { 21920, 44930 } } },
+	{ "steady", 300, 320400,
+	  { { 21740, 45100 }, { 21700, 45180 }, { 21670, 45250 },
+	    { 21630, 45330 }, { 21580, 45410 }, { 21540, 45490 },
+	    { 21500, 45570 }, { 21450, 45650 }, { 21400, 45730 },
+	    { 21350, 45810 }, { 21300, 45890 }, { 21250, 45970 },
+	    { 21200, 46060 } } },
+	{ "steady", 300, 331200,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 300, 352800,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 360000,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 385200,
+	  { { 20990, 46410 }, { 20990, 46410 }, { 21000, 46410 },
+	    { 21000, 46410 }, { 21000, 46410 }, { 21000, 46410 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 300, 392400,
+	  { { 21410, 45740 }, { 21460, 45670 }, { 21510, 45590 },
+	    { 21550, 45510 }, { 21600, 45440 }, { 21640, 45370 },
+	    { 21690, 45300 }, { 21730, 45230 }, { 21770, 45170 },
+	    { 21810, 45100 }, { 21850, 45040 }, { 21880, 44980 },
+	    { 21920, 44930 } } },
+	{ "steady", 300, 399600,
+	  { { 22180, 44510 }, { 22190, 44500 }, { 22200, 44490 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44490 }, { 22190, 44500 }, { 22180, 44510 },
+	    { 22170, 44530 }, { 22160, 44550 }, { 22140, 44570 },
+	    { 22130, 44600 } } },
+	{ "steady", 300, 406800,
+	  { { 21770, 45170 }, { 21730, 45230 }, { 21690, 45300 },
+	    { 21640, 45370 }, { 21600, 45440 }, { 21550, 45510 },
+	    { 21510, 45590 }, { 21460, 45670 }, { 21410, 45740 },
+	    { 21360, 45820 }, { 21310, 45900 }, { 21260, 45980 },
+	    { 21210, 46070 } } },
+	{ "steady", 300, 417600,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+	{ "steady", 300, 439200,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 446400,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 471600,
+	  { { 20710, 46760 }, { 20680, 46800 }, { 20650, 46830 },
+	    { 20610, 46870 }, { 20580, 46910 }, { 20550, 46940 },
+	    { 20520, 46980 }, { 20490, 47020 }, { 20460, 47060 },
+	    { 20420, 47090 }, { 20390, 47130 }, { 20360, 47170 },
+	    { 20330, 47210 } } },
+	{ "steady", 300, 478800,
+	  { { 20340, 47030 }, { 20360, 46990 }, { 20370, 46950 },
+	    { 20390, 46910 }, { 20400, 46880 }, { 20410, 46850 },
+	    { 20420, 46820 }, { 20430, 46790 }, { 20440, 46770 },
+	    { 20440, 46740 }, { 20450, 46720 }, { 20450, 46700 },
+	    { 20450, 46690 } } },
+	{ "steady", 300, 486000,
+	  { { 20320, 46750 }, { 20290, 46780 }, { 20260, 46810 },
+	    { 20230, 46840 }, { 20200, 46880 }, { 20170, 46920 },
+	    { 20130, 46970 }, { 20090, 47020 }, { 20050, 47070 },
+	    { 20000, 47130 }, { 19960, 47190 }, { 19910, 47250 },
+	    { 19860, 47320 } } },
+	{ "steady", 300, 493200,
+	  { { 19100, 48370 }, { 19030, 48470 }, { 18950, 48580 },
+	    { 18880, 48690 }, { 18800, 48800 }, { 18720, 48910 },
+	    { 18640, 49030 }, { 18560, 49150 }, { 18480, 49260 },
+	    { 18390, 49380 }, { 18310, 49500 }, { 18260, 49580 },
+	    { 18210, 49670 } } },
+	{ "steady", 300, 504000,
+	  { { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 18000, 50000 }, { 18000, 50000 }, { 18000, 50000 },
+	    { 18000, 50000 } } },
+	{ "steady", 300, 525600,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 532800,
+	  { { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 }, { 17500, 52000 }, { 17500, 52000 },
+	    { 17500, 52000 } } },
+	{ "steady", 300, 558000,
+	  { { 20970, 46440 }, { 20980, 46440 }, { 20980, 46430 },
+	    { 20980, 46430 }, { 20980, 46430 }, { 20990, 46420 },
+	    { 20990, 46420 }, { 20990, 46420 }, { 20990, 46420 },
+	    { 20990, 46410 }, { 20990, 46410 }, { 20990, 46410 },
+	    { 20990, 46410 } } },
+	{ "steady", 300, 565200,
+	  { { 21410, 45750 }, { 21460, 45670 }, { 21510, 45590 },
+	    { 21550, 45510 }, { 21600, 45440 }, { 21640, 45370 },
+	    { 21690, 45300 }, { 21730, 45230 }, { 21770, 45170 },
+	    { 21810, 45100 }, { 21850, 45040 }, { 21880, 44980 },
+	    { 21920, 44930 } } },
+	{ "steady", 300, 572400,
+	  { { 22180, 44510 }, { 22190, 44500 }, { 22200, 44490 },
+	    { 22200, 44480 }, { 22200, 44480 }, { 22200, 44480 },
+	    { 22200, 44490 }, { 22190, 44500 }, { 22180, 44510 },
+	    { 22170, 44530 }, { 22160, 44550 }, { 22140, 44570 },
+	    { 22130, 44600 } } },
+	{ "steady", 300, 579600,
+	  { { 21770, 45170 }, { 21730, 45230 }, { 21690, 45300 },
+	    { 21640, 45370 }, { 21600, 45440 }, { 21550, 45510 },
+	    { 21510, 45590 }, { 21460, 45670 }, { 21410, 45740 },
+	    { 21360, 45820 }, { 21310, 45900 }, { 21260, 45980 },
+	    { 21210, 46070 } } },
+	{ "steady", 300, 590400,
+	  { { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 }, { 21000, 46400 }, { 21000, 46400 },
+	    { 21000, 46400 } } },
+};
+
+#endif /* WEEK_WINDOWS_H_ */
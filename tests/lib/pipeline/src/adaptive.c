@@ -0,0 +1,411 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test adaptive acquisition period
+ *
+ * Three day-long temperature and humidity traces are sampled at a fixed
+ * minute, at an adaptive period and at the fixed period that costs as many
+ * wakeups as the adaptive one. The samples are compared to the traces by
+ * linear interpolation during the events of each trace. A pipeline then
+ * checks that acquisition follows the period.
+ *
+ * The traces are synthetic: piecewise-linear ramps, steps and decays plus
+ * uniform noise, written to look like a storage room, an office and a
+ * bathroom. They are not recorded SHT40 data, so they show that the period
+ * reacts to events as intended, not how much a real deployment saves.
+ */
+
+#include <stdlib.h>
+
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/ztest.h>
+
+#include <app/lib/pipeline.h>
+
+#define SENSOR_NODE DT_NODELABEL(example_sensor)
+#define SENSOR_PIN DT_GPIO_PIN(SENSOR_NODE, input_gpios)
+
+#define MIN_MS (60 * MSEC_PER_SEC)
+#define DAY_MS (24 * 60 * MIN_MS)
+#define MINUTES(m) ((int64_t)(m) * MIN_MS)
+
+/* Traces: ground truth every second, compared every 5 s */
+#define COMPARE_MS 5000
+#define FIXED_MS MIN_MS
+#define MAX_SAMPLES (DAY_MS / 10000 + 1)
+
+#define TEMP 0
+#define HUM 1
+
+/* Changes worth a sample: 0.2 °C and 1 %RH */
+static const int32_t thresholds[] = { 200, 1000 };
+
+static struct pipeline_adaptive day = PIPELINE_ADAPTIVE_INITIALIZER(
+	10 * MSEC_PER_SEC, 3 * MIN_MS, thresholds, 4);
+
+struct event {
+	int64_t start_ms;
+	int64_t end_ms;
+};
+
+struct trace {
+	const char *name;
+	void (*fn)(int64_t t_ms, int32_t *temp, int32_t *hum);
+	const struct event *events;
+	size_t num_events;
+};
+
+struct outcome {
+	uint32_t samples;
+	uint32_t event_samples;
+	/* Mean absolute error during events, per value */
+	int64_t error[2];
+};
+
+static struct {
+	int64_t t_ms;
+	int32_t value[2];
+} samples[MAX_SAMPLES];
+
+static uint32_t noise_state;
+
+/* Deterministic sensor noise, uniform in [-amplitude, amplitude] */
+static int32_t noise(int32_t amplitude)
+{
+	noise_state = noise_state * 1664525U + 1013904223U;
+
+	return (int32_t)((noise_state >> 8) % (2 * amplitude + 1)) -
+	       amplitude;
+}
+
+/* Closed storage room: flat but for a slow diurnal swing */
+static void trace_storage(int64_t t_ms, int32_t *temp, int32_t *hum)
+{
+	int64_t m = t_ms < DAY_MS / 2 ? t_ms : DAY_MS - t_ms;
+	int32_t swing = (int32_t)(m / MINUTES(4));
+
+	*temp = 18000 + swing;
+	*hum = 52000 - swing;
+}
+
+/* Office: heating on at 07:00 and off at 18:00, a window aired at noon */
+static const struct event office_events[] = {
+	{ MINUTES(7 * 60), MINUTES(7 * 60 + 30) },
+	{ MINUTES(12 * 60), MINUTES(12 * 60 + 16) },
+	{ MINUTES(18 * 60), MINUTES(19 * 60) },
+};
+
+static void trace_office(int64_t t_ms, int32_t *temp, int32_t *hum)
+{
+	*temp = 19000;
+	*hum = 45000;
+
+	if (t_ms >= MINUTES(7 * 60) && t_ms < MINUTES(18 * 60)) {
+		*temp += 100 * MIN(t_ms - MINUTES(7 * 60), MINUTES(30)) /
+			 MIN_MS;
+	} else if (t_ms >= MINUTES(18 * 60)) {
+		*temp += 3000 - 50 * MIN(t_ms - MINUTES(18 * 60),
+					 MINUTES(60)) / MIN_MS;
+	}
+	if (t_ms >= MINUTES(12 * 60) && t_ms < MINUTES(12 * 60 + 15)) {
+		*temp -= 1500;
+		*hum += 8000;
+	}
+}
+
+/* Bathroom: three showers, humidity rises over 2 minutes and decays */
+static const int64_t showers[] = {
+	MINUTES(6 * 60 + 30),
+	MINUTES(7 * 60 + 15),
+	MINUTES(21 * 60),
+};
+
+static const struct event bathroom_events[] = {
+	{ MINUTES(6 * 60 + 30), MINUTES(7 * 60 + 42) },
+	{ MINUTES(7 * 60 + 15), MINUTES(8 * 60 + 27) },
+	{ MINUTES(21 * 60), MINUTES(22 * 60 + 12) },
+};
+
+static void trace_bathroom(int64_t t_ms, int32_t *temp, int32_t *hum)
+{
+	int64_t peak = 0;
+
+	for (size_t s = 0; s < ARRAY_SIZE(showers); s++) {
+		int64_t since = t_ms - showers[s];
+
+		if (since >= 0 && since < MINUTES(2)) {
+			peak = MAX(peak, 15000 * since / MIN_MS);
+		} else if (since >= MINUTES(2) && since < MINUTES(12)) {
+			peak = MAX(peak, 30000);
+		} else if (since >= MINUTES(12) && since < MINUTES(72)) {
+			int64_t decay = 500 * (since - MINUTES(12)) / MIN_MS;
+
+			peak = MAX(peak, 30000 - decay);
+		}
+	}
+
+	*temp = 21000 + (int32_t)(peak / 15);
+	*hum = 55000 + (int32_t)peak;
+}
+
+static const struct trace traces[] = {
+	{ "storage", trace_storage, NULL, 0 },
+	{ "office", trace_office, office_events, ARRAY_SIZE(office_events) },
+	{ "bathroom", trace_bathroom, bathroom_events,
+	  ARRAY_SIZE(bathroom_events) },
+};
+
+static bool in_event(const struct trace *trace, int64_t t_ms)
+{
+	for (size_t e = 0; e < trace->num_events; e++) {
+		if (t_ms >= trace->events[e].start_ms &&
+		    t_ms < trace->events[e].end_ms) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/* Sample a day of @p trace, adaptively unless @p fixed_ms is not 0 */
+static struct outcome replay(const struct trace *trace, uint32_t fixed_ms)
+{
+	struct outcome o = { 0 };
+	uint32_t period_ms = fixed_ms != 0 ? fixed_ms : FIXED_MS;
+	int64_t sum[2] = { 0 };
+	int64_t compared = 0;
+	uint32_t j = 0;
+
+	noise_state = 1;
+	zassert_ok(pipeline_adaptive_reset(&day));
+
+	for (int64_t t = 0; t < DAY_MS; t += period_ms) {
+		struct pipeline_sample sample = {
+			.timestamp_ms = t,
+			.count = 2,
+		};
+		int32_t temp, hum;
+
+		zassert_true(o.samples < MAX_SAMPLES);
+
+		trace->fn(t, &temp, &hum);
+		samples[o.samples].t_ms = t;
+		samples[o.samples].value[TEMP] = temp + noise(30);
+		samples[o.samples].value[HUM] = hum + noise(100);
+		(void)sensor_value_from_milli(&sample.values[TEMP],
+					      samples[o.samples].value[TEMP]);
+		(void)sensor_value_from_milli(&sample.values[HUM],
+					      samples[o.samples].value[HUM]);
+
+		o.event_samples += in_event(trace, t);
+		o.samples++;
+
+		if (fixed_ms == 0) {
+			period_ms = pipeline_adaptive_update(&day, &sample,
+							     period_ms);
+		}
+	}
+
+	for (int64_t t = 0; t < DAY_MS; t += COMPARE_MS) {
+		int32_t truth[2];
+
+		while (j + 1 < o.samples && samples[j + 1].t_ms <= t) {
+			j++;
+		}
+		if (j + 1 >= o.samples) {
+			break;
+		}
+		if (!in_event(trace, t)) {
+			continue;
+		}
+
+		trace->fn(t, &truth[TEMP], &truth[HUM]);
+		for (int v = 0; v < 2; v++) {
+			int64_t x0 = samples[j].value[v];
+			int64_t x1 = samples[j + 1].value[v];
+			int64_t span = samples[j + 1].t_ms - samples[j].t_ms;
+			int64_t interp =
+				x0 + (x1 - x0) * (t - samples[j].t_ms) / span;
+
+			sum[v] += llabs(interp - truth[v]);
+		}
+		compared++;
+	}
+
+	for (int v = 0; v < 2; v++) {
+		o.error[v] = compared > 0 ? sum[v] / compared : 0;
+	}
+
+	return o;
+}
+
+/* Mean error during events, in thousandths of a threshold, both values */
+static uint32_t error_score(const struct outcome *o)
+{
+	return (uint32_t)(o->error[TEMP] * 1000 / thresholds[TEMP] +
+			  o->error[HUM] * 1000 / thresholds[HUM]);
+}
+
+static void print_outcome(const char *name, const char *how,
+			  const struct outcome *o)
+{
+	printk("adaptive %s %-9s %4u wakeups, %3u during events, error "
+	       "%lld mC %lld m%%RH\n",
+	       name, how, o->samples, o->event_samples,
+	       (long long)o->error[TEMP], (long long)o->error[HUM]);
+}
+
+ZTEST(pipeline_adaptive, test_traces)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(traces); i++) {
+		const struct trace *trace = &traces[i];
+		struct outcome fixed = replay(trace, FIXED_MS);
+		struct outcome adaptive = replay(trace, 0);
+		struct outcome budget =
+			replay(trace, DAY_MS / adaptive.samples);
+
+		print_outcome(trace->name, "fixed", &fixed);
+		print_outcome(trace->name, "adaptive", &adaptive);
+		print_outcome(trace->name, "budget", &budget);
+
+		/* Fewer wakeups than once a minute */
+		zassert_true(adaptive.samples * 2 < fixed.samples,
+			     "%s: %u wakeups", trace->name, adaptive.samples);
+
+		if (trace->num_events == 0) {
+			continue;
+		}
+
+		/* Events better covered than at the same cost, fixed */
+		zassert_true(adaptive.event_samples > budget.event_samples,
+			     "%s: %u samples during events, %u fixed",
+			     trace->name, adaptive.event_samples,
+			     budget.event_samples);
+		zassert_true(error_score(&adaptive) < error_score(&budget),
+			     "%s: error %u, %u fixed", trace->name,
+			     error_score(&adaptive), error_score(&budget));
+	}
+}
+
+ZTEST(pipeline_adaptive, test_invalid)
+{
+	static const int32_t zero[] = { 0 };
+	struct pipeline_adaptive reversed =
+		PIPELINE_ADAPTIVE_INITIALIZER(100, 10, thresholds, 1);
+	struct pipeline_adaptive no_threshold =
+		PIPELINE_ADAPTIVE_INITIALIZER(10, 100, zero, 1);
+
+	zassert_equal(pipeline_adaptive_reset(&reversed), -EINVAL);
+	zassert_equal(pipeline_adaptive_reset(&no_threshold), -EINVAL);
+
+	zassert_equal(pipeline_adaptive_bounds_set(&no_threshold, 0, 100),
+		      -EINVAL);
+	zassert_equal(pipeline_adaptive_bounds_set(&no_threshold, 100, 10),
+		      -EINVAL);
+	zassert_ok(pipeline_adaptive_bounds_set(&reversed, 10, 100));
+	zassert_ok(pipeline_adaptive_reset(&reversed));
+}
+
+/* Acquisition follows the period */
+
+#define E2E_MIN_MS 10
+#define E2E_MAX_MS 80
+#define TOLERANCE_MS 2
+
+struct e2e_record {
+	int64_t t_ms;
+	int32_t value;
+};
+
+K_MSGQ_DEFINE(e2e_records, sizeof(struct e2e_record), 16, 8);
+
+static int record_sample(struct net_buf *buf, void *user_data)
+{
+	const struct pipeline_sample *sample = pipeline_sample(buf);
+	struct e2e_record rec = {
+		.t_ms = sample->timestamp_ms,
+		.value = sample->values[0].val1,
+	};
+
+	ARG_UNUSED(user_data);
+
+	return k_msgq_put(&e2e_records, &rec, K_NO_WAIT);
+}
+
+static const enum sensor_channel e2e_channels[] = { SENSOR_CHAN_PROX };
+static const int32_t e2e_thresholds[] = { 500 };
+
+static struct pipeline_adaptive e2e_adaptive = PIPELINE_ADAPTIVE_INITIALIZER(
+	E2E_MIN_MS, E2E_MAX_MS, e2e_thresholds, 2);
+
+static struct pipeline_acquire e2e_source = {
+	.sensor = DEVICE_DT_GET(SENSOR_NODE),
+	.channels = e2e_channels,
+	.num_channels = ARRAY_SIZE(e2e_channels),
+	.period_ms = E2E_MIN_MS,
+	.adaptive = &e2e_adaptive,
+};
+
+static struct pipeline_sink e2e_sink =
+	PIPELINE_SINK_INITIALIZER(record_sample, NULL);
+
+PIPELINE_DEFINE(adaptive_e2e, 4, &e2e_source, &e2e_sink.stage);
+
+static struct e2e_record next_record(void)
+{
+	struct e2e_record rec = { 0 };
+
+	zassert_ok(k_msgq_get(&e2e_records, &rec, K_MSEC(4 * E2E_MAX_MS)),
+		   "no sample");
+
+	return rec;
+}
+
+ZTEST(pipeline_adaptive, test_acquisition)
+{
+	/* Flat input: doubled every second sample, up to the maximum */
+	static const uint32_t flat[] = { 10, 10, 20, 20, 40, 40, 80, 80, 80 };
+	struct pipeline_adaptive_stats stats;
+	struct e2e_record prev, rec;
+
+	zassert_ok(gpio_emul_input_set(
+		DEVICE_DT_GET(DT_GPIO_CTLR(SENSOR_NODE, input_gpios)),
+		SENSOR_PIN, 1));
+	k_msgq_purge(&e2e_records);
+	zassert_ok(pipeline_start(&adaptive_e2e));
+
+	prev = next_record();
+	for (size_t i = 0; i < ARRAY_SIZE(flat); i++) {
+		rec = next_record();
+		zassert_within(rec.t_ms - prev.t_ms, flat[i], TOLERANCE_MS,
+			       "period %zu is %lld ms", i,
+			       (long long)(rec.t_ms - prev.t_ms));
+		prev = rec;
+	}
+
+	/* A step: half a period to the next sample, as the rate was */
+	zassert_ok(gpio_emul_input_set(
+		DEVICE_DT_GET(DT_GPIO_CTLR(SENSOR_NODE, input_gpios)),
+		SENSOR_PIN, 0));
+	do {
+		prev = next_record();
+	} while (prev.value != 0);
+
+	rec = next_record();
+	zassert_within(rec.t_ms - prev.t_ms, E2E_MAX_MS / 2, TOLERANCE_MS,
+		       "period after the step is %lld ms",
+		       (long long)(rec.t_ms - prev.t_ms));
+
+	zassert_ok(pipeline_stop(&adaptive_e2e));
+
+	pipeline_adaptive_stats_get(&e2e_adaptive, &stats);
+	zassert_equal(stats.faster, 1);
+	zassert_equal(stats.slower, 3);
+	zassert_equal(stats.period_ms, E2E_MAX_MS / 2);
+}
+
+ZTEST_SUITE(pipeline_adaptive, NULL, NULL, NULL, NULL, NULL);
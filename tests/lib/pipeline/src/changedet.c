@@ -0,0 +1,363 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test pipeline change detection stage
+ *
+ * The stage is fed temperature and humidity traces, one sample at a time,
+ * outside of any pipeline. Short traces check what is passed on around a
+ * change; longer ones, shaped after indoor SHT40 logs, compare the bytes
+ * uploaded with those of uploading every sample in hourly batches.
+ */
+
+#include <zephyr/ztest.h>
+
+#include <app/lib/pipeline.h>
+
+#define TRACE_BUFS 24
+
+/* Edge Impulse JSON upload: envelope and headers, then per sample */
+#define UPLOAD_OVERHEAD 330
+#define SAMPLE_BYTES 20
+#define BASELINE_BATCH 60
+
+/* Summaries come from the pipeline's pool, so samples are accounted to it */
+NET_BUF_POOL_FIXED_DEFINE(trace_pool, TRACE_BUFS,
+			  sizeof(struct pipeline_sample),
+			  sizeof(struct pipeline *), pipeline_buf_destroy);
+
+static struct pipeline trace = { .name = "trace", .pool = &trace_pool };
+
+static struct pipeline_changedet changedet = PIPELINE_CHANGEDET_INITIALIZER();
+
+static const struct pipeline_changedet_params defaults = {
+	.alpha_shift = 4,
+	.drift = 50,
+	.threshold = 500,
+	.pre = 4,
+	.post = 8,
+	.heartbeat = 60,
+};
+
+struct outcome {
+	uint32_t windows;
+	uint32_t window_samples;
+	uint32_t summaries;
+	/* Index of the first sample of the last window, and its length */
+	int64_t window_start;
+	uint32_t window_len;
+	int64_t summary_start;
+	int32_t summary_temp;
+};
+
+/* Deterministic sensor noise, uniform in [-amplitude, amplitude] */
+static uint32_t noise_state;
+
+static int32_t noise(int32_t amplitude)
+{
+	noise_state = noise_state * 1664525U + 1013904223U;
+
+	return (int32_t)((noise_state >> 8) % (2 * amplitude + 1)) -
+	       amplitude;
+}
+
+/* One sample of @p temp m°C and @p hum m%RH, timestamped with its index */
+static struct net_buf *trace_sample(int64_t index, int32_t temp, int32_t hum)
+{
+	struct net_buf *buf = net_buf_alloc(&trace_pool, K_NO_WAIT);
+	struct pipeline_sample *sample;
+
+	zassert_not_null(buf, "trace pool exhausted");
+
+	/* As acquisition would */
+	*(struct pipeline **)net_buf_user_data(buf) = &trace;
+	trace.stats.bufs_used++;
+
+	sample = net_buf_add(buf, sizeof(*sample));
+	*sample = (struct pipeline_sample){
+		.timestamp_ms = index,
+		.count = 2,
+	};
+	(void)sensor_value_from_milli(&sample->values[0], temp);
+	(void)sensor_value_from_milli(&sample->values[1], hum);
+
+	return buf;
+}
+
+static void consume(struct net_buf *out, struct outcome *o)
+{
+	const struct pipeline_sample *first;
+	uint32_t len = 0;
+
+	if (out == NULL) {
+		return;
+	}
+
+	first = pipeline_sample(out);
+	for (struct net_buf *frag = out; frag != NULL; frag = frag->frags) {
+		len++;
+	}
+
+	if (first->flags & PIPELINE_SAMPLE_SUMMARY) {
+		zassert_equal(len, 1, "summary of %u samples", len);
+		o->summaries++;
+		o->summary_start = first->timestamp_ms;
+		o->summary_temp = (int32_t)sensor_value_to_milli(
+			&first->values[0]);
+	} else {
+		o->windows++;
+		o->window_samples += len;
+		o->window_start = first->timestamp_ms;
+		o->window_len = len;
+	}
+
+	net_buf_unref(out);
+}
+
+static void feed(int64_t index, int32_t temp, int32_t hum, struct outcome *o)
+{
+	consume(changedet.stage.api->process(&changedet.stage,
+					     trace_sample(index, temp, hum)),
+		o);
+}
+
+static void finish(struct outcome *o)
+{
+	consume(changedet.stage.api->flush(&changedet.stage), o);
+}
+
+static void check_no_leak(void)
+{
+	struct net_buf *bufs[TRACE_BUFS];
+
+	for (int i = 0; i < TRACE_BUFS; i++) {
+		bufs[i] = net_buf_alloc(&trace_pool, K_NO_WAIT);
+		zassert_not_null(bufs[i], "%d buffers leaked", TRACE_BUFS - i);
+	}
+	for (int i = 0; i < TRACE_BUFS; i++) {
+		net_buf_unref(bufs[i]);
+	}
+}
+
+ZTEST(pipeline_changedet, test_step)
+{
+	struct outcome o = { 0 };
+
+	/* 21.5 °C, then 2 °C warmer from sample 30 on */
+	for (int i = 0; i < 50; i++) {
+		feed(i, (i < 30 ? 21500 : 23500) + noise(30),
+		     45000 + noise(100), &o);
+	}
+
+	zassert_equal(o.windows, 1, "%u windows for one step", o.windows);
+	zassert_equal(o.window_start, 30 - defaults.pre,
+		      "window starts at %lld", (long long)o.window_start);
+	zassert_equal(o.window_len, defaults.pre + 1 + defaults.post);
+	zassert_equal(o.summaries, 0);
+
+	finish(&o);
+	zassert_equal(o.windows, 1, "nothing left to pass on but a summary");
+	zassert_equal(o.summaries, 1);
+	/* Samples 0-25 and 39-49: none of the window's, at 21.5 or 23.5 °C */
+	zassert_within(o.summary_temp, (26 * 21500 + 11 * 23500) / 37, 20,
+		       "window samples summarized, mean %d", o.summary_temp);
+	check_no_leak();
+}
+
+ZTEST(pipeline_changedet, test_heartbeat)
+{
+	struct outcome o = { 0 };
+
+	/* Summaries lag by the pre samples held for a change */
+	for (int i = 0; i < 2 * defaults.heartbeat + defaults.pre; i++) {
+		feed(i, 21500 + noise(30), 45000 + noise(100), &o);
+	}
+
+	zassert_equal(o.windows, 0, "noise detected as a change");
+	zassert_equal(o.summaries, 2);
+	zassert_equal(o.summary_start, defaults.heartbeat,
+		      "summary does not start after the previous one");
+	zassert_within(o.summary_temp, 21500, 10, "mean %d", o.summary_temp);
+
+	finish(&o);
+	zassert_equal(o.summaries, 3, "held samples not summarized on flush");
+	zassert_equal(o.summary_start, 2 * defaults.heartbeat);
+	check_no_leak();
+}
+
+ZTEST(pipeline_changedet, test_ramp)
+{
+	struct outcome o = { 0 };
+
+	/* Flat, then a ramp of 0.1 °C per sample for 40 samples, then flat */
+	for (int i = 0; i < 100; i++) {
+		int32_t temp = 21500 + 100 * CLAMP(i - 20, 0, 40);
+
+		feed(i, temp + noise(30), 45000 + noise(100), &o);
+	}
+	finish(&o);
+
+	zassert_true(o.windows >= 1, "ramp not detected");
+	/* Most of the ramp is passed on at full resolution */
+	zassert_true(o.window_samples >= 30, "only %u samples of the ramp",
+		     o.window_samples);
+	check_no_leak();
+}
+
+ZTEST(pipeline_changedet, test_params)
+{
+	struct pipeline_changedet_params params = defaults;
+	struct outcome o = { 0 };
+
+	params.pre = CONFIG_PIPELINE_CHANGEDET_MAX_PRE + 1;
+	zassert_equal(pipeline_changedet_params_set(&changedet, &params),
+		      -EINVAL);
+
+	/* A full window, a summary and one sample being acquired */
+	params = defaults;
+	params.post = TRACE_BUFS - defaults.pre - 2;
+	zassert_equal(pipeline_changedet_params_set(&changedet, &params),
+		      -ENOBUFS, "window larger than the pool accepted");
+	params.post--;
+	zassert_ok(pipeline_changedet_params_set(&changedet, &params));
+
+	/* No heartbeat and no samples from before a change */
+	params = defaults;
+	params.pre = 0;
+	params.heartbeat = 0;
+	zassert_ok(pipeline_changedet_params_set(&changedet, &params));
+
+	for (int i = 0; i < 100; i++) {
+		feed(i, (i < 50 ? 21500 : 19000) + noise(30), 45000, &o);
+	}
+
+	zassert_equal(o.summaries, 0);
+	zassert_equal(o.windows, 1);
+	zassert_equal(o.window_start, 50, "window starts at %lld",
+		      (long long)o.window_start);
+	zassert_equal(o.window_len, 1 + params.post);
+
+	finish(&o);
+	zassert_equal(o.summaries, 0, "heartbeat disabled");
+	check_no_leak();
+}
+
+/* Traces: 24 hours at one sample a minute */
+
+#define DAY_SAMPLES (24 * 60)
+
+typedef void (*trace_fn)(int i, int32_t *temp, int32_t *hum);
+
+/* Closed storage room: flat but for a slow diurnal swing */
+static void trace_storage(int i, int32_t *temp, int32_t *hum)
+{
+	int32_t swing = (i < DAY_SAMPLES / 2 ? i : DAY_SAMPLES - i) / 4;
+
+	*temp = 18000 + swing + noise(30);
+	*hum = 52000 - swing + noise(100);
+}
+
+/* Office: heating on at 07:00 and off at 18:00, a window aired at noon */
+static void trace_office(int i, int32_t *temp, int32_t *hum)
+{
+	*temp = 19000 + noise(30);
+	*hum = 45000 + noise(100);
+
+	if (i >= 7 * 60 && i < 18 * 60) {
+		*temp += 100 * MIN(i - 7 * 60, 30);
+	} else if (i >= 18 * 60) {
+		*temp += 3000 - 50 * MIN(i - 18 * 60, 60);
+	}
+	if (i >= 12 * 60 && i < 12 * 60 + 15) {
+		*temp -= 1500;
+		*hum += 8000;
+	}
+}
+
+/* Bathroom: three showers, humidity jumps and decays */
+static void trace_bathroom(int i, int32_t *temp, int32_t *hum)
+{
+	static const int showers[] = { 6 * 60 + 30, 7 * 60 + 15, 21 * 60 };
+	int32_t peak = 0;
+
+	for (size_t s = 0; s < ARRAY_SIZE(showers); s++) {
+		int since = i - showers[s];
+
+		if (since >= 0 && since < 10) {
+			peak = MAX(peak, 30000);
+		} else if (since >= 10 && since < 70) {
+			peak = MAX(peak, 30000 - 500 * (since - 10));
+		}
+	}
+
+	*temp = 21000 + peak / 15 + noise(30);
+	*hum = 55000 + peak + noise(100);
+}
+
+/* Replay a day of @p fn, expecting to save at least @p saving percent */
+static void replay(const char *name, trace_fn fn, uint32_t saving)
+{
+	struct pipeline_changedet_stats before, after;
+	struct outcome o = { 0 };
+	uint32_t baseline, bytes, saved;
+	int32_t temp, hum;
+
+	/* Each trace starts from scratch */
+	zassert_ok(changedet.stage.api->init(&changedet.stage));
+	pipeline_changedet_stats_get(&changedet, &before);
+
+	for (int i = 0; i < DAY_SAMPLES; i++) {
+		fn(i, &temp, &hum);
+		feed(i, temp, hum, &o);
+	}
+	finish(&o);
+
+	pipeline_changedet_stats_get(&changedet, &after);
+
+	baseline = DIV_ROUND_UP(DAY_SAMPLES, BASELINE_BATCH) *
+			   UPLOAD_OVERHEAD +
+		   DAY_SAMPLES * SAMPLE_BYTES;
+	bytes = (o.windows + o.summaries) * UPLOAD_OVERHEAD +
+		(o.window_samples + o.summaries) * SAMPLE_BYTES;
+	saved = 100U - 100U * bytes / baseline;
+
+	printk("changedet %s: %u changes, %u windows of %u samples, "
+	       "%u summaries; %u of %u bytes uploaded, %u%% saved\n",
+	       name, after.changes - before.changes, o.windows,
+	       o.window_samples, o.summaries, bytes, baseline, saved);
+
+	zassert_equal(after.samples - before.samples, DAY_SAMPLES);
+	zassert_equal(after.window_samples - before.window_samples,
+		      o.window_samples);
+	zassert_true(saved >= saving, "%s: %u%% saved", name, saved);
+	check_no_leak();
+}
+
+ZTEST(pipeline_changedet, test_traces)
+{
+	replay("storage", trace_storage, 75);
+	replay("office", trace_office, 50);
+	replay("bathroom", trace_bathroom, 40);
+}
+
+static void *changedet_setup(void)
+{
+	changedet.stage.pipeline = &trace;
+
+	return NULL;
+}
+
+static void changedet_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	noise_state = 1;
+	zassert_ok(pipeline_changedet_params_set(&changedet, &defaults));
+	zassert_ok(changedet.stage.api->init(&changedet.stage));
+}
+
+ZTEST_SUITE(pipeline_changedet, NULL, changedet_setup, changedet_before,
+	    NULL, NULL);
@@ -0,0 +1,501 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test pipeline end to end
+ *
+ * Pipelines read the example sensor and a button wired to the GPIO emulator
+ * on a period, run the samples through transform, batch and sink stages and
+ * record what comes out: every acquired sample must reach the sink exactly
+ * once, in order and on time, or be accounted for in the statistics.
+ */
+
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/ztest.h>
+
+#include <app/lib/pipeline.h>
+
+#define SENSOR_NODE DT_NODELABEL(example_sensor)
+#define SENSOR_PIN DT_GPIO_PIN(SENSOR_NODE, input_gpios)
+#define BUTTON_NODE DT_PATH(zephyr_user)
+#define BUTTON_PIN DT_GPIO_PIN(BUTTON_NODE, button_gpios)
+
+#define PERIOD_MS 20
+#define BATCH_SIZE 5
+#define MAX_AGE_MS 50
+#define SLOW_PERIOD_MS 10
+#define SLOW_BUFS 4
+
+/* Allowed deviation from the nominal time */
+#define TOLERANCE_MS 2
+
+static const struct device *const port =
+	DEVICE_DT_GET(DT_GPIO_CTLR(SENSOR_NODE, input_gpios));
+
+static const enum sensor_channel channels[] = { SENSOR_CHAN_PROX };
+static const struct gpio_dt_spec button =
+	GPIO_DT_SPEC_GET(BUTTON_NODE, button_gpios);
+
+struct batch_record {
+	int64_t arrived_ms;
+	uint8_t count;
+	int64_t t_ms[BATCH_SIZE];
+	int32_t value[BATCH_SIZE];
+};
+
+K_MSGQ_DEFINE(batches, sizeof(struct batch_record), 8, 8);
+
+static int record_sink(struct net_buf *samples, void *user_data)
+{
+	struct batch_record rec = { .arrived_ms = k_uptime_get() };
+
+	ARG_UNUSED(user_data);
+
+	for (; samples != NULL; samples = samples->frags) {
+		struct pipeline_sample *sample = pipeline_sample(samples);
+
+		if (rec.count < BATCH_SIZE) {
+			rec.t_ms[rec.count] = sample->timestamp_ms;
+			rec.value[rec.count] = sample->values[0].val1;
+		}
+		rec.count++;
+	}
+
+	return k_msgq_put(&batches, &rec, K_NO_WAIT);
+}
+
+/* Consume batches until none came for @p quiet_ms, return the samples */
+static int drain(uint32_t quiet_ms)
+{
+	struct batch_record rec;
+	int samples = 0;
+
+	while (k_msgq_get(&batches, &rec, K_MSEC(quiet_ms)) == 0) {
+		samples += rec.count;
+	}
+
+	return samples;
+}
+
+static struct pipeline_stats stats_since(struct pipeline *pipeline,
+					 const struct pipeline_stats *before)
+{
+	struct pipeline_stats now;
+
+	pipeline_stats_get(pipeline, &now);
+
+	return (struct pipeline_stats){
+		.acquired = now.acquired - before->acquired,
+		.no_buf = now.no_buf - before->no_buf,
+		.acquire_errors = now.acquire_errors - before->acquire_errors,
+		.dropped = now.dropped - before->dropped,
+		.delivered = now.delivered - before->delivered,
+		.sink_errors = now.sink_errors - before->sink_errors,
+	};
+}
+
+/* Sensor and button, scaled, button presses dropped, batches of five */
+
+static struct pipeline_acquire sensor_and_button = {
+	.sensor = DEVICE_DT_GET(SENSOR_NODE),
+	.channels = channels,
+	.num_channels = ARRAY_SIZE(channels),
+	.gpios = &button,
+	.num_gpios = 1,
+	.period_ms = PERIOD_MS,
+};
+
+static int scale_unless_pressed(struct pipeline_sample *sample,
+				void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (sample->values[1].val1 != 0) {
+		return 1;
+	}
+
+	sample->values[0].val1 *= 100;
+
+	return 0;
+}
+
+static struct pipeline_transform scale =
+	PIPELINE_TRANSFORM_INITIALIZER(scale_unless_pressed, NULL);
+static struct pipeline_batch batch_of_five =
+	PIPELINE_BATCH_INITIALIZER(BATCH_SIZE, 0);
+static struct pipeline_sink sink = PIPELINE_SINK_INITIALIZER(record_sink, NULL);
+
+PIPELINE_DEFINE(e2e, 2 * BATCH_SIZE, &sensor_and_button, &scale.stage,
+		&batch_of_five.stage, &sink.stage);
+
+ZTEST(pipeline_e2e, test_periodic_batches)
+{
+	struct pipeline_stats before, st;
+	struct batch_record rec;
+	int64_t t0 = 0;
+	int n = 0;
+
+	pipeline_stats_get(&e2e, &before);
+	zassert_ok(pipeline_start(&e2e));
+
+	for (int b = 0; b < 4; b++) {
+		zassert_ok(k_msgq_get(&batches, &rec,
+				      K_MSEC(2 * BATCH_SIZE * PERIOD_MS)),
+			   "batch %d missing", b);
+		zassert_equal(rec.count, BATCH_SIZE, "batch %d has %u samples",
+			      b, rec.count);
+
+		for (int i = 0; i < BATCH_SIZE; i++, n++) {
+			int64_t nominal;
+
+			if (n == 0) {
+				t0 = rec.t_ms[0];
+			}
+			nominal = t0 + n * PERIOD_MS;
+
+			zassert_equal(rec.value[i], 100, "sample %d not scaled",
+				      n);
+			/* Against the first sample, so drift would show */
+			zassert_within(rec.t_ms[i], nominal, TOLERANCE_MS,
+				       "sample %d at %lld ms, expected %lld", n,
+				       rec.t_ms[i] - t0, nominal - t0);
+		}
+
+		/* A batch leaves as soon as its last sample is in */
+		zassert_within(rec.arrived_ms, rec.t_ms[BATCH_SIZE - 1],
+			       TOLERANCE_MS);
+	}
+
+	zassert_ok(pipeline_stop(&e2e));
+	n += drain(100);
+
+	st = stats_since(&e2e, &before);
+	zassert_equal(st.acquired, n, "%u acquired, %d delivered", st.acquired,
+		      n);
+	zassert_equal(st.delivered, n);
+	zassert_equal(st.dropped + st.no_buf + st.acquire_errors, 0);
+}
+
+ZTEST(pipeline_e2e, test_stop_flushes)
+{
+	struct pipeline_stats before, st;
+	struct batch_record rec;
+
+	pipeline_stats_get(&e2e, &before);
+	zassert_ok(pipeline_start(&e2e));
+	k_msleep(3 * PERIOD_MS - PERIOD_MS / 2);
+	zassert_ok(pipeline_stop(&e2e));
+
+	/* Three samples in a batch that would otherwise wait for five */
+	zassert_ok(k_msgq_get(&batches, &rec, K_MSEC(100)),
+		   "incomplete batch not flushed");
+	zassert_equal(rec.count, 3);
+	zassert_equal(drain(100), 0);
+
+	st = stats_since(&e2e, &before);
+	zassert_equal(st.acquired, 3);
+	zassert_equal(st.delivered, 3);
+}
+
+ZTEST(pipeline_e2e, test_transform_drops)
+{
+	struct pipeline_stats before, st;
+	int delivered;
+
+	pipeline_stats_get(&e2e, &before);
+	zassert_ok(pipeline_start(&e2e));
+
+	/* Pressed for five periods */
+	k_msleep(PERIOD_MS / 2);
+	zassert_ok(gpio_emul_input_set(port, BUTTON_PIN, 0));
+	k_msleep(5 * PERIOD_MS);
+	zassert_ok(gpio_emul_input_set(port, BUTTON_PIN, 1));
+	k_msleep(3 * PERIOD_MS);
+
+	zassert_ok(pipeline_stop(&e2e));
+	delivered = drain(100);
+
+	st = stats_since(&e2e, &before);
+	zassert_equal(st.dropped, 5, "%u samples dropped", st.dropped);
+	zassert_equal(st.delivered, delivered);
+	zassert_equal(st.acquired, st.dropped + st.delivered,
+		      "samples went missing");
+}
+
+/* A batch that never fills up leaves when its first sample is old enough */
+
+static struct pipeline_acquire sensor_only = {
+	.sensor = DEVICE_DT_GET(SENSOR_NODE),
+	.channels = channels,
+	.num_channels = ARRAY_SIZE(channels),
+	.period_ms = PERIOD_MS,
+};
+
+static struct pipeline_batch aged_batch = PIPELINE_BATCH_INITIALIZER(100,
+								     MAX_AGE_MS);
+static struct pipeline_sink aged_sink =
+	PIPELINE_SINK_INITIALIZER(record_sink, NULL);
+
+PIPELINE_DEFINE(aged, 8, &sensor_only, &aged_batch.stage, &aged_sink.stage);
+
+ZTEST(pipeline_e2e, test_max_age)
+{
+	struct batch_record rec;
+
+	zassert_ok(pipeline_start(&aged));
+	zassert_ok(k_msgq_get(&batches, &rec, K_MSEC(4 * MAX_AGE_MS)),
+		   "aged batch not passed on");
+	zassert_ok(pipeline_stop(&aged));
+	(void)drain(100);
+
+	/* Samples at 0, 20 and 40 ms; the batch leaves at 50 ms */
+	zassert_equal(rec.count, DIV_ROUND_UP(MAX_AGE_MS, PERIOD_MS));
+	zassert_within(rec.arrived_ms - rec.t_ms[0], MAX_AGE_MS, TOLERANCE_MS,
+		       "batch left after %lld ms",
+		       rec.arrived_ms - rec.t_ms[0]);
+}
+
+/* A sink that blocks must neither lose samples nor stall acquisition */
+
+static K_SEM_DEFINE(gate, 0, 1);
+static atomic_t gate_open;
+static int64_t slow_t_ms[128];
+static int slow_count;
+
+static int blocking_sink(struct net_buf *samples, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (!atomic_get(&gate_open)) {
+		(void)k_sem_take(&gate, K_FOREVER);
+	}
+
+	if (slow_count < ARRAY_SIZE(slow_t_ms)) {
+		slow_t_ms[slow_count] = pipeline_sample(samples)->timestamp_ms;
+	}
+	slow_count++;
+
+	return 0;
+}
+
+static struct pipeline_acquire slow_source = {
+	.sensor = DEVICE_DT_GET(SENSOR_NODE),
+	.channels = channels,
+	.num_channels = ARRAY_SIZE(channels),
+	.period_ms = SLOW_PERIOD_MS,
+};
+
+static struct pipeline_sink slow_sink =
+	PIPELINE_SINK_INITIALIZER(blocking_sink, NULL);
+
+PIPELINE_DEFINE(slow, SLOW_BUFS, &slow_source, &slow_sink.stage);
+
+ZTEST(pipeline_e2e, test_backpressure)
+{
+	struct pipeline_stats before, st, now;
+
+	pipeline_stats_get(&slow, &before);
+	zassert_ok(pipeline_start(&slow));
+	k_msleep(20 * SLOW_PERIOD_MS);
+
+	st = stats_since(&slow, &before);
+	pipeline_stats_get(&slow, &now);
+	zassert_true(st.acquired <= SLOW_BUFS,
+		     "%u samples acquired with %d buffers", st.acquired,
+		     SLOW_BUFS);
+	if (CONFIG_PIPELINE_THREADS > 1) {
+		/* Acquisition kept its pace on another thread */
+		zassert_true(st.acquired + st.no_buf >= 19,
+			     "%u acquisitions in 20 periods",
+			     st.acquired + st.no_buf);
+		zassert_true(st.no_buf > 0);
+		zassert_equal(now.bufs_used, SLOW_BUFS);
+	}
+
+	atomic_set(&gate_open, 1);
+	k_sem_give(&gate);
+	zassert_ok(pipeline_stop(&slow));
+	k_msleep(100);
+
+	st = stats_since(&slow, &before);
+	zassert_equal(slow_count, st.acquired,
+		      "%d of %u acquired samples delivered", slow_count,
+		      st.acquired);
+	for (int i = 1; i < MIN(slow_count, ARRAY_SIZE(slow_t_ms)); i++) {
+		zassert_true(slow_t_ms[i] > slow_t_ms[i - 1],
+			     "sample %d delivered out of order", i);
+	}
+
+	/* Every buffer is back, the high-water mark stays */
+	pipeline_stats_get(&slow, &now);
+	zassert_equal(now.bufs_used, 0, "%u buffers leaked", now.bufs_used);
+	if (CONFIG_PIPELINE_THREADS > 1) {
+		zassert_equal(now.bufs_max_used, SLOW_BUFS);
+	}
+}
+
+/* The period changes between samples without a restart */
+
+#define RETIMED_SLOW_MS 1000
+#define RETIMED_FAST_MS 20
+
+static struct pipeline_acquire retimed_source = {
+	.sensor = DEVICE_DT_GET(SENSOR_NODE),
+	.channels = channels,
+	.num_channels = ARRAY_SIZE(channels),
+	.period_ms = RETIMED_SLOW_MS,
+};
+
+static struct pipeline_sink retimed_sink =
+	PIPELINE_SINK_INITIALIZER(record_sink, NULL);
+
+PIPELINE_DEFINE(retimed, 4, &retimed_source, &retimed_sink.stage);
+
+ZTEST(pipeline_e2e, test_period_set)
+{
+	struct batch_record rec;
+	int64_t changed_ms;
+	int64_t prev_ms;
+
+	zassert_equal(pipeline_period_set(&retimed, 0), -EINVAL);
+
+	zassert_ok(pipeline_start(&retimed));
+	zassert_ok(k_msgq_get(&batches, &rec, K_MSEC(100)));
+	prev_ms = rec.t_ms[0];
+
+	/* Shorter: one period is already past, so a sample right away */
+	k_msleep(50);
+	changed_ms = k_uptime_get();
+	zassert_ok(pipeline_period_set(&retimed, RETIMED_FAST_MS));
+	zassert_ok(k_msgq_get(&batches, &rec, K_MSEC(100)));
+	zassert_within(rec.t_ms[0], changed_ms, TOLERANCE_MS,
+		       "first sample %lld ms after the change",
+		       rec.t_ms[0] - changed_ms);
+	prev_ms = rec.t_ms[0];
+
+	/* Then on the new period, without catching up on missed ones */
+	for (int i = 0; i < 3; i++) {
+		zassert_ok(k_msgq_get(&batches, &rec, K_MSEC(100)));
+		zassert_within(rec.t_ms[0] - prev_ms, RETIMED_FAST_MS,
+			       TOLERANCE_MS, "sample %d after %lld ms", i,
+			       rec.t_ms[0] - prev_ms);
+		prev_ms = rec.t_ms[0];
+	}
+
+	/* Longer: counted from the last sample */
+	zassert_ok(pipeline_period_set(&retimed, 3 * RETIMED_FAST_MS));
+	zassert_ok(k_msgq_get(&batches, &rec, K_MSEC(200)));
+	zassert_within(rec.t_ms[0] - prev_ms, 3 * RETIMED_FAST_MS,
+		       TOLERANCE_MS, "sample after %lld ms",
+		       rec.t_ms[0] - prev_ms);
+
+	zassert_ok(pipeline_stop(&retimed));
+	(void)drain(100);
+}
+
+/* A change detection window short of buffers is passed on as it is */
+
+#define STARVED_BUFS 8
+#define STARVED_HELD 3
+
+static struct pipeline_acquire starved_source = {
+	.sensor = DEVICE_DT_GET(SENSOR_NODE),
+	.channels = channels,
+	.num_channels = ARRAY_SIZE(channels),
+	.period_ms = PERIOD_MS,
+};
+
+static struct pipeline_changedet starved_changes =
+	PIPELINE_CHANGEDET_INITIALIZER();
+static struct pipeline_sink starved_sink =
+	PIPELINE_SINK_INITIALIZER(record_sink, NULL);
+
+PIPELINE_DEFINE(starved, STARVED_BUFS, &starved_source,
+		&starved_changes.stage, &starved_sink.stage);
+
+ZTEST(pipeline_e2e, test_starved_window)
+{
+	/* pre + 1 + post + 2 samples, just what the pool holds */
+	const struct pipeline_changedet_params params = {
+		.alpha_shift = 4,
+		.drift = 50,
+		.threshold = 500,
+		.pre = 1,
+		.post = 4,
+	};
+	struct pipeline_changedet_params larger = params;
+	struct net_buf *held[STARVED_HELD];
+	struct pipeline_stats before, st;
+	struct batch_record rec;
+
+	zassert_ok(pipeline_changedet_params_set(&starved_changes, &params));
+	pipeline_stats_get(&starved, &before);
+	zassert_ok(pipeline_start(&starved));
+
+	larger.post++;
+	zassert_equal(pipeline_changedet_params_set(&starved_changes, &larger),
+		      -ENOBUFS, "window larger than the pool accepted");
+
+	/* As a sink still sending an earlier window would */
+	for (int i = 0; i < STARVED_HELD; i++) {
+		k_spinlock_key_t key;
+
+		held[i] = net_buf_alloc(&starved_pool, K_NO_WAIT);
+		zassert_not_null(held[i]);
+		*(struct pipeline **)net_buf_user_data(held[i]) = &starved;
+		key = k_spin_lock(&starved.lock);
+		starved.stats.bufs_used++;
+		k_spin_unlock(&starved.lock, key);
+	}
+
+	/* A step: the window runs out of buffers before its last sample */
+	k_msleep(3 * PERIOD_MS);
+	zassert_ok(gpio_emul_input_set(port, SENSOR_PIN, 0));
+	zassert_ok(k_msgq_get(&batches, &rec, K_MSEC(20 * PERIOD_MS)),
+		   "window wedged without buffers");
+	zassert_equal(rec.count, STARVED_BUFS - STARVED_HELD,
+		      "window of %u samples", rec.count);
+	zassert_equal(rec.value[0], 1, "pre sample missing");
+	zassert_equal(rec.value[1], 0);
+
+	st = stats_since(&starved, &before);
+	zassert_true(st.no_buf > 0);
+
+	/* With the pool back, the next step gets its full window */
+	for (int i = 0; i < STARVED_HELD; i++) {
+		net_buf_unref(held[i]);
+	}
+	k_msleep(3 * PERIOD_MS);
+	zassert_ok(gpio_emul_input_set(port, SENSOR_PIN, 1));
+	zassert_ok(k_msgq_get(&batches, &rec, K_MSEC(20 * PERIOD_MS)),
+		   "no window after the shortage");
+	zassert_equal(rec.count, params.pre + 1 + params.post,
+		      "window of %u samples", rec.count);
+
+	zassert_ok(pipeline_stop(&starved));
+	(void)drain(100);
+	pipeline_stats_get(&starved, &st);
+	zassert_equal(st.bufs_used, 0, "%u buffers leaked", st.bufs_used);
+}
+
+static void *e2e_setup(void)
+{
+	zassert_ok(gpio_pin_configure_dt(&button, GPIO_INPUT));
+
+	return NULL;
+}
+
+static void e2e_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	/* Sensor input high, button released */
+	zassert_ok(gpio_emul_input_set(port, SENSOR_PIN, 1));
+	zassert_ok(gpio_emul_input_set(port, BUTTON_PIN, 1));
+	k_msgq_purge(&batches);
+}
+
+ZTEST_SUITE(pipeline_e2e, NULL, e2e_setup, e2e_before, NULL, NULL);
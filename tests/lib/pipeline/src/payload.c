@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test pipeline payload slab
+ *
+ * Payloads are allocated until the slab runs dry, to check that exhaustion
+ * fails cleanly or waits for a release, that references keep a payload
+ * alive and that the usage statistics follow.
+ */
+
+#include <zephyr/ztest.h>
+
+#include <app/lib/pipeline.h>
+
+#define COUNT CONFIG_PIPELINE_PAYLOAD_COUNT
+
+/* Allowed deviation from the nominal time */
+#define TOLERANCE_MS 2
+
+static struct pipeline_payload *held[COUNT];
+
+static void exhaust(void)
+{
+	for (int i = 0; i < COUNT; i++) {
+		held[i] = pipeline_payload_alloc(K_NO_WAIT);
+		zassert_not_null(held[i], "payload %d of %d unavailable", i,
+				 COUNT);
+		zassert_equal(held[i]->len, 0);
+		zassert_equal(held[i]->size, CONFIG_PIPELINE_PAYLOAD_SIZE);
+	}
+}
+
+static void release_all(void)
+{
+	for (int i = 0; i < COUNT; i++) {
+		if (held[i] != NULL) {
+			pipeline_payload_unref(held[i]);
+			held[i] = NULL;
+		}
+	}
+}
+
+ZTEST(pipeline_payload, test_exhaustion)
+{
+	struct pipeline_payload_stats before, st;
+	int64_t start;
+
+	pipeline_payload_stats_get(&before);
+	exhaust();
+
+	zassert_is_null(pipeline_payload_alloc(K_NO_WAIT),
+			"allocated past the end of the slab");
+
+	start = k_uptime_get();
+	zassert_is_null(pipeline_payload_alloc(K_MSEC(20)));
+	zassert_within(k_uptime_get() - start, 20, TOLERANCE_MS,
+		       "did not wait for the timeout");
+
+	pipeline_payload_stats_get(&st);
+	zassert_equal(st.count, COUNT);
+	zassert_equal(st.used, COUNT);
+	zassert_equal(st.max_used, COUNT);
+	zassert_equal(st.failures - before.failures, 2);
+
+	release_all();
+
+	pipeline_payload_stats_get(&st);
+	zassert_equal(st.used, 0, "%u payloads leaked", st.used);
+	zassert_equal(st.max_used, COUNT, "high-water mark lost");
+}
+
+ZTEST(pipeline_payload, test_references)
+{
+	struct pipeline_payload_stats st;
+	struct pipeline_payload *payload = pipeline_payload_alloc(K_NO_WAIT);
+
+	zassert_not_null(payload);
+	zassert_equal_ptr(pipeline_payload_ref(payload), payload);
+	zassert_equal_ptr(pipeline_payload_ref(payload), payload);
+
+	memset(payload->data, 0xa5, payload->size);
+	payload->len = payload->size;
+
+	/* Two consumers done, the third one still holds it */
+	pipeline_payload_unref(payload);
+	pipeline_payload_unref(payload);
+
+	pipeline_payload_stats_get(&st);
+	zassert_equal(st.used, 1, "payload freed while referenced");
+	zassert_equal(payload->data[payload->size - 1], 0xa5);
+
+	pipeline_payload_unref(payload);
+
+	pipeline_payload_stats_get(&st);
+	zassert_equal(st.used, 0, "payload not freed with its last reference");
+}
+
+static void release_one(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	pipeline_payload_unref(held[0]);
+	held[0] = NULL;
+}
+
+static K_WORK_DELAYABLE_DEFINE(release_work, release_one);
+
+ZTEST(pipeline_payload, test_waits_for_release)
+{
+	struct pipeline_payload *payload;
+	int64_t start;
+
+	exhaust();
+
+	start = k_uptime_get();
+	k_work_schedule(&release_work, K_MSEC(30));
+
+	payload = pipeline_payload_alloc(K_MSEC(200));
+	zassert_not_null(payload, "released payload not handed over");
+	zassert_within(k_uptime_get() - start, 30, TOLERANCE_MS);
+
+	pipeline_payload_unref(payload);
+}
+
+static void payload_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	(void)k_work_cancel_delayable(&release_work);
+	release_all();
+}
+
+ZTEST_SUITE(pipeline_payload, NULL, NULL, NULL, payload_after, NULL);
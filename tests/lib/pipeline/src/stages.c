@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test pipeline stages
+ *
+ * Each stage is fed hand-made buffers, outside of any pipeline, and checked
+ * for what it passes on, what it keeps and that no buffer leaks. Acquisition
+ * is tested on its own in a pipeline that only has a sink.
+ */
+
+#include <zephyr/drivers/gpio/gpio_emul.h>
+#include <zephyr/ztest.h>
+
+#include <app/lib/pipeline.h>
+
+#define UNIT_BUFS 8
+
+#define SENSOR_NODE DT_NODELABEL(example_sensor)
+#define SENSOR_PIN DT_GPIO_PIN(SENSOR_NODE, input_gpios)
+#define BUTTON_NODE DT_PATH(zephyr_user)
+#define BUTTON_PIN DT_GPIO_PIN(BUTTON_NODE, button_gpios)
+
+NET_BUF_POOL_FIXED_DEFINE(unit_pool, UNIT_BUFS, sizeof(struct pipeline_sample),
+			  0, NULL);
+
+/* Stages tested outside of a pipeline still account to one */
+static struct pipeline unit = { .name = "unit" };
+
+static const struct device *const port =
+	DEVICE_DT_GET(DT_GPIO_CTLR(SENSOR_NODE, input_gpios));
+
+static struct net_buf *make_sample(int32_t value)
+{
+	struct net_buf *buf = net_buf_alloc(&unit_pool, K_NO_WAIT);
+	struct pipeline_sample *sample;
+
+	zassert_not_null(buf, "unit pool exhausted");
+
+	sample = net_buf_add(buf, sizeof(*sample));
+	sample->timestamp_ms = k_uptime_get();
+	sample->epoch_ms = 0;
+	sample->flags = 0;
+	sample->count = 1;
+	sample->values[0] = (struct sensor_value){ .val1 = value };
+
+	return buf;
+}
+
+/* Chain @p n samples with values 0 to n - 1 */
+static struct net_buf *make_chain(int n)
+{
+	struct net_buf *head = make_sample(0);
+
+	for (int i = 1; i < n; i++) {
+		net_buf_frag_add(head, make_sample(i));
+	}
+
+	return head;
+}
+
+static void check_chain(struct net_buf *buf, const int32_t *values, int n)
+{
+	for (int i = 0; i < n; i++, buf = buf->frags) {
+		zassert_not_null(buf, "chain ends after %d samples", i);
+		zassert_equal(pipeline_sample(buf)->values[0].val1, values[i],
+			      "sample %d is %d", i,
+			      pipeline_sample(buf)->values[0].val1);
+	}
+	zassert_is_null(buf, "chain longer than %d samples", n);
+}
+
+/* Every buffer of the pool must be back */
+static void check_no_leak(void)
+{
+	struct net_buf *bufs[UNIT_BUFS];
+
+	for (int i = 0; i < UNIT_BUFS; i++) {
+		bufs[i] = net_buf_alloc(&unit_pool, K_NO_WAIT);
+		zassert_not_null(bufs[i], "%d buffers leaked", UNIT_BUFS - i);
+	}
+	for (int i = 0; i < UNIT_BUFS; i++) {
+		net_buf_unref(bufs[i]);
+	}
+}
+
+static void unit_reset(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	unit.stats = (struct pipeline_stats){ 0 };
+}
+
+/* Transform */
+
+static int scale_drop_odd(struct pipeline_sample *sample, void *user_data)
+{
+	int32_t *scale = user_data;
+
+	if (sample->values[0].val1 % 2 != 0) {
+		return 1;
+	}
+
+	sample->values[0].val1 *= *scale;
+
+	return 0;
+}
+
+static int32_t scale = 10;
+static struct pipeline_transform transform =
+	PIPELINE_TRANSFORM_INITIALIZER(scale_drop_odd, &scale);
+
+ZTEST(pipeline_transform, test_in_place)
+{
+	struct net_buf *buf = make_sample(4);
+	struct net_buf *out;
+
+	out = transform.stage.api->process(&transform.stage, buf);
+	zassert_equal_ptr(out, buf, "sample was not modified in place");
+	check_chain(out, (const int32_t[]){ 40 }, 1);
+
+	net_buf_unref(out);
+	check_no_leak();
+}
+
+ZTEST(pipeline_transform, test_drop_from_chain)
+{
+	struct pipeline_stats stats;
+	struct net_buf *out;
+
+	/* 1, 3 and 5 go, including the head */
+	out = transform.stage.api->process(&transform.stage, make_chain(6));
+	check_chain(out, (const int32_t[]){ 0, 20, 40 }, 3);
+	net_buf_unref(out);
+
+	/* A single odd sample leaves nothing */
+	zassert_is_null(transform.stage.api->process(&transform.stage,
+						     make_sample(7)));
+
+	pipeline_stats_get(&unit, &stats);
+	zassert_equal(stats.dropped, 4);
+	check_no_leak();
+}
+
+static void *transform_setup(void)
+{
+	transform.stage.pipeline = &unit;
+
+	return NULL;
+}
+
+ZTEST_SUITE(pipeline_transform, NULL, transform_setup, unit_reset, NULL,
+	    NULL);
+
+/* Batch */
+
+static struct pipeline_batch batch = PIPELINE_BATCH_INITIALIZER(3, 0);
+
+ZTEST(pipeline_batch, test_full_batches)
+{
+	struct net_buf *out;
+
+	for (int i = 0; i < 2; i++) {
+		zassert_is_null(batch.stage.api->process(&batch.stage,
+							 make_sample(3 * i)));
+		zassert_is_null(batch.stage.api->process(&batch.stage,
+							 make_sample(3 * i + 1)));
+		out = batch.stage.api->process(&batch.stage,
+					       make_sample(3 * i + 2));
+		zassert_not_null(out, "batch %d not passed on when full", i);
+		check_chain(out,
+			    (const int32_t[]){ 3 * i, 3 * i + 1, 3 * i + 2 },
+			    3);
+		net_buf_unref(out);
+	}
+
+	check_no_leak();
+}
+
+ZTEST(pipeline_batch, test_chains_count)
+{
+	struct net_buf *out;
+
+	/* A chain of two plus one sample fill a batch of three */
+	zassert_is_null(batch.stage.api->process(&batch.stage, make_chain(2)));
+	out = batch.stage.api->process(&batch.stage, make_sample(2));
+	check_chain(out, (const int32_t[]){ 0, 1, 2 }, 3);
+	net_buf_unref(out);
+
+	check_no_leak();
+}
+
+ZTEST(pipeline_batch, test_flush)
+{
+	struct net_buf *out;
+
+	zassert_is_null(batch.stage.api->flush(&batch.stage),
+			"empty batch passed on");
+
+	zassert_is_null(batch.stage.api->process(&batch.stage, make_sample(5)));
+	out = batch.stage.api->flush(&batch.stage);
+	check_chain(out, (const int32_t[]){ 5 }, 1);
+	net_buf_unref(out);
+
+	/* The next batch starts from scratch */
+	zassert_is_null(batch.stage.api->process(&batch.stage, make_sample(6)));
+	zassert_is_null(batch.stage.api->process(&batch.stage, make_sample(7)));
+	out = batch.stage.api->process(&batch.stage, make_sample(8));
+	check_chain(out, (const int32_t[]){ 6, 7, 8 }, 3);
+	net_buf_unref(out);
+
+	check_no_leak();
+}
+
+static void *batch_setup(void)
+{
+	batch.stage.pipeline = &unit;
+	zassert_ok(batch.stage.api->init(&batch.stage));
+
+	return NULL;
+}
+
+ZTEST_SUITE(pipeline_batch, NULL, batch_setup, unit_reset, NULL, NULL);
+
+/* Sink */
+
+static int sink_calls;
+static int sink_samples;
+
+static int count_sink(struct net_buf *samples, void *user_data)
+{
+	int *ret = user_data;
+
+	sink_calls++;
+	for (; samples != NULL; samples = samples->frags) {
+		sink_samples++;
+	}
+
+	return *ret;
+}
+
+static int sink_ret;
+static struct pipeline_sink sink =
+	PIPELINE_SINK_INITIALIZER(count_sink, &sink_ret);
+
+ZTEST(pipeline_sink, test_passes_on)
+{
+	struct pipeline_stats stats;
+	struct net_buf *buf = make_chain(4);
+
+	sink_ret = 0;
+	zassert_equal_ptr(sink.stage.api->process(&sink.stage, buf), buf,
+			  "a sink must pass the buffer on");
+	net_buf_unref(buf);
+
+	zassert_equal(sink_calls, 1);
+	zassert_equal(sink_samples, 4);
+
+	pipeline_stats_get(&unit, &stats);
+	zassert_equal(stats.delivered, 4);
+	zassert_equal(stats.sink_errors, 0);
+	check_no_leak();
+}
+
+ZTEST(pipeline_sink, test_errors)
+{
+	struct pipeline_stats stats;
+	struct net_buf *buf = make_sample(0);
+
+	sink_ret = -EIO;
+	zassert_equal_ptr(sink.stage.api->process(&sink.stage, buf), buf);
+	net_buf_unref(buf);
+
+	pipeline_stats_get(&unit, &stats);
+	zassert_equal(stats.delivered, 1, "failed samples still delivered");
+	zassert_equal(stats.sink_errors, 1);
+	check_no_leak();
+}
+
+static void sink_before(void *fixture)
+{
+	unit_reset(fixture);
+	sink_calls = 0;
+	sink_samples = 0;
+}
+
+static void *sink_setup(void)
+{
+	sink.stage.pipeline = &unit;
+
+	return NULL;
+}
+
+ZTEST_SUITE(pipeline_sink, NULL, sink_setup, sink_before, NULL, NULL);
+
+/* Acquire */
+
+static const enum sensor_channel acquire_channels[] = { SENSOR_CHAN_PROX };
+static const struct gpio_dt_spec button =
+	GPIO_DT_SPEC_GET(BUTTON_NODE, button_gpios);
+
+static struct pipeline_acquire acquire = {
+	.sensor = DEVICE_DT_GET(SENSOR_NODE),
+	.channels = acquire_channels,
+	.num_channels = ARRAY_SIZE(acquire_channels),
+	.gpios = &button,
+	.num_gpios = 1,
+};
+
+K_MSGQ_DEFINE(acquired, sizeof(struct pipeline_sample), 4, 4);
+
+static int record_sink(struct net_buf *samples, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	return k_msgq_put(&acquired, pipeline_sample(samples), K_NO_WAIT);
+}
+
+static struct pipeline_sink record =
+	PIPELINE_SINK_INITIALIZER(record_sink, NULL);
+
+PIPELINE_DEFINE(acquire_pipeline, 2, &acquire, &record.stage);
+
+ZTEST(pipeline_acquire, test_values)
+{
+	struct pipeline_sample sample;
+	int64_t before;
+
+	/* Sensor input high, button released (active low) */
+	zassert_ok(gpio_emul_input_set(port, SENSOR_PIN, 1));
+	zassert_ok(gpio_emul_input_set(port, BUTTON_PIN, 1));
+
+	before = k_uptime_get();
+	zassert_ok(pipeline_trigger(&acquire_pipeline));
+	zassert_ok(k_msgq_get(&acquired, &sample, K_MSEC(100)));
+
+	zassert_equal(sample.count, 2);
+	zassert_equal(sample.values[0].val1, 1, "sensor channel not read");
+	zassert_equal(sample.values[1].val1, 0, "button level not read");
+	zassert_true(sample.timestamp_ms >= before &&
+		     sample.timestamp_ms <= k_uptime_get(),
+		     "sample not timestamped when it was acquired");
+	zassert_equal(sample.epoch_ms, 0, "no wall clock to stamp with");
+
+	/* Sensor input low, button pressed */
+	zassert_ok(gpio_emul_input_set(port, SENSOR_PIN, 0));
+	zassert_ok(gpio_emul_input_set(port, BUTTON_PIN, 0));
+
+	zassert_ok(pipeline_trigger(&acquire_pipeline));
+	zassert_ok(k_msgq_get(&acquired, &sample, K_MSEC(100)));
+
+	zassert_equal(sample.values[0].val1, 0);
+	zassert_equal(sample.values[1].val1, 1);
+}
+
+ZTEST(pipeline_acquire, test_on_demand_only)
+{
+	struct pipeline_sample sample;
+
+	/* Nothing comes without a trigger */
+	zassert_equal(k_msgq_get(&acquired, &sample, K_MSEC(50)), -EAGAIN);
+
+	zassert_ok(pipeline_stop(&acquire_pipeline));
+	zassert_equal(pipeline_stop(&acquire_pipeline), -EALREADY);
+	zassert_equal(pipeline_trigger(&acquire_pipeline), -EAGAIN);
+	zassert_ok(pipeline_start(&acquire_pipeline));
+	zassert_equal(pipeline_start(&acquire_pipeline), -EALREADY);
+}
+
+static void *acquire_setup(void)
+{
+	zassert_ok(gpio_pin_configure_dt(&button, GPIO_INPUT));
+	zassert_ok(pipeline_start(&acquire_pipeline));
+
+	return NULL;
+}
+
+static void acquire_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	(void)pipeline_stop(&acquire_pipeline);
+}
+
+ZTEST_SUITE(pipeline_acquire, NULL, acquire_setup, NULL, NULL,
+	    acquire_teardown);
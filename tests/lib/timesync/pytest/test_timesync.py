@@ -0,0 +1,47 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''Time synchronization against scripts/sntp_standin.py.
+
+Run through twister on native_sim, e.g.
+
+  west twister -p native_sim -T tests/lib/timesync
+'''
+
+import re
+import time
+
+import pytest
+from twister_harness import DeviceAdapter
+
+# Host clock, then 200 ms ahead (slewed), then 5 s ahead (stepped), as
+# expected by src/main.c
+OFFSETS = '0,200,5000'
+# Console latency on top of the synchronization error
+TOLERANCE_MS = 500
+
+
+@pytest.fixture(scope='module')
+def sntp(standin):
+    return standin('sntp_standin.py', 'CONFIG_TIMESYNC_PORT',
+                   '--offsets', OFFSETS)
+
+
+def test_timesync(sntp, dut: DeviceAdapter):
+    lines = dut.readlines_until(regex=r'timesync: epoch \d+ ms', timeout=60)
+    host_ms = time.time() * 1000
+    m = re.search(r'timesync: epoch (\d+) ms', lines[-1])
+    assert m, lines
+
+    # The first reply is the host clock, read as soon as it is printed
+    error_ms = host_ms - int(m.group(1))
+    print(f'device clock {error_ms:.0f} ms behind the host')
+    assert -TOLERANCE_MS < error_ms < TOLERANCE_MS
+
+    lines = dut.readlines_until(regex=r'PROJECT EXECUTION (SUCCESSFUL|FAILED)',
+                                timeout=60)
+    output = '\n'.join(lines)
+    assert 'PROJECT EXECUTION SUCCESSFUL' in output, output
+
+    out = '\n'.join(sntp.stop())
+    assert len(re.findall(r'^SNTP .* offset', out, re.M)) == 3, out
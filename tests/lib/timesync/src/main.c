@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test timesync library
+ *
+ * The SNTP stand-in answers with the host clock, then with the host clock
+ * 200 ms ahead, then 5 s ahead. The first synchronization steps the clock,
+ * the second one slews it and the third one steps it again.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+
+#include <zephyr/ztest.h>
+
+#include <app/lib/timesync.h>
+
+/* Offsets of the stand-in replies, see pytest/test_timesync.py */
+#define SLEW_MS 200
+#define STEP_MS 5000
+
+/* Uptime has millisecond resolution, the round trip adds its own error */
+#define TOLERANCE_MS 20
+
+/* 2020-01-01T00:00:00Z */
+#define Y2020_MS 1577836800000LL
+
+#define SLEW_PER_S_MS (CONFIG_TIMESYNC_SLEW_PPM / 1000)
+
+ZTEST(timesync, test_a_unsynced)
+{
+	int64_t epoch_ms;
+
+	zassert_false(timesync_is_synced());
+	zassert_equal(timesync_now_ms(&epoch_ms), -EAGAIN);
+}
+
+ZTEST(timesync, test_b_first_sync)
+{
+	struct timesync_stats stats;
+	int64_t epoch_ms;
+
+	zassert_ok(timesync_start(K_SECONDS(5)), "first sync failed");
+	zassert_true(timesync_is_synced());
+
+	zassert_ok(timesync_now_ms(&epoch_ms));
+	/* Compared against the host clock by the pytest */
+	printk("timesync: epoch %lld ms\n", (long long)epoch_ms);
+	zassert_true(epoch_ms > Y2020_MS, "clock not set");
+
+	timesync_stats_get(&stats);
+	zassert_equal(stats.syncs, 1);
+	zassert_equal(stats.steps, 1, "the first sync must step");
+	zassert_equal(stats.slewing_ms, 0);
+}
+
+ZTEST(timesync, test_c_slew)
+{
+	struct timesync_stats stats;
+	int64_t u0, u1, e0, e1, slewed, prev, now, end;
+
+	/* Forces a resync, the stand-in is now ahead by SLEW_MS */
+	zassert_ok(timesync_start(K_SECONDS(5)), "resync failed");
+
+	timesync_stats_get(&stats);
+	zassert_equal(stats.syncs, 2);
+	zassert_equal(stats.steps, 1, "a small error must not step");
+	zassert_within(stats.last_error_ms, SLEW_MS, TOLERANCE_MS);
+	zassert_within(stats.slewing_ms, SLEW_MS, TOLERANCE_MS);
+
+	/* For a second, the clock runs faster by the slew rate */
+	u0 = k_uptime_get();
+	k_msleep(1000);
+	u1 = k_uptime_get();
+	zassert_ok(timesync_to_epoch_ms(u0, &e0));
+	zassert_ok(timesync_to_epoch_ms(u1, &e1));
+	slewed = (e1 - e0) - (u1 - u0);
+	zassert_within(slewed, (u1 - u0) * SLEW_PER_S_MS / MSEC_PER_SEC, 2,
+		       "slewed %lld ms in %lld ms", (long long)slewed,
+		       (long long)(u1 - u0));
+
+	/* Until the slew completes, and never backwards */
+	end = u0 + SLEW_MS * MSEC_PER_SEC / SLEW_PER_S_MS + 500;
+	zassert_ok(timesync_now_ms(&prev));
+	while (k_uptime_get() < end) {
+		zassert_ok(timesync_now_ms(&now));
+		zassert_true(now >= prev, "clock went back by %lld ms",
+			     (long long)(prev - now));
+		prev = now;
+		k_msleep(10);
+	}
+
+	timesync_stats_get(&stats);
+	zassert_equal(stats.slewing_ms, 0, "slew not complete");
+	zassert_within(stats.max_error_ms, SLEW_MS, TOLERANCE_MS);
+}
+
+ZTEST(timesync, test_d_step)
+{
+	struct timesync_stats stats;
+	int64_t before, after;
+
+	zassert_ok(timesync_now_ms(&before));
+
+	/* The stand-in is now ahead by STEP_MS */
+	zassert_ok(timesync_start(K_SECONDS(5)), "resync failed");
+
+	zassert_ok(timesync_now_ms(&after));
+	timesync_stats_get(&stats);
+	zassert_equal(stats.steps, 2, "a large error must step");
+	zassert_within(stats.last_error_ms, STEP_MS - SLEW_MS, TOLERANCE_MS);
+	zassert_equal(stats.slewing_ms, 0);
+	zassert_true(after - before >= STEP_MS - SLEW_MS - TOLERANCE_MS);
+	zassert_true(stats.last_rtt_ms < CONFIG_TIMESYNC_TIMEOUT_MS);
+	zassert_equal(stats.failures, 0);
+}
+
+ZTEST(timesync, test_e_stop)
+{
+	int64_t a, b;
+
+	timesync_stop();
+
+	/* The clock keeps running on its last offset */
+	zassert_true(timesync_is_synced());
+	zassert_ok(timesync_now_ms(&a));
+	k_msleep(100);
+	zassert_ok(timesync_now_ms(&b));
+	zassert_within(b - a, 100, 2);
+}
+
+ZTEST_SUITE(timesync, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,92 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''Uplink backends against the stand-in peers in scripts/.
+
+Run through twister on native_sim, e.g.
+
+  west twister -p native_sim -T tests/lib/uplink
+'''
+
+import re
+
+import pytest
+from twister_harness import DeviceAdapter
+
+BURST = 50
+COAP_DROP_EVERY = 20
+
+
+@pytest.fixture(scope='module')
+def peer(standin, build_config):
+    '''The stand-in of the backend built, see conftest.py.'''
+    if build_config.get('CONFIG_UPLINK_BACKEND_MQTT') == 'y':
+        return standin('mqtt_standin.py', 'CONFIG_UPLINK_PORT')
+    if build_config.get('CONFIG_UPLINK_BACKEND_COAP') == 'y':
+        # Lossy and asking for small blocks, to exercise both
+        return standin('coap_standin.py', 'CONFIG_UPLINK_PORT',
+                       '--drop-every', str(COAP_DROP_EVERY),
+                       '--max-block', '32')
+    if build_config.get('CONFIG_UPLINK_HTTP_TLS') == 'y':
+        return standin('tls_standin.py', 'CONFIG_UPLINK_PORT')
+    return standin('http_standin.py', 'CONFIG_UPLINK_PORT')
+
+
+def tls_handshakes(peer):
+    '''Stop the TLS stand-in and return its (resumed, ms) per handshake.'''
+    return [(m.group(1) == 'resumed', float(m.group(2)))
+            for m in re.finditer(r'^TLS \S+ \S+ \S+ (full|resumed) '
+                                 r'([\d.]+) ms', '\n'.join(peer.stop()),
+                                 re.M)]
+
+
+def test_uplink(peer, dut: DeviceAdapter):
+    lines = dut.readlines_until(regex=r'PROJECT EXECUTION (SUCCESSFUL|FAILED)',
+                                timeout=120)
+    output = '\n'.join(lines)
+    assert 'PROJECT EXECUTION SUCCESSFUL' in output, output
+
+    m = re.search(r'uplink (\w+): (\d+) sent, (\d+) acked, (\d+) failed, '
+                  r'(\d+) connects, (\d+) payload bytes, wire tx (\d+) '
+                  r'rx (\d+), packets tx (\d+) rx (\d+), (\d+) retransmits, '
+                  r'(\d+) ms', output)
+    assert m, output
+
+    backend = m.group(1)
+    (sent, acked, failed, connects, payload, tx, rx, ptx, prx, retx,
+     ms) = (int(m.group(i)) for i in range(2, 13))
+    assert sent == BURST
+    assert failed == 0
+
+    print(f'{backend}: {(tx + rx - payload) / sent:.0f} framing bytes and '
+          f'{(ptx + prx) / sent:.1f} packets per message, '
+          f'{retx} retransmits, {sent * 1000 / max(ms, 1):.0f} msgs/s')
+
+    if backend == 'http':
+        # A connection and a full set of headers for every message
+        assert connects == sent
+        assert ptx + prx >= 8 * sent
+
+        handshakes = tls_handshakes(peer)
+        if handshakes:
+            full = [ms for resumed, ms in handshakes if not resumed]
+            resumed = [ms for resumed, ms in handshakes if resumed]
+            print(f'TLS: {len(full)} full handshakes, '
+                  f'{sum(full) / max(len(full), 1):.1f} ms mean; '
+                  f'{len(resumed)} resumed, '
+                  f'{sum(resumed) / max(len(resumed), 1):.1f} ms mean')
+            # Only the first connection needs the key exchange
+            assert len(full) == 1
+            assert len(resumed) == len(handshakes) - 1
+    elif backend == 'mqtt':
+        # The session opened by test_a_connect carries the whole burst
+        assert connects == 0
+        assert ptx >= sent
+    else:
+        assert connects == 0
+        # One confirmable request and one ACK per block; every datagram
+        # the stand-in dropped costs one retransmission
+        assert prx == ptx - retx
+        assert retx > 0
+        if prx == sent:
+            assert ptx + prx - retx == 2 * sent
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file test uplink library
+ *
+ * This suite sends a burst of telemetry-sized messages through whichever
+ * uplink backend is configured, against a stand-in peer on the host, and
+ * prints the resulting statistics so the backends can be compared.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <zephyr/ztest.h>
+
+#include <app/lib/uplink.h>
+
+#define BURST 50
+#define PAYLOAD_LEN 200
+
+static uint8_t payload[PAYLOAD_LEN];
+
+static void *uplink_setup(void)
+{
+	/* Roughly the size of one encoded sample window */
+	snprintf((char *)payload, sizeof(payload),
+		 "{\"protected\":{\"ver\":\"v1\",\"alg\":\"none\"},"
+		 "\"payload\":{\"device_type\":\"TEST\",\"interval_ms\":1000,"
+		 "\"sensors\":[{\"name\":\"temperature\",\"units\":\"Cel\"}],"
+		 "\"values\":[[21.5],[21.6],[21.6],[21.7]]}}");
+
+	return NULL;
+}
+
+ZTEST(uplink, test_a_connect)
+{
+	zassert_ok(uplink_connect(), "connect failed");
+}
+
+ZTEST(uplink, test_b_burst)
+{
+	struct uplink_msg msg = {
+		.label = "burst",
+		.payload = payload,
+		.len = strlen((char *)payload),
+		.content_type = "application/json",
+		.headers = "x-label: burst\r\n",
+	};
+	struct uplink_stats before, after;
+	int64_t start;
+	uint32_t elapsed;
+	uint32_t sent, acked;
+
+	uplink_stats_get(&before);
+	start = k_uptime_get();
+
+	for (int i = 0; i < BURST; i++) {
+		zassert_ok(uplink_send(&msg), "send %d failed", i);
+	}
+	zassert_ok(uplink_flush(K_SECONDS(10)), "flush timed out");
+
+	elapsed = (uint32_t)(k_uptime_get() - start);
+	uplink_stats_get(&after);
+
+	sent = after.sent - before.sent;
+	acked = after.acked - before.acked;
+
+	printk("uplink %s: %u sent, %u acked, %u failed, %u connects, "
+	       "%llu payload bytes, wire tx %llu rx %llu, "
+	       "packets tx %u rx %u, %u retransmits, %u ms, "
+	       "max latency %u ms\n",
+	       uplink_backend_name(), sent, acked, after.failed - before.failed,
+	       after.connects - before.connects,
+	       after.payload_bytes - before.payload_bytes,
+	       after.wire_tx_bytes - before.wire_tx_bytes,
+	       after.wire_rx_bytes - before.wire_rx_bytes,
+	       after.packets_tx - before.packets_tx,
+	       after.packets_rx - before.packets_rx,
+	       after.retransmits - before.retransmits, elapsed,
+	       after.max_latency_ms);
+
+	if (after.connects > 0) {
+		printk("uplink session setup: max %u ms, mean %llu ms\n",
+		       after.max_connect_ms,
+		       after.total_connect_ms / after.connects);
+	}
+
+	zassert_equal(sent, BURST, "not every message was sent");
+	zassert_equal(after.failed, before.failed, "sends failed");
+	zassert_true(after.wire_tx_bytes - before.wire_tx_bytes >
+		     after.payload_bytes - before.payload_bytes,
+		     "framing not accounted");
+
+#if defined(CONFIG_UPLINK_BACKEND_MQTT) && CONFIG_UPLINK_MQTT_QOS == 0
+	/* Fire and forget, nothing comes back */
+	zassert_equal(acked, 0, "QoS 0 publishes cannot be acknowledged");
+#else
+	zassert_equal(acked, BURST, "not every message was acknowledged");
+#endif
+}
+
+ZTEST(uplink, test_c_idle_flush)
+{
+	zassert_ok(uplink_flush(K_NO_WAIT), "nothing should be outstanding");
+}
+
+ZTEST(uplink, test_d_label_too_long)
+{
+	char label[128];
+	struct uplink_msg msg = {
+		.label = label,
+		.payload = payload,
+		.len = 1,
+	};
+
+	/* Longer than the MQTT topic and CoAP query buffers */
+	memset(label, 'x', sizeof(label) - 1);
+	label[sizeof(label) - 1] = '\0';
+
+#if defined(CONFIG_UPLINK_BACKEND_MQTT) || defined(CONFIG_UPLINK_BACKEND_COAP)
+	zassert_equal(uplink_send(&msg), -ENAMETOOLONG);
+#else
+	/* HTTP carries the label in caller headers only, so this is fine */
+	zassert_ok(uplink_send(&msg));
+#endif
+}
+
+ZTEST(uplink, test_e_disconnect)
+{
+	struct uplink_stats before, after;
+
+	uplink_stats_get(&before);
+	uplink_disconnect();
+
+	/* Sending again reconnects on demand */
+	zassert_ok(uplink_send(&(struct uplink_msg){
+			   .label = "again",
+			   .payload = payload,
+			   .len = 16,
+		   }));
+	zassert_ok(uplink_flush(K_SECONDS(5)));
+
+	uplink_stats_get(&after);
+	zassert_equal(after.connects, before.connects + 1,
+		      "expected exactly one new connection");
+}
+
+ZTEST(uplink, test_f_peer)
+{
+	struct uplink_peer peer, moved;
+	struct uplink_stats before, after;
+
+	uplink_peer_get(&peer);
+	zassert_str_equal(peer.host, CONFIG_UPLINK_HOST);
+	zassert_equal(peer.port, CONFIG_UPLINK_PORT);
+
+	moved = peer;
+	moved.port = 0;
+	zassert_equal(uplink_peer_set(&moved), -EINVAL);
+	moved = peer;
+	moved.host[0] = '\0';
+	zassert_equal(uplink_peer_set(&moved), -EINVAL);
+	moved = peer;
+	memset(moved.path, 'x', sizeof(moved.path));
+	zassert_equal(uplink_peer_set(&moved), -EINVAL);
+
+	moved = peer;
+	moved.port = peer.port + 1;
+	zassert_ok(uplink_peer_set(&moved));
+	uplink_peer_get(&moved);
+	zassert_equal(moved.port, peer.port + 1);
+
+	/* Back to the stand-in: the session is opened again */
+	uplink_stats_get(&before);
+	zassert_ok(uplink_peer_set(&peer));
+	zassert_ok(uplink_send(&(struct uplink_msg){
+			   .label = "moved",
+			   .payload = payload,
+			   .len = 16,
+		   }));
+	zassert_ok(uplink_flush(K_SECONDS(5)));
+
+	uplink_stats_get(&after);
+	zassert_equal(after.connects, before.connects + 1,
+		      "expected exactly one new connection");
+}
+
+ZTEST_SUITE(uplink, NULL, uplink_setup, NULL, NULL, NULL);
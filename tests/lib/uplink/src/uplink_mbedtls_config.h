@@ -0,0 +1,8 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Resume TLS sessions through tickets, which is what the stand-in offers */
+#define MBEDTLS_SSL_SESSION_TICKETS
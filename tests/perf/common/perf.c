@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/printk.h>
+#include <zephyr/timing/timing.h>
+
+#include "perf.h"
+
+/* A row of baseline.csv */
+struct perf_baseline {
+	const char *name;
+	uint32_t ns_per_op;
+	uint32_t tolerance_pct;
+};
+
+#include "perf_baseline.h"
+
+#ifdef CONFIG_NATIVE_LIBRARY
+/* perf_clock_bottom.c */
+uint64_t perf_clock_ns_bottom(void);
+#else
+static timing_t origin;
+#endif
+
+static int benchmarks;
+static int regressions;
+static int errors;
+
+void perf_init(void)
+{
+#ifndef CONFIG_NATIVE_LIBRARY
+	timing_init();
+	timing_start();
+	origin = timing_counter_get();
+#endif
+}
+
+uint64_t perf_clock_ns(void)
+{
+#ifdef CONFIG_NATIVE_LIBRARY
+	return perf_clock_ns_bottom();
+#else
+	timing_t now = timing_counter_get();
+
+	return timing_cycles_to_ns(timing_cycles_get(&origin, &now));
+#endif
+}
+
+static const struct perf_baseline *find_baseline(const char *name)
+{
+	for (const struct perf_baseline *base = perf_baselines;
+	     base->name != NULL; base++) {
+		if (strcmp(base->name, name) == 0) {
+			return base;
+		}
+	}
+
+	return NULL;
+}
+
+void perf_run(const char *name, perf_op_t op, void *user_data, uint32_t ops)
+{
+	uint64_t best = UINT64_MAX;
+
+	for (uint32_t i = 0; i < PERF_WARMUP_OPS; i++) {
+		op(user_data);
+	}
+
+	/* Other threads and the host only ever slow a round down */
+	for (int round = 0; round < PERF_ROUNDS; round++) {
+		uint64_t start = perf_clock_ns();
+
+		for (uint32_t i = 0; i < ops; i++) {
+			op(user_data);
+		}
+		best = MIN(best, perf_clock_ns() - start);
+	}
+
+	perf_report(name, best, ops);
+}
+
+void perf_report(const char *name, uint64_t ns, uint32_t ops)
+{
+	const struct perf_baseline *base = find_baseline(name);
+	uint32_t ns_per_op = (uint32_t)((ns + ops / 2) / ops);
+	int64_t limit;
+	int permille;
+
+	benchmarks++;
+
+	if (base == NULL || base->ns_per_op == 0) {
+		/* Once a gated board has rows, every benchmark needs one */
+		if (PERF_BASELINE_REQUIRED) {
+			errors++;
+		}
+		printk("PERF %s %s: %u ns/op, no baseline%s\n", CONFIG_BOARD,
+		       name, ns_per_op,
+		       PERF_BASELINE_REQUIRED ? " (required)" : "");
+		return;
+	}
+
+	permille = (int)(((int64_t)ns_per_op - base->ns_per_op) * 1000 /
+			 base->ns_per_op);
+	limit = (int64_t)base->ns_per_op * (100 + base->tolerance_pct) / 100;
+	if (ns_per_op > limit && PERF_BASELINE_GATED) {
+		regressions++;
+	}
+
+	printk("PERF %s %s: %u ns/op, baseline %u, %s%d.%d%%%s%s\n",
+	       CONFIG_BOARD, name, ns_per_op, base->ns_per_op,
+	       permille < 0 ? "-" : "+", abs(permille) / 10, abs(permille) % 10,
+	       ns_per_op > limit ? " REGRESSION" : "",
+	       ns_per_op > limit && !PERF_BASELINE_GATED ? " (not gated)" : "");
+}
+
+void perf_error(const char *name, int err)
+{
+	errors++;
+	printk("PERF %s %s: failed (%d)\n", CONFIG_BOARD, name, err);
+}
+
+int perf_summary(void)
+{
+	printk("PERF DONE %d benchmarks, %d regressions, %d errors\n",
+	       benchmarks, regressions, errors);
+
+	return regressions + errors;
+}
@@ -0,0 +1,64 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+# Benchmark helpers for the tests in tests/perf, and the rows of
+# baseline.csv for the board built for, as perf_baseline.h. Included after
+# find_package(Zephyr).
+
+set(PERF_BASELINE ${CMAKE_CURRENT_LIST_DIR}/../baseline.csv)
+set(PERF_GENERATED ${CMAKE_CURRENT_BINARY_DIR}/perf)
+
+# Boards the gate holds on: qemu_cortex_m0, where QEMU counts instructions
+# (CONFIG_QEMU_ICOUNT) and time follows the code run. native_sim times with
+# the host clock, as noisy as whatever else runs on the machine, so there
+# and elsewhere results are only reported. Once a gated board has rows, a
+# benchmark without one is an error too, so a new benchmark cannot slip
+# past the gate. Kept in step with scripts/perf_baseline.py.
+set(PERF_GATED_BOARDS qemu_cortex_m0)
+if(BOARD IN_LIST PERF_GATED_BOARDS)
+  set(PERF_GATED 1)
+else()
+  set(PERF_GATED 0)
+endif()
+
+set(PERF_ROWS "")
+file(STRINGS ${PERF_BASELINE} perf_lines)
+foreach(line IN LISTS perf_lines)
+  if(line MATCHES "^([^#,]+),([^,]+),([0-9]+),([0-9]+)$")
+    if(CMAKE_MATCH_1 STREQUAL BOARD)
+      string(APPEND PERF_ROWS
+        "\t{ \"${CMAKE_MATCH_2}\", ${CMAKE_MATCH_3}, ${CMAKE_MATCH_4} },\n")
+    endif()
+  endif()
+endforeach()
+
+if(PERF_GATED AND NOT PERF_ROWS STREQUAL "")
+  set(PERF_REQUIRED 1)
+else()
+  set(PERF_REQUIRED 0)
+endif()
+
+file(CONFIGURE OUTPUT ${PERF_GENERATED}/perf_baseline.h @ONLY CONTENT
+"/* Generated from tests/perf/baseline.csv for @BOARD@, do not edit */
+
+#define PERF_BASELINE_GATED @PERF_GATED@
+#define PERF_BASELINE_REQUIRED @PERF_REQUIRED@
+
+static const struct perf_baseline perf_baselines[] = {
+@PERF_ROWS@\t{ NULL },
+};
+")
+set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS
+  ${PERF_BASELINE})
+
+target_include_directories(app PRIVATE
+  ${CMAKE_CURRENT_LIST_DIR}
+  ${PERF_GENERATED}
+)
+target_sources(app PRIVATE ${CMAKE_CURRENT_LIST_DIR}/perf.c)
+
+if(CONFIG_NATIVE_LIBRARY)
+  # The host clock, read from the native simulator runner
+  target_sources(native_simulator INTERFACE
+    ${CMAKE_CURRENT_LIST_DIR}/perf_clock_bottom.c)
+endif()
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Benchmark helpers of the tests in tests/perf.
+ *
+ * Every benchmark prints one line with its time per operation, compared
+ * with the row of tests/perf/baseline.csv for the board:
+ *
+ *   PERF <board> <benchmark>: <ns> ns/op[, baseline <ns>, <+-x.y>%]
+ *
+ * followed by " REGRESSION" when slower than the baseline allows. That
+ * fails the test on the boards the tests are gated on, listed in
+ * perf.cmake, where once the board has rows a benchmark without one counts
+ * as an error too; elsewhere it is only reported. Once all ran, a summary
+ * line tells twister the outcome:
+ *
+ *   PERF DONE <n> benchmarks, <n> regressions, <n> errors
+ *
+ * Time is the host clock on native_sim, where simulated time stands still
+ * while code runs, and the timing functions of the target elsewhere.
+ */
+
+#ifndef PERF_H_
+#define PERF_H_
+
+#include <stdint.h>
+
+/* Rounds of a benchmark; the fastest one is reported */
+#define PERF_ROUNDS 5
+
+/* Calls before the first round, to get lazy initialization out of the way */
+#define PERF_WARMUP_OPS 8
+
+/* One operation of a benchmark */
+typedef void (*perf_op_t)(void *user_data);
+
+/* Start the benchmark clock, before any other perf_ call */
+void perf_init(void);
+
+/* Time of the benchmark clock, in nanoseconds */
+uint64_t perf_clock_ns(void);
+
+/* Time PERF_ROUNDS rounds of @p ops calls of @p op, and report the fastest */
+void perf_run(const char *name, perf_op_t op, void *user_data, uint32_t ops);
+
+/* Report @p ns spent on @p ops operations, timed by the caller */
+void perf_report(const char *name, uint64_t ns, uint32_t ops);
+
+/* Report that benchmark @p name could not run, with error @p err */
+void perf_error(const char *name, int err);
+
+/* Print the summary line, return the number of regressions and errors */
+int perf_summary(void);
+
+#endif /* PERF_H_ */
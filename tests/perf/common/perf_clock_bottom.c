@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Host side of the native_sim benchmark clock, built into the native
+ * simulator runner with the host C library.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+uint64_t perf_clock_ns_bottom(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file benchmark payload encoding
+ *
+ * A batch of samples, a chain of pipeline buffers as sinks receive it, is
+ * encoded as JSON into a payload from the slab, the way the demo apps
+ * encode their uploads: the cost of formatting with cbprintf and of the
+ * payload slab, which both change with Zephyr upgrades.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+
+#include <app/lib/pipeline.h>
+
+#include "perf.h"
+
+#define BATCH_SIZE 16
+#define OPS 100
+
+NET_BUF_POOL_FIXED_DEFINE(batch_pool, BATCH_SIZE,
+			  sizeof(struct pipeline_sample), 0, NULL);
+
+static struct net_buf *batch;
+
+/* snprintk() into @p out at @p len, keeping track of overflows */
+#define APPEND(out, size, len, ...)                                            \
+	do {                                                                   \
+		if ((len) < (size)) {                                          \
+			(len) += snprintk((out) + (len), (size) - (len),       \
+					  __VA_ARGS__);                        \
+		}                                                              \
+	} while (0)
+
+/* Fixed point, without pulling floating point formatting in */
+static size_t encode_value(char *out, size_t size, size_t len,
+			   const struct sensor_value *value)
+{
+	bool negative = value->val1 < 0 || value->val2 < 0;
+
+	APPEND(out, size, len, "%s%d.%06d", negative ? "-" : "",
+	       abs(value->val1), abs(value->val2));
+
+	return len;
+}
+
+static int encode_batch(struct pipeline_payload *payload,
+			struct net_buf *samples)
+{
+	char *out = (char *)payload->data;
+	size_t size = payload->size;
+	size_t len = 0;
+
+	APPEND(out, size, len, "{\"t0\":%lld,\"values\":[",
+	       (long long)pipeline_sample(samples)->timestamp_ms);
+
+	for (struct net_buf *buf = samples; buf != NULL; buf = buf->frags) {
+		struct pipeline_sample *sample = pipeline_sample(buf);
+
+		APPEND(out, size, len, "[");
+		for (int i = 0; i < sample->count; i++) {
+			if (i > 0) {
+				APPEND(out, size, len, ",");
+			}
+			len = encode_value(out, size, len, &sample->values[i]);
+		}
+		APPEND(out, size, len, buf->frags != NULL ? "]," : "]");
+	}
+
+	APPEND(out, size, len, "]}");
+
+	if (len >= size) {
+		return -ENOSPC;
+	}
+	payload->len = len;
+
+	return 0;
+}
+
+static void json_batch(void *user_data)
+{
+	struct pipeline_payload *payload = pipeline_payload_alloc(K_NO_WAIT);
+
+	ARG_UNUSED(user_data);
+
+	(void)encode_batch(payload, batch);
+	pipeline_payload_unref(payload);
+}
+
+/* One payload handed to two consumers, say two transports */
+static void payload_refs(void *user_data)
+{
+	struct pipeline_payload *payload = pipeline_payload_alloc(K_NO_WAIT);
+
+	ARG_UNUSED(user_data);
+
+	pipeline_payload_ref(payload);
+	pipeline_payload_unref(payload);
+	pipeline_payload_unref(payload);
+}
+
+static int fill_batch(void)
+{
+	for (int i = 0; i < BATCH_SIZE; i++) {
+		struct net_buf *buf = net_buf_alloc(&batch_pool, K_NO_WAIT);
+		struct pipeline_sample *sample;
+
+		if (buf == NULL) {
+			return -ENOMEM;
+		}
+
+		sample = net_buf_add(buf, sizeof(*sample));
+		memset(sample, 0, sizeof(*sample));
+		sample->timestamp_ms = 1000 * i;
+		sample->count = 2;
+		/* Temperature and relative humidity, as the demo apps read */
+		sample->values[0] = (struct sensor_value){ 21, 250000 + i };
+		sample->values[1] = (struct sensor_value){ 45, 500000 + i };
+
+		if (batch == NULL) {
+			batch = buf;
+		} else {
+			net_buf_frag_add(batch, buf);
+		}
+	}
+
+	return 0;
+}
+
+int main(void)
+{
+	struct pipeline_payload *payload;
+	int ret;
+
+	perf_init();
+
+	ret = fill_batch();
+	if (ret < 0) {
+		perf_error("encoder.json_batch", ret);
+		return perf_summary();
+	}
+
+	/* The batch must fit, or only part of it would be timed */
+	payload = pipeline_payload_alloc(K_NO_WAIT);
+	ret = payload != NULL ? encode_batch(payload, batch) : -ENOMEM;
+	if (payload != NULL) {
+		pipeline_payload_unref(payload);
+	}
+
+	if (ret < 0) {
+		perf_error("encoder.json_batch", ret);
+	} else {
+		perf_run("encoder.json_batch", json_batch, NULL, OPS);
+	}
+	perf_run("encoder.payload_refs", payload_refs, NULL, OPS * 10);
+
+	return perf_summary();
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file benchmark sample acquisition
+ *
+ * sampler.pipeline times one on-demand acquisition from pipeline_trigger()
+ * until the sink has the sample: the acquisition work, the buffer pool and
+ * the hand-offs between the stage work queues. The source reads no sensor,
+ * a transform fills the values in, so the pipeline alone is measured.
+ *
+ * sampler.median and sampler.trimmed_mean combine the readings of one
+ * oversampled measurement, as the sht4x-group driver does.
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+
+#include <app/lib/filters.h>
+#include <app/lib/pipeline.h>
+
+#include "perf.h"
+
+#define OPS 100
+#define FILTER_OPS 1000
+#define OVERSAMPLING 16
+
+static int fill(struct pipeline_sample *sample, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	sample->count = 2;
+	sample->values[0] = (struct sensor_value){ 21, 250000 };
+	sample->values[1] = (struct sensor_value){ 45, 500000 };
+
+	return 0;
+}
+
+static K_SEM_DEFINE(delivered, 0, 1);
+
+static int signal_sink(struct net_buf *samples, void *user_data)
+{
+	ARG_UNUSED(samples);
+	ARG_UNUSED(user_data);
+
+	k_sem_give(&delivered);
+
+	return 0;
+}
+
+static struct pipeline_acquire on_demand;
+static struct pipeline_transform filler =
+	PIPELINE_TRANSFORM_INITIALIZER(fill, NULL);
+static struct pipeline_sink sink =
+	PIPELINE_SINK_INITIALIZER(signal_sink, NULL);
+
+PIPELINE_DEFINE(bench, 4, &on_demand, &filler.stage, &sink.stage);
+
+static int lost;
+
+static void acquire_one(void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	if (pipeline_trigger(&bench) < 0 ||
+	    k_sem_take(&delivered, K_MSEC(100)) < 0) {
+		lost++;
+	}
+}
+
+/* Readings of a noisy quantity with an outlier, in milli-units */
+static const int32_t readings[OVERSAMPLING] = {
+	21250, 21262, 21243, 21255, 21901, 21248, 21251, 21259,
+	21246, 21253, 21240, 21257, 21249, 21261, 21244, 21252,
+};
+
+static void combine(void *user_data)
+{
+	enum filter_type type = (enum filter_type)(uintptr_t)user_data;
+	int32_t values[OVERSAMPLING];
+	int32_t out;
+
+	/* The filters sort in place */
+	memcpy(values, readings, sizeof(values));
+	(void)filter_apply(type, values, OVERSAMPLING, &out);
+}
+
+int main(void)
+{
+	int ret;
+
+	perf_init();
+
+	ret = pipeline_start(&bench);
+	if (ret < 0) {
+		perf_error("sampler.pipeline", ret);
+	} else {
+		perf_run("sampler.pipeline", acquire_one, NULL, OPS);
+		(void)pipeline_stop(&bench);
+		if (lost > 0) {
+			perf_error("sampler.pipeline", -ETIMEDOUT);
+		}
+	}
+
+	perf_run("sampler.median", combine, (void *)(uintptr_t)FILTER_MEDIAN,
+		 FILTER_OPS);
+	perf_run("sampler.trimmed_mean", combine,
+		 (void *)(uintptr_t)FILTER_TRIMMED_MEAN, FILTER_OPS);
+
+	return perf_summary();
+}
@@ -0,0 +1,43 @@
+# Copyright (c) 2025 John O'Sullivan
+# SPDX-License-Identifier: Apache-2.0
+
+'''Uplink round trips against the stand-in peers in scripts/, reported
+against tests/perf/baseline.csv: native_sim, the only platform they run
+on, times with the host clock and is not gated.
+
+Run through twister on native_sim, e.g.
+
+  west twister -p native_sim -T tests/perf
+'''
+
+import re
+
+import pytest
+from twister_harness import DeviceAdapter
+
+
+@pytest.fixture(scope='module')
+def peer(standin, build_config):
+    '''The stand-in of the backend built, see conftest.py.'''
+    if build_config.get('CONFIG_UPLINK_BACKEND_MQTT') == 'y':
+        return standin('mqtt_standin.py', 'CONFIG_UPLINK_PORT')
+    if build_config.get('CONFIG_UPLINK_BACKEND_COAP') == 'y':
+        return standin('coap_standin.py', 'CONFIG_UPLINK_PORT')
+    return standin('http_standin.py', 'CONFIG_UPLINK_PORT')
+
+
+def test_uplink_perf(peer, dut: DeviceAdapter):
+    lines = dut.readlines_until(regex=r'PERF DONE .*', timeout=120)
+
+    results = [line for line in lines if line.startswith('PERF ')]
+    for line in results:
+        print(line)
+
+    m = re.search(r'PERF DONE (\d+) benchmarks, (\d+) regressions, '
+                  r'(\d+) errors', results[-1])
+    assert m, results[-1]
+
+    benchmarks, regressions, errors = (int(m.group(i)) for i in (1, 2, 3))
+    assert benchmarks >= 1
+    assert errors == 0, 'benchmark failed to run'
+    assert regressions == 0, 'slower than tests/perf/baseline.csv allows'
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 John O'Sullivan
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file benchmark the uplink against a stand-in peer
+ *
+ * uplink.<backend> times one message from uplink_send() until the peer
+ * confirmed it, through whichever backend is configured, against the
+ * stand-in from scripts/ on the host: the backend and the socket layer on
+ * the device side, and the loopback round trip.
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+
+#include <app/lib/uplink.h>
+
+#include "perf.h"
+
+#define OPS 20
+
+static char payload[200];
+static int lost;
+
+static void send_one(void *user_data)
+{
+	const struct uplink_msg *msg = user_data;
+
+	if (uplink_send(msg) < 0 || uplink_flush(K_SECONDS(5)) < 0) {
+		lost++;
+	}
+}
+
+int main(void)
+{
+	struct uplink_msg msg = {
+		.label = "perf",
+		.payload = (const uint8_t *)payload,
+		.content_type = "application/json",
+		.headers = "x-label: perf\r\n",
+	};
+	char name[32];
+	int ret;
+
+	perf_init();
+
+	/* Roughly the size of one encoded sample window */
+	snprintf(payload, sizeof(payload),
+		 "{\"protected\":{\"ver\":\"v1\",\"alg\":\"none\"},"
+		 "\"payload\":{\"device_type\":\"TEST\",\"interval_ms\":1000,"
+		 "\"sensors\":[{\"name\":\"temperature\",\"units\":\"Cel\"}],"
+		 "\"values\":[[21.5],[21.6],[21.6],[21.7]]}}");
+	msg.len = strlen(payload);
+
+	snprintk(name, sizeof(name), "uplink.%s", uplink_backend_name());
+
+	ret = uplink_connect();
+	if (ret < 0) {
+		perf_error(name, ret);
+		return perf_summary();
+	}
+
+	perf_run(name, send_one, &msg, OPS);
+	if (lost > 0) {
+		perf_error(name, -EIO);
+	}
+
+	uplink_disconnect();
+
+	return perf_summary();
+}